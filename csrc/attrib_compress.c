@@ -0,0 +1,252 @@
+#include <lean/lean.h>
+
+#include "data_marshal.h"
+#include "vertex_pack.h"
+#include "attrib_compress.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Bulk compression of vertex attributes and texture data: half floats, octahedral and
+// 10-10-10-2 normals, unorm8 colors. Halving or quartering attribute size cuts the vertex
+// fetch bandwidth by the same amount.
+//
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define HAVE_F16C_DISPATCH 1
+
+// compiled for F16C regardless of the global flags, only called after the cpuid check
+__attribute__((target("avx,f16c")))
+static void doublesToHalvesF16C(const double *src, uint16_t *dst, size_t count)
+{
+    size_t ix = 0;
+    for (; ix + 8 <= count; ix += 8) {
+        __m128 lo = _mm256_cvtpd_ps(_mm256_loadu_pd(src + ix));
+        __m128 hi = _mm256_cvtpd_ps(_mm256_loadu_pd(src + ix + 4));
+        __m256 values = _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+        _mm_storeu_si128((__m128i *)(dst + ix), _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+    }
+    for (; ix < count; ix++) {
+        dst[ix] = packHalf((float)src[ix]);
+    }
+}
+
+__attribute__((target("avx,f16c")))
+static void floatsToHalvesF16C(const float *src, uint16_t *dst, size_t count)
+{
+    size_t ix = 0;
+    for (; ix + 8 <= count; ix += 8) {
+        __m256 values = _mm256_loadu_ps(src + ix);
+        _mm_storeu_si128((__m128i *)(dst + ix), _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+    }
+    for (; ix < count; ix++) {
+        dst[ix] = packHalf(src[ix]);
+    }
+}
+
+__attribute__((target("avx,f16c")))
+static void halvesToFloatsF16C(const uint16_t *src, float *dst, size_t count)
+{
+    size_t ix = 0;
+    for (; ix + 8 <= count; ix += 8) {
+        __m128i halves = _mm_loadu_si128((const __m128i *)(src + ix));
+        _mm256_storeu_ps(dst + ix, _mm256_cvtph_ps(halves));
+    }
+    for (; ix < count; ix++) {
+        __m128 one = _mm_cvtph_ps(_mm_cvtsi32_si128(src[ix]));
+        dst[ix] = _mm_cvtss_f32(one);
+    }
+}
+
+static int hasF16C()
+{
+    static int cached = -1;
+    if (cached < 0) {
+        __builtin_cpu_init();
+        cached = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+    }
+    return cached;
+}
+
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define HAVE_NEON_HALF 1
+#endif
+
+static float unpackHalf(uint16_t half)
+{
+    uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+    uint32_t exponent = (half >> 10) & 0x1f;
+    uint32_t mantissa = half & 0x3ff;
+    uint32_t bits;
+    if (exponent == 0x1f) {
+        bits = sign | 0x7f800000 | (mantissa << 13);
+    }
+    else if (exponent != 0) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    }
+    else {
+        // zero or denormal: mantissa * 2^-24
+        float value = (float)mantissa * (1.0f / 16777216.0f);
+        memcpy(&bits, &value, sizeof(bits));
+        bits |= sign;
+    }
+    float result;
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+void convertDoublesToHalves(const double *src, uint16_t *dst, size_t count)
+{
+#if defined(HAVE_F16C_DISPATCH)
+    if (hasF16C()) {
+        doublesToHalvesF16C(src, dst, count);
+        return;
+    }
+#elif defined(HAVE_NEON_HALF)
+    size_t ix = 0;
+    for (; ix + 4 <= count; ix += 4) {
+        float32x4_t values = vcombine_f32(vcvt_f32_f64(vld1q_f64(src + ix)), vcvt_f32_f64(vld1q_f64(src + ix + 2)));
+        vst1_u16(dst + ix, vreinterpret_u16_f16(vcvt_f16_f32(values)));
+    }
+    src += ix; dst += ix; count -= ix;
+#endif
+    for (size_t ix=0; ix < count; ix++) {
+        dst[ix] = packHalf((float)src[ix]);
+    }
+}
+
+void convertFloatsToHalves(const float *src, uint16_t *dst, size_t count)
+{
+#if defined(HAVE_F16C_DISPATCH)
+    if (hasF16C()) {
+        floatsToHalvesF16C(src, dst, count);
+        return;
+    }
+#elif defined(HAVE_NEON_HALF)
+    size_t ix = 0;
+    for (; ix + 4 <= count; ix += 4) {
+        vst1_u16(dst + ix, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + ix))));
+    }
+    src += ix; dst += ix; count -= ix;
+#endif
+    for (size_t ix=0; ix < count; ix++) {
+        dst[ix] = packHalf(src[ix]);
+    }
+}
+
+void convertHalvesToFloats(const uint16_t *src, float *dst, size_t count)
+{
+#if defined(HAVE_F16C_DISPATCH)
+    if (hasF16C()) {
+        halvesToFloatsF16C(src, dst, count);
+        return;
+    }
+#elif defined(HAVE_NEON_HALF)
+    size_t ix = 0;
+    for (; ix + 4 <= count; ix += 4) {
+        vst1q_f32(dst + ix, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + ix))));
+    }
+    src += ix; dst += ix; count -= ix;
+#endif
+    for (size_t ix=0; ix < count; ix++) {
+        dst[ix] = unpackHalf(src[ix]);
+    }
+}
+
+void packOctahedralNormals(const double *src, int16_t *dst, size_t normalCount)
+{
+    for (size_t ix=0; ix < normalCount; ix++) {
+        float x = (float)src[ix*3], y = (float)src[ix*3+1], z = (float)src[ix*3+2];
+        float l1 = fabsf(x) + fabsf(y) + fabsf(z);
+        if (l1 > 0.0f) {
+            x /= l1; y /= l1; z /= l1;
+        }
+        else {
+            x = 0.0f; y = 0.0f; z = 1.0f;
+        }
+        // fold the lower hemisphere over the diagonals
+        if (z < 0.0f) {
+            float ox = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            float oy = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+            x = ox; y = oy;
+        }
+        dst[ix*2] = packSnorm16(x);
+        dst[ix*2+1] = packSnorm16(y);
+    }
+}
+
+void packNormals10_10_10_2(const double *src, uint32_t *dst, size_t normalCount)
+{
+    for (size_t ix=0; ix < normalCount; ix++) {
+        dst[ix] = packSnorm10_10_10_2((float)src[ix*3], (float)src[ix*3+1], (float)src[ix*3+2], 0.0f);
+    }
+}
+
+void packColorsUnorm8(const double *src, uint8_t *dst, size_t colorCount)
+{
+    for (size_t ix=0; ix < colorCount * 4; ix++) {
+        dst[ix] = packUnorm8((float)src[ix]);
+    }
+}
+
+
+// packHalfFloats : FloatArray → ByteArray
+//
+// also the input format for GLSizedTextureFormat.R16F with GLPixelType.HalfFloat
+lean_obj_res lean_pack_half_floats(b_lean_obj_arg values)
+{
+    size_t count = lean_sarray_size(values);
+    lean_object *packed = lean_alloc_sarray(1, count * 2, count * 2);
+    convertDoublesToHalves((const double *)lean_sarray_cptr(values), (uint16_t *)lean_sarray_cptr(packed), count);
+    return packed;
+}
+
+// unpackHalfFloats : ByteArray → FloatArray
+//
+lean_obj_res lean_unpack_half_floats(b_lean_obj_arg bytes)
+{
+    size_t count = lean_sarray_size(bytes) / 2;
+    float *floats = malloc(count * sizeof(float) + 1);
+    convertHalvesToFloats((const uint16_t *)lean_sarray_cptr(bytes), floats, count);
+    lean_object *unpacked = lean_alloc_sarray(sizeof(double), count, count);
+    double *out = (double *)lean_sarray_cptr(unpacked);
+    for (size_t ix=0; ix < count; ix++) {
+        out[ix] = floats[ix];
+    }
+    free(floats);
+    return unpacked;
+}
+
+// packOctahedralNormals : FloatArray → ByteArray
+//
+lean_obj_res lean_pack_octahedral_normals(b_lean_obj_arg normals)
+{
+    size_t count = lean_sarray_size(normals) / 3;
+    lean_object *packed = lean_alloc_sarray(1, count * 4, count * 4);
+    packOctahedralNormals((const double *)lean_sarray_cptr(normals), (int16_t *)lean_sarray_cptr(packed), count);
+    return packed;
+}
+
+// packNormals10_10_10_2 : FloatArray → ByteArray
+//
+lean_obj_res lean_pack_normals_10_10_10_2(b_lean_obj_arg normals)
+{
+    size_t count = lean_sarray_size(normals) / 3;
+    lean_object *packed = lean_alloc_sarray(1, count * 4, count * 4);
+    packNormals10_10_10_2((const double *)lean_sarray_cptr(normals), (uint32_t *)lean_sarray_cptr(packed), count);
+    return packed;
+}
+
+// packColorsUnorm8 : FloatArray → ByteArray
+//
+lean_obj_res lean_pack_colors_unorm8(b_lean_obj_arg colors)
+{
+    size_t count = lean_sarray_size(colors) / 4;
+    lean_object *packed = lean_alloc_sarray(1, count * 4, count * 4);
+    packColorsUnorm8((const double *)lean_sarray_cptr(colors), lean_sarray_cptr(packed), count);
+    return packed;
+}
@@ -26,6 +26,7 @@ extern lean_object *lean_mk_ptr(void *someptr)
 {
       lean_external_class *opaqueptr_class = get_opaqueptr_class();
       lean_object *packed = lean_alloc_external(opaqueptr_class, someptr);
+      return packed;
 }
 
 extern lean_object *lean_mk_packptr(void *someptr)
@@ -0,0 +1,186 @@
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+#include <GLFW/glfw3.h>
+
+#include "data_marshal.h"
+#include "gl_loader.h"
+#include "window_state.h"
+
+#include <stdatomic.h>
+
+//
+// Loading the per-context GL function tables of glad_context.c, eagerly or through lazily
+// resolving trampolines, and the counters glLoaderStats reports on how long that took. The
+// capabilities glGetCapabilities returns are queried right after a window's table is loaded.
+//
+
+/*inductive GLLoaderMode
+  | Eager
+  | Lazy
+*/
+static _Atomic uint8_t loaderMode = 0;
+
+// per mode: tables loaded and the time spent loading them
+static _Atomic uint64_t tableLoads[2];
+static _Atomic uint64_t tableLoadTicks[2];
+
+int loadGLContextTable(GladGLContext *gl)
+{
+    uint8_t mode = atomic_load(&loaderMode);
+    uint64_t start = glfwGetTimerValue();
+    int loaded = mode == 1
+        ? gladLoadGLContextLazy(gl, (GLADloadproc) glfwGetProcAddress)
+        : gladLoadGLContext(gl, (GLADloadproc) glfwGetProcAddress);
+    if (loaded) {
+        atomic_fetch_add(&tableLoadTicks[mode], glfwGetTimerValue() - start);
+        atomic_fetch_add(&tableLoads[mode], 1);
+    }
+    return loaded;
+}
+
+// glSetLoaderMode : GLLoaderMode → IO Unit
+//
+// applies to contexts made current for the first time from now on
+lean_obj_res lean_glfw_set_loader_mode(uint8_t mode)
+{
+    atomic_store(&loaderMode, mode);
+    return lean_return_unit();
+}
+
+static uint64_t ticksToNanos(uint64_t ticks)
+{
+    return (uint64_t)((double)ticks * 1e9 / (double)glfwGetTimerFrequency());
+}
+
+/*structure GLLoaderStats where
+  eagerLoads : UInt64
+  eagerNanos : UInt64
+  lazyLoads : UInt64
+  lazyNanos : UInt64
+  lazyResolved : UInt64
+  extensionCount : UInt64
+*/
+
+// glLoaderStats : IO GLLoaderStats
+//
+// the last two fields describe the context current on the calling thread, 0 without one
+lean_obj_res lean_glfw_loader_stats()
+{
+    lean_object *stats = lean_alloc_ctor(0, 0, 48);
+    lean_ctor_set_uint64(stats, 0, atomic_load(&tableLoads[0]));
+    lean_ctor_set_uint64(stats, 8, ticksToNanos(atomic_load(&tableLoadTicks[0])));
+    lean_ctor_set_uint64(stats, 16, atomic_load(&tableLoads[1]));
+    lean_ctor_set_uint64(stats, 24, ticksToNanos(atomic_load(&tableLoadTicks[1])));
+    lean_ctor_set_uint64(stats, 32, gladCurrentContext ? gladCurrentContext->lazyResolved : 0);
+    lean_ctor_set_uint64(stats, 40, gladCurrentContext ? gladCurrentContext->extensionCount : 0);
+    return lean_io_result_mk_ok(stats);
+}
+
+// glHasExtension : String → IO Bool
+//
+// a hash lookup in the current context's extension set
+lean_obj_res lean_glfw_has_extension(b_lean_obj_arg name)
+{
+    int found = gladCurrentContext != NULL && gladHasExtension(gladCurrentContext, lean_string_cstr(name));
+    return lean_io_result_mk_ok(lean_box(found));
+}
+
+static uint32_t getLimit(GLenum pname)
+{
+    GLint value = 0;
+    glGetIntegerv(pname, &value);
+    return value > 0 ? (uint32_t)value : 0;
+}
+
+// with the context's table current
+void queryCapabilities(glCapabilities_t *caps)
+{
+    caps->major = (uint32_t)gladCurrentContext->major;
+    caps->minor = (uint32_t)gladCurrentContext->minor;
+    caps->maxTextureSize = getLimit(GL_MAX_TEXTURE_SIZE);
+    caps->max3DTextureSize = getLimit(GL_MAX_3D_TEXTURE_SIZE);
+    caps->maxArrayTextureLayers = getLimit(GL_MAX_ARRAY_TEXTURE_LAYERS);
+    caps->maxSamples = getLimit(GL_MAX_SAMPLES);
+    caps->maxColorAttachments = getLimit(GL_MAX_COLOR_ATTACHMENTS);
+    caps->maxVertexAttribs = getLimit(GL_MAX_VERTEX_ATTRIBS);
+    caps->maxUniformBlockSize = getLimit(GL_MAX_UNIFORM_BLOCK_SIZE);
+    if (GLAD_GL_VERSION_4_3) {
+        caps->maxShaderStorageBufferBindings = getLimit(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS);
+        caps->maxComputeWorkGroupInvocations = getLimit(GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS);
+    }
+    caps->maxCombinedTextureImageUnits = getLimit(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS);
+
+    caps->bindlessTexture = GLAD_GL_ARB_bindless_texture;
+    caps->indirectParameters = GLAD_GL_VERSION_4_6 || GLAD_GL_ARB_indirect_parameters;
+    caps->parallelShaderCompile = GLAD_GL_KHR_parallel_shader_compile;
+    caps->spirv = GLAD_GL_VERSION_4_6 || GLAD_GL_ARB_gl_spirv;
+    caps->anisotropicFiltering = GLAD_GL_VERSION_4_6 || GLAD_GL_EXT_texture_filter_anisotropic;
+    if (caps->anisotropicFiltering) {
+        GLfloat anisotropy = 0;
+        glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &anisotropy);
+        caps->maxAnisotropy = anisotropy;
+    }
+    if (caps->parallelShaderCompile) {
+        caps->maxShaderCompilerThreads = getLimit(GL_MAX_SHADER_COMPILER_THREADS_KHR);
+    }
+}
+
+/*structure GLCapabilities where
+  major : UInt32
+  minor : UInt32
+  maxTextureSize : UInt32
+  max3DTextureSize : UInt32
+  maxArrayTextureLayers : UInt32
+  maxSamples : UInt32
+  maxColorAttachments : UInt32
+  maxVertexAttribs : UInt32
+  maxUniformBlockSize : UInt32
+  maxShaderStorageBufferBindings : UInt32
+  maxComputeWorkGroupInvocations : UInt32
+  maxCombinedTextureImageUnits : UInt32
+  maxAnisotropy : Float
+  maxShaderCompilerThreads : UInt32
+  bindlessTexture : Bool
+  indirectParameters : Bool
+  parallelShaderCompile : Bool
+  spirv : Bool
+  anisotropicFiltering : Bool
+*/
+
+// glGetCapabilities : @& Window → IO GLCapabilities
+//
+// no GL calls: the values were queried when the context was first made current
+lean_obj_res lean_glfw_get_capabilities(b_lean_obj_arg lw)
+{
+    GLFWwindow *window = (GLFWwindow *)(lean_get_external_data(lw));
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to glGetCapabilities")));
+    }
+    windowState_t *state = getWindowState(window);
+    if (state->gl == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("glGetCapabilities: the window's context has not been made current yet")));
+    }
+    const glCapabilities_t *caps = &state->caps;
+    lean_object *result = lean_alloc_ctor(0, 0, sizeof(double) + 13 * sizeof(uint32_t) + 5);
+    // the Float sorts before the UInt32s
+    lean_ctor_set_float(result, 0, (double)caps->maxAnisotropy);
+    const uint32_t limits[13] = {
+        caps->major, caps->minor,
+        caps->maxTextureSize, caps->max3DTextureSize, caps->maxArrayTextureLayers,
+        caps->maxSamples, caps->maxColorAttachments, caps->maxVertexAttribs,
+        caps->maxUniformBlockSize, caps->maxShaderStorageBufferBindings,
+        caps->maxComputeWorkGroupInvocations, caps->maxCombinedTextureImageUnits,
+        caps->maxShaderCompilerThreads
+    };
+    for (int ix=0; ix < 13; ix++) {
+        lean_ctor_set_uint32(result, sizeof(double) + ix * sizeof(uint32_t), limits[ix]);
+    }
+    size_t flags = sizeof(double) + 13 * sizeof(uint32_t);
+    lean_ctor_set_uint8(result, flags + 0, caps->bindlessTexture);
+    lean_ctor_set_uint8(result, flags + 1, caps->indirectParameters);
+    lean_ctor_set_uint8(result, flags + 2, caps->parallelShaderCompile);
+    lean_ctor_set_uint8(result, flags + 3, caps->spirv);
+    lean_ctor_set_uint8(result, flags + 4, caps->anisotropicFiltering);
+    return lean_io_result_mk_ok(result);
+}
@@ -0,0 +1,5225 @@
+// Per-context GL loader, generated from glad.h and glad_ext.h by
+// tools/gen_glad_context.py.
+// Do not edit; rerun the script instead.
+
+#include <glad/glad_context.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+GLAD_THREAD_LOCAL GladGLContext *gladCurrentContext = NULL;
+
+typedef struct {
+    const char *name;
+    unsigned short offset;
+    unsigned short flag;    // offset of the version or extension flag providing it
+} gladFunction_t;
+
+static const gladFunction_t gladFunctions[] = {
+    { "glCullFace", offsetof(GladGLContext, CullFace), offsetof(GladGLContext, VERSION_1_0) },
+    { "glFrontFace", offsetof(GladGLContext, FrontFace), offsetof(GladGLContext, VERSION_1_0) },
+    { "glHint", offsetof(GladGLContext, Hint), offsetof(GladGLContext, VERSION_1_0) },
+    { "glLineWidth", offsetof(GladGLContext, LineWidth), offsetof(GladGLContext, VERSION_1_0) },
+    { "glPointSize", offsetof(GladGLContext, PointSize), offsetof(GladGLContext, VERSION_1_0) },
+    { "glPolygonMode", offsetof(GladGLContext, PolygonMode), offsetof(GladGLContext, VERSION_1_0) },
+    { "glScissor", offsetof(GladGLContext, Scissor), offsetof(GladGLContext, VERSION_1_0) },
+    { "glTexParameterf", offsetof(GladGLContext, TexParameterf), offsetof(GladGLContext, VERSION_1_0) },
+    { "glTexParameterfv", offsetof(GladGLContext, TexParameterfv), offsetof(GladGLContext, VERSION_1_0) },
+    { "glTexParameteri", offsetof(GladGLContext, TexParameteri), offsetof(GladGLContext, VERSION_1_0) },
+    { "glTexParameteriv", offsetof(GladGLContext, TexParameteriv), offsetof(GladGLContext, VERSION_1_0) },
+    { "glTexImage1D", offsetof(GladGLContext, TexImage1D), offsetof(GladGLContext, VERSION_1_0) },
+    { "glTexImage2D", offsetof(GladGLContext, TexImage2D), offsetof(GladGLContext, VERSION_1_0) },
+    { "glDrawBuffer", offsetof(GladGLContext, DrawBuffer), offsetof(GladGLContext, VERSION_1_0) },
+    { "glClear", offsetof(GladGLContext, Clear), offsetof(GladGLContext, VERSION_1_0) },
+    { "glClearColor", offsetof(GladGLContext, ClearColor), offsetof(GladGLContext, VERSION_1_0) },
+    { "glClearStencil", offsetof(GladGLContext, ClearStencil), offsetof(GladGLContext, VERSION_1_0) },
+    { "glClearDepth", offsetof(GladGLContext, ClearDepth), offsetof(GladGLContext, VERSION_1_0) },
+    { "glStencilMask", offsetof(GladGLContext, StencilMask), offsetof(GladGLContext, VERSION_1_0) },
+    { "glColorMask", offsetof(GladGLContext, ColorMask), offsetof(GladGLContext, VERSION_1_0) },
+    { "glDepthMask", offsetof(GladGLContext, DepthMask), offsetof(GladGLContext, VERSION_1_0) },
+    { "glDisable", offsetof(GladGLContext, Disable), offsetof(GladGLContext, VERSION_1_0) },
+    { "glEnable", offsetof(GladGLContext, Enable), offsetof(GladGLContext, VERSION_1_0) },
+    { "glFinish", offsetof(GladGLContext, Finish), offsetof(GladGLContext, VERSION_1_0) },
+    { "glFlush", offsetof(GladGLContext, Flush), offsetof(GladGLContext, VERSION_1_0) },
+    { "glBlendFunc", offsetof(GladGLContext, BlendFunc), offsetof(GladGLContext, VERSION_1_0) },
+    { "glLogicOp", offsetof(GladGLContext, LogicOp), offsetof(GladGLContext, VERSION_1_0) },
+    { "glStencilFunc", offsetof(GladGLContext, StencilFunc), offsetof(GladGLContext, VERSION_1_0) },
+    { "glStencilOp", offsetof(GladGLContext, StencilOp), offsetof(GladGLContext, VERSION_1_0) },
+    { "glDepthFunc", offsetof(GladGLContext, DepthFunc), offsetof(GladGLContext, VERSION_1_0) },
+    { "glPixelStoref", offsetof(GladGLContext, PixelStoref), offsetof(GladGLContext, VERSION_1_0) },
+    { "glPixelStorei", offsetof(GladGLContext, PixelStorei), offsetof(GladGLContext, VERSION_1_0) },
+    { "glReadBuffer", offsetof(GladGLContext, ReadBuffer), offsetof(GladGLContext, VERSION_1_0) },
+    { "glReadPixels", offsetof(GladGLContext, ReadPixels), offsetof(GladGLContext, VERSION_1_0) },
+    { "glGetBooleanv", offsetof(GladGLContext, GetBooleanv), offsetof(GladGLContext, VERSION_1_0) },
+    { "glGetDoublev", offsetof(GladGLContext, GetDoublev), offsetof(GladGLContext, VERSION_1_0) },
+    { "glGetError", offsetof(GladGLContext, GetError), offsetof(GladGLContext, VERSION_1_0) },
+    { "glGetFloatv", offsetof(GladGLContext, GetFloatv), offsetof(GladGLContext, VERSION_1_0) },
+    { "glGetIntegerv", offsetof(GladGLContext, GetIntegerv), offsetof(GladGLContext, VERSION_1_0) },
+    { "glGetString", offsetof(GladGLContext, GetString), offsetof(GladGLContext, VERSION_1_0) },
+    { "glGetTexImage", offsetof(GladGLContext, GetTexImage), offsetof(GladGLContext, VERSION_1_0) },
+    { "glGetTexParameterfv", offsetof(GladGLContext, GetTexParameterfv), offsetof(GladGLContext, VERSION_1_0) },
+    { "glGetTexParameteriv", offsetof(GladGLContext, GetTexParameteriv), offsetof(GladGLContext, VERSION_1_0) },
+    { "glGetTexLevelParameterfv", offsetof(GladGLContext, GetTexLevelParameterfv), offsetof(GladGLContext, VERSION_1_0) },
+    { "glGetTexLevelParameteriv", offsetof(GladGLContext, GetTexLevelParameteriv), offsetof(GladGLContext, VERSION_1_0) },
+    { "glIsEnabled", offsetof(GladGLContext, IsEnabled), offsetof(GladGLContext, VERSION_1_0) },
+    { "glDepthRange", offsetof(GladGLContext, DepthRange), offsetof(GladGLContext, VERSION_1_0) },
+    { "glViewport", offsetof(GladGLContext, Viewport), offsetof(GladGLContext, VERSION_1_0) },
+    { "glDrawArrays", offsetof(GladGLContext, DrawArrays), offsetof(GladGLContext, VERSION_1_1) },
+    { "glDrawElements", offsetof(GladGLContext, DrawElements), offsetof(GladGLContext, VERSION_1_1) },
+    { "glPolygonOffset", offsetof(GladGLContext, PolygonOffset), offsetof(GladGLContext, VERSION_1_1) },
+    { "glCopyTexImage1D", offsetof(GladGLContext, CopyTexImage1D), offsetof(GladGLContext, VERSION_1_1) },
+    { "glCopyTexImage2D", offsetof(GladGLContext, CopyTexImage2D), offsetof(GladGLContext, VERSION_1_1) },
+    { "glCopyTexSubImage1D", offsetof(GladGLContext, CopyTexSubImage1D), offsetof(GladGLContext, VERSION_1_1) },
+    { "glCopyTexSubImage2D", offsetof(GladGLContext, CopyTexSubImage2D), offsetof(GladGLContext, VERSION_1_1) },
+    { "glTexSubImage1D", offsetof(GladGLContext, TexSubImage1D), offsetof(GladGLContext, VERSION_1_1) },
+    { "glTexSubImage2D", offsetof(GladGLContext, TexSubImage2D), offsetof(GladGLContext, VERSION_1_1) },
+    { "glBindTexture", offsetof(GladGLContext, BindTexture), offsetof(GladGLContext, VERSION_1_1) },
+    { "glDeleteTextures", offsetof(GladGLContext, DeleteTextures), offsetof(GladGLContext, VERSION_1_1) },
+    { "glGenTextures", offsetof(GladGLContext, GenTextures), offsetof(GladGLContext, VERSION_1_1) },
+    { "glIsTexture", offsetof(GladGLContext, IsTexture), offsetof(GladGLContext, VERSION_1_1) },
+    { "glDrawRangeElements", offsetof(GladGLContext, DrawRangeElements), offsetof(GladGLContext, VERSION_1_2) },
+    { "glTexImage3D", offsetof(GladGLContext, TexImage3D), offsetof(GladGLContext, VERSION_1_2) },
+    { "glTexSubImage3D", offsetof(GladGLContext, TexSubImage3D), offsetof(GladGLContext, VERSION_1_2) },
+    { "glCopyTexSubImage3D", offsetof(GladGLContext, CopyTexSubImage3D), offsetof(GladGLContext, VERSION_1_2) },
+    { "glActiveTexture", offsetof(GladGLContext, ActiveTexture), offsetof(GladGLContext, VERSION_1_3) },
+    { "glSampleCoverage", offsetof(GladGLContext, SampleCoverage), offsetof(GladGLContext, VERSION_1_3) },
+    { "glCompressedTexImage3D", offsetof(GladGLContext, CompressedTexImage3D), offsetof(GladGLContext, VERSION_1_3) },
+    { "glCompressedTexImage2D", offsetof(GladGLContext, CompressedTexImage2D), offsetof(GladGLContext, VERSION_1_3) },
+    { "glCompressedTexImage1D", offsetof(GladGLContext, CompressedTexImage1D), offsetof(GladGLContext, VERSION_1_3) },
+    { "glCompressedTexSubImage3D", offsetof(GladGLContext, CompressedTexSubImage3D), offsetof(GladGLContext, VERSION_1_3) },
+    { "glCompressedTexSubImage2D", offsetof(GladGLContext, CompressedTexSubImage2D), offsetof(GladGLContext, VERSION_1_3) },
+    { "glCompressedTexSubImage1D", offsetof(GladGLContext, CompressedTexSubImage1D), offsetof(GladGLContext, VERSION_1_3) },
+    { "glGetCompressedTexImage", offsetof(GladGLContext, GetCompressedTexImage), offsetof(GladGLContext, VERSION_1_3) },
+    { "glBlendFuncSeparate", offsetof(GladGLContext, BlendFuncSeparate), offsetof(GladGLContext, VERSION_1_4) },
+    { "glMultiDrawArrays", offsetof(GladGLContext, MultiDrawArrays), offsetof(GladGLContext, VERSION_1_4) },
+    { "glMultiDrawElements", offsetof(GladGLContext, MultiDrawElements), offsetof(GladGLContext, VERSION_1_4) },
+    { "glPointParameterf", offsetof(GladGLContext, PointParameterf), offsetof(GladGLContext, VERSION_1_4) },
+    { "glPointParameterfv", offsetof(GladGLContext, PointParameterfv), offsetof(GladGLContext, VERSION_1_4) },
+    { "glPointParameteri", offsetof(GladGLContext, PointParameteri), offsetof(GladGLContext, VERSION_1_4) },
+    { "glPointParameteriv", offsetof(GladGLContext, PointParameteriv), offsetof(GladGLContext, VERSION_1_4) },
+    { "glBlendColor", offsetof(GladGLContext, BlendColor), offsetof(GladGLContext, VERSION_1_4) },
+    { "glBlendEquation", offsetof(GladGLContext, BlendEquation), offsetof(GladGLContext, VERSION_1_4) },
+    { "glGenQueries", offsetof(GladGLContext, GenQueries), offsetof(GladGLContext, VERSION_1_5) },
+    { "glDeleteQueries", offsetof(GladGLContext, DeleteQueries), offsetof(GladGLContext, VERSION_1_5) },
+    { "glIsQuery", offsetof(GladGLContext, IsQuery), offsetof(GladGLContext, VERSION_1_5) },
+    { "glBeginQuery", offsetof(GladGLContext, BeginQuery), offsetof(GladGLContext, VERSION_1_5) },
+    { "glEndQuery", offsetof(GladGLContext, EndQuery), offsetof(GladGLContext, VERSION_1_5) },
+    { "glGetQueryiv", offsetof(GladGLContext, GetQueryiv), offsetof(GladGLContext, VERSION_1_5) },
+    { "glGetQueryObjectiv", offsetof(GladGLContext, GetQueryObjectiv), offsetof(GladGLContext, VERSION_1_5) },
+    { "glGetQueryObjectuiv", offsetof(GladGLContext, GetQueryObjectuiv), offsetof(GladGLContext, VERSION_1_5) },
+    { "glBindBuffer", offsetof(GladGLContext, BindBuffer), offsetof(GladGLContext, VERSION_1_5) },
+    { "glDeleteBuffers", offsetof(GladGLContext, DeleteBuffers), offsetof(GladGLContext, VERSION_1_5) },
+    { "glGenBuffers", offsetof(GladGLContext, GenBuffers), offsetof(GladGLContext, VERSION_1_5) },
+    { "glIsBuffer", offsetof(GladGLContext, IsBuffer), offsetof(GladGLContext, VERSION_1_5) },
+    { "glBufferData", offsetof(GladGLContext, BufferData), offsetof(GladGLContext, VERSION_1_5) },
+    { "glBufferSubData", offsetof(GladGLContext, BufferSubData), offsetof(GladGLContext, VERSION_1_5) },
+    { "glGetBufferSubData", offsetof(GladGLContext, GetBufferSubData), offsetof(GladGLContext, VERSION_1_5) },
+    { "glMapBuffer", offsetof(GladGLContext, MapBuffer), offsetof(GladGLContext, VERSION_1_5) },
+    { "glUnmapBuffer", offsetof(GladGLContext, UnmapBuffer), offsetof(GladGLContext, VERSION_1_5) },
+    { "glGetBufferParameteriv", offsetof(GladGLContext, GetBufferParameteriv), offsetof(GladGLContext, VERSION_1_5) },
+    { "glGetBufferPointerv", offsetof(GladGLContext, GetBufferPointerv), offsetof(GladGLContext, VERSION_1_5) },
+    { "glBlendEquationSeparate", offsetof(GladGLContext, BlendEquationSeparate), offsetof(GladGLContext, VERSION_2_0) },
+    { "glDrawBuffers", offsetof(GladGLContext, DrawBuffers), offsetof(GladGLContext, VERSION_2_0) },
+    { "glStencilOpSeparate", offsetof(GladGLContext, StencilOpSeparate), offsetof(GladGLContext, VERSION_2_0) },
+    { "glStencilFuncSeparate", offsetof(GladGLContext, StencilFuncSeparate), offsetof(GladGLContext, VERSION_2_0) },
+    { "glStencilMaskSeparate", offsetof(GladGLContext, StencilMaskSeparate), offsetof(GladGLContext, VERSION_2_0) },
+    { "glAttachShader", offsetof(GladGLContext, AttachShader), offsetof(GladGLContext, VERSION_2_0) },
+    { "glBindAttribLocation", offsetof(GladGLContext, BindAttribLocation), offsetof(GladGLContext, VERSION_2_0) },
+    { "glCompileShader", offsetof(GladGLContext, CompileShader), offsetof(GladGLContext, VERSION_2_0) },
+    { "glCreateProgram", offsetof(GladGLContext, CreateProgram), offsetof(GladGLContext, VERSION_2_0) },
+    { "glCreateShader", offsetof(GladGLContext, CreateShader), offsetof(GladGLContext, VERSION_2_0) },
+    { "glDeleteProgram", offsetof(GladGLContext, DeleteProgram), offsetof(GladGLContext, VERSION_2_0) },
+    { "glDeleteShader", offsetof(GladGLContext, DeleteShader), offsetof(GladGLContext, VERSION_2_0) },
+    { "glDetachShader", offsetof(GladGLContext, DetachShader), offsetof(GladGLContext, VERSION_2_0) },
+    { "glDisableVertexAttribArray", offsetof(GladGLContext, DisableVertexAttribArray), offsetof(GladGLContext, VERSION_2_0) },
+    { "glEnableVertexAttribArray", offsetof(GladGLContext, EnableVertexAttribArray), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetActiveAttrib", offsetof(GladGLContext, GetActiveAttrib), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetActiveUniform", offsetof(GladGLContext, GetActiveUniform), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetAttachedShaders", offsetof(GladGLContext, GetAttachedShaders), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetAttribLocation", offsetof(GladGLContext, GetAttribLocation), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetProgramiv", offsetof(GladGLContext, GetProgramiv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetProgramInfoLog", offsetof(GladGLContext, GetProgramInfoLog), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetShaderiv", offsetof(GladGLContext, GetShaderiv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetShaderInfoLog", offsetof(GladGLContext, GetShaderInfoLog), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetShaderSource", offsetof(GladGLContext, GetShaderSource), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetUniformLocation", offsetof(GladGLContext, GetUniformLocation), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetUniformfv", offsetof(GladGLContext, GetUniformfv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetUniformiv", offsetof(GladGLContext, GetUniformiv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetVertexAttribdv", offsetof(GladGLContext, GetVertexAttribdv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetVertexAttribfv", offsetof(GladGLContext, GetVertexAttribfv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetVertexAttribiv", offsetof(GladGLContext, GetVertexAttribiv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glGetVertexAttribPointerv", offsetof(GladGLContext, GetVertexAttribPointerv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glIsProgram", offsetof(GladGLContext, IsProgram), offsetof(GladGLContext, VERSION_2_0) },
+    { "glIsShader", offsetof(GladGLContext, IsShader), offsetof(GladGLContext, VERSION_2_0) },
+    { "glLinkProgram", offsetof(GladGLContext, LinkProgram), offsetof(GladGLContext, VERSION_2_0) },
+    { "glShaderSource", offsetof(GladGLContext, ShaderSource), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUseProgram", offsetof(GladGLContext, UseProgram), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform1f", offsetof(GladGLContext, Uniform1f), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform2f", offsetof(GladGLContext, Uniform2f), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform3f", offsetof(GladGLContext, Uniform3f), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform4f", offsetof(GladGLContext, Uniform4f), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform1i", offsetof(GladGLContext, Uniform1i), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform2i", offsetof(GladGLContext, Uniform2i), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform3i", offsetof(GladGLContext, Uniform3i), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform4i", offsetof(GladGLContext, Uniform4i), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform1fv", offsetof(GladGLContext, Uniform1fv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform2fv", offsetof(GladGLContext, Uniform2fv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform3fv", offsetof(GladGLContext, Uniform3fv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform4fv", offsetof(GladGLContext, Uniform4fv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform1iv", offsetof(GladGLContext, Uniform1iv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform2iv", offsetof(GladGLContext, Uniform2iv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform3iv", offsetof(GladGLContext, Uniform3iv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniform4iv", offsetof(GladGLContext, Uniform4iv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniformMatrix2fv", offsetof(GladGLContext, UniformMatrix2fv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniformMatrix3fv", offsetof(GladGLContext, UniformMatrix3fv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniformMatrix4fv", offsetof(GladGLContext, UniformMatrix4fv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glValidateProgram", offsetof(GladGLContext, ValidateProgram), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib1d", offsetof(GladGLContext, VertexAttrib1d), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib1dv", offsetof(GladGLContext, VertexAttrib1dv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib1f", offsetof(GladGLContext, VertexAttrib1f), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib1fv", offsetof(GladGLContext, VertexAttrib1fv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib1s", offsetof(GladGLContext, VertexAttrib1s), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib1sv", offsetof(GladGLContext, VertexAttrib1sv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib2d", offsetof(GladGLContext, VertexAttrib2d), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib2dv", offsetof(GladGLContext, VertexAttrib2dv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib2f", offsetof(GladGLContext, VertexAttrib2f), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib2fv", offsetof(GladGLContext, VertexAttrib2fv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib2s", offsetof(GladGLContext, VertexAttrib2s), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib2sv", offsetof(GladGLContext, VertexAttrib2sv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib3d", offsetof(GladGLContext, VertexAttrib3d), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib3dv", offsetof(GladGLContext, VertexAttrib3dv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib3f", offsetof(GladGLContext, VertexAttrib3f), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib3fv", offsetof(GladGLContext, VertexAttrib3fv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib3s", offsetof(GladGLContext, VertexAttrib3s), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib3sv", offsetof(GladGLContext, VertexAttrib3sv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4Nbv", offsetof(GladGLContext, VertexAttrib4Nbv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4Niv", offsetof(GladGLContext, VertexAttrib4Niv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4Nsv", offsetof(GladGLContext, VertexAttrib4Nsv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4Nub", offsetof(GladGLContext, VertexAttrib4Nub), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4Nubv", offsetof(GladGLContext, VertexAttrib4Nubv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4Nuiv", offsetof(GladGLContext, VertexAttrib4Nuiv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4Nusv", offsetof(GladGLContext, VertexAttrib4Nusv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4bv", offsetof(GladGLContext, VertexAttrib4bv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4d", offsetof(GladGLContext, VertexAttrib4d), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4dv", offsetof(GladGLContext, VertexAttrib4dv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4f", offsetof(GladGLContext, VertexAttrib4f), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4fv", offsetof(GladGLContext, VertexAttrib4fv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4iv", offsetof(GladGLContext, VertexAttrib4iv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4s", offsetof(GladGLContext, VertexAttrib4s), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4sv", offsetof(GladGLContext, VertexAttrib4sv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4ubv", offsetof(GladGLContext, VertexAttrib4ubv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4uiv", offsetof(GladGLContext, VertexAttrib4uiv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttrib4usv", offsetof(GladGLContext, VertexAttrib4usv), offsetof(GladGLContext, VERSION_2_0) },
+    { "glVertexAttribPointer", offsetof(GladGLContext, VertexAttribPointer), offsetof(GladGLContext, VERSION_2_0) },
+    { "glUniformMatrix2x3fv", offsetof(GladGLContext, UniformMatrix2x3fv), offsetof(GladGLContext, VERSION_2_1) },
+    { "glUniformMatrix3x2fv", offsetof(GladGLContext, UniformMatrix3x2fv), offsetof(GladGLContext, VERSION_2_1) },
+    { "glUniformMatrix2x4fv", offsetof(GladGLContext, UniformMatrix2x4fv), offsetof(GladGLContext, VERSION_2_1) },
+    { "glUniformMatrix4x2fv", offsetof(GladGLContext, UniformMatrix4x2fv), offsetof(GladGLContext, VERSION_2_1) },
+    { "glUniformMatrix3x4fv", offsetof(GladGLContext, UniformMatrix3x4fv), offsetof(GladGLContext, VERSION_2_1) },
+    { "glUniformMatrix4x3fv", offsetof(GladGLContext, UniformMatrix4x3fv), offsetof(GladGLContext, VERSION_2_1) },
+    { "glColorMaski", offsetof(GladGLContext, ColorMaski), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetBooleani_v", offsetof(GladGLContext, GetBooleani_v), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetIntegeri_v", offsetof(GladGLContext, GetIntegeri_v), offsetof(GladGLContext, VERSION_3_0) },
+    { "glEnablei", offsetof(GladGLContext, Enablei), offsetof(GladGLContext, VERSION_3_0) },
+    { "glDisablei", offsetof(GladGLContext, Disablei), offsetof(GladGLContext, VERSION_3_0) },
+    { "glIsEnabledi", offsetof(GladGLContext, IsEnabledi), offsetof(GladGLContext, VERSION_3_0) },
+    { "glBeginTransformFeedback", offsetof(GladGLContext, BeginTransformFeedback), offsetof(GladGLContext, VERSION_3_0) },
+    { "glEndTransformFeedback", offsetof(GladGLContext, EndTransformFeedback), offsetof(GladGLContext, VERSION_3_0) },
+    { "glBindBufferRange", offsetof(GladGLContext, BindBufferRange), offsetof(GladGLContext, VERSION_3_0) },
+    { "glBindBufferBase", offsetof(GladGLContext, BindBufferBase), offsetof(GladGLContext, VERSION_3_0) },
+    { "glTransformFeedbackVaryings", offsetof(GladGLContext, TransformFeedbackVaryings), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetTransformFeedbackVarying", offsetof(GladGLContext, GetTransformFeedbackVarying), offsetof(GladGLContext, VERSION_3_0) },
+    { "glClampColor", offsetof(GladGLContext, ClampColor), offsetof(GladGLContext, VERSION_3_0) },
+    { "glBeginConditionalRender", offsetof(GladGLContext, BeginConditionalRender), offsetof(GladGLContext, VERSION_3_0) },
+    { "glEndConditionalRender", offsetof(GladGLContext, EndConditionalRender), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribIPointer", offsetof(GladGLContext, VertexAttribIPointer), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetVertexAttribIiv", offsetof(GladGLContext, GetVertexAttribIiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetVertexAttribIuiv", offsetof(GladGLContext, GetVertexAttribIuiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI1i", offsetof(GladGLContext, VertexAttribI1i), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI2i", offsetof(GladGLContext, VertexAttribI2i), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI3i", offsetof(GladGLContext, VertexAttribI3i), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI4i", offsetof(GladGLContext, VertexAttribI4i), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI1ui", offsetof(GladGLContext, VertexAttribI1ui), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI2ui", offsetof(GladGLContext, VertexAttribI2ui), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI3ui", offsetof(GladGLContext, VertexAttribI3ui), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI4ui", offsetof(GladGLContext, VertexAttribI4ui), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI1iv", offsetof(GladGLContext, VertexAttribI1iv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI2iv", offsetof(GladGLContext, VertexAttribI2iv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI3iv", offsetof(GladGLContext, VertexAttribI3iv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI4iv", offsetof(GladGLContext, VertexAttribI4iv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI1uiv", offsetof(GladGLContext, VertexAttribI1uiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI2uiv", offsetof(GladGLContext, VertexAttribI2uiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI3uiv", offsetof(GladGLContext, VertexAttribI3uiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI4uiv", offsetof(GladGLContext, VertexAttribI4uiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI4bv", offsetof(GladGLContext, VertexAttribI4bv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI4sv", offsetof(GladGLContext, VertexAttribI4sv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI4ubv", offsetof(GladGLContext, VertexAttribI4ubv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glVertexAttribI4usv", offsetof(GladGLContext, VertexAttribI4usv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetUniformuiv", offsetof(GladGLContext, GetUniformuiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glBindFragDataLocation", offsetof(GladGLContext, BindFragDataLocation), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetFragDataLocation", offsetof(GladGLContext, GetFragDataLocation), offsetof(GladGLContext, VERSION_3_0) },
+    { "glUniform1ui", offsetof(GladGLContext, Uniform1ui), offsetof(GladGLContext, VERSION_3_0) },
+    { "glUniform2ui", offsetof(GladGLContext, Uniform2ui), offsetof(GladGLContext, VERSION_3_0) },
+    { "glUniform3ui", offsetof(GladGLContext, Uniform3ui), offsetof(GladGLContext, VERSION_3_0) },
+    { "glUniform4ui", offsetof(GladGLContext, Uniform4ui), offsetof(GladGLContext, VERSION_3_0) },
+    { "glUniform1uiv", offsetof(GladGLContext, Uniform1uiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glUniform2uiv", offsetof(GladGLContext, Uniform2uiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glUniform3uiv", offsetof(GladGLContext, Uniform3uiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glUniform4uiv", offsetof(GladGLContext, Uniform4uiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glTexParameterIiv", offsetof(GladGLContext, TexParameterIiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glTexParameterIuiv", offsetof(GladGLContext, TexParameterIuiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetTexParameterIiv", offsetof(GladGLContext, GetTexParameterIiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetTexParameterIuiv", offsetof(GladGLContext, GetTexParameterIuiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glClearBufferiv", offsetof(GladGLContext, ClearBufferiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glClearBufferuiv", offsetof(GladGLContext, ClearBufferuiv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glClearBufferfv", offsetof(GladGLContext, ClearBufferfv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glClearBufferfi", offsetof(GladGLContext, ClearBufferfi), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetStringi", offsetof(GladGLContext, GetStringi), offsetof(GladGLContext, VERSION_3_0) },
+    { "glIsRenderbuffer", offsetof(GladGLContext, IsRenderbuffer), offsetof(GladGLContext, VERSION_3_0) },
+    { "glBindRenderbuffer", offsetof(GladGLContext, BindRenderbuffer), offsetof(GladGLContext, VERSION_3_0) },
+    { "glDeleteRenderbuffers", offsetof(GladGLContext, DeleteRenderbuffers), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGenRenderbuffers", offsetof(GladGLContext, GenRenderbuffers), offsetof(GladGLContext, VERSION_3_0) },
+    { "glRenderbufferStorage", offsetof(GladGLContext, RenderbufferStorage), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetRenderbufferParameteriv", offsetof(GladGLContext, GetRenderbufferParameteriv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glIsFramebuffer", offsetof(GladGLContext, IsFramebuffer), offsetof(GladGLContext, VERSION_3_0) },
+    { "glBindFramebuffer", offsetof(GladGLContext, BindFramebuffer), offsetof(GladGLContext, VERSION_3_0) },
+    { "glDeleteFramebuffers", offsetof(GladGLContext, DeleteFramebuffers), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGenFramebuffers", offsetof(GladGLContext, GenFramebuffers), offsetof(GladGLContext, VERSION_3_0) },
+    { "glCheckFramebufferStatus", offsetof(GladGLContext, CheckFramebufferStatus), offsetof(GladGLContext, VERSION_3_0) },
+    { "glFramebufferTexture1D", offsetof(GladGLContext, FramebufferTexture1D), offsetof(GladGLContext, VERSION_3_0) },
+    { "glFramebufferTexture2D", offsetof(GladGLContext, FramebufferTexture2D), offsetof(GladGLContext, VERSION_3_0) },
+    { "glFramebufferTexture3D", offsetof(GladGLContext, FramebufferTexture3D), offsetof(GladGLContext, VERSION_3_0) },
+    { "glFramebufferRenderbuffer", offsetof(GladGLContext, FramebufferRenderbuffer), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGetFramebufferAttachmentParameteriv", offsetof(GladGLContext, GetFramebufferAttachmentParameteriv), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGenerateMipmap", offsetof(GladGLContext, GenerateMipmap), offsetof(GladGLContext, VERSION_3_0) },
+    { "glBlitFramebuffer", offsetof(GladGLContext, BlitFramebuffer), offsetof(GladGLContext, VERSION_3_0) },
+    { "glRenderbufferStorageMultisample", offsetof(GladGLContext, RenderbufferStorageMultisample), offsetof(GladGLContext, VERSION_3_0) },
+    { "glFramebufferTextureLayer", offsetof(GladGLContext, FramebufferTextureLayer), offsetof(GladGLContext, VERSION_3_0) },
+    { "glMapBufferRange", offsetof(GladGLContext, MapBufferRange), offsetof(GladGLContext, VERSION_3_0) },
+    { "glFlushMappedBufferRange", offsetof(GladGLContext, FlushMappedBufferRange), offsetof(GladGLContext, VERSION_3_0) },
+    { "glBindVertexArray", offsetof(GladGLContext, BindVertexArray), offsetof(GladGLContext, VERSION_3_0) },
+    { "glDeleteVertexArrays", offsetof(GladGLContext, DeleteVertexArrays), offsetof(GladGLContext, VERSION_3_0) },
+    { "glGenVertexArrays", offsetof(GladGLContext, GenVertexArrays), offsetof(GladGLContext, VERSION_3_0) },
+    { "glIsVertexArray", offsetof(GladGLContext, IsVertexArray), offsetof(GladGLContext, VERSION_3_0) },
+    { "glDrawArraysInstanced", offsetof(GladGLContext, DrawArraysInstanced), offsetof(GladGLContext, VERSION_3_1) },
+    { "glDrawElementsInstanced", offsetof(GladGLContext, DrawElementsInstanced), offsetof(GladGLContext, VERSION_3_1) },
+    { "glTexBuffer", offsetof(GladGLContext, TexBuffer), offsetof(GladGLContext, VERSION_3_1) },
+    { "glPrimitiveRestartIndex", offsetof(GladGLContext, PrimitiveRestartIndex), offsetof(GladGLContext, VERSION_3_1) },
+    { "glCopyBufferSubData", offsetof(GladGLContext, CopyBufferSubData), offsetof(GladGLContext, VERSION_3_1) },
+    { "glGetUniformIndices", offsetof(GladGLContext, GetUniformIndices), offsetof(GladGLContext, VERSION_3_1) },
+    { "glGetActiveUniformsiv", offsetof(GladGLContext, GetActiveUniformsiv), offsetof(GladGLContext, VERSION_3_1) },
+    { "glGetActiveUniformName", offsetof(GladGLContext, GetActiveUniformName), offsetof(GladGLContext, VERSION_3_1) },
+    { "glGetUniformBlockIndex", offsetof(GladGLContext, GetUniformBlockIndex), offsetof(GladGLContext, VERSION_3_1) },
+    { "glGetActiveUniformBlockiv", offsetof(GladGLContext, GetActiveUniformBlockiv), offsetof(GladGLContext, VERSION_3_1) },
+    { "glGetActiveUniformBlockName", offsetof(GladGLContext, GetActiveUniformBlockName), offsetof(GladGLContext, VERSION_3_1) },
+    { "glUniformBlockBinding", offsetof(GladGLContext, UniformBlockBinding), offsetof(GladGLContext, VERSION_3_1) },
+    { "glDrawElementsBaseVertex", offsetof(GladGLContext, DrawElementsBaseVertex), offsetof(GladGLContext, VERSION_3_2) },
+    { "glDrawRangeElementsBaseVertex", offsetof(GladGLContext, DrawRangeElementsBaseVertex), offsetof(GladGLContext, VERSION_3_2) },
+    { "glDrawElementsInstancedBaseVertex", offsetof(GladGLContext, DrawElementsInstancedBaseVertex), offsetof(GladGLContext, VERSION_3_2) },
+    { "glMultiDrawElementsBaseVertex", offsetof(GladGLContext, MultiDrawElementsBaseVertex), offsetof(GladGLContext, VERSION_3_2) },
+    { "glProvokingVertex", offsetof(GladGLContext, ProvokingVertex), offsetof(GladGLContext, VERSION_3_2) },
+    { "glFenceSync", offsetof(GladGLContext, FenceSync), offsetof(GladGLContext, VERSION_3_2) },
+    { "glIsSync", offsetof(GladGLContext, IsSync), offsetof(GladGLContext, VERSION_3_2) },
+    { "glDeleteSync", offsetof(GladGLContext, DeleteSync), offsetof(GladGLContext, VERSION_3_2) },
+    { "glClientWaitSync", offsetof(GladGLContext, ClientWaitSync), offsetof(GladGLContext, VERSION_3_2) },
+    { "glWaitSync", offsetof(GladGLContext, WaitSync), offsetof(GladGLContext, VERSION_3_2) },
+    { "glGetInteger64v", offsetof(GladGLContext, GetInteger64v), offsetof(GladGLContext, VERSION_3_2) },
+    { "glGetSynciv", offsetof(GladGLContext, GetSynciv), offsetof(GladGLContext, VERSION_3_2) },
+    { "glGetInteger64i_v", offsetof(GladGLContext, GetInteger64i_v), offsetof(GladGLContext, VERSION_3_2) },
+    { "glGetBufferParameteri64v", offsetof(GladGLContext, GetBufferParameteri64v), offsetof(GladGLContext, VERSION_3_2) },
+    { "glFramebufferTexture", offsetof(GladGLContext, FramebufferTexture), offsetof(GladGLContext, VERSION_3_2) },
+    { "glTexImage2DMultisample", offsetof(GladGLContext, TexImage2DMultisample), offsetof(GladGLContext, VERSION_3_2) },
+    { "glTexImage3DMultisample", offsetof(GladGLContext, TexImage3DMultisample), offsetof(GladGLContext, VERSION_3_2) },
+    { "glGetMultisamplefv", offsetof(GladGLContext, GetMultisamplefv), offsetof(GladGLContext, VERSION_3_2) },
+    { "glSampleMaski", offsetof(GladGLContext, SampleMaski), offsetof(GladGLContext, VERSION_3_2) },
+    { "glBindFragDataLocationIndexed", offsetof(GladGLContext, BindFragDataLocationIndexed), offsetof(GladGLContext, VERSION_3_3) },
+    { "glGetFragDataIndex", offsetof(GladGLContext, GetFragDataIndex), offsetof(GladGLContext, VERSION_3_3) },
+    { "glGenSamplers", offsetof(GladGLContext, GenSamplers), offsetof(GladGLContext, VERSION_3_3) },
+    { "glDeleteSamplers", offsetof(GladGLContext, DeleteSamplers), offsetof(GladGLContext, VERSION_3_3) },
+    { "glIsSampler", offsetof(GladGLContext, IsSampler), offsetof(GladGLContext, VERSION_3_3) },
+    { "glBindSampler", offsetof(GladGLContext, BindSampler), offsetof(GladGLContext, VERSION_3_3) },
+    { "glSamplerParameteri", offsetof(GladGLContext, SamplerParameteri), offsetof(GladGLContext, VERSION_3_3) },
+    { "glSamplerParameteriv", offsetof(GladGLContext, SamplerParameteriv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glSamplerParameterf", offsetof(GladGLContext, SamplerParameterf), offsetof(GladGLContext, VERSION_3_3) },
+    { "glSamplerParameterfv", offsetof(GladGLContext, SamplerParameterfv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glSamplerParameterIiv", offsetof(GladGLContext, SamplerParameterIiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glSamplerParameterIuiv", offsetof(GladGLContext, SamplerParameterIuiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glGetSamplerParameteriv", offsetof(GladGLContext, GetSamplerParameteriv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glGetSamplerParameterIiv", offsetof(GladGLContext, GetSamplerParameterIiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glGetSamplerParameterfv", offsetof(GladGLContext, GetSamplerParameterfv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glGetSamplerParameterIuiv", offsetof(GladGLContext, GetSamplerParameterIuiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glQueryCounter", offsetof(GladGLContext, QueryCounter), offsetof(GladGLContext, VERSION_3_3) },
+    { "glGetQueryObjecti64v", offsetof(GladGLContext, GetQueryObjecti64v), offsetof(GladGLContext, VERSION_3_3) },
+    { "glGetQueryObjectui64v", offsetof(GladGLContext, GetQueryObjectui64v), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexAttribDivisor", offsetof(GladGLContext, VertexAttribDivisor), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexAttribP1ui", offsetof(GladGLContext, VertexAttribP1ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexAttribP1uiv", offsetof(GladGLContext, VertexAttribP1uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexAttribP2ui", offsetof(GladGLContext, VertexAttribP2ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexAttribP2uiv", offsetof(GladGLContext, VertexAttribP2uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexAttribP3ui", offsetof(GladGLContext, VertexAttribP3ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexAttribP3uiv", offsetof(GladGLContext, VertexAttribP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexAttribP4ui", offsetof(GladGLContext, VertexAttribP4ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexAttribP4uiv", offsetof(GladGLContext, VertexAttribP4uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexP2ui", offsetof(GladGLContext, VertexP2ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexP2uiv", offsetof(GladGLContext, VertexP2uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexP3ui", offsetof(GladGLContext, VertexP3ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexP3uiv", offsetof(GladGLContext, VertexP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexP4ui", offsetof(GladGLContext, VertexP4ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glVertexP4uiv", offsetof(GladGLContext, VertexP4uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glTexCoordP1ui", offsetof(GladGLContext, TexCoordP1ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glTexCoordP1uiv", offsetof(GladGLContext, TexCoordP1uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glTexCoordP2ui", offsetof(GladGLContext, TexCoordP2ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glTexCoordP2uiv", offsetof(GladGLContext, TexCoordP2uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glTexCoordP3ui", offsetof(GladGLContext, TexCoordP3ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glTexCoordP3uiv", offsetof(GladGLContext, TexCoordP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glTexCoordP4ui", offsetof(GladGLContext, TexCoordP4ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glTexCoordP4uiv", offsetof(GladGLContext, TexCoordP4uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glMultiTexCoordP1ui", offsetof(GladGLContext, MultiTexCoordP1ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glMultiTexCoordP1uiv", offsetof(GladGLContext, MultiTexCoordP1uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glMultiTexCoordP2ui", offsetof(GladGLContext, MultiTexCoordP2ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glMultiTexCoordP2uiv", offsetof(GladGLContext, MultiTexCoordP2uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glMultiTexCoordP3ui", offsetof(GladGLContext, MultiTexCoordP3ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glMultiTexCoordP3uiv", offsetof(GladGLContext, MultiTexCoordP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glMultiTexCoordP4ui", offsetof(GladGLContext, MultiTexCoordP4ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glMultiTexCoordP4uiv", offsetof(GladGLContext, MultiTexCoordP4uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glNormalP3ui", offsetof(GladGLContext, NormalP3ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glNormalP3uiv", offsetof(GladGLContext, NormalP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glColorP3ui", offsetof(GladGLContext, ColorP3ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glColorP3uiv", offsetof(GladGLContext, ColorP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glColorP4ui", offsetof(GladGLContext, ColorP4ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glColorP4uiv", offsetof(GladGLContext, ColorP4uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glSecondaryColorP3ui", offsetof(GladGLContext, SecondaryColorP3ui), offsetof(GladGLContext, VERSION_3_3) },
+    { "glSecondaryColorP3uiv", offsetof(GladGLContext, SecondaryColorP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+    { "glMinSampleShading", offsetof(GladGLContext, MinSampleShading), offsetof(GladGLContext, VERSION_4_0) },
+    { "glBlendEquationi", offsetof(GladGLContext, BlendEquationi), offsetof(GladGLContext, VERSION_4_0) },
+    { "glBlendEquationSeparatei", offsetof(GladGLContext, BlendEquationSeparatei), offsetof(GladGLContext, VERSION_4_0) },
+    { "glBlendFunci", offsetof(GladGLContext, BlendFunci), offsetof(GladGLContext, VERSION_4_0) },
+    { "glBlendFuncSeparatei", offsetof(GladGLContext, BlendFuncSeparatei), offsetof(GladGLContext, VERSION_4_0) },
+    { "glDrawArraysIndirect", offsetof(GladGLContext, DrawArraysIndirect), offsetof(GladGLContext, VERSION_4_0) },
+    { "glDrawElementsIndirect", offsetof(GladGLContext, DrawElementsIndirect), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniform1d", offsetof(GladGLContext, Uniform1d), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniform2d", offsetof(GladGLContext, Uniform2d), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniform3d", offsetof(GladGLContext, Uniform3d), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniform4d", offsetof(GladGLContext, Uniform4d), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniform1dv", offsetof(GladGLContext, Uniform1dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniform2dv", offsetof(GladGLContext, Uniform2dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniform3dv", offsetof(GladGLContext, Uniform3dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniform4dv", offsetof(GladGLContext, Uniform4dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniformMatrix2dv", offsetof(GladGLContext, UniformMatrix2dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniformMatrix3dv", offsetof(GladGLContext, UniformMatrix3dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniformMatrix4dv", offsetof(GladGLContext, UniformMatrix4dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniformMatrix2x3dv", offsetof(GladGLContext, UniformMatrix2x3dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniformMatrix2x4dv", offsetof(GladGLContext, UniformMatrix2x4dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniformMatrix3x2dv", offsetof(GladGLContext, UniformMatrix3x2dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniformMatrix3x4dv", offsetof(GladGLContext, UniformMatrix3x4dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniformMatrix4x2dv", offsetof(GladGLContext, UniformMatrix4x2dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniformMatrix4x3dv", offsetof(GladGLContext, UniformMatrix4x3dv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glGetUniformdv", offsetof(GladGLContext, GetUniformdv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glGetSubroutineUniformLocation", offsetof(GladGLContext, GetSubroutineUniformLocation), offsetof(GladGLContext, VERSION_4_0) },
+    { "glGetSubroutineIndex", offsetof(GladGLContext, GetSubroutineIndex), offsetof(GladGLContext, VERSION_4_0) },
+    { "glGetActiveSubroutineUniformiv", offsetof(GladGLContext, GetActiveSubroutineUniformiv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glGetActiveSubroutineUniformName", offsetof(GladGLContext, GetActiveSubroutineUniformName), offsetof(GladGLContext, VERSION_4_0) },
+    { "glGetActiveSubroutineName", offsetof(GladGLContext, GetActiveSubroutineName), offsetof(GladGLContext, VERSION_4_0) },
+    { "glUniformSubroutinesuiv", offsetof(GladGLContext, UniformSubroutinesuiv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glGetUniformSubroutineuiv", offsetof(GladGLContext, GetUniformSubroutineuiv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glGetProgramStageiv", offsetof(GladGLContext, GetProgramStageiv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glPatchParameteri", offsetof(GladGLContext, PatchParameteri), offsetof(GladGLContext, VERSION_4_0) },
+    { "glPatchParameterfv", offsetof(GladGLContext, PatchParameterfv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glBindTransformFeedback", offsetof(GladGLContext, BindTransformFeedback), offsetof(GladGLContext, VERSION_4_0) },
+    { "glDeleteTransformFeedbacks", offsetof(GladGLContext, DeleteTransformFeedbacks), offsetof(GladGLContext, VERSION_4_0) },
+    { "glGenTransformFeedbacks", offsetof(GladGLContext, GenTransformFeedbacks), offsetof(GladGLContext, VERSION_4_0) },
+    { "glIsTransformFeedback", offsetof(GladGLContext, IsTransformFeedback), offsetof(GladGLContext, VERSION_4_0) },
+    { "glPauseTransformFeedback", offsetof(GladGLContext, PauseTransformFeedback), offsetof(GladGLContext, VERSION_4_0) },
+    { "glResumeTransformFeedback", offsetof(GladGLContext, ResumeTransformFeedback), offsetof(GladGLContext, VERSION_4_0) },
+    { "glDrawTransformFeedback", offsetof(GladGLContext, DrawTransformFeedback), offsetof(GladGLContext, VERSION_4_0) },
+    { "glDrawTransformFeedbackStream", offsetof(GladGLContext, DrawTransformFeedbackStream), offsetof(GladGLContext, VERSION_4_0) },
+    { "glBeginQueryIndexed", offsetof(GladGLContext, BeginQueryIndexed), offsetof(GladGLContext, VERSION_4_0) },
+    { "glEndQueryIndexed", offsetof(GladGLContext, EndQueryIndexed), offsetof(GladGLContext, VERSION_4_0) },
+    { "glGetQueryIndexediv", offsetof(GladGLContext, GetQueryIndexediv), offsetof(GladGLContext, VERSION_4_0) },
+    { "glReleaseShaderCompiler", offsetof(GladGLContext, ReleaseShaderCompiler), offsetof(GladGLContext, VERSION_4_1) },
+    { "glShaderBinary", offsetof(GladGLContext, ShaderBinary), offsetof(GladGLContext, VERSION_4_1) },
+    { "glGetShaderPrecisionFormat", offsetof(GladGLContext, GetShaderPrecisionFormat), offsetof(GladGLContext, VERSION_4_1) },
+    { "glDepthRangef", offsetof(GladGLContext, DepthRangef), offsetof(GladGLContext, VERSION_4_1) },
+    { "glClearDepthf", offsetof(GladGLContext, ClearDepthf), offsetof(GladGLContext, VERSION_4_1) },
+    { "glGetProgramBinary", offsetof(GladGLContext, GetProgramBinary), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramBinary", offsetof(GladGLContext, ProgramBinary), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramParameteri", offsetof(GladGLContext, ProgramParameteri), offsetof(GladGLContext, VERSION_4_1) },
+    { "glUseProgramStages", offsetof(GladGLContext, UseProgramStages), offsetof(GladGLContext, VERSION_4_1) },
+    { "glActiveShaderProgram", offsetof(GladGLContext, ActiveShaderProgram), offsetof(GladGLContext, VERSION_4_1) },
+    { "glCreateShaderProgramv", offsetof(GladGLContext, CreateShaderProgramv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glBindProgramPipeline", offsetof(GladGLContext, BindProgramPipeline), offsetof(GladGLContext, VERSION_4_1) },
+    { "glDeleteProgramPipelines", offsetof(GladGLContext, DeleteProgramPipelines), offsetof(GladGLContext, VERSION_4_1) },
+    { "glGenProgramPipelines", offsetof(GladGLContext, GenProgramPipelines), offsetof(GladGLContext, VERSION_4_1) },
+    { "glIsProgramPipeline", offsetof(GladGLContext, IsProgramPipeline), offsetof(GladGLContext, VERSION_4_1) },
+    { "glGetProgramPipelineiv", offsetof(GladGLContext, GetProgramPipelineiv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform1i", offsetof(GladGLContext, ProgramUniform1i), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform1iv", offsetof(GladGLContext, ProgramUniform1iv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform1f", offsetof(GladGLContext, ProgramUniform1f), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform1fv", offsetof(GladGLContext, ProgramUniform1fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform1d", offsetof(GladGLContext, ProgramUniform1d), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform1dv", offsetof(GladGLContext, ProgramUniform1dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform1ui", offsetof(GladGLContext, ProgramUniform1ui), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform1uiv", offsetof(GladGLContext, ProgramUniform1uiv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform2i", offsetof(GladGLContext, ProgramUniform2i), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform2iv", offsetof(GladGLContext, ProgramUniform2iv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform2f", offsetof(GladGLContext, ProgramUniform2f), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform2fv", offsetof(GladGLContext, ProgramUniform2fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform2d", offsetof(GladGLContext, ProgramUniform2d), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform2dv", offsetof(GladGLContext, ProgramUniform2dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform2ui", offsetof(GladGLContext, ProgramUniform2ui), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform2uiv", offsetof(GladGLContext, ProgramUniform2uiv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform3i", offsetof(GladGLContext, ProgramUniform3i), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform3iv", offsetof(GladGLContext, ProgramUniform3iv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform3f", offsetof(GladGLContext, ProgramUniform3f), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform3fv", offsetof(GladGLContext, ProgramUniform3fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform3d", offsetof(GladGLContext, ProgramUniform3d), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform3dv", offsetof(GladGLContext, ProgramUniform3dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform3ui", offsetof(GladGLContext, ProgramUniform3ui), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform3uiv", offsetof(GladGLContext, ProgramUniform3uiv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform4i", offsetof(GladGLContext, ProgramUniform4i), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform4iv", offsetof(GladGLContext, ProgramUniform4iv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform4f", offsetof(GladGLContext, ProgramUniform4f), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform4fv", offsetof(GladGLContext, ProgramUniform4fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform4d", offsetof(GladGLContext, ProgramUniform4d), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform4dv", offsetof(GladGLContext, ProgramUniform4dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform4ui", offsetof(GladGLContext, ProgramUniform4ui), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniform4uiv", offsetof(GladGLContext, ProgramUniform4uiv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix2fv", offsetof(GladGLContext, ProgramUniformMatrix2fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix3fv", offsetof(GladGLContext, ProgramUniformMatrix3fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix4fv", offsetof(GladGLContext, ProgramUniformMatrix4fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix2dv", offsetof(GladGLContext, ProgramUniformMatrix2dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix3dv", offsetof(GladGLContext, ProgramUniformMatrix3dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix4dv", offsetof(GladGLContext, ProgramUniformMatrix4dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix2x3fv", offsetof(GladGLContext, ProgramUniformMatrix2x3fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix3x2fv", offsetof(GladGLContext, ProgramUniformMatrix3x2fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix2x4fv", offsetof(GladGLContext, ProgramUniformMatrix2x4fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix4x2fv", offsetof(GladGLContext, ProgramUniformMatrix4x2fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix3x4fv", offsetof(GladGLContext, ProgramUniformMatrix3x4fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix4x3fv", offsetof(GladGLContext, ProgramUniformMatrix4x3fv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix2x3dv", offsetof(GladGLContext, ProgramUniformMatrix2x3dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix3x2dv", offsetof(GladGLContext, ProgramUniformMatrix3x2dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix2x4dv", offsetof(GladGLContext, ProgramUniformMatrix2x4dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix4x2dv", offsetof(GladGLContext, ProgramUniformMatrix4x2dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix3x4dv", offsetof(GladGLContext, ProgramUniformMatrix3x4dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glProgramUniformMatrix4x3dv", offsetof(GladGLContext, ProgramUniformMatrix4x3dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glValidateProgramPipeline", offsetof(GladGLContext, ValidateProgramPipeline), offsetof(GladGLContext, VERSION_4_1) },
+    { "glGetProgramPipelineInfoLog", offsetof(GladGLContext, GetProgramPipelineInfoLog), offsetof(GladGLContext, VERSION_4_1) },
+    { "glVertexAttribL1d", offsetof(GladGLContext, VertexAttribL1d), offsetof(GladGLContext, VERSION_4_1) },
+    { "glVertexAttribL2d", offsetof(GladGLContext, VertexAttribL2d), offsetof(GladGLContext, VERSION_4_1) },
+    { "glVertexAttribL3d", offsetof(GladGLContext, VertexAttribL3d), offsetof(GladGLContext, VERSION_4_1) },
+    { "glVertexAttribL4d", offsetof(GladGLContext, VertexAttribL4d), offsetof(GladGLContext, VERSION_4_1) },
+    { "glVertexAttribL1dv", offsetof(GladGLContext, VertexAttribL1dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glVertexAttribL2dv", offsetof(GladGLContext, VertexAttribL2dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glVertexAttribL3dv", offsetof(GladGLContext, VertexAttribL3dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glVertexAttribL4dv", offsetof(GladGLContext, VertexAttribL4dv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glVertexAttribLPointer", offsetof(GladGLContext, VertexAttribLPointer), offsetof(GladGLContext, VERSION_4_1) },
+    { "glGetVertexAttribLdv", offsetof(GladGLContext, GetVertexAttribLdv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glViewportArrayv", offsetof(GladGLContext, ViewportArrayv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glViewportIndexedf", offsetof(GladGLContext, ViewportIndexedf), offsetof(GladGLContext, VERSION_4_1) },
+    { "glViewportIndexedfv", offsetof(GladGLContext, ViewportIndexedfv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glScissorArrayv", offsetof(GladGLContext, ScissorArrayv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glScissorIndexed", offsetof(GladGLContext, ScissorIndexed), offsetof(GladGLContext, VERSION_4_1) },
+    { "glScissorIndexedv", offsetof(GladGLContext, ScissorIndexedv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glDepthRangeArrayv", offsetof(GladGLContext, DepthRangeArrayv), offsetof(GladGLContext, VERSION_4_1) },
+    { "glDepthRangeIndexed", offsetof(GladGLContext, DepthRangeIndexed), offsetof(GladGLContext, VERSION_4_1) },
+    { "glGetFloati_v", offsetof(GladGLContext, GetFloati_v), offsetof(GladGLContext, VERSION_4_1) },
+    { "glGetDoublei_v", offsetof(GladGLContext, GetDoublei_v), offsetof(GladGLContext, VERSION_4_1) },
+    { "glDrawArraysInstancedBaseInstance", offsetof(GladGLContext, DrawArraysInstancedBaseInstance), offsetof(GladGLContext, VERSION_4_2) },
+    { "glDrawElementsInstancedBaseInstance", offsetof(GladGLContext, DrawElementsInstancedBaseInstance), offsetof(GladGLContext, VERSION_4_2) },
+    { "glDrawElementsInstancedBaseVertexBaseInstance", offsetof(GladGLContext, DrawElementsInstancedBaseVertexBaseInstance), offsetof(GladGLContext, VERSION_4_2) },
+    { "glGetInternalformativ", offsetof(GladGLContext, GetInternalformativ), offsetof(GladGLContext, VERSION_4_2) },
+    { "glGetActiveAtomicCounterBufferiv", offsetof(GladGLContext, GetActiveAtomicCounterBufferiv), offsetof(GladGLContext, VERSION_4_2) },
+    { "glBindImageTexture", offsetof(GladGLContext, BindImageTexture), offsetof(GladGLContext, VERSION_4_2) },
+    { "glMemoryBarrier", offsetof(GladGLContext, MemoryBarrier), offsetof(GladGLContext, VERSION_4_2) },
+    { "glTexStorage1D", offsetof(GladGLContext, TexStorage1D), offsetof(GladGLContext, VERSION_4_2) },
+    { "glTexStorage2D", offsetof(GladGLContext, TexStorage2D), offsetof(GladGLContext, VERSION_4_2) },
+    { "glTexStorage3D", offsetof(GladGLContext, TexStorage3D), offsetof(GladGLContext, VERSION_4_2) },
+    { "glDrawTransformFeedbackInstanced", offsetof(GladGLContext, DrawTransformFeedbackInstanced), offsetof(GladGLContext, VERSION_4_2) },
+    { "glDrawTransformFeedbackStreamInstanced", offsetof(GladGLContext, DrawTransformFeedbackStreamInstanced), offsetof(GladGLContext, VERSION_4_2) },
+    { "glClearBufferData", offsetof(GladGLContext, ClearBufferData), offsetof(GladGLContext, VERSION_4_3) },
+    { "glClearBufferSubData", offsetof(GladGLContext, ClearBufferSubData), offsetof(GladGLContext, VERSION_4_3) },
+    { "glDispatchCompute", offsetof(GladGLContext, DispatchCompute), offsetof(GladGLContext, VERSION_4_3) },
+    { "glDispatchComputeIndirect", offsetof(GladGLContext, DispatchComputeIndirect), offsetof(GladGLContext, VERSION_4_3) },
+    { "glCopyImageSubData", offsetof(GladGLContext, CopyImageSubData), offsetof(GladGLContext, VERSION_4_3) },
+    { "glFramebufferParameteri", offsetof(GladGLContext, FramebufferParameteri), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetFramebufferParameteriv", offsetof(GladGLContext, GetFramebufferParameteriv), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetInternalformati64v", offsetof(GladGLContext, GetInternalformati64v), offsetof(GladGLContext, VERSION_4_3) },
+    { "glInvalidateTexSubImage", offsetof(GladGLContext, InvalidateTexSubImage), offsetof(GladGLContext, VERSION_4_3) },
+    { "glInvalidateTexImage", offsetof(GladGLContext, InvalidateTexImage), offsetof(GladGLContext, VERSION_4_3) },
+    { "glInvalidateBufferSubData", offsetof(GladGLContext, InvalidateBufferSubData), offsetof(GladGLContext, VERSION_4_3) },
+    { "glInvalidateBufferData", offsetof(GladGLContext, InvalidateBufferData), offsetof(GladGLContext, VERSION_4_3) },
+    { "glInvalidateFramebuffer", offsetof(GladGLContext, InvalidateFramebuffer), offsetof(GladGLContext, VERSION_4_3) },
+    { "glInvalidateSubFramebuffer", offsetof(GladGLContext, InvalidateSubFramebuffer), offsetof(GladGLContext, VERSION_4_3) },
+    { "glMultiDrawArraysIndirect", offsetof(GladGLContext, MultiDrawArraysIndirect), offsetof(GladGLContext, VERSION_4_3) },
+    { "glMultiDrawElementsIndirect", offsetof(GladGLContext, MultiDrawElementsIndirect), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetProgramInterfaceiv", offsetof(GladGLContext, GetProgramInterfaceiv), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetProgramResourceIndex", offsetof(GladGLContext, GetProgramResourceIndex), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetProgramResourceName", offsetof(GladGLContext, GetProgramResourceName), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetProgramResourceiv", offsetof(GladGLContext, GetProgramResourceiv), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetProgramResourceLocation", offsetof(GladGLContext, GetProgramResourceLocation), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetProgramResourceLocationIndex", offsetof(GladGLContext, GetProgramResourceLocationIndex), offsetof(GladGLContext, VERSION_4_3) },
+    { "glShaderStorageBlockBinding", offsetof(GladGLContext, ShaderStorageBlockBinding), offsetof(GladGLContext, VERSION_4_3) },
+    { "glTexBufferRange", offsetof(GladGLContext, TexBufferRange), offsetof(GladGLContext, VERSION_4_3) },
+    { "glTexStorage2DMultisample", offsetof(GladGLContext, TexStorage2DMultisample), offsetof(GladGLContext, VERSION_4_3) },
+    { "glTexStorage3DMultisample", offsetof(GladGLContext, TexStorage3DMultisample), offsetof(GladGLContext, VERSION_4_3) },
+    { "glTextureView", offsetof(GladGLContext, TextureView), offsetof(GladGLContext, VERSION_4_3) },
+    { "glBindVertexBuffer", offsetof(GladGLContext, BindVertexBuffer), offsetof(GladGLContext, VERSION_4_3) },
+    { "glVertexAttribFormat", offsetof(GladGLContext, VertexAttribFormat), offsetof(GladGLContext, VERSION_4_3) },
+    { "glVertexAttribIFormat", offsetof(GladGLContext, VertexAttribIFormat), offsetof(GladGLContext, VERSION_4_3) },
+    { "glVertexAttribLFormat", offsetof(GladGLContext, VertexAttribLFormat), offsetof(GladGLContext, VERSION_4_3) },
+    { "glVertexAttribBinding", offsetof(GladGLContext, VertexAttribBinding), offsetof(GladGLContext, VERSION_4_3) },
+    { "glVertexBindingDivisor", offsetof(GladGLContext, VertexBindingDivisor), offsetof(GladGLContext, VERSION_4_3) },
+    { "glDebugMessageControl", offsetof(GladGLContext, DebugMessageControl), offsetof(GladGLContext, VERSION_4_3) },
+    { "glDebugMessageInsert", offsetof(GladGLContext, DebugMessageInsert), offsetof(GladGLContext, VERSION_4_3) },
+    { "glDebugMessageCallback", offsetof(GladGLContext, DebugMessageCallback), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetDebugMessageLog", offsetof(GladGLContext, GetDebugMessageLog), offsetof(GladGLContext, VERSION_4_3) },
+    { "glPushDebugGroup", offsetof(GladGLContext, PushDebugGroup), offsetof(GladGLContext, VERSION_4_3) },
+    { "glPopDebugGroup", offsetof(GladGLContext, PopDebugGroup), offsetof(GladGLContext, VERSION_4_3) },
+    { "glObjectLabel", offsetof(GladGLContext, ObjectLabel), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetObjectLabel", offsetof(GladGLContext, GetObjectLabel), offsetof(GladGLContext, VERSION_4_3) },
+    { "glObjectPtrLabel", offsetof(GladGLContext, ObjectPtrLabel), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetObjectPtrLabel", offsetof(GladGLContext, GetObjectPtrLabel), offsetof(GladGLContext, VERSION_4_3) },
+    { "glGetPointerv", offsetof(GladGLContext, GetPointerv), offsetof(GladGLContext, VERSION_4_3) },
+    { "glBufferStorage", offsetof(GladGLContext, BufferStorage), offsetof(GladGLContext, VERSION_4_4) },
+    { "glClearTexImage", offsetof(GladGLContext, ClearTexImage), offsetof(GladGLContext, VERSION_4_4) },
+    { "glClearTexSubImage", offsetof(GladGLContext, ClearTexSubImage), offsetof(GladGLContext, VERSION_4_4) },
+    { "glBindBuffersBase", offsetof(GladGLContext, BindBuffersBase), offsetof(GladGLContext, VERSION_4_4) },
+    { "glBindBuffersRange", offsetof(GladGLContext, BindBuffersRange), offsetof(GladGLContext, VERSION_4_4) },
+    { "glBindTextures", offsetof(GladGLContext, BindTextures), offsetof(GladGLContext, VERSION_4_4) },
+    { "glBindSamplers", offsetof(GladGLContext, BindSamplers), offsetof(GladGLContext, VERSION_4_4) },
+    { "glBindImageTextures", offsetof(GladGLContext, BindImageTextures), offsetof(GladGLContext, VERSION_4_4) },
+    { "glBindVertexBuffers", offsetof(GladGLContext, BindVertexBuffers), offsetof(GladGLContext, VERSION_4_4) },
+    { "glClipControl", offsetof(GladGLContext, ClipControl), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCreateTransformFeedbacks", offsetof(GladGLContext, CreateTransformFeedbacks), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTransformFeedbackBufferBase", offsetof(GladGLContext, TransformFeedbackBufferBase), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTransformFeedbackBufferRange", offsetof(GladGLContext, TransformFeedbackBufferRange), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetTransformFeedbackiv", offsetof(GladGLContext, GetTransformFeedbackiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetTransformFeedbacki_v", offsetof(GladGLContext, GetTransformFeedbacki_v), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetTransformFeedbacki64_v", offsetof(GladGLContext, GetTransformFeedbacki64_v), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCreateBuffers", offsetof(GladGLContext, CreateBuffers), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedBufferStorage", offsetof(GladGLContext, NamedBufferStorage), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedBufferData", offsetof(GladGLContext, NamedBufferData), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedBufferSubData", offsetof(GladGLContext, NamedBufferSubData), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCopyNamedBufferSubData", offsetof(GladGLContext, CopyNamedBufferSubData), offsetof(GladGLContext, VERSION_4_5) },
+    { "glClearNamedBufferData", offsetof(GladGLContext, ClearNamedBufferData), offsetof(GladGLContext, VERSION_4_5) },
+    { "glClearNamedBufferSubData", offsetof(GladGLContext, ClearNamedBufferSubData), offsetof(GladGLContext, VERSION_4_5) },
+    { "glMapNamedBuffer", offsetof(GladGLContext, MapNamedBuffer), offsetof(GladGLContext, VERSION_4_5) },
+    { "glMapNamedBufferRange", offsetof(GladGLContext, MapNamedBufferRange), offsetof(GladGLContext, VERSION_4_5) },
+    { "glUnmapNamedBuffer", offsetof(GladGLContext, UnmapNamedBuffer), offsetof(GladGLContext, VERSION_4_5) },
+    { "glFlushMappedNamedBufferRange", offsetof(GladGLContext, FlushMappedNamedBufferRange), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetNamedBufferParameteriv", offsetof(GladGLContext, GetNamedBufferParameteriv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetNamedBufferParameteri64v", offsetof(GladGLContext, GetNamedBufferParameteri64v), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetNamedBufferPointerv", offsetof(GladGLContext, GetNamedBufferPointerv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetNamedBufferSubData", offsetof(GladGLContext, GetNamedBufferSubData), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCreateFramebuffers", offsetof(GladGLContext, CreateFramebuffers), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedFramebufferRenderbuffer", offsetof(GladGLContext, NamedFramebufferRenderbuffer), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedFramebufferParameteri", offsetof(GladGLContext, NamedFramebufferParameteri), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedFramebufferTexture", offsetof(GladGLContext, NamedFramebufferTexture), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedFramebufferTextureLayer", offsetof(GladGLContext, NamedFramebufferTextureLayer), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedFramebufferDrawBuffer", offsetof(GladGLContext, NamedFramebufferDrawBuffer), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedFramebufferDrawBuffers", offsetof(GladGLContext, NamedFramebufferDrawBuffers), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedFramebufferReadBuffer", offsetof(GladGLContext, NamedFramebufferReadBuffer), offsetof(GladGLContext, VERSION_4_5) },
+    { "glInvalidateNamedFramebufferData", offsetof(GladGLContext, InvalidateNamedFramebufferData), offsetof(GladGLContext, VERSION_4_5) },
+    { "glInvalidateNamedFramebufferSubData", offsetof(GladGLContext, InvalidateNamedFramebufferSubData), offsetof(GladGLContext, VERSION_4_5) },
+    { "glClearNamedFramebufferiv", offsetof(GladGLContext, ClearNamedFramebufferiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glClearNamedFramebufferuiv", offsetof(GladGLContext, ClearNamedFramebufferuiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glClearNamedFramebufferfv", offsetof(GladGLContext, ClearNamedFramebufferfv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glClearNamedFramebufferfi", offsetof(GladGLContext, ClearNamedFramebufferfi), offsetof(GladGLContext, VERSION_4_5) },
+    { "glBlitNamedFramebuffer", offsetof(GladGLContext, BlitNamedFramebuffer), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCheckNamedFramebufferStatus", offsetof(GladGLContext, CheckNamedFramebufferStatus), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetNamedFramebufferParameteriv", offsetof(GladGLContext, GetNamedFramebufferParameteriv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetNamedFramebufferAttachmentParameteriv", offsetof(GladGLContext, GetNamedFramebufferAttachmentParameteriv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCreateRenderbuffers", offsetof(GladGLContext, CreateRenderbuffers), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedRenderbufferStorage", offsetof(GladGLContext, NamedRenderbufferStorage), offsetof(GladGLContext, VERSION_4_5) },
+    { "glNamedRenderbufferStorageMultisample", offsetof(GladGLContext, NamedRenderbufferStorageMultisample), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetNamedRenderbufferParameteriv", offsetof(GladGLContext, GetNamedRenderbufferParameteriv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCreateTextures", offsetof(GladGLContext, CreateTextures), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureBuffer", offsetof(GladGLContext, TextureBuffer), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureBufferRange", offsetof(GladGLContext, TextureBufferRange), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureStorage1D", offsetof(GladGLContext, TextureStorage1D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureStorage2D", offsetof(GladGLContext, TextureStorage2D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureStorage3D", offsetof(GladGLContext, TextureStorage3D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureStorage2DMultisample", offsetof(GladGLContext, TextureStorage2DMultisample), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureStorage3DMultisample", offsetof(GladGLContext, TextureStorage3DMultisample), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureSubImage1D", offsetof(GladGLContext, TextureSubImage1D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureSubImage2D", offsetof(GladGLContext, TextureSubImage2D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureSubImage3D", offsetof(GladGLContext, TextureSubImage3D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCompressedTextureSubImage1D", offsetof(GladGLContext, CompressedTextureSubImage1D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCompressedTextureSubImage2D", offsetof(GladGLContext, CompressedTextureSubImage2D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCompressedTextureSubImage3D", offsetof(GladGLContext, CompressedTextureSubImage3D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCopyTextureSubImage1D", offsetof(GladGLContext, CopyTextureSubImage1D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCopyTextureSubImage2D", offsetof(GladGLContext, CopyTextureSubImage2D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCopyTextureSubImage3D", offsetof(GladGLContext, CopyTextureSubImage3D), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureParameterf", offsetof(GladGLContext, TextureParameterf), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureParameterfv", offsetof(GladGLContext, TextureParameterfv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureParameteri", offsetof(GladGLContext, TextureParameteri), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureParameterIiv", offsetof(GladGLContext, TextureParameterIiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureParameterIuiv", offsetof(GladGLContext, TextureParameterIuiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureParameteriv", offsetof(GladGLContext, TextureParameteriv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGenerateTextureMipmap", offsetof(GladGLContext, GenerateTextureMipmap), offsetof(GladGLContext, VERSION_4_5) },
+    { "glBindTextureUnit", offsetof(GladGLContext, BindTextureUnit), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetTextureImage", offsetof(GladGLContext, GetTextureImage), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetCompressedTextureImage", offsetof(GladGLContext, GetCompressedTextureImage), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetTextureLevelParameterfv", offsetof(GladGLContext, GetTextureLevelParameterfv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetTextureLevelParameteriv", offsetof(GladGLContext, GetTextureLevelParameteriv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetTextureParameterfv", offsetof(GladGLContext, GetTextureParameterfv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetTextureParameterIiv", offsetof(GladGLContext, GetTextureParameterIiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetTextureParameterIuiv", offsetof(GladGLContext, GetTextureParameterIuiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetTextureParameteriv", offsetof(GladGLContext, GetTextureParameteriv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCreateVertexArrays", offsetof(GladGLContext, CreateVertexArrays), offsetof(GladGLContext, VERSION_4_5) },
+    { "glDisableVertexArrayAttrib", offsetof(GladGLContext, DisableVertexArrayAttrib), offsetof(GladGLContext, VERSION_4_5) },
+    { "glEnableVertexArrayAttrib", offsetof(GladGLContext, EnableVertexArrayAttrib), offsetof(GladGLContext, VERSION_4_5) },
+    { "glVertexArrayElementBuffer", offsetof(GladGLContext, VertexArrayElementBuffer), offsetof(GladGLContext, VERSION_4_5) },
+    { "glVertexArrayVertexBuffer", offsetof(GladGLContext, VertexArrayVertexBuffer), offsetof(GladGLContext, VERSION_4_5) },
+    { "glVertexArrayVertexBuffers", offsetof(GladGLContext, VertexArrayVertexBuffers), offsetof(GladGLContext, VERSION_4_5) },
+    { "glVertexArrayAttribBinding", offsetof(GladGLContext, VertexArrayAttribBinding), offsetof(GladGLContext, VERSION_4_5) },
+    { "glVertexArrayAttribFormat", offsetof(GladGLContext, VertexArrayAttribFormat), offsetof(GladGLContext, VERSION_4_5) },
+    { "glVertexArrayAttribIFormat", offsetof(GladGLContext, VertexArrayAttribIFormat), offsetof(GladGLContext, VERSION_4_5) },
+    { "glVertexArrayAttribLFormat", offsetof(GladGLContext, VertexArrayAttribLFormat), offsetof(GladGLContext, VERSION_4_5) },
+    { "glVertexArrayBindingDivisor", offsetof(GladGLContext, VertexArrayBindingDivisor), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetVertexArrayiv", offsetof(GladGLContext, GetVertexArrayiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetVertexArrayIndexediv", offsetof(GladGLContext, GetVertexArrayIndexediv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetVertexArrayIndexed64iv", offsetof(GladGLContext, GetVertexArrayIndexed64iv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCreateSamplers", offsetof(GladGLContext, CreateSamplers), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCreateProgramPipelines", offsetof(GladGLContext, CreateProgramPipelines), offsetof(GladGLContext, VERSION_4_5) },
+    { "glCreateQueries", offsetof(GladGLContext, CreateQueries), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetQueryBufferObjecti64v", offsetof(GladGLContext, GetQueryBufferObjecti64v), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetQueryBufferObjectiv", offsetof(GladGLContext, GetQueryBufferObjectiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetQueryBufferObjectui64v", offsetof(GladGLContext, GetQueryBufferObjectui64v), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetQueryBufferObjectuiv", offsetof(GladGLContext, GetQueryBufferObjectuiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glMemoryBarrierByRegion", offsetof(GladGLContext, MemoryBarrierByRegion), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetTextureSubImage", offsetof(GladGLContext, GetTextureSubImage), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetCompressedTextureSubImage", offsetof(GladGLContext, GetCompressedTextureSubImage), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetGraphicsResetStatus", offsetof(GladGLContext, GetGraphicsResetStatus), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnCompressedTexImage", offsetof(GladGLContext, GetnCompressedTexImage), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnTexImage", offsetof(GladGLContext, GetnTexImage), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnUniformdv", offsetof(GladGLContext, GetnUniformdv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnUniformfv", offsetof(GladGLContext, GetnUniformfv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnUniformiv", offsetof(GladGLContext, GetnUniformiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnUniformuiv", offsetof(GladGLContext, GetnUniformuiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glReadnPixels", offsetof(GladGLContext, ReadnPixels), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnMapdv", offsetof(GladGLContext, GetnMapdv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnMapfv", offsetof(GladGLContext, GetnMapfv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnMapiv", offsetof(GladGLContext, GetnMapiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnPixelMapfv", offsetof(GladGLContext, GetnPixelMapfv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnPixelMapuiv", offsetof(GladGLContext, GetnPixelMapuiv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnPixelMapusv", offsetof(GladGLContext, GetnPixelMapusv), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnPolygonStipple", offsetof(GladGLContext, GetnPolygonStipple), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnColorTable", offsetof(GladGLContext, GetnColorTable), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnConvolutionFilter", offsetof(GladGLContext, GetnConvolutionFilter), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnSeparableFilter", offsetof(GladGLContext, GetnSeparableFilter), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnHistogram", offsetof(GladGLContext, GetnHistogram), offsetof(GladGLContext, VERSION_4_5) },
+    { "glGetnMinmax", offsetof(GladGLContext, GetnMinmax), offsetof(GladGLContext, VERSION_4_5) },
+    { "glTextureBarrier", offsetof(GladGLContext, TextureBarrier), offsetof(GladGLContext, VERSION_4_5) },
+    { "glSpecializeShader", offsetof(GladGLContext, SpecializeShader), offsetof(GladGLContext, VERSION_4_6) },
+    { "glMultiDrawArraysIndirectCount", offsetof(GladGLContext, MultiDrawArraysIndirectCount), offsetof(GladGLContext, VERSION_4_6) },
+    { "glMultiDrawElementsIndirectCount", offsetof(GladGLContext, MultiDrawElementsIndirectCount), offsetof(GladGLContext, VERSION_4_6) },
+    { "glPolygonOffsetClamp", offsetof(GladGLContext, PolygonOffsetClamp), offsetof(GladGLContext, VERSION_4_6) },
+    { "glGetTextureHandleARB", offsetof(GladGLContext, GetTextureHandleARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glGetTextureSamplerHandleARB", offsetof(GladGLContext, GetTextureSamplerHandleARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glMakeTextureHandleResidentARB", offsetof(GladGLContext, MakeTextureHandleResidentARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glMakeTextureHandleNonResidentARB", offsetof(GladGLContext, MakeTextureHandleNonResidentARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glGetImageHandleARB", offsetof(GladGLContext, GetImageHandleARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glMakeImageHandleResidentARB", offsetof(GladGLContext, MakeImageHandleResidentARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glMakeImageHandleNonResidentARB", offsetof(GladGLContext, MakeImageHandleNonResidentARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glUniformHandleui64ARB", offsetof(GladGLContext, UniformHandleui64ARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glUniformHandleui64vARB", offsetof(GladGLContext, UniformHandleui64vARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glProgramUniformHandleui64ARB", offsetof(GladGLContext, ProgramUniformHandleui64ARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glProgramUniformHandleui64vARB", offsetof(GladGLContext, ProgramUniformHandleui64vARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glIsTextureHandleResidentARB", offsetof(GladGLContext, IsTextureHandleResidentARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glIsImageHandleResidentARB", offsetof(GladGLContext, IsImageHandleResidentARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glVertexAttribL1ui64ARB", offsetof(GladGLContext, VertexAttribL1ui64ARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glVertexAttribL1ui64vARB", offsetof(GladGLContext, VertexAttribL1ui64vARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glGetVertexAttribLui64vARB", offsetof(GladGLContext, GetVertexAttribLui64vARB), offsetof(GladGLContext, ARB_bindless_texture) },
+    { "glSpecializeShaderARB", offsetof(GladGLContext, SpecializeShaderARB), offsetof(GladGLContext, ARB_gl_spirv) },
+    { "glMultiDrawArraysIndirectCountARB", offsetof(GladGLContext, MultiDrawArraysIndirectCountARB), offsetof(GladGLContext, ARB_indirect_parameters) },
+    { "glMultiDrawElementsIndirectCountARB", offsetof(GladGLContext, MultiDrawElementsIndirectCountARB), offsetof(GladGLContext, ARB_indirect_parameters) },
+    { "glMaxShaderCompilerThreadsKHR", offsetof(GladGLContext, MaxShaderCompilerThreadsKHR), offsetof(GladGLContext, KHR_parallel_shader_compile) },
+};
+
+// like glad, only entry points of versions and extensions the context provides: some
+// drivers hand out non-NULL stubs for functions they don't support
+static int isAvailable(const GladGLContext *context, const gladFunction_t *function)
+{
+    int flag;
+    memcpy(&flag, (const char *)context + function->flag, sizeof(flag));
+    return flag;
+}
+
+// reads "4.6.0 ..." or "OpenGL ES 3.2 ..."
+static int parseVersion(const char *version, int *major, int *minor)
+{
+    while (*version != '\0' && (*version < '0' || *version > '9')) version++;
+    if (*version == '\0') {
+        return 0;
+    }
+    *major = *version++ - '0';
+    if (*version++ != '.' || *version < '0' || *version > '9') {
+        return 0;
+    }
+    *minor = *version - '0';
+    return 1;
+}
+
+static unsigned hashName(const char *name)
+{
+    unsigned hash = 2166136261u;
+    while (*name != '\0') {
+        hash = (hash ^ (unsigned char)*name++) * 16777619u;
+    }
+    return hash;
+}
+
+// glGetStringi's strings live as long as the context, so the set only stores pointers
+static void buildExtensionSet(GladGLContext *context, GLADloadproc load)
+{
+    PFNGLGETINTEGERVPROC getIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+    PFNGLGETSTRINGIPROC getStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+    GLint count = 0;
+    if (getIntegerv == NULL || getStringi == NULL) {
+        return;
+    }
+    getIntegerv(GL_NUM_EXTENSIONS, &count);
+    if (count <= 0) {
+        return;
+    }
+    unsigned size = 64;
+    while (size < (unsigned)count * 2) size <<= 1;
+    context->extensionSlots = calloc(size, sizeof(const char *));
+    if (context->extensionSlots == NULL) {
+        return;
+    }
+    context->extensionMask = size - 1;
+    for (GLint ix=0; ix < count; ix++) {
+        const char *name = (const char *)getStringi(GL_EXTENSIONS, (GLuint)ix);
+        if (name == NULL) {
+            continue;
+        }
+        unsigned slot = hashName(name) & context->extensionMask;
+        while (context->extensionSlots[slot] != NULL) {
+            slot = (slot + 1) & context->extensionMask;
+        }
+        context->extensionSlots[slot] = name;
+        context->extensionCount++;
+    }
+}
+
+int gladHasExtension(const GladGLContext *context, const char *name)
+{
+    if (context->extensionSlots == NULL) {
+        return 0;
+    }
+    unsigned slot = hashName(name) & context->extensionMask;
+    while (context->extensionSlots[slot] != NULL) {
+        if (strcmp(context->extensionSlots[slot], name) == 0) {
+            return 1;
+        }
+        slot = (slot + 1) & context->extensionMask;
+    }
+    return 0;
+}
+
+void gladFreeGLContext(GladGLContext *context)
+{
+    free((void *)context->extensionSlots);
+    context->extensionSlots = NULL;
+}
+
+// version, flags and extensions; the entry points are left NULL
+static int loadContextCommon(GladGLContext *context, GLADloadproc load)
+{
+    memset(context, 0, sizeof(*context));
+    context->load = load;
+    PFNGLGETSTRINGPROC getString = (PFNGLGETSTRINGPROC)load("glGetString");
+    if (getString == NULL) {
+        return 0;
+    }
+    const char *version = (const char *)getString(GL_VERSION);
+    if (version == NULL || !parseVersion(version, &context->major, &context->minor)) {
+        return 0;
+    }
+    int loaded = context->major * 10 + context->minor;
+    context->VERSION_1_0 = loaded >= 10;
+    context->VERSION_1_1 = loaded >= 11;
+    context->VERSION_1_2 = loaded >= 12;
+    context->VERSION_1_3 = loaded >= 13;
+    context->VERSION_1_4 = loaded >= 14;
+    context->VERSION_1_5 = loaded >= 15;
+    context->VERSION_2_0 = loaded >= 20;
+    context->VERSION_2_1 = loaded >= 21;
+    context->VERSION_3_0 = loaded >= 30;
+    context->VERSION_3_1 = loaded >= 31;
+    context->VERSION_3_2 = loaded >= 32;
+    context->VERSION_3_3 = loaded >= 33;
+    context->VERSION_4_0 = loaded >= 40;
+    context->VERSION_4_1 = loaded >= 41;
+    context->VERSION_4_2 = loaded >= 42;
+    context->VERSION_4_3 = loaded >= 43;
+    context->VERSION_4_4 = loaded >= 44;
+    context->VERSION_4_5 = loaded >= 45;
+    context->VERSION_4_6 = loaded >= 46;
+    buildExtensionSet(context, load);
+    context->ARB_bindless_texture = gladHasExtension(context, "GL_ARB_bindless_texture");
+    context->ARB_gl_spirv = gladHasExtension(context, "GL_ARB_gl_spirv");
+    context->ARB_indirect_parameters = gladHasExtension(context, "GL_ARB_indirect_parameters");
+    context->EXT_texture_compression_s3tc = gladHasExtension(context, "GL_EXT_texture_compression_s3tc");
+    context->EXT_texture_filter_anisotropic = gladHasExtension(context, "GL_EXT_texture_filter_anisotropic");
+    context->KHR_parallel_shader_compile = gladHasExtension(context, "GL_KHR_parallel_shader_compile");
+    return context->VERSION_1_0;
+}
+
+int gladLoadGLContext(GladGLContext *context, GLADloadproc load)
+{
+    if (!loadContextCommon(context, load)) {
+        return 0;
+    }
+    for (size_t ix=0; ix < sizeof(gladFunctions) / sizeof(gladFunctions[0]); ix++) {
+        if (isAvailable(context, &gladFunctions[ix])) {
+            void *proc = load(gladFunctions[ix].name);
+            memcpy((char *)context + gladFunctions[ix].offset, &proc, sizeof(proc));
+        }
+    }
+    return 1;
+}
+
+// called by a trampoline on the context current on its thread. Two threads sharing a
+// context may both resolve an entry point; they store the same pointer.
+static void resolveLazily(size_t ix)
+{
+    GladGLContext *context = gladCurrentContext;
+    void *proc = context->load(gladFunctions[ix].name);
+    memcpy((char *)context + gladFunctions[ix].offset, &proc, sizeof(proc));
+    context->lazyResolved++;
+}
+
+static void APIENTRY lazy_glCullFace(GLenum mode)
+{
+    resolveLazily(0);
+    gladCurrentContext->CullFace(mode);
+}
+static void APIENTRY lazy_glFrontFace(GLenum mode)
+{
+    resolveLazily(1);
+    gladCurrentContext->FrontFace(mode);
+}
+static void APIENTRY lazy_glHint(GLenum target, GLenum mode)
+{
+    resolveLazily(2);
+    gladCurrentContext->Hint(target, mode);
+}
+static void APIENTRY lazy_glLineWidth(GLfloat width)
+{
+    resolveLazily(3);
+    gladCurrentContext->LineWidth(width);
+}
+static void APIENTRY lazy_glPointSize(GLfloat size)
+{
+    resolveLazily(4);
+    gladCurrentContext->PointSize(size);
+}
+static void APIENTRY lazy_glPolygonMode(GLenum face, GLenum mode)
+{
+    resolveLazily(5);
+    gladCurrentContext->PolygonMode(face, mode);
+}
+static void APIENTRY lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    resolveLazily(6);
+    gladCurrentContext->Scissor(x, y, width, height);
+}
+static void APIENTRY lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+    resolveLazily(7);
+    gladCurrentContext->TexParameterf(target, pname, param);
+}
+static void APIENTRY lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+    resolveLazily(8);
+    gladCurrentContext->TexParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+    resolveLazily(9);
+    gladCurrentContext->TexParameteri(target, pname, param);
+}
+static void APIENTRY lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+    resolveLazily(10);
+    gladCurrentContext->TexParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    resolveLazily(11);
+    gladCurrentContext->TexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    resolveLazily(12);
+    gladCurrentContext->TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY lazy_glDrawBuffer(GLenum buf)
+{
+    resolveLazily(13);
+    gladCurrentContext->DrawBuffer(buf);
+}
+static void APIENTRY lazy_glClear(GLbitfield mask)
+{
+    resolveLazily(14);
+    gladCurrentContext->Clear(mask);
+}
+static void APIENTRY lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    resolveLazily(15);
+    gladCurrentContext->ClearColor(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glClearStencil(GLint s)
+{
+    resolveLazily(16);
+    gladCurrentContext->ClearStencil(s);
+}
+static void APIENTRY lazy_glClearDepth(GLdouble depth)
+{
+    resolveLazily(17);
+    gladCurrentContext->ClearDepth(depth);
+}
+static void APIENTRY lazy_glStencilMask(GLuint mask)
+{
+    resolveLazily(18);
+    gladCurrentContext->StencilMask(mask);
+}
+static void APIENTRY lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    resolveLazily(19);
+    gladCurrentContext->ColorMask(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glDepthMask(GLboolean flag)
+{
+    resolveLazily(20);
+    gladCurrentContext->DepthMask(flag);
+}
+static void APIENTRY lazy_glDisable(GLenum cap)
+{
+    resolveLazily(21);
+    gladCurrentContext->Disable(cap);
+}
+static void APIENTRY lazy_glEnable(GLenum cap)
+{
+    resolveLazily(22);
+    gladCurrentContext->Enable(cap);
+}
+static void APIENTRY lazy_glFinish(void)
+{
+    resolveLazily(23);
+    gladCurrentContext->Finish();
+}
+static void APIENTRY lazy_glFlush(void)
+{
+    resolveLazily(24);
+    gladCurrentContext->Flush();
+}
+static void APIENTRY lazy_glBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    resolveLazily(25);
+    gladCurrentContext->BlendFunc(sfactor, dfactor);
+}
+static void APIENTRY lazy_glLogicOp(GLenum opcode)
+{
+    resolveLazily(26);
+    gladCurrentContext->LogicOp(opcode);
+}
+static void APIENTRY lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+    resolveLazily(27);
+    gladCurrentContext->StencilFunc(func, ref, mask);
+}
+static void APIENTRY lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+    resolveLazily(28);
+    gladCurrentContext->StencilOp(fail, zfail, zpass);
+}
+static void APIENTRY lazy_glDepthFunc(GLenum func)
+{
+    resolveLazily(29);
+    gladCurrentContext->DepthFunc(func);
+}
+static void APIENTRY lazy_glPixelStoref(GLenum pname, GLfloat param)
+{
+    resolveLazily(30);
+    gladCurrentContext->PixelStoref(pname, param);
+}
+static void APIENTRY lazy_glPixelStorei(GLenum pname, GLint param)
+{
+    resolveLazily(31);
+    gladCurrentContext->PixelStorei(pname, param);
+}
+static void APIENTRY lazy_glReadBuffer(GLenum src)
+{
+    resolveLazily(32);
+    gladCurrentContext->ReadBuffer(src);
+}
+static void APIENTRY lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    resolveLazily(33);
+    gladCurrentContext->ReadPixels(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY lazy_glGetBooleanv(GLenum pname, GLboolean *data)
+{
+    resolveLazily(34);
+    gladCurrentContext->GetBooleanv(pname, data);
+}
+static void APIENTRY lazy_glGetDoublev(GLenum pname, GLdouble *data)
+{
+    resolveLazily(35);
+    gladCurrentContext->GetDoublev(pname, data);
+}
+static GLenum APIENTRY lazy_glGetError(void)
+{
+    resolveLazily(36);
+    return gladCurrentContext->GetError();
+}
+static void APIENTRY lazy_glGetFloatv(GLenum pname, GLfloat *data)
+{
+    resolveLazily(37);
+    gladCurrentContext->GetFloatv(pname, data);
+}
+static void APIENTRY lazy_glGetIntegerv(GLenum pname, GLint *data)
+{
+    resolveLazily(38);
+    gladCurrentContext->GetIntegerv(pname, data);
+}
+static const GLubyte * APIENTRY lazy_glGetString(GLenum name)
+{
+    resolveLazily(39);
+    return gladCurrentContext->GetString(name);
+}
+static void APIENTRY lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+    resolveLazily(40);
+    gladCurrentContext->GetTexImage(target, level, format, type, pixels);
+}
+static void APIENTRY lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+    resolveLazily(41);
+    gladCurrentContext->GetTexParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+    resolveLazily(42);
+    gladCurrentContext->GetTexParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params)
+{
+    resolveLazily(43);
+    gladCurrentContext->GetTexLevelParameterfv(target, level, pname, params);
+}
+static void APIENTRY lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params)
+{
+    resolveLazily(44);
+    gladCurrentContext->GetTexLevelParameteriv(target, level, pname, params);
+}
+static GLboolean APIENTRY lazy_glIsEnabled(GLenum cap)
+{
+    resolveLazily(45);
+    return gladCurrentContext->IsEnabled(cap);
+}
+static void APIENTRY lazy_glDepthRange(GLdouble n, GLdouble f)
+{
+    resolveLazily(46);
+    gladCurrentContext->DepthRange(n, f);
+}
+static void APIENTRY lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    resolveLazily(47);
+    gladCurrentContext->Viewport(x, y, width, height);
+}
+static void APIENTRY lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    resolveLazily(48);
+    gladCurrentContext->DrawArrays(mode, first, count);
+}
+static void APIENTRY lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    resolveLazily(49);
+    gladCurrentContext->DrawElements(mode, count, type, indices);
+}
+static void APIENTRY lazy_glPolygonOffset(GLfloat factor, GLfloat units)
+{
+    resolveLazily(50);
+    gladCurrentContext->PolygonOffset(factor, units);
+}
+static void APIENTRY lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    resolveLazily(51);
+    gladCurrentContext->CopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    resolveLazily(52);
+    gladCurrentContext->CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    resolveLazily(53);
+    gladCurrentContext->CopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void APIENTRY lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    resolveLazily(54);
+    gladCurrentContext->CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    resolveLazily(55);
+    gladCurrentContext->TexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    resolveLazily(56);
+    gladCurrentContext->TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY lazy_glBindTexture(GLenum target, GLuint texture)
+{
+    resolveLazily(57);
+    gladCurrentContext->BindTexture(target, texture);
+}
+static void APIENTRY lazy_glDeleteTextures(GLsizei n, const GLuint *textures)
+{
+    resolveLazily(58);
+    gladCurrentContext->DeleteTextures(n, textures);
+}
+static void APIENTRY lazy_glGenTextures(GLsizei n, GLuint *textures)
+{
+    resolveLazily(59);
+    gladCurrentContext->GenTextures(n, textures);
+}
+static GLboolean APIENTRY lazy_glIsTexture(GLuint texture)
+{
+    resolveLazily(60);
+    return gladCurrentContext->IsTexture(texture);
+}
+static void APIENTRY lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+    resolveLazily(61);
+    gladCurrentContext->DrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    resolveLazily(62);
+    gladCurrentContext->TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    resolveLazily(63);
+    gladCurrentContext->TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    resolveLazily(64);
+    gladCurrentContext->CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY lazy_glActiveTexture(GLenum texture)
+{
+    resolveLazily(65);
+    gladCurrentContext->ActiveTexture(texture);
+}
+static void APIENTRY lazy_glSampleCoverage(GLfloat value, GLboolean invert)
+{
+    resolveLazily(66);
+    gladCurrentContext->SampleCoverage(value, invert);
+}
+static void APIENTRY lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+    resolveLazily(67);
+    gladCurrentContext->CompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    resolveLazily(68);
+    gladCurrentContext->CompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+    resolveLazily(69);
+    gladCurrentContext->CompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    resolveLazily(70);
+    gladCurrentContext->CompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    resolveLazily(71);
+    gladCurrentContext->CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    resolveLazily(72);
+    gladCurrentContext->CompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img)
+{
+    resolveLazily(73);
+    gladCurrentContext->GetCompressedTexImage(target, level, img);
+}
+static void APIENTRY lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    resolveLazily(74);
+    gladCurrentContext->BlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+    resolveLazily(75);
+    gladCurrentContext->MultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+{
+    resolveLazily(76);
+    gladCurrentContext->MultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY lazy_glPointParameterf(GLenum pname, GLfloat param)
+{
+    resolveLazily(77);
+    gladCurrentContext->PointParameterf(pname, param);
+}
+static void APIENTRY lazy_glPointParameterfv(GLenum pname, const GLfloat *params)
+{
+    resolveLazily(78);
+    gladCurrentContext->PointParameterfv(pname, params);
+}
+static void APIENTRY lazy_glPointParameteri(GLenum pname, GLint param)
+{
+    resolveLazily(79);
+    gladCurrentContext->PointParameteri(pname, param);
+}
+static void APIENTRY lazy_glPointParameteriv(GLenum pname, const GLint *params)
+{
+    resolveLazily(80);
+    gladCurrentContext->PointParameteriv(pname, params);
+}
+static void APIENTRY lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    resolveLazily(81);
+    gladCurrentContext->BlendColor(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glBlendEquation(GLenum mode)
+{
+    resolveLazily(82);
+    gladCurrentContext->BlendEquation(mode);
+}
+static void APIENTRY lazy_glGenQueries(GLsizei n, GLuint *ids)
+{
+    resolveLazily(83);
+    gladCurrentContext->GenQueries(n, ids);
+}
+static void APIENTRY lazy_glDeleteQueries(GLsizei n, const GLuint *ids)
+{
+    resolveLazily(84);
+    gladCurrentContext->DeleteQueries(n, ids);
+}
+static GLboolean APIENTRY lazy_glIsQuery(GLuint id)
+{
+    resolveLazily(85);
+    return gladCurrentContext->IsQuery(id);
+}
+static void APIENTRY lazy_glBeginQuery(GLenum target, GLuint id)
+{
+    resolveLazily(86);
+    gladCurrentContext->BeginQuery(target, id);
+}
+static void APIENTRY lazy_glEndQuery(GLenum target)
+{
+    resolveLazily(87);
+    gladCurrentContext->EndQuery(target);
+}
+static void APIENTRY lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params)
+{
+    resolveLazily(88);
+    gladCurrentContext->GetQueryiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
+{
+    resolveLazily(89);
+    gladCurrentContext->GetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+{
+    resolveLazily(90);
+    gladCurrentContext->GetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY lazy_glBindBuffer(GLenum target, GLuint buffer)
+{
+    resolveLazily(91);
+    gladCurrentContext->BindBuffer(target, buffer);
+}
+static void APIENTRY lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+    resolveLazily(92);
+    gladCurrentContext->DeleteBuffers(n, buffers);
+}
+static void APIENTRY lazy_glGenBuffers(GLsizei n, GLuint *buffers)
+{
+    resolveLazily(93);
+    gladCurrentContext->GenBuffers(n, buffers);
+}
+static GLboolean APIENTRY lazy_glIsBuffer(GLuint buffer)
+{
+    resolveLazily(94);
+    return gladCurrentContext->IsBuffer(buffer);
+}
+static void APIENTRY lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    resolveLazily(95);
+    gladCurrentContext->BufferData(target, size, data, usage);
+}
+static void APIENTRY lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    resolveLazily(96);
+    gladCurrentContext->BufferSubData(target, offset, size, data);
+}
+static void APIENTRY lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+{
+    resolveLazily(97);
+    gladCurrentContext->GetBufferSubData(target, offset, size, data);
+}
+static void * APIENTRY lazy_glMapBuffer(GLenum target, GLenum access)
+{
+    resolveLazily(98);
+    return gladCurrentContext->MapBuffer(target, access);
+}
+static GLboolean APIENTRY lazy_glUnmapBuffer(GLenum target)
+{
+    resolveLazily(99);
+    return gladCurrentContext->UnmapBuffer(target);
+}
+static void APIENTRY lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+    resolveLazily(100);
+    gladCurrentContext->GetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params)
+{
+    resolveLazily(101);
+    gladCurrentContext->GetBufferPointerv(target, pname, params);
+}
+static void APIENTRY lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+    resolveLazily(102);
+    gladCurrentContext->BlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY lazy_glDrawBuffers(GLsizei n, const GLenum *bufs)
+{
+    resolveLazily(103);
+    gladCurrentContext->DrawBuffers(n, bufs);
+}
+static void APIENTRY lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    resolveLazily(104);
+    gladCurrentContext->StencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    resolveLazily(105);
+    gladCurrentContext->StencilFuncSeparate(face, func, ref, mask);
+}
+static void APIENTRY lazy_glStencilMaskSeparate(GLenum face, GLuint mask)
+{
+    resolveLazily(106);
+    gladCurrentContext->StencilMaskSeparate(face, mask);
+}
+static void APIENTRY lazy_glAttachShader(GLuint program, GLuint shader)
+{
+    resolveLazily(107);
+    gladCurrentContext->AttachShader(program, shader);
+}
+static void APIENTRY lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+    resolveLazily(108);
+    gladCurrentContext->BindAttribLocation(program, index, name);
+}
+static void APIENTRY lazy_glCompileShader(GLuint shader)
+{
+    resolveLazily(109);
+    gladCurrentContext->CompileShader(shader);
+}
+static GLuint APIENTRY lazy_glCreateProgram(void)
+{
+    resolveLazily(110);
+    return gladCurrentContext->CreateProgram();
+}
+static GLuint APIENTRY lazy_glCreateShader(GLenum type)
+{
+    resolveLazily(111);
+    return gladCurrentContext->CreateShader(type);
+}
+static void APIENTRY lazy_glDeleteProgram(GLuint program)
+{
+    resolveLazily(112);
+    gladCurrentContext->DeleteProgram(program);
+}
+static void APIENTRY lazy_glDeleteShader(GLuint shader)
+{
+    resolveLazily(113);
+    gladCurrentContext->DeleteShader(shader);
+}
+static void APIENTRY lazy_glDetachShader(GLuint program, GLuint shader)
+{
+    resolveLazily(114);
+    gladCurrentContext->DetachShader(program, shader);
+}
+static void APIENTRY lazy_glDisableVertexAttribArray(GLuint index)
+{
+    resolveLazily(115);
+    gladCurrentContext->DisableVertexAttribArray(index);
+}
+static void APIENTRY lazy_glEnableVertexAttribArray(GLuint index)
+{
+    resolveLazily(116);
+    gladCurrentContext->EnableVertexAttribArray(index);
+}
+static void APIENTRY lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    resolveLazily(117);
+    gladCurrentContext->GetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    resolveLazily(118);
+    gladCurrentContext->GetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+{
+    resolveLazily(119);
+    gladCurrentContext->GetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint APIENTRY lazy_glGetAttribLocation(GLuint program, const GLchar *name)
+{
+    resolveLazily(120);
+    return gladCurrentContext->GetAttribLocation(program, name);
+}
+static void APIENTRY lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    resolveLazily(121);
+    gladCurrentContext->GetProgramiv(program, pname, params);
+}
+static void APIENTRY lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    resolveLazily(122);
+    gladCurrentContext->GetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    resolveLazily(123);
+    gladCurrentContext->GetShaderiv(shader, pname, params);
+}
+static void APIENTRY lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    resolveLazily(124);
+    gladCurrentContext->GetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+    resolveLazily(125);
+    gladCurrentContext->GetShaderSource(shader, bufSize, length, source);
+}
+static GLint APIENTRY lazy_glGetUniformLocation(GLuint program, const GLchar *name)
+{
+    resolveLazily(126);
+    return gladCurrentContext->GetUniformLocation(program, name);
+}
+static void APIENTRY lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params)
+{
+    resolveLazily(127);
+    gladCurrentContext->GetUniformfv(program, location, params);
+}
+static void APIENTRY lazy_glGetUniformiv(GLuint program, GLint location, GLint *params)
+{
+    resolveLazily(128);
+    gladCurrentContext->GetUniformiv(program, location, params);
+}
+static void APIENTRY lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params)
+{
+    resolveLazily(129);
+    gladCurrentContext->GetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
+{
+    resolveLazily(130);
+    gladCurrentContext->GetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
+{
+    resolveLazily(131);
+    gladCurrentContext->GetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer)
+{
+    resolveLazily(132);
+    gladCurrentContext->GetVertexAttribPointerv(index, pname, pointer);
+}
+static GLboolean APIENTRY lazy_glIsProgram(GLuint program)
+{
+    resolveLazily(133);
+    return gladCurrentContext->IsProgram(program);
+}
+static GLboolean APIENTRY lazy_glIsShader(GLuint shader)
+{
+    resolveLazily(134);
+    return gladCurrentContext->IsShader(shader);
+}
+static void APIENTRY lazy_glLinkProgram(GLuint program)
+{
+    resolveLazily(135);
+    gladCurrentContext->LinkProgram(program);
+}
+static void APIENTRY lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+{
+    resolveLazily(136);
+    gladCurrentContext->ShaderSource(shader, count, string, length);
+}
+static void APIENTRY lazy_glUseProgram(GLuint program)
+{
+    resolveLazily(137);
+    gladCurrentContext->UseProgram(program);
+}
+static void APIENTRY lazy_glUniform1f(GLint location, GLfloat v0)
+{
+    resolveLazily(138);
+    gladCurrentContext->Uniform1f(location, v0);
+}
+static void APIENTRY lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+    resolveLazily(139);
+    gladCurrentContext->Uniform2f(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    resolveLazily(140);
+    gladCurrentContext->Uniform3f(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    resolveLazily(141);
+    gladCurrentContext->Uniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1i(GLint location, GLint v0)
+{
+    resolveLazily(142);
+    gladCurrentContext->Uniform1i(location, v0);
+}
+static void APIENTRY lazy_glUniform2i(GLint location, GLint v0, GLint v1)
+{
+    resolveLazily(143);
+    gladCurrentContext->Uniform2i(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+{
+    resolveLazily(144);
+    gladCurrentContext->Uniform3i(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    resolveLazily(145);
+    gladCurrentContext->Uniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    resolveLazily(146);
+    gladCurrentContext->Uniform1fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    resolveLazily(147);
+    gladCurrentContext->Uniform2fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    resolveLazily(148);
+    gladCurrentContext->Uniform3fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    resolveLazily(149);
+    gladCurrentContext->Uniform4fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value)
+{
+    resolveLazily(150);
+    gladCurrentContext->Uniform1iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value)
+{
+    resolveLazily(151);
+    gladCurrentContext->Uniform2iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value)
+{
+    resolveLazily(152);
+    gladCurrentContext->Uniform3iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value)
+{
+    resolveLazily(153);
+    gladCurrentContext->Uniform4iv(location, count, value);
+}
+static void APIENTRY lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(154);
+    gladCurrentContext->UniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(155);
+    gladCurrentContext->UniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(156);
+    gladCurrentContext->UniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glValidateProgram(GLuint program)
+{
+    resolveLazily(157);
+    gladCurrentContext->ValidateProgram(program);
+}
+static void APIENTRY lazy_glVertexAttrib1d(GLuint index, GLdouble x)
+{
+    resolveLazily(158);
+    gladCurrentContext->VertexAttrib1d(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v)
+{
+    resolveLazily(159);
+    gladCurrentContext->VertexAttrib1dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib1f(GLuint index, GLfloat x)
+{
+    resolveLazily(160);
+    gladCurrentContext->VertexAttrib1f(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v)
+{
+    resolveLazily(161);
+    gladCurrentContext->VertexAttrib1fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib1s(GLuint index, GLshort x)
+{
+    resolveLazily(162);
+    gladCurrentContext->VertexAttrib1s(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1sv(GLuint index, const GLshort *v)
+{
+    resolveLazily(163);
+    gladCurrentContext->VertexAttrib1sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
+{
+    resolveLazily(164);
+    gladCurrentContext->VertexAttrib2d(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v)
+{
+    resolveLazily(165);
+    gladCurrentContext->VertexAttrib2dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+{
+    resolveLazily(166);
+    gladCurrentContext->VertexAttrib2f(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v)
+{
+    resolveLazily(167);
+    gladCurrentContext->VertexAttrib2fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
+{
+    resolveLazily(168);
+    gladCurrentContext->VertexAttrib2s(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2sv(GLuint index, const GLshort *v)
+{
+    resolveLazily(169);
+    gladCurrentContext->VertexAttrib2sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    resolveLazily(170);
+    gladCurrentContext->VertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v)
+{
+    resolveLazily(171);
+    gladCurrentContext->VertexAttrib3dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    resolveLazily(172);
+    gladCurrentContext->VertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v)
+{
+    resolveLazily(173);
+    gladCurrentContext->VertexAttrib3fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    resolveLazily(174);
+    gladCurrentContext->VertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3sv(GLuint index, const GLshort *v)
+{
+    resolveLazily(175);
+    gladCurrentContext->VertexAttrib3sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v)
+{
+    resolveLazily(176);
+    gladCurrentContext->VertexAttrib4Nbv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Niv(GLuint index, const GLint *v)
+{
+    resolveLazily(177);
+    gladCurrentContext->VertexAttrib4Niv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v)
+{
+    resolveLazily(178);
+    gladCurrentContext->VertexAttrib4Nsv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    resolveLazily(179);
+    gladCurrentContext->VertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v)
+{
+    resolveLazily(180);
+    gladCurrentContext->VertexAttrib4Nubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v)
+{
+    resolveLazily(181);
+    gladCurrentContext->VertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v)
+{
+    resolveLazily(182);
+    gladCurrentContext->VertexAttrib4Nusv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v)
+{
+    resolveLazily(183);
+    gladCurrentContext->VertexAttrib4bv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    resolveLazily(184);
+    gladCurrentContext->VertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v)
+{
+    resolveLazily(185);
+    gladCurrentContext->VertexAttrib4dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    resolveLazily(186);
+    gladCurrentContext->VertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v)
+{
+    resolveLazily(187);
+    gladCurrentContext->VertexAttrib4fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4iv(GLuint index, const GLint *v)
+{
+    resolveLazily(188);
+    gladCurrentContext->VertexAttrib4iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    resolveLazily(189);
+    gladCurrentContext->VertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4sv(GLuint index, const GLshort *v)
+{
+    resolveLazily(190);
+    gladCurrentContext->VertexAttrib4sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v)
+{
+    resolveLazily(191);
+    gladCurrentContext->VertexAttrib4ubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v)
+{
+    resolveLazily(192);
+    gladCurrentContext->VertexAttrib4uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4usv(GLuint index, const GLushort *v)
+{
+    resolveLazily(193);
+    gladCurrentContext->VertexAttrib4usv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+    resolveLazily(194);
+    gladCurrentContext->VertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(195);
+    gladCurrentContext->UniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(196);
+    gladCurrentContext->UniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(197);
+    gladCurrentContext->UniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(198);
+    gladCurrentContext->UniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(199);
+    gladCurrentContext->UniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(200);
+    gladCurrentContext->UniformMatrix4x3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    resolveLazily(201);
+    gladCurrentContext->ColorMaski(index, r, g, b, a);
+}
+static void APIENTRY lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data)
+{
+    resolveLazily(202);
+    gladCurrentContext->GetBooleani_v(target, index, data);
+}
+static void APIENTRY lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data)
+{
+    resolveLazily(203);
+    gladCurrentContext->GetIntegeri_v(target, index, data);
+}
+static void APIENTRY lazy_glEnablei(GLenum target, GLuint index)
+{
+    resolveLazily(204);
+    gladCurrentContext->Enablei(target, index);
+}
+static void APIENTRY lazy_glDisablei(GLenum target, GLuint index)
+{
+    resolveLazily(205);
+    gladCurrentContext->Disablei(target, index);
+}
+static GLboolean APIENTRY lazy_glIsEnabledi(GLenum target, GLuint index)
+{
+    resolveLazily(206);
+    return gladCurrentContext->IsEnabledi(target, index);
+}
+static void APIENTRY lazy_glBeginTransformFeedback(GLenum primitiveMode)
+{
+    resolveLazily(207);
+    gladCurrentContext->BeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY lazy_glEndTransformFeedback(void)
+{
+    resolveLazily(208);
+    gladCurrentContext->EndTransformFeedback();
+}
+static void APIENTRY lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    resolveLazily(209);
+    gladCurrentContext->BindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    resolveLazily(210);
+    gladCurrentContext->BindBufferBase(target, index, buffer);
+}
+static void APIENTRY lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+{
+    resolveLazily(211);
+    gladCurrentContext->TransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+    resolveLazily(212);
+    gladCurrentContext->GetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glClampColor(GLenum target, GLenum clamp)
+{
+    resolveLazily(213);
+    gladCurrentContext->ClampColor(target, clamp);
+}
+static void APIENTRY lazy_glBeginConditionalRender(GLuint id, GLenum mode)
+{
+    resolveLazily(214);
+    gladCurrentContext->BeginConditionalRender(id, mode);
+}
+static void APIENTRY lazy_glEndConditionalRender(void)
+{
+    resolveLazily(215);
+    gladCurrentContext->EndConditionalRender();
+}
+static void APIENTRY lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    resolveLazily(216);
+    gladCurrentContext->VertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
+{
+    resolveLazily(217);
+    gladCurrentContext->GetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
+{
+    resolveLazily(218);
+    gladCurrentContext->GetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY lazy_glVertexAttribI1i(GLuint index, GLint x)
+{
+    resolveLazily(219);
+    gladCurrentContext->VertexAttribI1i(index, x);
+}
+static void APIENTRY lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y)
+{
+    resolveLazily(220);
+    gladCurrentContext->VertexAttribI2i(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
+{
+    resolveLazily(221);
+    gladCurrentContext->VertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    resolveLazily(222);
+    gladCurrentContext->VertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttribI1ui(GLuint index, GLuint x)
+{
+    resolveLazily(223);
+    gladCurrentContext->VertexAttribI1ui(index, x);
+}
+static void APIENTRY lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
+{
+    resolveLazily(224);
+    gladCurrentContext->VertexAttribI2ui(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    resolveLazily(225);
+    gladCurrentContext->VertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    resolveLazily(226);
+    gladCurrentContext->VertexAttribI4ui(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttribI1iv(GLuint index, const GLint *v)
+{
+    resolveLazily(227);
+    gladCurrentContext->VertexAttribI1iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI2iv(GLuint index, const GLint *v)
+{
+    resolveLazily(228);
+    gladCurrentContext->VertexAttribI2iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI3iv(GLuint index, const GLint *v)
+{
+    resolveLazily(229);
+    gladCurrentContext->VertexAttribI3iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4iv(GLuint index, const GLint *v)
+{
+    resolveLazily(230);
+    gladCurrentContext->VertexAttribI4iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v)
+{
+    resolveLazily(231);
+    gladCurrentContext->VertexAttribI1uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v)
+{
+    resolveLazily(232);
+    gladCurrentContext->VertexAttribI2uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v)
+{
+    resolveLazily(233);
+    gladCurrentContext->VertexAttribI3uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v)
+{
+    resolveLazily(234);
+    gladCurrentContext->VertexAttribI4uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v)
+{
+    resolveLazily(235);
+    gladCurrentContext->VertexAttribI4bv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4sv(GLuint index, const GLshort *v)
+{
+    resolveLazily(236);
+    gladCurrentContext->VertexAttribI4sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v)
+{
+    resolveLazily(237);
+    gladCurrentContext->VertexAttribI4ubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4usv(GLuint index, const GLushort *v)
+{
+    resolveLazily(238);
+    gladCurrentContext->VertexAttribI4usv(index, v);
+}
+static void APIENTRY lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params)
+{
+    resolveLazily(239);
+    gladCurrentContext->GetUniformuiv(program, location, params);
+}
+static void APIENTRY lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name)
+{
+    resolveLazily(240);
+    gladCurrentContext->BindFragDataLocation(program, color, name);
+}
+static GLint APIENTRY lazy_glGetFragDataLocation(GLuint program, const GLchar *name)
+{
+    resolveLazily(241);
+    return gladCurrentContext->GetFragDataLocation(program, name);
+}
+static void APIENTRY lazy_glUniform1ui(GLint location, GLuint v0)
+{
+    resolveLazily(242);
+    gladCurrentContext->Uniform1ui(location, v0);
+}
+static void APIENTRY lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1)
+{
+    resolveLazily(243);
+    gladCurrentContext->Uniform2ui(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    resolveLazily(244);
+    gladCurrentContext->Uniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    resolveLazily(245);
+    gladCurrentContext->Uniform4ui(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    resolveLazily(246);
+    gladCurrentContext->Uniform1uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    resolveLazily(247);
+    gladCurrentContext->Uniform2uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    resolveLazily(248);
+    gladCurrentContext->Uniform3uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    resolveLazily(249);
+    gladCurrentContext->Uniform4uiv(location, count, value);
+}
+static void APIENTRY lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params)
+{
+    resolveLazily(250);
+    gladCurrentContext->TexParameterIiv(target, pname, params);
+}
+static void APIENTRY lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params)
+{
+    resolveLazily(251);
+    gladCurrentContext->TexParameterIuiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params)
+{
+    resolveLazily(252);
+    gladCurrentContext->GetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params)
+{
+    resolveLazily(253);
+    gladCurrentContext->GetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    resolveLazily(254);
+    gladCurrentContext->ClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    resolveLazily(255);
+    gladCurrentContext->ClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    resolveLazily(256);
+    gladCurrentContext->ClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    resolveLazily(257);
+    gladCurrentContext->ClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY lazy_glGetStringi(GLenum name, GLuint index)
+{
+    resolveLazily(258);
+    return gladCurrentContext->GetStringi(name, index);
+}
+static GLboolean APIENTRY lazy_glIsRenderbuffer(GLuint renderbuffer)
+{
+    resolveLazily(259);
+    return gladCurrentContext->IsRenderbuffer(renderbuffer);
+}
+static void APIENTRY lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+    resolveLazily(260);
+    gladCurrentContext->BindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+    resolveLazily(261);
+    gladCurrentContext->DeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+    resolveLazily(262);
+    gladCurrentContext->GenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    resolveLazily(263);
+    gladCurrentContext->RenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+    resolveLazily(264);
+    gladCurrentContext->GetRenderbufferParameteriv(target, pname, params);
+}
+static GLboolean APIENTRY lazy_glIsFramebuffer(GLuint framebuffer)
+{
+    resolveLazily(265);
+    return gladCurrentContext->IsFramebuffer(framebuffer);
+}
+static void APIENTRY lazy_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    resolveLazily(266);
+    gladCurrentContext->BindFramebuffer(target, framebuffer);
+}
+static void APIENTRY lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+    resolveLazily(267);
+    gladCurrentContext->DeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+    resolveLazily(268);
+    gladCurrentContext->GenFramebuffers(n, framebuffers);
+}
+static GLenum APIENTRY lazy_glCheckFramebufferStatus(GLenum target)
+{
+    resolveLazily(269);
+    return gladCurrentContext->CheckFramebufferStatus(target);
+}
+static void APIENTRY lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    resolveLazily(270);
+    gladCurrentContext->FramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    resolveLazily(271);
+    gladCurrentContext->FramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+    resolveLazily(272);
+    gladCurrentContext->FramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    resolveLazily(273);
+    gladCurrentContext->FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    resolveLazily(274);
+    gladCurrentContext->GetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY lazy_glGenerateMipmap(GLenum target)
+{
+    resolveLazily(275);
+    gladCurrentContext->GenerateMipmap(target);
+}
+static void APIENTRY lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    resolveLazily(276);
+    gladCurrentContext->BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    resolveLazily(277);
+    gladCurrentContext->RenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    resolveLazily(278);
+    gladCurrentContext->FramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void * APIENTRY lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    resolveLazily(279);
+    return gladCurrentContext->MapBufferRange(target, offset, length, access);
+}
+static void APIENTRY lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    resolveLazily(280);
+    gladCurrentContext->FlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY lazy_glBindVertexArray(GLuint array)
+{
+    resolveLazily(281);
+    gladCurrentContext->BindVertexArray(array);
+}
+static void APIENTRY lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+    resolveLazily(282);
+    gladCurrentContext->DeleteVertexArrays(n, arrays);
+}
+static void APIENTRY lazy_glGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+    resolveLazily(283);
+    gladCurrentContext->GenVertexArrays(n, arrays);
+}
+static GLboolean APIENTRY lazy_glIsVertexArray(GLuint array)
+{
+    resolveLazily(284);
+    return gladCurrentContext->IsVertexArray(array);
+}
+static void APIENTRY lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    resolveLazily(285);
+    gladCurrentContext->DrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+    resolveLazily(286);
+    gladCurrentContext->DrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
+{
+    resolveLazily(287);
+    gladCurrentContext->TexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY lazy_glPrimitiveRestartIndex(GLuint index)
+{
+    resolveLazily(288);
+    gladCurrentContext->PrimitiveRestartIndex(index);
+}
+static void APIENTRY lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    resolveLazily(289);
+    gladCurrentContext->CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+{
+    resolveLazily(290);
+    gladCurrentContext->GetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+    resolveLazily(291);
+    gladCurrentContext->GetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+    resolveLazily(292);
+    gladCurrentContext->GetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName)
+{
+    resolveLazily(293);
+    return gladCurrentContext->GetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+    resolveLazily(294);
+    gladCurrentContext->GetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+    resolveLazily(295);
+    gladCurrentContext->GetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+    resolveLazily(296);
+    gladCurrentContext->UniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    resolveLazily(297);
+    gladCurrentContext->DrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    resolveLazily(298);
+    gladCurrentContext->DrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+{
+    resolveLazily(299);
+    gladCurrentContext->DrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+{
+    resolveLazily(300);
+    gladCurrentContext->MultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY lazy_glProvokingVertex(GLenum mode)
+{
+    resolveLazily(301);
+    gladCurrentContext->ProvokingVertex(mode);
+}
+static GLsync APIENTRY lazy_glFenceSync(GLenum condition, GLbitfield flags)
+{
+    resolveLazily(302);
+    return gladCurrentContext->FenceSync(condition, flags);
+}
+static GLboolean APIENTRY lazy_glIsSync(GLsync sync)
+{
+    resolveLazily(303);
+    return gladCurrentContext->IsSync(sync);
+}
+static void APIENTRY lazy_glDeleteSync(GLsync sync)
+{
+    resolveLazily(304);
+    gladCurrentContext->DeleteSync(sync);
+}
+static GLenum APIENTRY lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    resolveLazily(305);
+    return gladCurrentContext->ClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    resolveLazily(306);
+    gladCurrentContext->WaitSync(sync, flags, timeout);
+}
+static void APIENTRY lazy_glGetInteger64v(GLenum pname, GLint64 *data)
+{
+    resolveLazily(307);
+    gladCurrentContext->GetInteger64v(pname, data);
+}
+static void APIENTRY lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
+{
+    resolveLazily(308);
+    gladCurrentContext->GetSynciv(sync, pname, count, length, values);
+}
+static void APIENTRY lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
+{
+    resolveLazily(309);
+    gladCurrentContext->GetInteger64i_v(target, index, data);
+}
+static void APIENTRY lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params)
+{
+    resolveLazily(310);
+    gladCurrentContext->GetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+    resolveLazily(311);
+    gladCurrentContext->FramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    resolveLazily(312);
+    gladCurrentContext->TexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    resolveLazily(313);
+    gladCurrentContext->TexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
+{
+    resolveLazily(314);
+    gladCurrentContext->GetMultisamplefv(pname, index, val);
+}
+static void APIENTRY lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask)
+{
+    resolveLazily(315);
+    gladCurrentContext->SampleMaski(maskNumber, mask);
+}
+static void APIENTRY lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+{
+    resolveLazily(316);
+    gladCurrentContext->BindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static GLint APIENTRY lazy_glGetFragDataIndex(GLuint program, const GLchar *name)
+{
+    resolveLazily(317);
+    return gladCurrentContext->GetFragDataIndex(program, name);
+}
+static void APIENTRY lazy_glGenSamplers(GLsizei count, GLuint *samplers)
+{
+    resolveLazily(318);
+    gladCurrentContext->GenSamplers(count, samplers);
+}
+static void APIENTRY lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers)
+{
+    resolveLazily(319);
+    gladCurrentContext->DeleteSamplers(count, samplers);
+}
+static GLboolean APIENTRY lazy_glIsSampler(GLuint sampler)
+{
+    resolveLazily(320);
+    return gladCurrentContext->IsSampler(sampler);
+}
+static void APIENTRY lazy_glBindSampler(GLuint unit, GLuint sampler)
+{
+    resolveLazily(321);
+    gladCurrentContext->BindSampler(unit, sampler);
+}
+static void APIENTRY lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+{
+    resolveLazily(322);
+    gladCurrentContext->SamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
+{
+    resolveLazily(323);
+    gladCurrentContext->SamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+{
+    resolveLazily(324);
+    gladCurrentContext->SamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
+{
+    resolveLazily(325);
+    gladCurrentContext->SamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param)
+{
+    resolveLazily(326);
+    gladCurrentContext->SamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param)
+{
+    resolveLazily(327);
+    gladCurrentContext->SamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
+{
+    resolveLazily(328);
+    gladCurrentContext->GetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
+{
+    resolveLazily(329);
+    gladCurrentContext->GetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
+{
+    resolveLazily(330);
+    gladCurrentContext->GetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
+{
+    resolveLazily(331);
+    gladCurrentContext->GetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY lazy_glQueryCounter(GLuint id, GLenum target)
+{
+    resolveLazily(332);
+    gladCurrentContext->QueryCounter(id, target);
+}
+static void APIENTRY lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
+{
+    resolveLazily(333);
+    gladCurrentContext->GetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+{
+    resolveLazily(334);
+    gladCurrentContext->GetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY lazy_glVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+    resolveLazily(335);
+    gladCurrentContext->VertexAttribDivisor(index, divisor);
+}
+static void APIENTRY lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    resolveLazily(336);
+    gladCurrentContext->VertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    resolveLazily(337);
+    gladCurrentContext->VertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    resolveLazily(338);
+    gladCurrentContext->VertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    resolveLazily(339);
+    gladCurrentContext->VertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    resolveLazily(340);
+    gladCurrentContext->VertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    resolveLazily(341);
+    gladCurrentContext->VertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    resolveLazily(342);
+    gladCurrentContext->VertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    resolveLazily(343);
+    gladCurrentContext->VertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexP2ui(GLenum type, GLuint value)
+{
+    resolveLazily(344);
+    gladCurrentContext->VertexP2ui(type, value);
+}
+static void APIENTRY lazy_glVertexP2uiv(GLenum type, const GLuint *value)
+{
+    resolveLazily(345);
+    gladCurrentContext->VertexP2uiv(type, value);
+}
+static void APIENTRY lazy_glVertexP3ui(GLenum type, GLuint value)
+{
+    resolveLazily(346);
+    gladCurrentContext->VertexP3ui(type, value);
+}
+static void APIENTRY lazy_glVertexP3uiv(GLenum type, const GLuint *value)
+{
+    resolveLazily(347);
+    gladCurrentContext->VertexP3uiv(type, value);
+}
+static void APIENTRY lazy_glVertexP4ui(GLenum type, GLuint value)
+{
+    resolveLazily(348);
+    gladCurrentContext->VertexP4ui(type, value);
+}
+static void APIENTRY lazy_glVertexP4uiv(GLenum type, const GLuint *value)
+{
+    resolveLazily(349);
+    gladCurrentContext->VertexP4uiv(type, value);
+}
+static void APIENTRY lazy_glTexCoordP1ui(GLenum type, GLuint coords)
+{
+    resolveLazily(350);
+    gladCurrentContext->TexCoordP1ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords)
+{
+    resolveLazily(351);
+    gladCurrentContext->TexCoordP1uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP2ui(GLenum type, GLuint coords)
+{
+    resolveLazily(352);
+    gladCurrentContext->TexCoordP2ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords)
+{
+    resolveLazily(353);
+    gladCurrentContext->TexCoordP2uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP3ui(GLenum type, GLuint coords)
+{
+    resolveLazily(354);
+    gladCurrentContext->TexCoordP3ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords)
+{
+    resolveLazily(355);
+    gladCurrentContext->TexCoordP3uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP4ui(GLenum type, GLuint coords)
+{
+    resolveLazily(356);
+    gladCurrentContext->TexCoordP4ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords)
+{
+    resolveLazily(357);
+    gladCurrentContext->TexCoordP4uiv(type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
+{
+    resolveLazily(358);
+    gladCurrentContext->MultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+    resolveLazily(359);
+    gladCurrentContext->MultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
+{
+    resolveLazily(360);
+    gladCurrentContext->MultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+    resolveLazily(361);
+    gladCurrentContext->MultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
+{
+    resolveLazily(362);
+    gladCurrentContext->MultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+    resolveLazily(363);
+    gladCurrentContext->MultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
+{
+    resolveLazily(364);
+    gladCurrentContext->MultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+    resolveLazily(365);
+    gladCurrentContext->MultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glNormalP3ui(GLenum type, GLuint coords)
+{
+    resolveLazily(366);
+    gladCurrentContext->NormalP3ui(type, coords);
+}
+static void APIENTRY lazy_glNormalP3uiv(GLenum type, const GLuint *coords)
+{
+    resolveLazily(367);
+    gladCurrentContext->NormalP3uiv(type, coords);
+}
+static void APIENTRY lazy_glColorP3ui(GLenum type, GLuint color)
+{
+    resolveLazily(368);
+    gladCurrentContext->ColorP3ui(type, color);
+}
+static void APIENTRY lazy_glColorP3uiv(GLenum type, const GLuint *color)
+{
+    resolveLazily(369);
+    gladCurrentContext->ColorP3uiv(type, color);
+}
+static void APIENTRY lazy_glColorP4ui(GLenum type, GLuint color)
+{
+    resolveLazily(370);
+    gladCurrentContext->ColorP4ui(type, color);
+}
+static void APIENTRY lazy_glColorP4uiv(GLenum type, const GLuint *color)
+{
+    resolveLazily(371);
+    gladCurrentContext->ColorP4uiv(type, color);
+}
+static void APIENTRY lazy_glSecondaryColorP3ui(GLenum type, GLuint color)
+{
+    resolveLazily(372);
+    gladCurrentContext->SecondaryColorP3ui(type, color);
+}
+static void APIENTRY lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color)
+{
+    resolveLazily(373);
+    gladCurrentContext->SecondaryColorP3uiv(type, color);
+}
+static void APIENTRY lazy_glMinSampleShading(GLfloat value)
+{
+    resolveLazily(374);
+    gladCurrentContext->MinSampleShading(value);
+}
+static void APIENTRY lazy_glBlendEquationi(GLuint buf, GLenum mode)
+{
+    resolveLazily(375);
+    gladCurrentContext->BlendEquationi(buf, mode);
+}
+static void APIENTRY lazy_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    resolveLazily(376);
+    gladCurrentContext->BlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+static void APIENTRY lazy_glBlendFunci(GLuint buf, GLenum src, GLenum dst)
+{
+    resolveLazily(377);
+    gladCurrentContext->BlendFunci(buf, src, dst);
+}
+static void APIENTRY lazy_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    resolveLazily(378);
+    gladCurrentContext->BlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+static void APIENTRY lazy_glDrawArraysIndirect(GLenum mode, const void *indirect)
+{
+    resolveLazily(379);
+    gladCurrentContext->DrawArraysIndirect(mode, indirect);
+}
+static void APIENTRY lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect)
+{
+    resolveLazily(380);
+    gladCurrentContext->DrawElementsIndirect(mode, type, indirect);
+}
+static void APIENTRY lazy_glUniform1d(GLint location, GLdouble x)
+{
+    resolveLazily(381);
+    gladCurrentContext->Uniform1d(location, x);
+}
+static void APIENTRY lazy_glUniform2d(GLint location, GLdouble x, GLdouble y)
+{
+    resolveLazily(382);
+    gladCurrentContext->Uniform2d(location, x, y);
+}
+static void APIENTRY lazy_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+    resolveLazily(383);
+    gladCurrentContext->Uniform3d(location, x, y, z);
+}
+static void APIENTRY lazy_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    resolveLazily(384);
+    gladCurrentContext->Uniform4d(location, x, y, z, w);
+}
+static void APIENTRY lazy_glUniform1dv(GLint location, GLsizei count, const GLdouble *value)
+{
+    resolveLazily(385);
+    gladCurrentContext->Uniform1dv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2dv(GLint location, GLsizei count, const GLdouble *value)
+{
+    resolveLazily(386);
+    gladCurrentContext->Uniform2dv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3dv(GLint location, GLsizei count, const GLdouble *value)
+{
+    resolveLazily(387);
+    gladCurrentContext->Uniform3dv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4dv(GLint location, GLsizei count, const GLdouble *value)
+{
+    resolveLazily(388);
+    gladCurrentContext->Uniform4dv(location, count, value);
+}
+static void APIENTRY lazy_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(389);
+    gladCurrentContext->UniformMatrix2dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(390);
+    gladCurrentContext->UniformMatrix3dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(391);
+    gladCurrentContext->UniformMatrix4dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(392);
+    gladCurrentContext->UniformMatrix2x3dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(393);
+    gladCurrentContext->UniformMatrix2x4dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(394);
+    gladCurrentContext->UniformMatrix3x2dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(395);
+    gladCurrentContext->UniformMatrix3x4dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(396);
+    gladCurrentContext->UniformMatrix4x2dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(397);
+    gladCurrentContext->UniformMatrix4x3dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glGetUniformdv(GLuint program, GLint location, GLdouble *params)
+{
+    resolveLazily(398);
+    gladCurrentContext->GetUniformdv(program, location, params);
+}
+static GLint APIENTRY lazy_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name)
+{
+    resolveLazily(399);
+    return gladCurrentContext->GetSubroutineUniformLocation(program, shadertype, name);
+}
+static GLuint APIENTRY lazy_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name)
+{
+    resolveLazily(400);
+    return gladCurrentContext->GetSubroutineIndex(program, shadertype, name);
+}
+static void APIENTRY lazy_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values)
+{
+    resolveLazily(401);
+    gladCurrentContext->GetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+static void APIENTRY lazy_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+    resolveLazily(402);
+    gladCurrentContext->GetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY lazy_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+    resolveLazily(403);
+    gladCurrentContext->GetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY lazy_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices)
+{
+    resolveLazily(404);
+    gladCurrentContext->UniformSubroutinesuiv(shadertype, count, indices);
+}
+static void APIENTRY lazy_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params)
+{
+    resolveLazily(405);
+    gladCurrentContext->GetUniformSubroutineuiv(shadertype, location, params);
+}
+static void APIENTRY lazy_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values)
+{
+    resolveLazily(406);
+    gladCurrentContext->GetProgramStageiv(program, shadertype, pname, values);
+}
+static void APIENTRY lazy_glPatchParameteri(GLenum pname, GLint value)
+{
+    resolveLazily(407);
+    gladCurrentContext->PatchParameteri(pname, value);
+}
+static void APIENTRY lazy_glPatchParameterfv(GLenum pname, const GLfloat *values)
+{
+    resolveLazily(408);
+    gladCurrentContext->PatchParameterfv(pname, values);
+}
+static void APIENTRY lazy_glBindTransformFeedback(GLenum target, GLuint id)
+{
+    resolveLazily(409);
+    gladCurrentContext->BindTransformFeedback(target, id);
+}
+static void APIENTRY lazy_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
+{
+    resolveLazily(410);
+    gladCurrentContext->DeleteTransformFeedbacks(n, ids);
+}
+static void APIENTRY lazy_glGenTransformFeedbacks(GLsizei n, GLuint *ids)
+{
+    resolveLazily(411);
+    gladCurrentContext->GenTransformFeedbacks(n, ids);
+}
+static GLboolean APIENTRY lazy_glIsTransformFeedback(GLuint id)
+{
+    resolveLazily(412);
+    return gladCurrentContext->IsTransformFeedback(id);
+}
+static void APIENTRY lazy_glPauseTransformFeedback(void)
+{
+    resolveLazily(413);
+    gladCurrentContext->PauseTransformFeedback();
+}
+static void APIENTRY lazy_glResumeTransformFeedback(void)
+{
+    resolveLazily(414);
+    gladCurrentContext->ResumeTransformFeedback();
+}
+static void APIENTRY lazy_glDrawTransformFeedback(GLenum mode, GLuint id)
+{
+    resolveLazily(415);
+    gladCurrentContext->DrawTransformFeedback(mode, id);
+}
+static void APIENTRY lazy_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
+{
+    resolveLazily(416);
+    gladCurrentContext->DrawTransformFeedbackStream(mode, id, stream);
+}
+static void APIENTRY lazy_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id)
+{
+    resolveLazily(417);
+    gladCurrentContext->BeginQueryIndexed(target, index, id);
+}
+static void APIENTRY lazy_glEndQueryIndexed(GLenum target, GLuint index)
+{
+    resolveLazily(418);
+    gladCurrentContext->EndQueryIndexed(target, index);
+}
+static void APIENTRY lazy_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params)
+{
+    resolveLazily(419);
+    gladCurrentContext->GetQueryIndexediv(target, index, pname, params);
+}
+static void APIENTRY lazy_glReleaseShaderCompiler(void)
+{
+    resolveLazily(420);
+    gladCurrentContext->ReleaseShaderCompiler();
+}
+static void APIENTRY lazy_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+    resolveLazily(421);
+    gladCurrentContext->ShaderBinary(count, shaders, binaryFormat, binary, length);
+}
+static void APIENTRY lazy_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
+{
+    resolveLazily(422);
+    gladCurrentContext->GetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+static void APIENTRY lazy_glDepthRangef(GLfloat n, GLfloat f)
+{
+    resolveLazily(423);
+    gladCurrentContext->DepthRangef(n, f);
+}
+static void APIENTRY lazy_glClearDepthf(GLfloat d)
+{
+    resolveLazily(424);
+    gladCurrentContext->ClearDepthf(d);
+}
+static void APIENTRY lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+    resolveLazily(425);
+    gladCurrentContext->GetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+    resolveLazily(426);
+    gladCurrentContext->ProgramBinary(program, binaryFormat, binary, length);
+}
+static void APIENTRY lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+    resolveLazily(427);
+    gladCurrentContext->ProgramParameteri(program, pname, value);
+}
+static void APIENTRY lazy_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
+{
+    resolveLazily(428);
+    gladCurrentContext->UseProgramStages(pipeline, stages, program);
+}
+static void APIENTRY lazy_glActiveShaderProgram(GLuint pipeline, GLuint program)
+{
+    resolveLazily(429);
+    gladCurrentContext->ActiveShaderProgram(pipeline, program);
+}
+static GLuint APIENTRY lazy_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings)
+{
+    resolveLazily(430);
+    return gladCurrentContext->CreateShaderProgramv(type, count, strings);
+}
+static void APIENTRY lazy_glBindProgramPipeline(GLuint pipeline)
+{
+    resolveLazily(431);
+    gladCurrentContext->BindProgramPipeline(pipeline);
+}
+static void APIENTRY lazy_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
+{
+    resolveLazily(432);
+    gladCurrentContext->DeleteProgramPipelines(n, pipelines);
+}
+static void APIENTRY lazy_glGenProgramPipelines(GLsizei n, GLuint *pipelines)
+{
+    resolveLazily(433);
+    gladCurrentContext->GenProgramPipelines(n, pipelines);
+}
+static GLboolean APIENTRY lazy_glIsProgramPipeline(GLuint pipeline)
+{
+    resolveLazily(434);
+    return gladCurrentContext->IsProgramPipeline(pipeline);
+}
+static void APIENTRY lazy_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params)
+{
+    resolveLazily(435);
+    gladCurrentContext->GetProgramPipelineiv(pipeline, pname, params);
+}
+static void APIENTRY lazy_glProgramUniform1i(GLuint program, GLint location, GLint v0)
+{
+    resolveLazily(436);
+    gladCurrentContext->ProgramUniform1i(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    resolveLazily(437);
+    gladCurrentContext->ProgramUniform1iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform1f(GLuint program, GLint location, GLfloat v0)
+{
+    resolveLazily(438);
+    gladCurrentContext->ProgramUniform1f(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    resolveLazily(439);
+    gladCurrentContext->ProgramUniform1fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform1d(GLuint program, GLint location, GLdouble v0)
+{
+    resolveLazily(440);
+    gladCurrentContext->ProgramUniform1d(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    resolveLazily(441);
+    gladCurrentContext->ProgramUniform1dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform1ui(GLuint program, GLint location, GLuint v0)
+{
+    resolveLazily(442);
+    gladCurrentContext->ProgramUniform1ui(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    resolveLazily(443);
+    gladCurrentContext->ProgramUniform1uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
+{
+    resolveLazily(444);
+    gladCurrentContext->ProgramUniform2i(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    resolveLazily(445);
+    gladCurrentContext->ProgramUniform2iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+    resolveLazily(446);
+    gladCurrentContext->ProgramUniform2f(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    resolveLazily(447);
+    gladCurrentContext->ProgramUniform2fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1)
+{
+    resolveLazily(448);
+    gladCurrentContext->ProgramUniform2d(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    resolveLazily(449);
+    gladCurrentContext->ProgramUniform2dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+    resolveLazily(450);
+    gladCurrentContext->ProgramUniform2ui(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    resolveLazily(451);
+    gladCurrentContext->ProgramUniform2uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    resolveLazily(452);
+    gladCurrentContext->ProgramUniform3i(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    resolveLazily(453);
+    gladCurrentContext->ProgramUniform3iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    resolveLazily(454);
+    gladCurrentContext->ProgramUniform3f(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    resolveLazily(455);
+    gladCurrentContext->ProgramUniform3fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+    resolveLazily(456);
+    gladCurrentContext->ProgramUniform3d(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    resolveLazily(457);
+    gladCurrentContext->ProgramUniform3dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    resolveLazily(458);
+    gladCurrentContext->ProgramUniform3ui(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    resolveLazily(459);
+    gladCurrentContext->ProgramUniform3uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    resolveLazily(460);
+    gladCurrentContext->ProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    resolveLazily(461);
+    gladCurrentContext->ProgramUniform4iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    resolveLazily(462);
+    gladCurrentContext->ProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    resolveLazily(463);
+    gladCurrentContext->ProgramUniform4fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+{
+    resolveLazily(464);
+    gladCurrentContext->ProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    resolveLazily(465);
+    gladCurrentContext->ProgramUniform4dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    resolveLazily(466);
+    gladCurrentContext->ProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    resolveLazily(467);
+    gladCurrentContext->ProgramUniform4uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(468);
+    gladCurrentContext->ProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(469);
+    gladCurrentContext->ProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(470);
+    gladCurrentContext->ProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(471);
+    gladCurrentContext->ProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(472);
+    gladCurrentContext->ProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(473);
+    gladCurrentContext->ProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(474);
+    gladCurrentContext->ProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(475);
+    gladCurrentContext->ProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(476);
+    gladCurrentContext->ProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(477);
+    gladCurrentContext->ProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(478);
+    gladCurrentContext->ProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    resolveLazily(479);
+    gladCurrentContext->ProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(480);
+    gladCurrentContext->ProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(481);
+    gladCurrentContext->ProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(482);
+    gladCurrentContext->ProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(483);
+    gladCurrentContext->ProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(484);
+    gladCurrentContext->ProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    resolveLazily(485);
+    gladCurrentContext->ProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glValidateProgramPipeline(GLuint pipeline)
+{
+    resolveLazily(486);
+    gladCurrentContext->ValidateProgramPipeline(pipeline);
+}
+static void APIENTRY lazy_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    resolveLazily(487);
+    gladCurrentContext->GetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+static void APIENTRY lazy_glVertexAttribL1d(GLuint index, GLdouble x)
+{
+    resolveLazily(488);
+    gladCurrentContext->VertexAttribL1d(index, x);
+}
+static void APIENTRY lazy_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
+{
+    resolveLazily(489);
+    gladCurrentContext->VertexAttribL2d(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    resolveLazily(490);
+    gladCurrentContext->VertexAttribL3d(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    resolveLazily(491);
+    gladCurrentContext->VertexAttribL4d(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttribL1dv(GLuint index, const GLdouble *v)
+{
+    resolveLazily(492);
+    gladCurrentContext->VertexAttribL1dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribL2dv(GLuint index, const GLdouble *v)
+{
+    resolveLazily(493);
+    gladCurrentContext->VertexAttribL2dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribL3dv(GLuint index, const GLdouble *v)
+{
+    resolveLazily(494);
+    gladCurrentContext->VertexAttribL3dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribL4dv(GLuint index, const GLdouble *v)
+{
+    resolveLazily(495);
+    gladCurrentContext->VertexAttribL4dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    resolveLazily(496);
+    gladCurrentContext->VertexAttribLPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY lazy_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params)
+{
+    resolveLazily(497);
+    gladCurrentContext->GetVertexAttribLdv(index, pname, params);
+}
+static void APIENTRY lazy_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v)
+{
+    resolveLazily(498);
+    gladCurrentContext->ViewportArrayv(first, count, v);
+}
+static void APIENTRY lazy_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+    resolveLazily(499);
+    gladCurrentContext->ViewportIndexedf(index, x, y, w, h);
+}
+static void APIENTRY lazy_glViewportIndexedfv(GLuint index, const GLfloat *v)
+{
+    resolveLazily(500);
+    gladCurrentContext->ViewportIndexedfv(index, v);
+}
+static void APIENTRY lazy_glScissorArrayv(GLuint first, GLsizei count, const GLint *v)
+{
+    resolveLazily(501);
+    gladCurrentContext->ScissorArrayv(first, count, v);
+}
+static void APIENTRY lazy_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+    resolveLazily(502);
+    gladCurrentContext->ScissorIndexed(index, left, bottom, width, height);
+}
+static void APIENTRY lazy_glScissorIndexedv(GLuint index, const GLint *v)
+{
+    resolveLazily(503);
+    gladCurrentContext->ScissorIndexedv(index, v);
+}
+static void APIENTRY lazy_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v)
+{
+    resolveLazily(504);
+    gladCurrentContext->DepthRangeArrayv(first, count, v);
+}
+static void APIENTRY lazy_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
+{
+    resolveLazily(505);
+    gladCurrentContext->DepthRangeIndexed(index, n, f);
+}
+static void APIENTRY lazy_glGetFloati_v(GLenum target, GLuint index, GLfloat *data)
+{
+    resolveLazily(506);
+    gladCurrentContext->GetFloati_v(target, index, data);
+}
+static void APIENTRY lazy_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data)
+{
+    resolveLazily(507);
+    gladCurrentContext->GetDoublei_v(target, index, data);
+}
+static void APIENTRY lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+    resolveLazily(508);
+    gladCurrentContext->DrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+static void APIENTRY lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+{
+    resolveLazily(509);
+    gladCurrentContext->DrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+static void APIENTRY lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+{
+    resolveLazily(510);
+    gladCurrentContext->DrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+static void APIENTRY lazy_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params)
+{
+    resolveLazily(511);
+    gladCurrentContext->GetInternalformativ(target, internalformat, pname, count, params);
+}
+static void APIENTRY lazy_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params)
+{
+    resolveLazily(512);
+    gladCurrentContext->GetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+static void APIENTRY lazy_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+    resolveLazily(513);
+    gladCurrentContext->BindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+static void APIENTRY lazy_glMemoryBarrier(GLbitfield barriers)
+{
+    resolveLazily(514);
+    gladCurrentContext->MemoryBarrier(barriers);
+}
+static void APIENTRY lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    resolveLazily(515);
+    gladCurrentContext->TexStorage1D(target, levels, internalformat, width);
+}
+static void APIENTRY lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    resolveLazily(516);
+    gladCurrentContext->TexStorage2D(target, levels, internalformat, width, height);
+}
+static void APIENTRY lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    resolveLazily(517);
+    gladCurrentContext->TexStorage3D(target, levels, internalformat, width, height, depth);
+}
+static void APIENTRY lazy_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount)
+{
+    resolveLazily(518);
+    gladCurrentContext->DrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+static void APIENTRY lazy_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+{
+    resolveLazily(519);
+    gladCurrentContext->DrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+static void APIENTRY lazy_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    resolveLazily(520);
+    gladCurrentContext->ClearBufferData(target, internalformat, format, type, data);
+}
+static void APIENTRY lazy_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    resolveLazily(521);
+    gladCurrentContext->ClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+static void APIENTRY lazy_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+    resolveLazily(522);
+    gladCurrentContext->DispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+static void APIENTRY lazy_glDispatchComputeIndirect(GLintptr indirect)
+{
+    resolveLazily(523);
+    gladCurrentContext->DispatchComputeIndirect(indirect);
+}
+static void APIENTRY lazy_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+    resolveLazily(524);
+    gladCurrentContext->CopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+static void APIENTRY lazy_glFramebufferParameteri(GLenum target, GLenum pname, GLint param)
+{
+    resolveLazily(525);
+    gladCurrentContext->FramebufferParameteri(target, pname, param);
+}
+static void APIENTRY lazy_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+    resolveLazily(526);
+    gladCurrentContext->GetFramebufferParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params)
+{
+    resolveLazily(527);
+    gladCurrentContext->GetInternalformati64v(target, internalformat, pname, count, params);
+}
+static void APIENTRY lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+    resolveLazily(528);
+    gladCurrentContext->InvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+static void APIENTRY lazy_glInvalidateTexImage(GLuint texture, GLint level)
+{
+    resolveLazily(529);
+    gladCurrentContext->InvalidateTexImage(texture, level);
+}
+static void APIENTRY lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    resolveLazily(530);
+    gladCurrentContext->InvalidateBufferSubData(buffer, offset, length);
+}
+static void APIENTRY lazy_glInvalidateBufferData(GLuint buffer)
+{
+    resolveLazily(531);
+    gladCurrentContext->InvalidateBufferData(buffer);
+}
+static void APIENTRY lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments)
+{
+    resolveLazily(532);
+    gladCurrentContext->InvalidateFramebuffer(target, numAttachments, attachments);
+}
+static void APIENTRY lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    resolveLazily(533);
+    gladCurrentContext->InvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    resolveLazily(534);
+    gladCurrentContext->MultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+static void APIENTRY lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    resolveLazily(535);
+    gladCurrentContext->MultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY lazy_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params)
+{
+    resolveLazily(536);
+    gladCurrentContext->GetProgramInterfaceiv(program, programInterface, pname, params);
+}
+static GLuint APIENTRY lazy_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name)
+{
+    resolveLazily(537);
+    return gladCurrentContext->GetProgramResourceIndex(program, programInterface, name);
+}
+static void APIENTRY lazy_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+    resolveLazily(538);
+    gladCurrentContext->GetProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+static void APIENTRY lazy_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params)
+{
+    resolveLazily(539);
+    gladCurrentContext->GetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+}
+static GLint APIENTRY lazy_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name)
+{
+    resolveLazily(540);
+    return gladCurrentContext->GetProgramResourceLocation(program, programInterface, name);
+}
+static GLint APIENTRY lazy_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name)
+{
+    resolveLazily(541);
+    return gladCurrentContext->GetProgramResourceLocationIndex(program, programInterface, name);
+}
+static void APIENTRY lazy_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+    resolveLazily(542);
+    gladCurrentContext->ShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+static void APIENTRY lazy_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    resolveLazily(543);
+    gladCurrentContext->TexBufferRange(target, internalformat, buffer, offset, size);
+}
+static void APIENTRY lazy_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    resolveLazily(544);
+    gladCurrentContext->TexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    resolveLazily(545);
+    gladCurrentContext->TexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+    resolveLazily(546);
+    gladCurrentContext->TextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+static void APIENTRY lazy_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    resolveLazily(547);
+    gladCurrentContext->BindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+static void APIENTRY lazy_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    resolveLazily(548);
+    gladCurrentContext->VertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY lazy_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    resolveLazily(549);
+    gladCurrentContext->VertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY lazy_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    resolveLazily(550);
+    gladCurrentContext->VertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY lazy_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex)
+{
+    resolveLazily(551);
+    gladCurrentContext->VertexAttribBinding(attribindex, bindingindex);
+}
+static void APIENTRY lazy_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor)
+{
+    resolveLazily(552);
+    gladCurrentContext->VertexBindingDivisor(bindingindex, divisor);
+}
+static void APIENTRY lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+    resolveLazily(553);
+    gladCurrentContext->DebugMessageControl(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+    resolveLazily(554);
+    gladCurrentContext->DebugMessageInsert(source, type, id, severity, length, buf);
+}
+static void APIENTRY lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam)
+{
+    resolveLazily(555);
+    gladCurrentContext->DebugMessageCallback(callback, userParam);
+}
+static GLuint APIENTRY lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    resolveLazily(556);
+    return gladCurrentContext->GetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+static void APIENTRY lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message)
+{
+    resolveLazily(557);
+    gladCurrentContext->PushDebugGroup(source, id, length, message);
+}
+static void APIENTRY lazy_glPopDebugGroup(void)
+{
+    resolveLazily(558);
+    gladCurrentContext->PopDebugGroup();
+}
+static void APIENTRY lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+{
+    resolveLazily(559);
+    gladCurrentContext->ObjectLabel(identifier, name, length, label);
+}
+static void APIENTRY lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    resolveLazily(560);
+    gladCurrentContext->GetObjectLabel(identifier, name, bufSize, length, label);
+}
+static void APIENTRY lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label)
+{
+    resolveLazily(561);
+    gladCurrentContext->ObjectPtrLabel(ptr, length, label);
+}
+static void APIENTRY lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    resolveLazily(562);
+    gladCurrentContext->GetObjectPtrLabel(ptr, bufSize, length, label);
+}
+static void APIENTRY lazy_glGetPointerv(GLenum pname, void **params)
+{
+    resolveLazily(563);
+    gladCurrentContext->GetPointerv(pname, params);
+}
+static void APIENTRY lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    resolveLazily(564);
+    gladCurrentContext->BufferStorage(target, size, data, flags);
+}
+static void APIENTRY lazy_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
+{
+    resolveLazily(565);
+    gladCurrentContext->ClearTexImage(texture, level, format, type, data);
+}
+static void APIENTRY lazy_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data)
+{
+    resolveLazily(566);
+    gladCurrentContext->ClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+static void APIENTRY lazy_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
+{
+    resolveLazily(567);
+    gladCurrentContext->BindBuffersBase(target, first, count, buffers);
+}
+static void APIENTRY lazy_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes)
+{
+    resolveLazily(568);
+    gladCurrentContext->BindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+static void APIENTRY lazy_glBindTextures(GLuint first, GLsizei count, const GLuint *textures)
+{
+    resolveLazily(569);
+    gladCurrentContext->BindTextures(first, count, textures);
+}
+static void APIENTRY lazy_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers)
+{
+    resolveLazily(570);
+    gladCurrentContext->BindSamplers(first, count, samplers);
+}
+static void APIENTRY lazy_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures)
+{
+    resolveLazily(571);
+    gladCurrentContext->BindImageTextures(first, count, textures);
+}
+static void APIENTRY lazy_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    resolveLazily(572);
+    gladCurrentContext->BindVertexBuffers(first, count, buffers, offsets, strides);
+}
+static void APIENTRY lazy_glClipControl(GLenum origin, GLenum depth)
+{
+    resolveLazily(573);
+    gladCurrentContext->ClipControl(origin, depth);
+}
+static void APIENTRY lazy_glCreateTransformFeedbacks(GLsizei n, GLuint *ids)
+{
+    resolveLazily(574);
+    gladCurrentContext->CreateTransformFeedbacks(n, ids);
+}
+static void APIENTRY lazy_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer)
+{
+    resolveLazily(575);
+    gladCurrentContext->TransformFeedbackBufferBase(xfb, index, buffer);
+}
+static void APIENTRY lazy_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    resolveLazily(576);
+    gladCurrentContext->TransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+static void APIENTRY lazy_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param)
+{
+    resolveLazily(577);
+    gladCurrentContext->GetTransformFeedbackiv(xfb, pname, param);
+}
+static void APIENTRY lazy_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param)
+{
+    resolveLazily(578);
+    gladCurrentContext->GetTransformFeedbacki_v(xfb, pname, index, param);
+}
+static void APIENTRY lazy_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param)
+{
+    resolveLazily(579);
+    gladCurrentContext->GetTransformFeedbacki64_v(xfb, pname, index, param);
+}
+static void APIENTRY lazy_glCreateBuffers(GLsizei n, GLuint *buffers)
+{
+    resolveLazily(580);
+    gladCurrentContext->CreateBuffers(n, buffers);
+}
+static void APIENTRY lazy_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    resolveLazily(581);
+    gladCurrentContext->NamedBufferStorage(buffer, size, data, flags);
+}
+static void APIENTRY lazy_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
+{
+    resolveLazily(582);
+    gladCurrentContext->NamedBufferData(buffer, size, data, usage);
+}
+static void APIENTRY lazy_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    resolveLazily(583);
+    gladCurrentContext->NamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY lazy_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    resolveLazily(584);
+    gladCurrentContext->CopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+static void APIENTRY lazy_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    resolveLazily(585);
+    gladCurrentContext->ClearNamedBufferData(buffer, internalformat, format, type, data);
+}
+static void APIENTRY lazy_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    resolveLazily(586);
+    gladCurrentContext->ClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+static void * APIENTRY lazy_glMapNamedBuffer(GLuint buffer, GLenum access)
+{
+    resolveLazily(587);
+    return gladCurrentContext->MapNamedBuffer(buffer, access);
+}
+static void * APIENTRY lazy_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    resolveLazily(588);
+    return gladCurrentContext->MapNamedBufferRange(buffer, offset, length, access);
+}
+static GLboolean APIENTRY lazy_glUnmapNamedBuffer(GLuint buffer)
+{
+    resolveLazily(589);
+    return gladCurrentContext->UnmapNamedBuffer(buffer);
+}
+static void APIENTRY lazy_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    resolveLazily(590);
+    gladCurrentContext->FlushMappedNamedBufferRange(buffer, offset, length);
+}
+static void APIENTRY lazy_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params)
+{
+    resolveLazily(591);
+    gladCurrentContext->GetNamedBufferParameteriv(buffer, pname, params);
+}
+static void APIENTRY lazy_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params)
+{
+    resolveLazily(592);
+    gladCurrentContext->GetNamedBufferParameteri64v(buffer, pname, params);
+}
+static void APIENTRY lazy_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params)
+{
+    resolveLazily(593);
+    gladCurrentContext->GetNamedBufferPointerv(buffer, pname, params);
+}
+static void APIENTRY lazy_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data)
+{
+    resolveLazily(594);
+    gladCurrentContext->GetNamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY lazy_glCreateFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+    resolveLazily(595);
+    gladCurrentContext->CreateFramebuffers(n, framebuffers);
+}
+static void APIENTRY lazy_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    resolveLazily(596);
+    gladCurrentContext->NamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY lazy_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param)
+{
+    resolveLazily(597);
+    gladCurrentContext->NamedFramebufferParameteri(framebuffer, pname, param);
+}
+static void APIENTRY lazy_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+    resolveLazily(598);
+    gladCurrentContext->NamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+static void APIENTRY lazy_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    resolveLazily(599);
+    gladCurrentContext->NamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+static void APIENTRY lazy_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
+{
+    resolveLazily(600);
+    gladCurrentContext->NamedFramebufferDrawBuffer(framebuffer, buf);
+}
+static void APIENTRY lazy_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs)
+{
+    resolveLazily(601);
+    gladCurrentContext->NamedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+static void APIENTRY lazy_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
+{
+    resolveLazily(602);
+    gladCurrentContext->NamedFramebufferReadBuffer(framebuffer, src);
+}
+static void APIENTRY lazy_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments)
+{
+    resolveLazily(603);
+    gladCurrentContext->InvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+static void APIENTRY lazy_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    resolveLazily(604);
+    gladCurrentContext->InvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY lazy_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    resolveLazily(605);
+    gladCurrentContext->ClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    resolveLazily(606);
+    gladCurrentContext->ClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    resolveLazily(607);
+    gladCurrentContext->ClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    resolveLazily(608);
+    gladCurrentContext->ClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+static void APIENTRY lazy_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    resolveLazily(609);
+    gladCurrentContext->BlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static GLenum APIENTRY lazy_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target)
+{
+    resolveLazily(610);
+    return gladCurrentContext->CheckNamedFramebufferStatus(framebuffer, target);
+}
+static void APIENTRY lazy_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param)
+{
+    resolveLazily(611);
+    gladCurrentContext->GetNamedFramebufferParameteriv(framebuffer, pname, param);
+}
+static void APIENTRY lazy_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params)
+{
+    resolveLazily(612);
+    gladCurrentContext->GetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+}
+static void APIENTRY lazy_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+    resolveLazily(613);
+    gladCurrentContext->CreateRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY lazy_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    resolveLazily(614);
+    gladCurrentContext->NamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+static void APIENTRY lazy_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    resolveLazily(615);
+    gladCurrentContext->NamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+static void APIENTRY lazy_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params)
+{
+    resolveLazily(616);
+    gladCurrentContext->GetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+}
+static void APIENTRY lazy_glCreateTextures(GLenum target, GLsizei n, GLuint *textures)
+{
+    resolveLazily(617);
+    gladCurrentContext->CreateTextures(target, n, textures);
+}
+static void APIENTRY lazy_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer)
+{
+    resolveLazily(618);
+    gladCurrentContext->TextureBuffer(texture, internalformat, buffer);
+}
+static void APIENTRY lazy_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    resolveLazily(619);
+    gladCurrentContext->TextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+static void APIENTRY lazy_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    resolveLazily(620);
+    gladCurrentContext->TextureStorage1D(texture, levels, internalformat, width);
+}
+static void APIENTRY lazy_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    resolveLazily(621);
+    gladCurrentContext->TextureStorage2D(texture, levels, internalformat, width, height);
+}
+static void APIENTRY lazy_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    resolveLazily(622);
+    gladCurrentContext->TextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+static void APIENTRY lazy_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    resolveLazily(623);
+    gladCurrentContext->TextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    resolveLazily(624);
+    gladCurrentContext->TextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    resolveLazily(625);
+    gladCurrentContext->TextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY lazy_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    resolveLazily(626);
+    gladCurrentContext->TextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY lazy_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    resolveLazily(627);
+    gladCurrentContext->TextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY lazy_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    resolveLazily(628);
+    gladCurrentContext->CompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    resolveLazily(629);
+    gladCurrentContext->CompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    resolveLazily(630);
+    gladCurrentContext->CompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY lazy_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    resolveLazily(631);
+    gladCurrentContext->CopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+static void APIENTRY lazy_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    resolveLazily(632);
+    gladCurrentContext->CopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY lazy_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    resolveLazily(633);
+    gladCurrentContext->CopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY lazy_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param)
+{
+    resolveLazily(634);
+    gladCurrentContext->TextureParameterf(texture, pname, param);
+}
+static void APIENTRY lazy_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param)
+{
+    resolveLazily(635);
+    gladCurrentContext->TextureParameterfv(texture, pname, param);
+}
+static void APIENTRY lazy_glTextureParameteri(GLuint texture, GLenum pname, GLint param)
+{
+    resolveLazily(636);
+    gladCurrentContext->TextureParameteri(texture, pname, param);
+}
+static void APIENTRY lazy_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params)
+{
+    resolveLazily(637);
+    gladCurrentContext->TextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY lazy_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params)
+{
+    resolveLazily(638);
+    gladCurrentContext->TextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY lazy_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param)
+{
+    resolveLazily(639);
+    gladCurrentContext->TextureParameteriv(texture, pname, param);
+}
+static void APIENTRY lazy_glGenerateTextureMipmap(GLuint texture)
+{
+    resolveLazily(640);
+    gladCurrentContext->GenerateTextureMipmap(texture);
+}
+static void APIENTRY lazy_glBindTextureUnit(GLuint unit, GLuint texture)
+{
+    resolveLazily(641);
+    gladCurrentContext->BindTextureUnit(unit, texture);
+}
+static void APIENTRY lazy_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    resolveLazily(642);
+    gladCurrentContext->GetTextureImage(texture, level, format, type, bufSize, pixels);
+}
+static void APIENTRY lazy_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels)
+{
+    resolveLazily(643);
+    gladCurrentContext->GetCompressedTextureImage(texture, level, bufSize, pixels);
+}
+static void APIENTRY lazy_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params)
+{
+    resolveLazily(644);
+    gladCurrentContext->GetTextureLevelParameterfv(texture, level, pname, params);
+}
+static void APIENTRY lazy_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params)
+{
+    resolveLazily(645);
+    gladCurrentContext->GetTextureLevelParameteriv(texture, level, pname, params);
+}
+static void APIENTRY lazy_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params)
+{
+    resolveLazily(646);
+    gladCurrentContext->GetTextureParameterfv(texture, pname, params);
+}
+static void APIENTRY lazy_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params)
+{
+    resolveLazily(647);
+    gladCurrentContext->GetTextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY lazy_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params)
+{
+    resolveLazily(648);
+    gladCurrentContext->GetTextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY lazy_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params)
+{
+    resolveLazily(649);
+    gladCurrentContext->GetTextureParameteriv(texture, pname, params);
+}
+static void APIENTRY lazy_glCreateVertexArrays(GLsizei n, GLuint *arrays)
+{
+    resolveLazily(650);
+    gladCurrentContext->CreateVertexArrays(n, arrays);
+}
+static void APIENTRY lazy_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index)
+{
+    resolveLazily(651);
+    gladCurrentContext->DisableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY lazy_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index)
+{
+    resolveLazily(652);
+    gladCurrentContext->EnableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY lazy_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
+{
+    resolveLazily(653);
+    gladCurrentContext->VertexArrayElementBuffer(vaobj, buffer);
+}
+static void APIENTRY lazy_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    resolveLazily(654);
+    gladCurrentContext->VertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+static void APIENTRY lazy_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    resolveLazily(655);
+    gladCurrentContext->VertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+static void APIENTRY lazy_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+    resolveLazily(656);
+    gladCurrentContext->VertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+static void APIENTRY lazy_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    resolveLazily(657);
+    gladCurrentContext->VertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY lazy_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    resolveLazily(658);
+    gladCurrentContext->VertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY lazy_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    resolveLazily(659);
+    gladCurrentContext->VertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY lazy_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+    resolveLazily(660);
+    gladCurrentContext->VertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+static void APIENTRY lazy_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param)
+{
+    resolveLazily(661);
+    gladCurrentContext->GetVertexArrayiv(vaobj, pname, param);
+}
+static void APIENTRY lazy_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param)
+{
+    resolveLazily(662);
+    gladCurrentContext->GetVertexArrayIndexediv(vaobj, index, pname, param);
+}
+static void APIENTRY lazy_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param)
+{
+    resolveLazily(663);
+    gladCurrentContext->GetVertexArrayIndexed64iv(vaobj, index, pname, param);
+}
+static void APIENTRY lazy_glCreateSamplers(GLsizei n, GLuint *samplers)
+{
+    resolveLazily(664);
+    gladCurrentContext->CreateSamplers(n, samplers);
+}
+static void APIENTRY lazy_glCreateProgramPipelines(GLsizei n, GLuint *pipelines)
+{
+    resolveLazily(665);
+    gladCurrentContext->CreateProgramPipelines(n, pipelines);
+}
+static void APIENTRY lazy_glCreateQueries(GLenum target, GLsizei n, GLuint *ids)
+{
+    resolveLazily(666);
+    gladCurrentContext->CreateQueries(target, n, ids);
+}
+static void APIENTRY lazy_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    resolveLazily(667);
+    gladCurrentContext->GetQueryBufferObjecti64v(id, buffer, pname, offset);
+}
+static void APIENTRY lazy_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    resolveLazily(668);
+    gladCurrentContext->GetQueryBufferObjectiv(id, buffer, pname, offset);
+}
+static void APIENTRY lazy_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    resolveLazily(669);
+    gladCurrentContext->GetQueryBufferObjectui64v(id, buffer, pname, offset);
+}
+static void APIENTRY lazy_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    resolveLazily(670);
+    gladCurrentContext->GetQueryBufferObjectuiv(id, buffer, pname, offset);
+}
+static void APIENTRY lazy_glMemoryBarrierByRegion(GLbitfield barriers)
+{
+    resolveLazily(671);
+    gladCurrentContext->MemoryBarrierByRegion(barriers);
+}
+static void APIENTRY lazy_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    resolveLazily(672);
+    gladCurrentContext->GetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+static void APIENTRY lazy_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels)
+{
+    resolveLazily(673);
+    gladCurrentContext->GetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+static GLenum APIENTRY lazy_glGetGraphicsResetStatus(void)
+{
+    resolveLazily(674);
+    return gladCurrentContext->GetGraphicsResetStatus();
+}
+static void APIENTRY lazy_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels)
+{
+    resolveLazily(675);
+    gladCurrentContext->GetnCompressedTexImage(target, lod, bufSize, pixels);
+}
+static void APIENTRY lazy_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    resolveLazily(676);
+    gladCurrentContext->GetnTexImage(target, level, format, type, bufSize, pixels);
+}
+static void APIENTRY lazy_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+    resolveLazily(677);
+    gladCurrentContext->GetnUniformdv(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+    resolveLazily(678);
+    gladCurrentContext->GetnUniformfv(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+    resolveLazily(679);
+    gladCurrentContext->GetnUniformiv(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+    resolveLazily(680);
+    gladCurrentContext->GetnUniformuiv(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+    resolveLazily(681);
+    gladCurrentContext->ReadnPixels(x, y, width, height, format, type, bufSize, data);
+}
+static void APIENTRY lazy_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v)
+{
+    resolveLazily(682);
+    gladCurrentContext->GetnMapdv(target, query, bufSize, v);
+}
+static void APIENTRY lazy_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v)
+{
+    resolveLazily(683);
+    gladCurrentContext->GetnMapfv(target, query, bufSize, v);
+}
+static void APIENTRY lazy_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v)
+{
+    resolveLazily(684);
+    gladCurrentContext->GetnMapiv(target, query, bufSize, v);
+}
+static void APIENTRY lazy_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values)
+{
+    resolveLazily(685);
+    gladCurrentContext->GetnPixelMapfv(map, bufSize, values);
+}
+static void APIENTRY lazy_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values)
+{
+    resolveLazily(686);
+    gladCurrentContext->GetnPixelMapuiv(map, bufSize, values);
+}
+static void APIENTRY lazy_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values)
+{
+    resolveLazily(687);
+    gladCurrentContext->GetnPixelMapusv(map, bufSize, values);
+}
+static void APIENTRY lazy_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern)
+{
+    resolveLazily(688);
+    gladCurrentContext->GetnPolygonStipple(bufSize, pattern);
+}
+static void APIENTRY lazy_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table)
+{
+    resolveLazily(689);
+    gladCurrentContext->GetnColorTable(target, format, type, bufSize, table);
+}
+static void APIENTRY lazy_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image)
+{
+    resolveLazily(690);
+    gladCurrentContext->GetnConvolutionFilter(target, format, type, bufSize, image);
+}
+static void APIENTRY lazy_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span)
+{
+    resolveLazily(691);
+    gladCurrentContext->GetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+}
+static void APIENTRY lazy_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values)
+{
+    resolveLazily(692);
+    gladCurrentContext->GetnHistogram(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY lazy_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values)
+{
+    resolveLazily(693);
+    gladCurrentContext->GetnMinmax(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY lazy_glTextureBarrier(void)
+{
+    resolveLazily(694);
+    gladCurrentContext->TextureBarrier();
+}
+static void APIENTRY lazy_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue)
+{
+    resolveLazily(695);
+    gladCurrentContext->SpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+}
+static void APIENTRY lazy_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    resolveLazily(696);
+    gladCurrentContext->MultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY lazy_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    resolveLazily(697);
+    gladCurrentContext->MultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY lazy_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp)
+{
+    resolveLazily(698);
+    gladCurrentContext->PolygonOffsetClamp(factor, units, clamp);
+}
+static GLuint64 APIENTRY lazy_glGetTextureHandleARB(GLuint texture)
+{
+    resolveLazily(699);
+    return gladCurrentContext->GetTextureHandleARB(texture);
+}
+static GLuint64 APIENTRY lazy_glGetTextureSamplerHandleARB(GLuint texture, GLuint sampler)
+{
+    resolveLazily(700);
+    return gladCurrentContext->GetTextureSamplerHandleARB(texture, sampler);
+}
+static void APIENTRY lazy_glMakeTextureHandleResidentARB(GLuint64 handle)
+{
+    resolveLazily(701);
+    gladCurrentContext->MakeTextureHandleResidentARB(handle);
+}
+static void APIENTRY lazy_glMakeTextureHandleNonResidentARB(GLuint64 handle)
+{
+    resolveLazily(702);
+    gladCurrentContext->MakeTextureHandleNonResidentARB(handle);
+}
+static GLuint64 APIENTRY lazy_glGetImageHandleARB(GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format)
+{
+    resolveLazily(703);
+    return gladCurrentContext->GetImageHandleARB(texture, level, layered, layer, format);
+}
+static void APIENTRY lazy_glMakeImageHandleResidentARB(GLuint64 handle, GLenum access)
+{
+    resolveLazily(704);
+    gladCurrentContext->MakeImageHandleResidentARB(handle, access);
+}
+static void APIENTRY lazy_glMakeImageHandleNonResidentARB(GLuint64 handle)
+{
+    resolveLazily(705);
+    gladCurrentContext->MakeImageHandleNonResidentARB(handle);
+}
+static void APIENTRY lazy_glUniformHandleui64ARB(GLint location, GLuint64 value)
+{
+    resolveLazily(706);
+    gladCurrentContext->UniformHandleui64ARB(location, value);
+}
+static void APIENTRY lazy_glUniformHandleui64vARB(GLint location, GLsizei count, const GLuint64 *value)
+{
+    resolveLazily(707);
+    gladCurrentContext->UniformHandleui64vARB(location, count, value);
+}
+static void APIENTRY lazy_glProgramUniformHandleui64ARB(GLuint program, GLint location, GLuint64 value)
+{
+    resolveLazily(708);
+    gladCurrentContext->ProgramUniformHandleui64ARB(program, location, value);
+}
+static void APIENTRY lazy_glProgramUniformHandleui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *values)
+{
+    resolveLazily(709);
+    gladCurrentContext->ProgramUniformHandleui64vARB(program, location, count, values);
+}
+static GLboolean APIENTRY lazy_glIsTextureHandleResidentARB(GLuint64 handle)
+{
+    resolveLazily(710);
+    return gladCurrentContext->IsTextureHandleResidentARB(handle);
+}
+static GLboolean APIENTRY lazy_glIsImageHandleResidentARB(GLuint64 handle)
+{
+    resolveLazily(711);
+    return gladCurrentContext->IsImageHandleResidentARB(handle);
+}
+static void APIENTRY lazy_glVertexAttribL1ui64ARB(GLuint index, GLuint64EXT x)
+{
+    resolveLazily(712);
+    gladCurrentContext->VertexAttribL1ui64ARB(index, x);
+}
+static void APIENTRY lazy_glVertexAttribL1ui64vARB(GLuint index, const GLuint64EXT *v)
+{
+    resolveLazily(713);
+    gladCurrentContext->VertexAttribL1ui64vARB(index, v);
+}
+static void APIENTRY lazy_glGetVertexAttribLui64vARB(GLuint index, GLenum pname, GLuint64EXT *params)
+{
+    resolveLazily(714);
+    gladCurrentContext->GetVertexAttribLui64vARB(index, pname, params);
+}
+static void APIENTRY lazy_glSpecializeShaderARB(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue)
+{
+    resolveLazily(715);
+    gladCurrentContext->SpecializeShaderARB(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+}
+static void APIENTRY lazy_glMultiDrawArraysIndirectCountARB(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    resolveLazily(716);
+    gladCurrentContext->MultiDrawArraysIndirectCountARB(mode, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY lazy_glMultiDrawElementsIndirectCountARB(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    resolveLazily(717);
+    gladCurrentContext->MultiDrawElementsIndirectCountARB(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY lazy_glMaxShaderCompilerThreadsKHR(GLuint count)
+{
+    resolveLazily(718);
+    gladCurrentContext->MaxShaderCompilerThreadsKHR(count);
+}
+
+static void *const gladTrampolines[] = {
+    (void *)lazy_glCullFace,
+    (void *)lazy_glFrontFace,
+    (void *)lazy_glHint,
+    (void *)lazy_glLineWidth,
+    (void *)lazy_glPointSize,
+    (void *)lazy_glPolygonMode,
+    (void *)lazy_glScissor,
+    (void *)lazy_glTexParameterf,
+    (void *)lazy_glTexParameterfv,
+    (void *)lazy_glTexParameteri,
+    (void *)lazy_glTexParameteriv,
+    (void *)lazy_glTexImage1D,
+    (void *)lazy_glTexImage2D,
+    (void *)lazy_glDrawBuffer,
+    (void *)lazy_glClear,
+    (void *)lazy_glClearColor,
+    (void *)lazy_glClearStencil,
+    (void *)lazy_glClearDepth,
+    (void *)lazy_glStencilMask,
+    (void *)lazy_glColorMask,
+    (void *)lazy_glDepthMask,
+    (void *)lazy_glDisable,
+    (void *)lazy_glEnable,
+    (void *)lazy_glFinish,
+    (void *)lazy_glFlush,
+    (void *)lazy_glBlendFunc,
+    (void *)lazy_glLogicOp,
+    (void *)lazy_glStencilFunc,
+    (void *)lazy_glStencilOp,
+    (void *)lazy_glDepthFunc,
+    (void *)lazy_glPixelStoref,
+    (void *)lazy_glPixelStorei,
+    (void *)lazy_glReadBuffer,
+    (void *)lazy_glReadPixels,
+    (void *)lazy_glGetBooleanv,
+    (void *)lazy_glGetDoublev,
+    (void *)lazy_glGetError,
+    (void *)lazy_glGetFloatv,
+    (void *)lazy_glGetIntegerv,
+    (void *)lazy_glGetString,
+    (void *)lazy_glGetTexImage,
+    (void *)lazy_glGetTexParameterfv,
+    (void *)lazy_glGetTexParameteriv,
+    (void *)lazy_glGetTexLevelParameterfv,
+    (void *)lazy_glGetTexLevelParameteriv,
+    (void *)lazy_glIsEnabled,
+    (void *)lazy_glDepthRange,
+    (void *)lazy_glViewport,
+    (void *)lazy_glDrawArrays,
+    (void *)lazy_glDrawElements,
+    (void *)lazy_glPolygonOffset,
+    (void *)lazy_glCopyTexImage1D,
+    (void *)lazy_glCopyTexImage2D,
+    (void *)lazy_glCopyTexSubImage1D,
+    (void *)lazy_glCopyTexSubImage2D,
+    (void *)lazy_glTexSubImage1D,
+    (void *)lazy_glTexSubImage2D,
+    (void *)lazy_glBindTexture,
+    (void *)lazy_glDeleteTextures,
+    (void *)lazy_glGenTextures,
+    (void *)lazy_glIsTexture,
+    (void *)lazy_glDrawRangeElements,
+    (void *)lazy_glTexImage3D,
+    (void *)lazy_glTexSubImage3D,
+    (void *)lazy_glCopyTexSubImage3D,
+    (void *)lazy_glActiveTexture,
+    (void *)lazy_glSampleCoverage,
+    (void *)lazy_glCompressedTexImage3D,
+    (void *)lazy_glCompressedTexImage2D,
+    (void *)lazy_glCompressedTexImage1D,
+    (void *)lazy_glCompressedTexSubImage3D,
+    (void *)lazy_glCompressedTexSubImage2D,
+    (void *)lazy_glCompressedTexSubImage1D,
+    (void *)lazy_glGetCompressedTexImage,
+    (void *)lazy_glBlendFuncSeparate,
+    (void *)lazy_glMultiDrawArrays,
+    (void *)lazy_glMultiDrawElements,
+    (void *)lazy_glPointParameterf,
+    (void *)lazy_glPointParameterfv,
+    (void *)lazy_glPointParameteri,
+    (void *)lazy_glPointParameteriv,
+    (void *)lazy_glBlendColor,
+    (void *)lazy_glBlendEquation,
+    (void *)lazy_glGenQueries,
+    (void *)lazy_glDeleteQueries,
+    (void *)lazy_glIsQuery,
+    (void *)lazy_glBeginQuery,
+    (void *)lazy_glEndQuery,
+    (void *)lazy_glGetQueryiv,
+    (void *)lazy_glGetQueryObjectiv,
+    (void *)lazy_glGetQueryObjectuiv,
+    (void *)lazy_glBindBuffer,
+    (void *)lazy_glDeleteBuffers,
+    (void *)lazy_glGenBuffers,
+    (void *)lazy_glIsBuffer,
+    (void *)lazy_glBufferData,
+    (void *)lazy_glBufferSubData,
+    (void *)lazy_glGetBufferSubData,
+    (void *)lazy_glMapBuffer,
+    (void *)lazy_glUnmapBuffer,
+    (void *)lazy_glGetBufferParameteriv,
+    (void *)lazy_glGetBufferPointerv,
+    (void *)lazy_glBlendEquationSeparate,
+    (void *)lazy_glDrawBuffers,
+    (void *)lazy_glStencilOpSeparate,
+    (void *)lazy_glStencilFuncSeparate,
+    (void *)lazy_glStencilMaskSeparate,
+    (void *)lazy_glAttachShader,
+    (void *)lazy_glBindAttribLocation,
+    (void *)lazy_glCompileShader,
+    (void *)lazy_glCreateProgram,
+    (void *)lazy_glCreateShader,
+    (void *)lazy_glDeleteProgram,
+    (void *)lazy_glDeleteShader,
+    (void *)lazy_glDetachShader,
+    (void *)lazy_glDisableVertexAttribArray,
+    (void *)lazy_glEnableVertexAttribArray,
+    (void *)lazy_glGetActiveAttrib,
+    (void *)lazy_glGetActiveUniform,
+    (void *)lazy_glGetAttachedShaders,
+    (void *)lazy_glGetAttribLocation,
+    (void *)lazy_glGetProgramiv,
+    (void *)lazy_glGetProgramInfoLog,
+    (void *)lazy_glGetShaderiv,
+    (void *)lazy_glGetShaderInfoLog,
+    (void *)lazy_glGetShaderSource,
+    (void *)lazy_glGetUniformLocation,
+    (void *)lazy_glGetUniformfv,
+    (void *)lazy_glGetUniformiv,
+    (void *)lazy_glGetVertexAttribdv,
+    (void *)lazy_glGetVertexAttribfv,
+    (void *)lazy_glGetVertexAttribiv,
+    (void *)lazy_glGetVertexAttribPointerv,
+    (void *)lazy_glIsProgram,
+    (void *)lazy_glIsShader,
+    (void *)lazy_glLinkProgram,
+    (void *)lazy_glShaderSource,
+    (void *)lazy_glUseProgram,
+    (void *)lazy_glUniform1f,
+    (void *)lazy_glUniform2f,
+    (void *)lazy_glUniform3f,
+    (void *)lazy_glUniform4f,
+    (void *)lazy_glUniform1i,
+    (void *)lazy_glUniform2i,
+    (void *)lazy_glUniform3i,
+    (void *)lazy_glUniform4i,
+    (void *)lazy_glUniform1fv,
+    (void *)lazy_glUniform2fv,
+    (void *)lazy_glUniform3fv,
+    (void *)lazy_glUniform4fv,
+    (void *)lazy_glUniform1iv,
+    (void *)lazy_glUniform2iv,
+    (void *)lazy_glUniform3iv,
+    (void *)lazy_glUniform4iv,
+    (void *)lazy_glUniformMatrix2fv,
+    (void *)lazy_glUniformMatrix3fv,
+    (void *)lazy_glUniformMatrix4fv,
+    (void *)lazy_glValidateProgram,
+    (void *)lazy_glVertexAttrib1d,
+    (void *)lazy_glVertexAttrib1dv,
+    (void *)lazy_glVertexAttrib1f,
+    (void *)lazy_glVertexAttrib1fv,
+    (void *)lazy_glVertexAttrib1s,
+    (void *)lazy_glVertexAttrib1sv,
+    (void *)lazy_glVertexAttrib2d,
+    (void *)lazy_glVertexAttrib2dv,
+    (void *)lazy_glVertexAttrib2f,
+    (void *)lazy_glVertexAttrib2fv,
+    (void *)lazy_glVertexAttrib2s,
+    (void *)lazy_glVertexAttrib2sv,
+    (void *)lazy_glVertexAttrib3d,
+    (void *)lazy_glVertexAttrib3dv,
+    (void *)lazy_glVertexAttrib3f,
+    (void *)lazy_glVertexAttrib3fv,
+    (void *)lazy_glVertexAttrib3s,
+    (void *)lazy_glVertexAttrib3sv,
+    (void *)lazy_glVertexAttrib4Nbv,
+    (void *)lazy_glVertexAttrib4Niv,
+    (void *)lazy_glVertexAttrib4Nsv,
+    (void *)lazy_glVertexAttrib4Nub,
+    (void *)lazy_glVertexAttrib4Nubv,
+    (void *)lazy_glVertexAttrib4Nuiv,
+    (void *)lazy_glVertexAttrib4Nusv,
+    (void *)lazy_glVertexAttrib4bv,
+    (void *)lazy_glVertexAttrib4d,
+    (void *)lazy_glVertexAttrib4dv,
+    (void *)lazy_glVertexAttrib4f,
+    (void *)lazy_glVertexAttrib4fv,
+    (void *)lazy_glVertexAttrib4iv,
+    (void *)lazy_glVertexAttrib4s,
+    (void *)lazy_glVertexAttrib4sv,
+    (void *)lazy_glVertexAttrib4ubv,
+    (void *)lazy_glVertexAttrib4uiv,
+    (void *)lazy_glVertexAttrib4usv,
+    (void *)lazy_glVertexAttribPointer,
+    (void *)lazy_glUniformMatrix2x3fv,
+    (void *)lazy_glUniformMatrix3x2fv,
+    (void *)lazy_glUniformMatrix2x4fv,
+    (void *)lazy_glUniformMatrix4x2fv,
+    (void *)lazy_glUniformMatrix3x4fv,
+    (void *)lazy_glUniformMatrix4x3fv,
+    (void *)lazy_glColorMaski,
+    (void *)lazy_glGetBooleani_v,
+    (void *)lazy_glGetIntegeri_v,
+    (void *)lazy_glEnablei,
+    (void *)lazy_glDisablei,
+    (void *)lazy_glIsEnabledi,
+    (void *)lazy_glBeginTransformFeedback,
+    (void *)lazy_glEndTransformFeedback,
+    (void *)lazy_glBindBufferRange,
+    (void *)lazy_glBindBufferBase,
+    (void *)lazy_glTransformFeedbackVaryings,
+    (void *)lazy_glGetTransformFeedbackVarying,
+    (void *)lazy_glClampColor,
+    (void *)lazy_glBeginConditionalRender,
+    (void *)lazy_glEndConditionalRender,
+    (void *)lazy_glVertexAttribIPointer,
+    (void *)lazy_glGetVertexAttribIiv,
+    (void *)lazy_glGetVertexAttribIuiv,
+    (void *)lazy_glVertexAttribI1i,
+    (void *)lazy_glVertexAttribI2i,
+    (void *)lazy_glVertexAttribI3i,
+    (void *)lazy_glVertexAttribI4i,
+    (void *)lazy_glVertexAttribI1ui,
+    (void *)lazy_glVertexAttribI2ui,
+    (void *)lazy_glVertexAttribI3ui,
+    (void *)lazy_glVertexAttribI4ui,
+    (void *)lazy_glVertexAttribI1iv,
+    (void *)lazy_glVertexAttribI2iv,
+    (void *)lazy_glVertexAttribI3iv,
+    (void *)lazy_glVertexAttribI4iv,
+    (void *)lazy_glVertexAttribI1uiv,
+    (void *)lazy_glVertexAttribI2uiv,
+    (void *)lazy_glVertexAttribI3uiv,
+    (void *)lazy_glVertexAttribI4uiv,
+    (void *)lazy_glVertexAttribI4bv,
+    (void *)lazy_glVertexAttribI4sv,
+    (void *)lazy_glVertexAttribI4ubv,
+    (void *)lazy_glVertexAttribI4usv,
+    (void *)lazy_glGetUniformuiv,
+    (void *)lazy_glBindFragDataLocation,
+    (void *)lazy_glGetFragDataLocation,
+    (void *)lazy_glUniform1ui,
+    (void *)lazy_glUniform2ui,
+    (void *)lazy_glUniform3ui,
+    (void *)lazy_glUniform4ui,
+    (void *)lazy_glUniform1uiv,
+    (void *)lazy_glUniform2uiv,
+    (void *)lazy_glUniform3uiv,
+    (void *)lazy_glUniform4uiv,
+    (void *)lazy_glTexParameterIiv,
+    (void *)lazy_glTexParameterIuiv,
+    (void *)lazy_glGetTexParameterIiv,
+    (void *)lazy_glGetTexParameterIuiv,
+    (void *)lazy_glClearBufferiv,
+    (void *)lazy_glClearBufferuiv,
+    (void *)lazy_glClearBufferfv,
+    (void *)lazy_glClearBufferfi,
+    (void *)lazy_glGetStringi,
+    (void *)lazy_glIsRenderbuffer,
+    (void *)lazy_glBindRenderbuffer,
+    (void *)lazy_glDeleteRenderbuffers,
+    (void *)lazy_glGenRenderbuffers,
+    (void *)lazy_glRenderbufferStorage,
+    (void *)lazy_glGetRenderbufferParameteriv,
+    (void *)lazy_glIsFramebuffer,
+    (void *)lazy_glBindFramebuffer,
+    (void *)lazy_glDeleteFramebuffers,
+    (void *)lazy_glGenFramebuffers,
+    (void *)lazy_glCheckFramebufferStatus,
+    (void *)lazy_glFramebufferTexture1D,
+    (void *)lazy_glFramebufferTexture2D,
+    (void *)lazy_glFramebufferTexture3D,
+    (void *)lazy_glFramebufferRenderbuffer,
+    (void *)lazy_glGetFramebufferAttachmentParameteriv,
+    (void *)lazy_glGenerateMipmap,
+    (void *)lazy_glBlitFramebuffer,
+    (void *)lazy_glRenderbufferStorageMultisample,
+    (void *)lazy_glFramebufferTextureLayer,
+    (void *)lazy_glMapBufferRange,
+    (void *)lazy_glFlushMappedBufferRange,
+    (void *)lazy_glBindVertexArray,
+    (void *)lazy_glDeleteVertexArrays,
+    (void *)lazy_glGenVertexArrays,
+    (void *)lazy_glIsVertexArray,
+    (void *)lazy_glDrawArraysInstanced,
+    (void *)lazy_glDrawElementsInstanced,
+    (void *)lazy_glTexBuffer,
+    (void *)lazy_glPrimitiveRestartIndex,
+    (void *)lazy_glCopyBufferSubData,
+    (void *)lazy_glGetUniformIndices,
+    (void *)lazy_glGetActiveUniformsiv,
+    (void *)lazy_glGetActiveUniformName,
+    (void *)lazy_glGetUniformBlockIndex,
+    (void *)lazy_glGetActiveUniformBlockiv,
+    (void *)lazy_glGetActiveUniformBlockName,
+    (void *)lazy_glUniformBlockBinding,
+    (void *)lazy_glDrawElementsBaseVertex,
+    (void *)lazy_glDrawRangeElementsBaseVertex,
+    (void *)lazy_glDrawElementsInstancedBaseVertex,
+    (void *)lazy_glMultiDrawElementsBaseVertex,
+    (void *)lazy_glProvokingVertex,
+    (void *)lazy_glFenceSync,
+    (void *)lazy_glIsSync,
+    (void *)lazy_glDeleteSync,
+    (void *)lazy_glClientWaitSync,
+    (void *)lazy_glWaitSync,
+    (void *)lazy_glGetInteger64v,
+    (void *)lazy_glGetSynciv,
+    (void *)lazy_glGetInteger64i_v,
+    (void *)lazy_glGetBufferParameteri64v,
+    (void *)lazy_glFramebufferTexture,
+    (void *)lazy_glTexImage2DMultisample,
+    (void *)lazy_glTexImage3DMultisample,
+    (void *)lazy_glGetMultisamplefv,
+    (void *)lazy_glSampleMaski,
+    (void *)lazy_glBindFragDataLocationIndexed,
+    (void *)lazy_glGetFragDataIndex,
+    (void *)lazy_glGenSamplers,
+    (void *)lazy_glDeleteSamplers,
+    (void *)lazy_glIsSampler,
+    (void *)lazy_glBindSampler,
+    (void *)lazy_glSamplerParameteri,
+    (void *)lazy_glSamplerParameteriv,
+    (void *)lazy_glSamplerParameterf,
+    (void *)lazy_glSamplerParameterfv,
+    (void *)lazy_glSamplerParameterIiv,
+    (void *)lazy_glSamplerParameterIuiv,
+    (void *)lazy_glGetSamplerParameteriv,
+    (void *)lazy_glGetSamplerParameterIiv,
+    (void *)lazy_glGetSamplerParameterfv,
+    (void *)lazy_glGetSamplerParameterIuiv,
+    (void *)lazy_glQueryCounter,
+    (void *)lazy_glGetQueryObjecti64v,
+    (void *)lazy_glGetQueryObjectui64v,
+    (void *)lazy_glVertexAttribDivisor,
+    (void *)lazy_glVertexAttribP1ui,
+    (void *)lazy_glVertexAttribP1uiv,
+    (void *)lazy_glVertexAttribP2ui,
+    (void *)lazy_glVertexAttribP2uiv,
+    (void *)lazy_glVertexAttribP3ui,
+    (void *)lazy_glVertexAttribP3uiv,
+    (void *)lazy_glVertexAttribP4ui,
+    (void *)lazy_glVertexAttribP4uiv,
+    (void *)lazy_glVertexP2ui,
+    (void *)lazy_glVertexP2uiv,
+    (void *)lazy_glVertexP3ui,
+    (void *)lazy_glVertexP3uiv,
+    (void *)lazy_glVertexP4ui,
+    (void *)lazy_glVertexP4uiv,
+    (void *)lazy_glTexCoordP1ui,
+    (void *)lazy_glTexCoordP1uiv,
+    (void *)lazy_glTexCoordP2ui,
+    (void *)lazy_glTexCoordP2uiv,
+    (void *)lazy_glTexCoordP3ui,
+    (void *)lazy_glTexCoordP3uiv,
+    (void *)lazy_glTexCoordP4ui,
+    (void *)lazy_glTexCoordP4uiv,
+    (void *)lazy_glMultiTexCoordP1ui,
+    (void *)lazy_glMultiTexCoordP1uiv,
+    (void *)lazy_glMultiTexCoordP2ui,
+    (void *)lazy_glMultiTexCoordP2uiv,
+    (void *)lazy_glMultiTexCoordP3ui,
+    (void *)lazy_glMultiTexCoordP3uiv,
+    (void *)lazy_glMultiTexCoordP4ui,
+    (void *)lazy_glMultiTexCoordP4uiv,
+    (void *)lazy_glNormalP3ui,
+    (void *)lazy_glNormalP3uiv,
+    (void *)lazy_glColorP3ui,
+    (void *)lazy_glColorP3uiv,
+    (void *)lazy_glColorP4ui,
+    (void *)lazy_glColorP4uiv,
+    (void *)lazy_glSecondaryColorP3ui,
+    (void *)lazy_glSecondaryColorP3uiv,
+    (void *)lazy_glMinSampleShading,
+    (void *)lazy_glBlendEquationi,
+    (void *)lazy_glBlendEquationSeparatei,
+    (void *)lazy_glBlendFunci,
+    (void *)lazy_glBlendFuncSeparatei,
+    (void *)lazy_glDrawArraysIndirect,
+    (void *)lazy_glDrawElementsIndirect,
+    (void *)lazy_glUniform1d,
+    (void *)lazy_glUniform2d,
+    (void *)lazy_glUniform3d,
+    (void *)lazy_glUniform4d,
+    (void *)lazy_glUniform1dv,
+    (void *)lazy_glUniform2dv,
+    (void *)lazy_glUniform3dv,
+    (void *)lazy_glUniform4dv,
+    (void *)lazy_glUniformMatrix2dv,
+    (void *)lazy_glUniformMatrix3dv,
+    (void *)lazy_glUniformMatrix4dv,
+    (void *)lazy_glUniformMatrix2x3dv,
+    (void *)lazy_glUniformMatrix2x4dv,
+    (void *)lazy_glUniformMatrix3x2dv,
+    (void *)lazy_glUniformMatrix3x4dv,
+    (void *)lazy_glUniformMatrix4x2dv,
+    (void *)lazy_glUniformMatrix4x3dv,
+    (void *)lazy_glGetUniformdv,
+    (void *)lazy_glGetSubroutineUniformLocation,
+    (void *)lazy_glGetSubroutineIndex,
+    (void *)lazy_glGetActiveSubroutineUniformiv,
+    (void *)lazy_glGetActiveSubroutineUniformName,
+    (void *)lazy_glGetActiveSubroutineName,
+    (void *)lazy_glUniformSubroutinesuiv,
+    (void *)lazy_glGetUniformSubroutineuiv,
+    (void *)lazy_glGetProgramStageiv,
+    (void *)lazy_glPatchParameteri,
+    (void *)lazy_glPatchParameterfv,
+    (void *)lazy_glBindTransformFeedback,
+    (void *)lazy_glDeleteTransformFeedbacks,
+    (void *)lazy_glGenTransformFeedbacks,
+    (void *)lazy_glIsTransformFeedback,
+    (void *)lazy_glPauseTransformFeedback,
+    (void *)lazy_glResumeTransformFeedback,
+    (void *)lazy_glDrawTransformFeedback,
+    (void *)lazy_glDrawTransformFeedbackStream,
+    (void *)lazy_glBeginQueryIndexed,
+    (void *)lazy_glEndQueryIndexed,
+    (void *)lazy_glGetQueryIndexediv,
+    (void *)lazy_glReleaseShaderCompiler,
+    (void *)lazy_glShaderBinary,
+    (void *)lazy_glGetShaderPrecisionFormat,
+    (void *)lazy_glDepthRangef,
+    (void *)lazy_glClearDepthf,
+    (void *)lazy_glGetProgramBinary,
+    (void *)lazy_glProgramBinary,
+    (void *)lazy_glProgramParameteri,
+    (void *)lazy_glUseProgramStages,
+    (void *)lazy_glActiveShaderProgram,
+    (void *)lazy_glCreateShaderProgramv,
+    (void *)lazy_glBindProgramPipeline,
+    (void *)lazy_glDeleteProgramPipelines,
+    (void *)lazy_glGenProgramPipelines,
+    (void *)lazy_glIsProgramPipeline,
+    (void *)lazy_glGetProgramPipelineiv,
+    (void *)lazy_glProgramUniform1i,
+    (void *)lazy_glProgramUniform1iv,
+    (void *)lazy_glProgramUniform1f,
+    (void *)lazy_glProgramUniform1fv,
+    (void *)lazy_glProgramUniform1d,
+    (void *)lazy_glProgramUniform1dv,
+    (void *)lazy_glProgramUniform1ui,
+    (void *)lazy_glProgramUniform1uiv,
+    (void *)lazy_glProgramUniform2i,
+    (void *)lazy_glProgramUniform2iv,
+    (void *)lazy_glProgramUniform2f,
+    (void *)lazy_glProgramUniform2fv,
+    (void *)lazy_glProgramUniform2d,
+    (void *)lazy_glProgramUniform2dv,
+    (void *)lazy_glProgramUniform2ui,
+    (void *)lazy_glProgramUniform2uiv,
+    (void *)lazy_glProgramUniform3i,
+    (void *)lazy_glProgramUniform3iv,
+    (void *)lazy_glProgramUniform3f,
+    (void *)lazy_glProgramUniform3fv,
+    (void *)lazy_glProgramUniform3d,
+    (void *)lazy_glProgramUniform3dv,
+    (void *)lazy_glProgramUniform3ui,
+    (void *)lazy_glProgramUniform3uiv,
+    (void *)lazy_glProgramUniform4i,
+    (void *)lazy_glProgramUniform4iv,
+    (void *)lazy_glProgramUniform4f,
+    (void *)lazy_glProgramUniform4fv,
+    (void *)lazy_glProgramUniform4d,
+    (void *)lazy_glProgramUniform4dv,
+    (void *)lazy_glProgramUniform4ui,
+    (void *)lazy_glProgramUniform4uiv,
+    (void *)lazy_glProgramUniformMatrix2fv,
+    (void *)lazy_glProgramUniformMatrix3fv,
+    (void *)lazy_glProgramUniformMatrix4fv,
+    (void *)lazy_glProgramUniformMatrix2dv,
+    (void *)lazy_glProgramUniformMatrix3dv,
+    (void *)lazy_glProgramUniformMatrix4dv,
+    (void *)lazy_glProgramUniformMatrix2x3fv,
+    (void *)lazy_glProgramUniformMatrix3x2fv,
+    (void *)lazy_glProgramUniformMatrix2x4fv,
+    (void *)lazy_glProgramUniformMatrix4x2fv,
+    (void *)lazy_glProgramUniformMatrix3x4fv,
+    (void *)lazy_glProgramUniformMatrix4x3fv,
+    (void *)lazy_glProgramUniformMatrix2x3dv,
+    (void *)lazy_glProgramUniformMatrix3x2dv,
+    (void *)lazy_glProgramUniformMatrix2x4dv,
+    (void *)lazy_glProgramUniformMatrix4x2dv,
+    (void *)lazy_glProgramUniformMatrix3x4dv,
+    (void *)lazy_glProgramUniformMatrix4x3dv,
+    (void *)lazy_glValidateProgramPipeline,
+    (void *)lazy_glGetProgramPipelineInfoLog,
+    (void *)lazy_glVertexAttribL1d,
+    (void *)lazy_glVertexAttribL2d,
+    (void *)lazy_glVertexAttribL3d,
+    (void *)lazy_glVertexAttribL4d,
+    (void *)lazy_glVertexAttribL1dv,
+    (void *)lazy_glVertexAttribL2dv,
+    (void *)lazy_glVertexAttribL3dv,
+    (void *)lazy_glVertexAttribL4dv,
+    (void *)lazy_glVertexAttribLPointer,
+    (void *)lazy_glGetVertexAttribLdv,
+    (void *)lazy_glViewportArrayv,
+    (void *)lazy_glViewportIndexedf,
+    (void *)lazy_glViewportIndexedfv,
+    (void *)lazy_glScissorArrayv,
+    (void *)lazy_glScissorIndexed,
+    (void *)lazy_glScissorIndexedv,
+    (void *)lazy_glDepthRangeArrayv,
+    (void *)lazy_glDepthRangeIndexed,
+    (void *)lazy_glGetFloati_v,
+    (void *)lazy_glGetDoublei_v,
+    (void *)lazy_glDrawArraysInstancedBaseInstance,
+    (void *)lazy_glDrawElementsInstancedBaseInstance,
+    (void *)lazy_glDrawElementsInstancedBaseVertexBaseInstance,
+    (void *)lazy_glGetInternalformativ,
+    (void *)lazy_glGetActiveAtomicCounterBufferiv,
+    (void *)lazy_glBindImageTexture,
+    (void *)lazy_glMemoryBarrier,
+    (void *)lazy_glTexStorage1D,
+    (void *)lazy_glTexStorage2D,
+    (void *)lazy_glTexStorage3D,
+    (void *)lazy_glDrawTransformFeedbackInstanced,
+    (void *)lazy_glDrawTransformFeedbackStreamInstanced,
+    (void *)lazy_glClearBufferData,
+    (void *)lazy_glClearBufferSubData,
+    (void *)lazy_glDispatchCompute,
+    (void *)lazy_glDispatchComputeIndirect,
+    (void *)lazy_glCopyImageSubData,
+    (void *)lazy_glFramebufferParameteri,
+    (void *)lazy_glGetFramebufferParameteriv,
+    (void *)lazy_glGetInternalformati64v,
+    (void *)lazy_glInvalidateTexSubImage,
+    (void *)lazy_glInvalidateTexImage,
+    (void *)lazy_glInvalidateBufferSubData,
+    (void *)lazy_glInvalidateBufferData,
+    (void *)lazy_glInvalidateFramebuffer,
+    (void *)lazy_glInvalidateSubFramebuffer,
+    (void *)lazy_glMultiDrawArraysIndirect,
+    (void *)lazy_glMultiDrawElementsIndirect,
+    (void *)lazy_glGetProgramInterfaceiv,
+    (void *)lazy_glGetProgramResourceIndex,
+    (void *)lazy_glGetProgramResourceName,
+    (void *)lazy_glGetProgramResourceiv,
+    (void *)lazy_glGetProgramResourceLocation,
+    (void *)lazy_glGetProgramResourceLocationIndex,
+    (void *)lazy_glShaderStorageBlockBinding,
+    (void *)lazy_glTexBufferRange,
+    (void *)lazy_glTexStorage2DMultisample,
+    (void *)lazy_glTexStorage3DMultisample,
+    (void *)lazy_glTextureView,
+    (void *)lazy_glBindVertexBuffer,
+    (void *)lazy_glVertexAttribFormat,
+    (void *)lazy_glVertexAttribIFormat,
+    (void *)lazy_glVertexAttribLFormat,
+    (void *)lazy_glVertexAttribBinding,
+    (void *)lazy_glVertexBindingDivisor,
+    (void *)lazy_glDebugMessageControl,
+    (void *)lazy_glDebugMessageInsert,
+    (void *)lazy_glDebugMessageCallback,
+    (void *)lazy_glGetDebugMessageLog,
+    (void *)lazy_glPushDebugGroup,
+    (void *)lazy_glPopDebugGroup,
+    (void *)lazy_glObjectLabel,
+    (void *)lazy_glGetObjectLabel,
+    (void *)lazy_glObjectPtrLabel,
+    (void *)lazy_glGetObjectPtrLabel,
+    (void *)lazy_glGetPointerv,
+    (void *)lazy_glBufferStorage,
+    (void *)lazy_glClearTexImage,
+    (void *)lazy_glClearTexSubImage,
+    (void *)lazy_glBindBuffersBase,
+    (void *)lazy_glBindBuffersRange,
+    (void *)lazy_glBindTextures,
+    (void *)lazy_glBindSamplers,
+    (void *)lazy_glBindImageTextures,
+    (void *)lazy_glBindVertexBuffers,
+    (void *)lazy_glClipControl,
+    (void *)lazy_glCreateTransformFeedbacks,
+    (void *)lazy_glTransformFeedbackBufferBase,
+    (void *)lazy_glTransformFeedbackBufferRange,
+    (void *)lazy_glGetTransformFeedbackiv,
+    (void *)lazy_glGetTransformFeedbacki_v,
+    (void *)lazy_glGetTransformFeedbacki64_v,
+    (void *)lazy_glCreateBuffers,
+    (void *)lazy_glNamedBufferStorage,
+    (void *)lazy_glNamedBufferData,
+    (void *)lazy_glNamedBufferSubData,
+    (void *)lazy_glCopyNamedBufferSubData,
+    (void *)lazy_glClearNamedBufferData,
+    (void *)lazy_glClearNamedBufferSubData,
+    (void *)lazy_glMapNamedBuffer,
+    (void *)lazy_glMapNamedBufferRange,
+    (void *)lazy_glUnmapNamedBuffer,
+    (void *)lazy_glFlushMappedNamedBufferRange,
+    (void *)lazy_glGetNamedBufferParameteriv,
+    (void *)lazy_glGetNamedBufferParameteri64v,
+    (void *)lazy_glGetNamedBufferPointerv,
+    (void *)lazy_glGetNamedBufferSubData,
+    (void *)lazy_glCreateFramebuffers,
+    (void *)lazy_glNamedFramebufferRenderbuffer,
+    (void *)lazy_glNamedFramebufferParameteri,
+    (void *)lazy_glNamedFramebufferTexture,
+    (void *)lazy_glNamedFramebufferTextureLayer,
+    (void *)lazy_glNamedFramebufferDrawBuffer,
+    (void *)lazy_glNamedFramebufferDrawBuffers,
+    (void *)lazy_glNamedFramebufferReadBuffer,
+    (void *)lazy_glInvalidateNamedFramebufferData,
+    (void *)lazy_glInvalidateNamedFramebufferSubData,
+    (void *)lazy_glClearNamedFramebufferiv,
+    (void *)lazy_glClearNamedFramebufferuiv,
+    (void *)lazy_glClearNamedFramebufferfv,
+    (void *)lazy_glClearNamedFramebufferfi,
+    (void *)lazy_glBlitNamedFramebuffer,
+    (void *)lazy_glCheckNamedFramebufferStatus,
+    (void *)lazy_glGetNamedFramebufferParameteriv,
+    (void *)lazy_glGetNamedFramebufferAttachmentParameteriv,
+    (void *)lazy_glCreateRenderbuffers,
+    (void *)lazy_glNamedRenderbufferStorage,
+    (void *)lazy_glNamedRenderbufferStorageMultisample,
+    (void *)lazy_glGetNamedRenderbufferParameteriv,
+    (void *)lazy_glCreateTextures,
+    (void *)lazy_glTextureBuffer,
+    (void *)lazy_glTextureBufferRange,
+    (void *)lazy_glTextureStorage1D,
+    (void *)lazy_glTextureStorage2D,
+    (void *)lazy_glTextureStorage3D,
+    (void *)lazy_glTextureStorage2DMultisample,
+    (void *)lazy_glTextureStorage3DMultisample,
+    (void *)lazy_glTextureSubImage1D,
+    (void *)lazy_glTextureSubImage2D,
+    (void *)lazy_glTextureSubImage3D,
+    (void *)lazy_glCompressedTextureSubImage1D,
+    (void *)lazy_glCompressedTextureSubImage2D,
+    (void *)lazy_glCompressedTextureSubImage3D,
+    (void *)lazy_glCopyTextureSubImage1D,
+    (void *)lazy_glCopyTextureSubImage2D,
+    (void *)lazy_glCopyTextureSubImage3D,
+    (void *)lazy_glTextureParameterf,
+    (void *)lazy_glTextureParameterfv,
+    (void *)lazy_glTextureParameteri,
+    (void *)lazy_glTextureParameterIiv,
+    (void *)lazy_glTextureParameterIuiv,
+    (void *)lazy_glTextureParameteriv,
+    (void *)lazy_glGenerateTextureMipmap,
+    (void *)lazy_glBindTextureUnit,
+    (void *)lazy_glGetTextureImage,
+    (void *)lazy_glGetCompressedTextureImage,
+    (void *)lazy_glGetTextureLevelParameterfv,
+    (void *)lazy_glGetTextureLevelParameteriv,
+    (void *)lazy_glGetTextureParameterfv,
+    (void *)lazy_glGetTextureParameterIiv,
+    (void *)lazy_glGetTextureParameterIuiv,
+    (void *)lazy_glGetTextureParameteriv,
+    (void *)lazy_glCreateVertexArrays,
+    (void *)lazy_glDisableVertexArrayAttrib,
+    (void *)lazy_glEnableVertexArrayAttrib,
+    (void *)lazy_glVertexArrayElementBuffer,
+    (void *)lazy_glVertexArrayVertexBuffer,
+    (void *)lazy_glVertexArrayVertexBuffers,
+    (void *)lazy_glVertexArrayAttribBinding,
+    (void *)lazy_glVertexArrayAttribFormat,
+    (void *)lazy_glVertexArrayAttribIFormat,
+    (void *)lazy_glVertexArrayAttribLFormat,
+    (void *)lazy_glVertexArrayBindingDivisor,
+    (void *)lazy_glGetVertexArrayiv,
+    (void *)lazy_glGetVertexArrayIndexediv,
+    (void *)lazy_glGetVertexArrayIndexed64iv,
+    (void *)lazy_glCreateSamplers,
+    (void *)lazy_glCreateProgramPipelines,
+    (void *)lazy_glCreateQueries,
+    (void *)lazy_glGetQueryBufferObjecti64v,
+    (void *)lazy_glGetQueryBufferObjectiv,
+    (void *)lazy_glGetQueryBufferObjectui64v,
+    (void *)lazy_glGetQueryBufferObjectuiv,
+    (void *)lazy_glMemoryBarrierByRegion,
+    (void *)lazy_glGetTextureSubImage,
+    (void *)lazy_glGetCompressedTextureSubImage,
+    (void *)lazy_glGetGraphicsResetStatus,
+    (void *)lazy_glGetnCompressedTexImage,
+    (void *)lazy_glGetnTexImage,
+    (void *)lazy_glGetnUniformdv,
+    (void *)lazy_glGetnUniformfv,
+    (void *)lazy_glGetnUniformiv,
+    (void *)lazy_glGetnUniformuiv,
+    (void *)lazy_glReadnPixels,
+    (void *)lazy_glGetnMapdv,
+    (void *)lazy_glGetnMapfv,
+    (void *)lazy_glGetnMapiv,
+    (void *)lazy_glGetnPixelMapfv,
+    (void *)lazy_glGetnPixelMapuiv,
+    (void *)lazy_glGetnPixelMapusv,
+    (void *)lazy_glGetnPolygonStipple,
+    (void *)lazy_glGetnColorTable,
+    (void *)lazy_glGetnConvolutionFilter,
+    (void *)lazy_glGetnSeparableFilter,
+    (void *)lazy_glGetnHistogram,
+    (void *)lazy_glGetnMinmax,
+    (void *)lazy_glTextureBarrier,
+    (void *)lazy_glSpecializeShader,
+    (void *)lazy_glMultiDrawArraysIndirectCount,
+    (void *)lazy_glMultiDrawElementsIndirectCount,
+    (void *)lazy_glPolygonOffsetClamp,
+    (void *)lazy_glGetTextureHandleARB,
+    (void *)lazy_glGetTextureSamplerHandleARB,
+    (void *)lazy_glMakeTextureHandleResidentARB,
+    (void *)lazy_glMakeTextureHandleNonResidentARB,
+    (void *)lazy_glGetImageHandleARB,
+    (void *)lazy_glMakeImageHandleResidentARB,
+    (void *)lazy_glMakeImageHandleNonResidentARB,
+    (void *)lazy_glUniformHandleui64ARB,
+    (void *)lazy_glUniformHandleui64vARB,
+    (void *)lazy_glProgramUniformHandleui64ARB,
+    (void *)lazy_glProgramUniformHandleui64vARB,
+    (void *)lazy_glIsTextureHandleResidentARB,
+    (void *)lazy_glIsImageHandleResidentARB,
+    (void *)lazy_glVertexAttribL1ui64ARB,
+    (void *)lazy_glVertexAttribL1ui64vARB,
+    (void *)lazy_glGetVertexAttribLui64vARB,
+    (void *)lazy_glSpecializeShaderARB,
+    (void *)lazy_glMultiDrawArraysIndirectCountARB,
+    (void *)lazy_glMultiDrawElementsIndirectCountARB,
+    (void *)lazy_glMaxShaderCompilerThreadsKHR,
+};
+
+int gladLoadGLContextLazy(GladGLContext *context, GLADloadproc load)
+{
+    if (!loadContextCommon(context, load)) {
+        return 0;
+    }
+    for (size_t ix=0; ix < sizeof(gladFunctions) / sizeof(gladFunctions[0]); ix++) {
+        if (isAvailable(context, &gladFunctions[ix])) {
+            memcpy((char *)context + gladFunctions[ix].offset, &gladTrampolines[ix], sizeof(void *));
+        }
+    }
+    return 1;
+}
@@ -1,12 +1,15 @@
 
 #include <lean/lean.h>
 
-#include <glad/glad.h>
+#include <glad/glad_context.h>
 #include <GLFW/glfw3.h>
 
 #include "data_marshal.h"
+#include "gl_loader.h"
+#include "window_state.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 
 // glfwInit : IO Unit
 //
@@ -34,6 +37,191 @@ lean_obj_res lean_glfw_create_window()
     return lean_io_result_mk_ok(lean_mk_ptr(window));
 }
 
+/*inductive ContextErrorMode
+  | Default
+  | Debug
+  | NoError
+*/
+
+/*structure WindowConfig where
+  title : String
+  width height contextMajor contextMinor samples depthBits stencilBits alphaBits refreshRate : UInt32
+  fullscreen coreProfile visible resizable srgb doubleBuffer transparent : Bool
+  errorMode : ContextErrorMode
+*/
+#define WINDOW_CONFIG_SCALARS sizeof(void*)
+
+GLFWwindow *createSharedContextWindow(GLFWwindow *share)
+{
+    glfwDefaultWindowHints();
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    // a worker context never presents, so skip everything but the context itself
+    glfwWindowHint(GLFW_DEPTH_BITS, 0);
+    glfwWindowHint(GLFW_STENCIL_BITS, 0);
+    glfwWindowHint(GLFW_DOUBLEBUFFER, GLFW_FALSE);
+    GLFWwindow *window = glfwCreateWindow(1, 1, "shared context", NULL, share);
+    glfwDefaultWindowHints();
+    return window;
+}
+
+// glfwCreateWindowWithConfig : @& WindowConfig → IO Window
+//
+lean_obj_res lean_glfw_create_window_with_config(b_lean_obj_arg config)
+{
+    const char *title = lean_string_cstr(lean_ctor_get(config, 0));
+    uint32_t width = lean_ctor_get_uint32(config, WINDOW_CONFIG_SCALARS + 0);
+    uint32_t height = lean_ctor_get_uint32(config, WINDOW_CONFIG_SCALARS + 4);
+    uint32_t contextMajor = lean_ctor_get_uint32(config, WINDOW_CONFIG_SCALARS + 8);
+    uint32_t contextMinor = lean_ctor_get_uint32(config, WINDOW_CONFIG_SCALARS + 12);
+    uint32_t samples = lean_ctor_get_uint32(config, WINDOW_CONFIG_SCALARS + 16);
+    uint32_t depthBits = lean_ctor_get_uint32(config, WINDOW_CONFIG_SCALARS + 20);
+    uint32_t stencilBits = lean_ctor_get_uint32(config, WINDOW_CONFIG_SCALARS + 24);
+    uint32_t alphaBits = lean_ctor_get_uint32(config, WINDOW_CONFIG_SCALARS + 28);
+    uint32_t refreshRate = lean_ctor_get_uint32(config, WINDOW_CONFIG_SCALARS + 32);
+    uint8_t fullscreen = lean_ctor_get_uint8(config, WINDOW_CONFIG_SCALARS + 36);
+    uint8_t coreProfile = lean_ctor_get_uint8(config, WINDOW_CONFIG_SCALARS + 37);
+    uint8_t visible = lean_ctor_get_uint8(config, WINDOW_CONFIG_SCALARS + 38);
+    uint8_t resizable = lean_ctor_get_uint8(config, WINDOW_CONFIG_SCALARS + 39);
+    uint8_t srgb = lean_ctor_get_uint8(config, WINDOW_CONFIG_SCALARS + 40);
+    uint8_t doubleBuffer = lean_ctor_get_uint8(config, WINDOW_CONFIG_SCALARS + 41);
+    uint8_t transparent = lean_ctor_get_uint8(config, WINDOW_CONFIG_SCALARS + 42);
+    uint8_t errorMode = lean_ctor_get_uint8(config, WINDOW_CONFIG_SCALARS + 43);
+
+    if (width == 0 || height == 0) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("glfwCreateWindowWithConfig: width and height must be non-zero")));
+    }
+
+    // start from the defaults so hints from an earlier window don't leak into this one
+    glfwDefaultWindowHints();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, (int)contextMajor);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, (int)contextMinor);
+    if (coreProfile && (contextMajor > 3 || (contextMajor == 3 && contextMinor >= 2))) {
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    }
+    glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
+    glfwWindowHint(GLFW_RESIZABLE, resizable ? GLFW_TRUE : GLFW_FALSE);
+    glfwWindowHint(GLFW_SRGB_CAPABLE, srgb ? GLFW_TRUE : GLFW_FALSE);
+    glfwWindowHint(GLFW_DOUBLEBUFFER, doubleBuffer ? GLFW_TRUE : GLFW_FALSE);
+    glfwWindowHint(GLFW_TRANSPARENT_FRAMEBUFFER, transparent ? GLFW_TRUE : GLFW_FALSE);
+    // a transparent framebuffer needs destination alpha
+    glfwWindowHint(GLFW_ALPHA_BITS, transparent && alphaBits < 8 ? 8 : (int)alphaBits);
+    glfwWindowHint(GLFW_SAMPLES, (int)samples);
+    glfwWindowHint(GLFW_DEPTH_BITS, (int)depthBits);
+    glfwWindowHint(GLFW_STENCIL_BITS, (int)stencilBits);
+    glfwWindowHint(GLFW_REFRESH_RATE, refreshRate == 0 ? GLFW_DONT_CARE : (int)refreshRate);
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, errorMode == 1 ? GLFW_TRUE : GLFW_FALSE);
+    glfwWindowHint(GLFW_CONTEXT_NO_ERROR, errorMode == 2 ? GLFW_TRUE : GLFW_FALSE);
+
+    GLFWmonitor *monitor = NULL;
+    if (fullscreen) {
+        monitor = glfwGetPrimaryMonitor();
+        if (monitor == NULL) {
+            glfwDefaultWindowHints();
+            return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("glfwCreateWindowWithConfig: fullscreen requested but no monitor is connected")));
+        }
+    }
+
+    GLFWwindow* window = glfwCreateWindow((int)width, (int)height, title, monitor, NULL);
+    glfwDefaultWindowHints();
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Error calling glfwCreateWindow in glfwCreateWindowWithConfig")));
+    }
+    return lean_io_result_mk_ok(lean_mk_ptr(window));
+}
+
+// glfwCreateSharedContext : @& Window → IO Window
+//
+// A hidden 1x1 window whose context shares objects with the given window's, for making current
+// on a worker thread. Must be called on the main thread, like every window creation.
+lean_obj_res lean_glfw_create_shared_context(b_lean_obj_arg lw)
+{
+    GLFWwindow *share = (GLFWwindow *)(lean_get_external_data(lw));
+    if (share == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to glfwCreateSharedContext")));
+    }
+    GLFWwindow *window = createSharedContextWindow(share);
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Error calling glfwCreateWindow in glfwCreateSharedContext")));
+    }
+    return lean_io_result_mk_ok(lean_mk_ptr(window));
+}
+
+// glfwInitHeadless : IO Unit
+//
+// GLFW 3.4 has a null platform that needs no display server; windows on it are just
+// bookkeeping and the context comes from EGL (surfaceless on Mesa) or OSMesa. Older GLFW
+// builds fall back to the normal platform, which needs a display.
+lean_obj_res lean_glfw_init_headless()
+{
+#ifdef GLFW_PLATFORM_NULL
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#endif
+    int ok = glfwInit();
+#ifdef GLFW_PLATFORM_NULL
+    glfwInitHint(GLFW_PLATFORM, GLFW_ANY_PLATFORM);
+#endif
+    if (ok) {
+        return lean_return_unit();
+    }
+    else {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Error calling glfwInit for a headless context")));
+    }
+}
+
+// glfwCreateHeadlessWindow : (width : UInt32) → (height : UInt32) → IO Window
+//
+// A hidden window whose only purpose is to own a 4.5 context; rendering goes to framebuffer
+// objects and is read back. The default framebuffer is not used so it is kept minimal.
+// EGL is tried first since Mesa's llvmpipe supports it without a display, then OSMesa.
+lean_obj_res lean_glfw_create_headless_window(uint32_t width, uint32_t height)
+{
+    static const int contextApis[] = { GLFW_EGL_CONTEXT_API, GLFW_OSMESA_CONTEXT_API, GLFW_NATIVE_CONTEXT_API };
+
+    GLFWwindow* window = NULL;
+    for (size_t ix=0; ix < sizeof(contextApis) / sizeof(contextApis[0]) && window == NULL; ix++) {
+        glfwDefaultWindowHints();
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, contextApis[ix]);
+        glfwWindowHint(GLFW_DEPTH_BITS, 0);
+        glfwWindowHint(GLFW_STENCIL_BITS, 0);
+        glfwWindowHint(GLFW_DOUBLEBUFFER, GLFW_FALSE);
+        window = glfwCreateWindow(width > 0 ? (int)width : 1, height > 0 ? (int)height : 1, "headless", NULL, NULL);
+    }
+    glfwDefaultWindowHints();
+
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Error calling glfwCreateWindow for a headless context (no EGL, OSMesa or native context available)")));
+    }
+    return lean_io_result_mk_ok(lean_mk_ptr(window));
+}
+
+// Switching contexts only swaps the thread-local table pointer; the table is loaded once per
+// context, so contexts on different threads each call through their own entry points.
+int makeWindowContextCurrent(GLFWwindow *window)
+{
+    windowState_t *state = getWindowState(window);
+    glfwMakeContextCurrent(window);
+    if (state->gl == NULL) {
+        GladGLContext *gl = malloc(sizeof(GladGLContext));
+        if (!loadGLContextTable(gl)) {
+            gladFreeGLContext(gl);
+            free(gl);
+            return 0;
+        }
+        state->gl = gl;
+        gladCurrentContext = gl;
+        queryCapabilities(&state->caps);
+    }
+    gladCurrentContext = state->gl;
+    return 1;
+}
+
 // glfwMakeCurrentContext : Window -> IO Unit
 lean_obj_res lean_glfw_make_context_current(b_lean_obj_arg lw)
 {
@@ -43,10 +231,8 @@ lean_obj_res lean_glfw_make_context_current(b_lean_obj_arg lw)
    }
    else
    {
-        glfwMakeContextCurrent(window);
-       
-        if (!gladLoadGLLoader((GLADloadproc) glfwGetProcAddress)) {
-            return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Call to 'gladLoadGLLoader' failed in glfwMakeCurrentContext")));
+        if (!makeWindowContextCurrent(window)) {
+            return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Loading the GL function table failed in glfwMakeCurrentContext")));
         }
         else {
             return lean_return_unit();
@@ -63,6 +249,7 @@ lean_obj_res lean_glfw_destroy_window(lean_obj_arg lw)
         return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to glfwDestroyWindow")));
    }
    else {
+       destroyWindowState(window);
        glfwDestroyWindow(window);
    }
    return lean_return_unit();
@@ -117,6 +304,21 @@ lean_obj_res lean_glfw_get_time()
     return lean_io_result_mk_ok(lean_box_float(glfwGetTime()));
 }
 
+// glfwGetTimerValue : IO UInt64
+//
+// the raw monotonic counter, in glfwGetTimerFrequency ticks per second
+lean_obj_res lean_glfw_get_timer_value()
+{
+    return lean_io_result_mk_ok(lean_box_uint64(glfwGetTimerValue()));
+}
+
+// glfwGetTimerFrequency : IO UInt64
+//
+lean_obj_res lean_glfw_get_timer_frequency()
+{
+    return lean_io_result_mk_ok(lean_box_uint64(glfwGetTimerFrequency()));
+}
+
 // glfwSwapBuffers : Window -> IO Unit
 //
 lean_obj_res lean_glfw_swap_buffers(lean_obj_arg lw)
@@ -146,4 +348,73 @@ lean_obj_res lean_glfw_poll_events()
 {
     glfwPollEvents();
     return lean_return_unit();
-}
\ No newline at end of file
+}
+
+// glfwWaitEvents : IO Unit
+//
+lean_obj_res lean_glfw_wait_events()
+{
+    glfwWaitEvents();
+    return lean_return_unit();
+}
+
+// glfwWaitEventsTimeout : (timeout : Float) → IO Unit
+//
+lean_obj_res lean_glfw_wait_events_timeout(double timeout)
+{
+    glfwWaitEventsTimeout(timeout);
+    return lean_return_unit();
+}
+
+// glfwPostEmptyEvent : IO Unit
+//
+lean_obj_res lean_glfw_post_empty_event()
+{
+    glfwPostEmptyEvent();
+    return lean_return_unit();
+}
+
+/*structure FrameTick where
+  timestamp : UInt64
+  framebufferWidth : UInt32
+  framebufferHeight : UInt32
+  eventCount : UInt32
+  shouldClose : Bool
+  framebufferResized : Bool
+*/
+
+// frameTick : @& Window → IO FrameTick
+//
+// swap, poll, close check and timestamp in one call, returning one small unboxed structure
+lean_obj_res lean_glfw_frame_tick(b_lean_obj_arg lw)
+{
+    GLFWwindow *window = (GLFWwindow *)(lean_get_external_data(lw));
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to frameTick")));
+    }
+    windowState_t *state = getWindowState(window);
+
+    glfwSwapBuffers(window);
+    glfwPollEvents();
+
+    uint64_t timestamp = glfwGetTimerValue();
+    int shouldClose = glfwWindowShouldClose(window);
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    int resized = width != state->tickWidth || height != state->tickHeight;
+    state->tickWidth = width;
+    state->tickHeight = height;
+    uint32_t eventCount = 0;
+    if (state->ring.events != NULL) {
+        eventCount = atomic_load_explicit(&state->ring.head, memory_order_relaxed) - atomic_load_explicit(&state->ring.tail, memory_order_relaxed);
+    }
+
+    lean_object *tick = lean_alloc_ctor(0, 0, 22);
+    lean_ctor_set_uint64(tick, 0, timestamp);
+    lean_ctor_set_uint32(tick, 8, (uint32_t)width);
+    lean_ctor_set_uint32(tick, 12, (uint32_t)height);
+    lean_ctor_set_uint32(tick, 16, eventCount);
+    lean_ctor_set_uint8(tick, 20, shouldClose ? 1 : 0);
+    lean_ctor_set_uint8(tick, 21, resized ? 1 : 0);
+    return lean_io_result_mk_ok(tick);
+}
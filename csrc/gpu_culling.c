@@ -0,0 +1,293 @@
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+#include <GLFW/glfw3.h>
+
+#include "data_marshal.h"
+#include "opengl_ffi.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+//
+// GPU driven frustum culling. A compute pass tests one bounding sphere per instance against the
+// frustum planes and appends a DrawElementsIndirectCommand for each survivor, using an atomic
+// counter to compact the output. The counter buffer is then used directly as the draw count
+// parameter for glMultiDrawElementsIndirectCount, so nothing is ever read back to the CPU.
+//
+
+// matches the layout GL expects in the indirect buffer
+typedef struct {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint  baseVertex;
+    GLuint baseInstance;
+} drawElementsCommand_t;
+
+#define CULL_GROUP_SIZE 64
+
+static const char *cullShaderSource =
+"#version 450 core\n"
+"layout (local_size_x = 64) in;\n"
+"struct DrawCommand { uint count; uint instanceCount; uint firstIndex; int baseVertex; uint baseInstance; };\n"
+"layout (std430, binding = 0) readonly buffer InstanceBounds { vec4 bounds[]; };\n"
+"layout (std430, binding = 1) readonly buffer CommandTemplates { DrawCommand templates[]; };\n"
+"layout (std430, binding = 2) writeonly buffer VisibleCommands { DrawCommand commands[]; };\n"
+"layout (binding = 0, offset = 0) uniform atomic_uint visibleCount;\n"
+"uniform vec4 frustumPlanes[6];\n"
+"uniform uint instanceCount;\n"
+"void main() {\n"
+"  uint ix = gl_GlobalInvocationID.x;\n"
+"  if (ix >= instanceCount) return;\n"
+"  vec4 sphere = bounds[ix];\n"
+"  for (int p = 0; p < 6; p++) {\n"
+"    if (dot(frustumPlanes[p].xyz, sphere.xyz) + frustumPlanes[p].w < -sphere.w) return;\n"
+"  }\n"
+"  uint slot = atomicCounterIncrement(visibleCount);\n"
+"  DrawCommand cmd = templates[ix];\n"
+"  cmd.instanceCount = 1u;\n"
+"  cmd.baseInstance = ix;\n"
+"  commands[slot] = cmd;\n"
+"}\n";
+
+typedef struct {
+    GLuint program;
+    GLint planesLocation;
+    GLint instanceCountLocation;
+    GLuint commandBuffer;   // compacted DrawElementsIndirectCommands
+    GLuint counterBuffer;   // one GLuint atomic counter, also the draw count parameter
+    uint32_t maxInstances;
+    uint32_t lastInstanceCount;
+    int countDraw;          // glMultiDrawElementsIndirectCount, core or ARB_indirect_parameters
+} gpuCuller_t;
+
+// looked up in the current context's table at each draw, so the culler follows the context
+// (and lazily resolved entry points) it is drawn with
+static PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC multiDrawIndirectCount()
+{
+    return GLAD_GL_VERSION_4_6 ? glMultiDrawElementsIndirectCount : glMultiDrawElementsIndirectCountARB;
+}
+
+static lean_obj_res cullerError(const char *message)
+{
+    return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string(message)));
+}
+
+// createGPUCuller : (maxInstances : UInt32) → IO GPUCuller
+//
+lean_obj_res lean_gpuculler_create(uint32_t maxInstances)
+{
+    if (!GLAD_GL_VERSION_4_3) {
+        return cullerError("GPU culling needs compute shaders (OpenGL 4.3 or later)");
+    }
+    if (maxInstances == 0) {
+        return cullerError("createGPUCuller needs maxInstances > 0");
+    }
+
+    GLuint shader = glCreateShader(GL_COMPUTE_SHADER);
+    glShaderSource(shader, 1, &cullShaderSource, NULL);
+    glCompileShader(shader);
+    GLint result;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &result);
+    if (result != GL_TRUE) {
+        GLint logLength;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &logLength);
+        GLchar *logString = malloc(logLength);
+        glGetShaderInfoLog(shader, logLength, NULL, logString);
+        lean_obj_res errorLog = lean_mk_string(logString);
+        free(logString);
+        glDeleteShader(shader);
+        return lean_io_result_mk_error(lean_mk_io_user_error(errorLog));
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, shader);
+    glLinkProgram(program);
+    glDeleteShader(shader);
+    glGetProgramiv(program, GL_LINK_STATUS, &result);
+    if (result != GL_TRUE) {
+        GLint logLength;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &logLength);
+        GLchar *logString = malloc(logLength);
+        glGetProgramInfoLog(program, logLength, NULL, logString);
+        lean_obj_res errorLog = lean_mk_string(logString);
+        free(logString);
+        glDeleteProgram(program);
+        return lean_io_result_mk_error(lean_mk_io_user_error(errorLog));
+    }
+
+    gpuCuller_t *culler = calloc(1, sizeof(gpuCuller_t));
+    culler->program = program;
+    culler->planesLocation = glGetUniformLocation(program, "frustumPlanes");
+    culler->instanceCountLocation = glGetUniformLocation(program, "instanceCount");
+    culler->maxInstances = maxInstances;
+    culler->countDraw = GLAD_GL_VERSION_4_6 || GLAD_GL_ARB_indirect_parameters;
+
+    glCreateBuffers(1, &culler->commandBuffer);
+    glNamedBufferStorage(culler->commandBuffer, (GLsizeiptr)maxInstances * sizeof(drawElementsCommand_t), NULL, GL_DYNAMIC_STORAGE_BIT);
+    glCreateBuffers(1, &culler->counterBuffer);
+    glNamedBufferStorage(culler->counterBuffer, sizeof(GLuint), NULL, GL_DYNAMIC_STORAGE_BIT);
+
+    return lean_io_result_mk_ok(lean_mk_ptr(culler));
+}
+
+// destroyGPUCuller : GPUCuller → IO Unit
+//
+lean_obj_res lean_gpuculler_destroy(lean_obj_arg lculler)
+{
+    gpuCuller_t *culler = (gpuCuller_t *)lean_get_external_data(lculler);
+    if (culler == NULL) {
+        return cullerError("NULL culler passed to destroyGPUCuller");
+    }
+    glDeleteProgram(culler->program);
+    glDeleteBuffers(1, &culler->commandBuffer);
+    glDeleteBuffers(1, &culler->counterBuffer);
+    free(culler);
+    lean_clear_ptr(lculler);
+    return lean_return_unit();
+}
+
+// extract the six frustum planes from a column-major view-projection matrix (Gribb/Hartmann),
+// normalized so the plane distance can be compared against the sphere radius.
+static void extractFrustumPlanes(const double *m, GLfloat planes[24])
+{
+    // row i of the matrix is (m[i], m[4+i], m[8+i], m[12+i])
+    for (int p = 0; p < 6; p++) {
+        int row = p / 2;
+        double sign = (p % 2 == 0) ? 1.0 : -1.0;
+        double plane[4];
+        for (int c = 0; c < 4; c++) {
+            plane[c] = m[c*4 + 3] + sign * m[c*4 + row];
+        }
+        double length = sqrt(plane[0]*plane[0] + plane[1]*plane[1] + plane[2]*plane[2]);
+        if (length > 0.0) {
+            for (int c = 0; c < 4; c++) { plane[c] /= length; }
+        }
+        for (int c = 0; c < 4; c++) {
+            planes[p*4 + c] = (GLfloat)plane[c];
+        }
+    }
+}
+
+// gpuCull : GPUCuller → (viewProjection : FloatArray) → (boundsBuffer : GLBufferObject) → (commandTemplates : GLBufferObject) → (instanceCount : UInt32) → IO Unit
+//
+lean_obj_res lean_gpuculler_cull(
+    b_lean_obj_arg lculler, b_lean_obj_arg viewProjection,
+    uint32_t boundsBuffer, uint32_t templateBuffer, uint32_t instanceCount)
+{
+    gpuCuller_t *culler = (gpuCuller_t *)lean_get_external_data(lculler);
+    if (culler == NULL) {
+        return cullerError("NULL culler passed to gpuCull");
+    }
+    if (lean_sarray_size(viewProjection) != 16) {
+        return cullerError("View-projection matrix needs to be 16 floats in gpuCull");
+    }
+    if (instanceCount > culler->maxInstances) {
+        return cullerError("instanceCount is larger than the maxInstances given to createGPUCuller");
+    }
+
+    GLfloat planes[24];
+    extractFrustumPlanes((const double *)lean_sarray_cptr(viewProjection), planes);
+
+    // reset the counter on the GPU. Without the count draw we issue maxDrawCount commands,
+    // so zero the command buffer too: commands past the visible count have count=0 and draw nothing.
+    GLuint zero = 0;
+    glClearNamedBufferData(culler->counterBuffer, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+    if (!culler->countDraw) {
+        glClearNamedBufferData(culler->commandBuffer, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+    }
+
+    // leave the caller's program bound afterwards
+    GLint previousProgram = 0;
+    glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+    glUseProgram(culler->program);
+    glProgramUniform4fv(culler->program, culler->planesLocation, 6, planes);
+    glProgramUniform1ui(culler->program, culler->instanceCountLocation, instanceCount);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, boundsBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, templateBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, culler->commandBuffer);
+    glBindBufferBase(GL_ATOMIC_COUNTER_BUFFER, 0, culler->counterBuffer);
+
+    glDispatchCompute((instanceCount + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE, 1, 1);
+
+    // the indirect commands and the draw count are both consumed as command data
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+    glUseProgram((GLuint)previousProgram);
+
+    culler->lastInstanceCount = instanceCount;
+    return lean_return_unit();
+}
+
+// gpuCullDraw : GPUCuller → GLDrawMode → (indexType : GLDataType) → GLVertexArrayObject → IO Unit
+//
+lean_obj_res lean_gpuculler_draw(b_lean_obj_arg lculler, uint8_t mode, uint8_t indexType, uint32_t vao)
+{
+    gpuCuller_t *culler = (gpuCuller_t *)lean_get_external_data(lculler);
+    if (culler == NULL) {
+        return cullerError("NULL culler passed to gpuCullDraw");
+    }
+
+    glBindVertexArray(vao);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, culler->commandBuffer);
+    if (culler->countDraw) {
+        glBindBuffer(GL_PARAMETER_BUFFER, culler->counterBuffer);
+        multiDrawIndirectCount()(
+            convertGLDrawMode(mode), convertGLDataType(indexType),
+            NULL, 0, (GLsizei)culler->lastInstanceCount, sizeof(drawElementsCommand_t));
+        glBindBuffer(GL_PARAMETER_BUFFER, 0);
+    }
+    else {
+        glMultiDrawElementsIndirect(
+            convertGLDrawMode(mode), convertGLDataType(indexType),
+            NULL, (GLsizei)culler->lastInstanceCount, sizeof(drawElementsCommand_t));
+    }
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+    return lean_return_unit();
+}
+
+// gpuCullerOutputBuffers : GPUCuller → IO (GLBufferObject × GLBufferObject)
+//
+// the compacted command buffer and the visible count buffer, for callers that want to issue
+// their own indirect draws
+lean_obj_res lean_gpuculler_output_buffers(b_lean_obj_arg lculler)
+{
+    gpuCuller_t *culler = (gpuCuller_t *)lean_get_external_data(lculler);
+    if (culler == NULL) {
+        return cullerError("NULL culler passed to gpuCullerOutputBuffers");
+    }
+    lean_object* tuple = lean_alloc_ctor(0, 2, 0);
+    lean_ctor_set(tuple, 0, lean_box_uint32(culler->commandBuffer));
+    lean_ctor_set(tuple, 1, lean_box_uint32(culler->counterBuffer));
+    return lean_io_result_mk_ok(tuple);
+}
+
+/*
+structure DrawElementsIndirectCommand where
+  count : UInt32
+  instanceCount : UInt32
+  firstIndex : UInt32
+  baseVertex : UInt32
+  baseInstance : UInt32
+*/
+
+// packDrawElementsCommands : Array DrawElementsIndirectCommand → ByteArray
+//
+lean_obj_res lean_pack_draw_elements_commands(b_lean_obj_arg commands)
+{
+    size_t commandCount = lean_array_size(commands);
+    lean_object *packed = lean_alloc_sarray(1, commandCount * sizeof(drawElementsCommand_t), commandCount * sizeof(drawElementsCommand_t));
+    drawElementsCommand_t *out = (drawElementsCommand_t *)lean_sarray_cptr(packed);
+    for (size_t ix=0; ix < commandCount; ix++) {
+        // structure with only scalar fields: five UInt32 values stored in declaration order
+        lean_object *cmd = lean_array_get_core(commands, ix);
+        out[ix].count         = lean_ctor_get_uint32(cmd, 0);
+        out[ix].instanceCount = lean_ctor_get_uint32(cmd, 4);
+        out[ix].firstIndex    = lean_ctor_get_uint32(cmd, 8);
+        out[ix].baseVertex    = (GLint)lean_ctor_get_uint32(cmd, 12);
+        out[ix].baseInstance  = lean_ctor_get_uint32(cmd, 16);
+    }
+    return packed;
+}
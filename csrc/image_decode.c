@@ -0,0 +1,657 @@
+#include "image_decode.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Image decoders used by the texture loading worker pool. Only what texture loading needs:
+// - PNG: all color types, bit depths 1-16, non-interlaced, tRNS transparency
+// - QOI: the whole format
+// Everything is converted to RGBA8. PNG needs zlib inflate, which is implemented here with
+// table-driven Huffman decoding rather than adding a library dependency.
+//
+
+// keeps a hostile header from asking for an enormous allocation
+#define MAX_IMAGE_PIXELS (1u << 28)
+
+static decodedImage_t decodeFailure(const char *message)
+{
+    decodedImage_t result = { 0, 0, NULL, message };
+    return result;
+}
+
+static uint32_t readBE32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+
+//
+// inflate (RFC 1951)
+//
+
+#define HUFF_FAST_BITS 10
+#define HUFF_MAX_BITS 15
+
+typedef struct {
+    uint16_t fast[1 << HUFF_FAST_BITS];  // symbol | length << 9, 0 if the code is longer than HUFF_FAST_BITS
+    uint16_t count[HUFF_MAX_BITS + 1];   // number of codes of each length
+    uint16_t symbol[288];                // symbols ordered by code
+} huffman_t;
+
+typedef struct {
+    const uint8_t *src;
+    size_t length;
+    size_t pos;
+    uint64_t bits;
+    int bitCount;
+    int overrun;      // zero bytes padded in past the end of the input
+    uint8_t *out;
+    size_t outLength;
+    size_t outPos;
+} inflateState_t;
+
+static inline void needBits(inflateState_t *s, int n)
+{
+    while (s->bitCount < n) {
+        uint64_t byte = 0;
+        if (s->pos < s->length) {
+            byte = s->src[s->pos++];
+        }
+        else {
+            s->overrun++;
+        }
+        s->bits |= byte << s->bitCount;
+        s->bitCount += 8;
+    }
+}
+
+static inline uint32_t getBits(inflateState_t *s, int n)
+{
+    if (n == 0) {
+        return 0;
+    }
+    needBits(s, n);
+    uint32_t value = (uint32_t)(s->bits & ((1u << n) - 1));
+    s->bits >>= n;
+    s->bitCount -= n;
+    return value;
+}
+
+// returns 0 if the lengths don't form a valid (possibly incomplete) prefix code
+static int buildHuffman(huffman_t *h, const uint8_t *lengths, int symbolCount)
+{
+    memset(h->count, 0, sizeof(h->count));
+    memset(h->fast, 0, sizeof(h->fast));
+    for (int sym=0; sym < symbolCount; sym++) {
+        h->count[lengths[sym]]++;
+    }
+    h->count[0] = 0;
+
+    int left = 1;
+    for (int len=1; len <= HUFF_MAX_BITS; len++) {
+        left <<= 1;
+        left -= h->count[len];
+        if (left < 0) {
+            return 0; // over-subscribed
+        }
+    }
+
+    uint16_t offsets[HUFF_MAX_BITS + 2];
+    uint32_t nextCode[HUFF_MAX_BITS + 1];
+    offsets[1] = 0;
+    uint32_t code = 0;
+    for (int len=1; len <= HUFF_MAX_BITS; len++) {
+        offsets[len + 1] = offsets[len] + h->count[len];
+        code = (code + (len > 1 ? h->count[len - 1] : 0)) << 1;
+        nextCode[len] = code;
+    }
+
+    for (int sym=0; sym < symbolCount; sym++) {
+        int len = lengths[sym];
+        if (len == 0) {
+            continue;
+        }
+        h->symbol[offsets[len]++] = (uint16_t)sym;
+
+        uint32_t c = nextCode[len]++;
+        if (len <= HUFF_FAST_BITS) {
+            // deflate sends codes MSB first into an LSB first stream, so index the table by the reversed code
+            uint32_t reversed = 0;
+            for (int b=0; b < len; b++) {
+                reversed |= ((c >> b) & 1) << (len - 1 - b);
+            }
+            for (uint32_t j=reversed; j < (1u << HUFF_FAST_BITS); j += (1u << len)) {
+                h->fast[j] = (uint16_t)(sym | (len << 9));
+            }
+        }
+    }
+    return 1;
+}
+
+static int decodeSymbol(inflateState_t *s, const huffman_t *h)
+{
+    needBits(s, HUFF_MAX_BITS);
+    uint16_t entry = h->fast[s->bits & ((1u << HUFF_FAST_BITS) - 1)];
+    if (entry != 0) {
+        int len = entry >> 9;
+        s->bits >>= len;
+        s->bitCount -= len;
+        return entry & 0x1ff;
+    }
+
+    // long code: walk the canonical code one bit at a time
+    int code = 0, first = 0, index = 0;
+    for (int len=1; len <= HUFF_MAX_BITS; len++) {
+        code |= (int)(s->bits & 1);
+        s->bits >>= 1;
+        s->bitCount--;
+        int count = h->count[len];
+        if (code - count < first) {
+            return h->symbol[index + (code - first)];
+        }
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+static const uint16_t lengthBase[29] = { 3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258 };
+static const uint8_t lengthExtra[29] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0 };
+static const uint16_t distBase[30] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577 };
+static const uint8_t distExtra[30] = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+
+static int inflateCodes(inflateState_t *s, const huffman_t *lit, const huffman_t *dist)
+{
+    for (;;) {
+        int sym = decodeSymbol(s, lit);
+        if (sym < 0 || s->overrun > 4) {
+            return 0;
+        }
+        if (sym < 256) {
+            if (s->outPos >= s->outLength) {
+                return 0;
+            }
+            s->out[s->outPos++] = (uint8_t)sym;
+        }
+        else if (sym == 256) {
+            return 1;
+        }
+        else {
+            sym -= 257;
+            if (sym >= 29) {
+                return 0;
+            }
+            size_t len = lengthBase[sym] + getBits(s, lengthExtra[sym]);
+            int dsym = decodeSymbol(s, dist);
+            if (dsym < 0 || dsym >= 30) {
+                return 0;
+            }
+            size_t distance = distBase[dsym] + getBits(s, distExtra[dsym]);
+            if (distance > s->outPos || len > s->outLength - s->outPos) {
+                return 0;
+            }
+            // byte by byte: the source may overlap the bytes being written
+            uint8_t *dst = s->out + s->outPos;
+            const uint8_t *src = dst - distance;
+            for (size_t ix=0; ix < len; ix++) {
+                dst[ix] = src[ix];
+            }
+            s->outPos += len;
+        }
+    }
+}
+
+static int inflateStored(inflateState_t *s)
+{
+    // drop to a byte boundary; whole bytes still sitting in the bit buffer come first
+    s->bits >>= (s->bitCount & 7);
+    s->bitCount -= (s->bitCount & 7);
+    uint32_t len = getBits(s, 16);
+    uint32_t nlen = getBits(s, 16);
+    if ((len ^ 0xffff) != nlen) {
+        return 0;
+    }
+    while (len > 0 && s->bitCount > 0) {
+        if (s->outPos >= s->outLength) return 0;
+        s->out[s->outPos++] = (uint8_t)getBits(s, 8);
+        len--;
+    }
+    if (len > s->length - s->pos || len > s->outLength - s->outPos) {
+        return 0;
+    }
+    memcpy(s->out + s->outPos, s->src + s->pos, len);
+    s->pos += len;
+    s->outPos += len;
+    return 1;
+}
+
+static int inflateDynamic(inflateState_t *s, huffman_t *lit, huffman_t *dist)
+{
+    static const uint8_t order[19] = { 16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15 };
+    int litCount = (int)getBits(s, 5) + 257;
+    int distCount = (int)getBits(s, 5) + 1;
+    int codeLengthCount = (int)getBits(s, 4) + 4;
+    if (litCount > 286 || distCount > 30) {
+        return 0;
+    }
+
+    uint8_t lengths[286 + 30];
+    memset(lengths, 0, 19);
+    for (int ix=0; ix < codeLengthCount; ix++) {
+        lengths[order[ix]] = (uint8_t)getBits(s, 3);
+    }
+    huffman_t lengthCode;
+    if (!buildHuffman(&lengthCode, lengths, 19)) {
+        return 0;
+    }
+
+    int ix = 0;
+    while (ix < litCount + distCount) {
+        int sym = decodeSymbol(s, &lengthCode);
+        if (sym < 0 || s->overrun > 4) {
+            return 0;
+        }
+        if (sym < 16) {
+            lengths[ix++] = (uint8_t)sym;
+            continue;
+        }
+        uint8_t value = 0;
+        int repeat;
+        if (sym == 16) {
+            if (ix == 0) return 0;
+            value = lengths[ix - 1];
+            repeat = 3 + (int)getBits(s, 2);
+        }
+        else if (sym == 17) {
+            repeat = 3 + (int)getBits(s, 3);
+        }
+        else {
+            repeat = 11 + (int)getBits(s, 7);
+        }
+        if (ix + repeat > litCount + distCount) {
+            return 0;
+        }
+        while (repeat-- > 0) {
+            lengths[ix++] = value;
+        }
+    }
+    if (lengths[256] == 0) {
+        return 0; // no end of block code
+    }
+    return buildHuffman(lit, lengths, litCount) && buildHuffman(dist, lengths + litCount, distCount);
+}
+
+// zlib stream (RFC 1950) into a buffer of known size. Returns 1 and the number of bytes written
+// in *written, or 0 on a corrupt stream or when out of memory.
+static int zlibInflate(const uint8_t *src, size_t length, uint8_t *out, size_t outLength, size_t *written)
+{
+    if (length < 2 || (src[0] & 0x0f) != 8 || ((src[0] << 8) | src[1]) % 31 != 0 || (src[1] & 0x20)) {
+        return 0;
+    }
+
+    inflateState_t s;
+    memset(&s, 0, sizeof(s));
+    s.src = src + 2;
+    s.length = length - 2;
+    s.out = out;
+    s.outLength = outLength;
+
+    huffman_t *lit = malloc(sizeof(huffman_t));
+    huffman_t *dist = malloc(sizeof(huffman_t));
+    int finalBlock = 0, ok = lit != NULL && dist != NULL;
+    while (ok && !finalBlock) {
+        finalBlock = (int)getBits(&s, 1);
+        uint32_t type = getBits(&s, 2);
+        switch (type) {
+            case 0:
+                ok = inflateStored(&s);
+                break;
+            case 1: {
+                uint8_t lengths[288 + 30];
+                memset(lengths, 8, 144);
+                memset(lengths + 144, 9, 112);
+                memset(lengths + 256, 7, 24);
+                memset(lengths + 280, 8, 8);
+                memset(lengths + 288, 5, 30);
+                ok = buildHuffman(lit, lengths, 288) && buildHuffman(dist, lengths + 288, 30) && inflateCodes(&s, lit, dist);
+                break;
+            }
+            case 2:
+                ok = inflateDynamic(&s, lit, dist) && inflateCodes(&s, lit, dist);
+                break;
+            default:
+                ok = 0;
+        }
+        if (s.overrun > 4) {
+            ok = 0;
+        }
+    }
+    free(lit);
+    free(dist);
+    *written = s.outPos;
+    return ok;
+}
+
+
+//
+// PNG
+//
+
+static uint8_t paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int p = (int)a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+decodedImage_t decodePNG(const uint8_t *data, size_t length)
+{
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    if (length < 8 || memcmp(data, signature, 8) != 0) {
+        return decodeFailure("Not a PNG file");
+    }
+
+    uint32_t width = 0, height = 0;
+    uint8_t depth = 0, colorType = 0, interlace = 0;
+    uint8_t palette[256][4];
+    uint32_t paletteSize = 0;
+    int hasColorKey = 0;
+    uint16_t colorKey[3] = { 0, 0, 0 };
+    uint8_t *idat = NULL;
+    size_t idatLength = 0, idatCapacity = 0;
+
+    for (int ix=0; ix < 256; ix++) {
+        palette[ix][0] = palette[ix][1] = palette[ix][2] = 0;
+        palette[ix][3] = 255;
+    }
+
+    size_t pos = 8;
+    int sawHeader = 0, sawEnd = 0;
+    while (pos + 12 <= length && !sawEnd) {
+        uint32_t chunkLength = readBE32(data + pos);
+        const uint8_t *type = data + pos + 4;
+        const uint8_t *chunk = data + pos + 8;
+        if (chunkLength > length - pos - 12) {
+            free(idat);
+            return decodeFailure("Truncated PNG chunk");
+        }
+
+        if (memcmp(type, "IHDR", 4) == 0 && chunkLength >= 13) {
+            width = readBE32(chunk);
+            height = readBE32(chunk + 4);
+            depth = chunk[8];
+            colorType = chunk[9];
+            interlace = chunk[12];
+            sawHeader = 1;
+        }
+        else if (memcmp(type, "PLTE", 4) == 0) {
+            paletteSize = chunkLength / 3;
+            if (paletteSize > 256) paletteSize = 256;
+            for (uint32_t p=0; p < paletteSize; p++) {
+                palette[p][0] = chunk[p*3];
+                palette[p][1] = chunk[p*3+1];
+                palette[p][2] = chunk[p*3+2];
+            }
+        }
+        else if (memcmp(type, "tRNS", 4) == 0) {
+            if (colorType == 3) {
+                for (uint32_t p=0; p < chunkLength && p < 256; p++) {
+                    palette[p][3] = chunk[p];
+                }
+            }
+            else if (colorType == 0 && chunkLength >= 2) {
+                hasColorKey = 1;
+                colorKey[0] = (uint16_t)((chunk[0] << 8) | chunk[1]);
+            }
+            else if (colorType == 2 && chunkLength >= 6) {
+                hasColorKey = 1;
+                for (int c=0; c < 3; c++) {
+                    colorKey[c] = (uint16_t)((chunk[c*2] << 8) | chunk[c*2+1]);
+                }
+            }
+        }
+        else if (memcmp(type, "IDAT", 4) == 0) {
+            if (idatLength + chunkLength > idatCapacity) {
+                idatCapacity = (idatLength + chunkLength) * 2;
+                uint8_t *grown = realloc(idat, idatCapacity);
+                if (grown == NULL) {
+                    free(idat);
+                    return decodeFailure("out of memory");
+                }
+                idat = grown;
+            }
+            memcpy(idat + idatLength, chunk, chunkLength);
+            idatLength += chunkLength;
+        }
+        else if (memcmp(type, "IEND", 4) == 0) {
+            sawEnd = 1;
+        }
+        pos += 12 + chunkLength;
+    }
+
+    if (!sawHeader || idat == NULL) {
+        free(idat);
+        return decodeFailure("PNG has no header or image data");
+    }
+    if (interlace != 0) {
+        free(idat);
+        return decodeFailure("Interlaced PNGs are not supported");
+    }
+
+    int channels;
+    switch (colorType) {
+        case 0: channels = 1; break;  // gray
+        case 2: channels = 3; break;  // rgb
+        case 3: channels = 1; break;  // palette
+        case 4: channels = 2; break;  // gray + alpha
+        case 6: channels = 4; break;  // rgba
+        default:
+            free(idat);
+            return decodeFailure("Invalid PNG color type");
+    }
+    int validDepth = (depth == 8) || (depth == 16 && colorType != 3)
+        || ((depth == 1 || depth == 2 || depth == 4) && (colorType == 0 || colorType == 3));
+    if (!validDepth) {
+        free(idat);
+        return decodeFailure("Invalid PNG bit depth");
+    }
+    if (width == 0 || height == 0 || (uint64_t)width * height > MAX_IMAGE_PIXELS) {
+        free(idat);
+        return decodeFailure("PNG dimensions out of range");
+    }
+
+    size_t bitsPerPixel = (size_t)channels * depth;
+    size_t rowBytes = (width * bitsPerPixel + 7) / 8;
+    size_t filterBpp = bitsPerPixel >= 8 ? bitsPerPixel / 8 : 1;
+    size_t rawLength = (rowBytes + 1) * height;
+    uint8_t *raw = malloc(rawLength);
+    if (raw == NULL) {
+        free(idat);
+        return decodeFailure("out of memory");
+    }
+    size_t inflated = 0;
+    int inflateOk = zlibInflate(idat, idatLength, raw, rawLength, &inflated);
+    free(idat);
+    if (!inflateOk || inflated != rawLength) {
+        free(raw);
+        return decodeFailure("Corrupt PNG image data");
+    }
+
+    // undo the per-row filters in place; row y starts at raw + y*(rowBytes+1) + 1
+    for (uint32_t y=0; y < height; y++) {
+        uint8_t filter = raw[y * (rowBytes + 1)];
+        uint8_t *row = raw + y * (rowBytes + 1) + 1;
+        const uint8_t *prior = y > 0 ? row - (rowBytes + 1) : NULL;
+        for (size_t x=0; x < rowBytes; x++) {
+            uint8_t a = x >= filterBpp ? row[x - filterBpp] : 0;
+            uint8_t b = prior ? prior[x] : 0;
+            uint8_t c = (prior && x >= filterBpp) ? prior[x - filterBpp] : 0;
+            switch (filter) {
+                case 0: break;
+                case 1: row[x] += a; break;
+                case 2: row[x] += b; break;
+                case 3: row[x] += (uint8_t)(((int)a + b) >> 1); break;
+                case 4: row[x] += paeth(a, b, c); break;
+                default:
+                    free(raw);
+                    return decodeFailure("Invalid PNG filter type");
+            }
+        }
+    }
+
+    uint8_t *pixels = malloc((size_t)width * height * 4);
+    if (pixels == NULL) {
+        free(raw);
+        return decodeFailure("out of memory");
+    }
+    for (uint32_t y=0; y < height; y++) {
+        const uint8_t *row = raw + y * (rowBytes + 1) + 1;
+        uint8_t *out = pixels + (size_t)y * width * 4;
+        for (uint32_t x=0; x < width; x++, out += 4) {
+            // fetch each channel at full precision (up to 16 bits)
+            uint16_t sample[4] = { 0, 0, 0, 0 };
+            if (depth < 8) {
+                size_t bit = (size_t)x * depth;
+                uint8_t byte = row[bit / 8];
+                sample[0] = (byte >> (8 - depth - (bit % 8))) & ((1 << depth) - 1);
+            }
+            else {
+                for (int c=0; c < channels; c++) {
+                    sample[c] = depth == 8 ? row[(size_t)x * channels + c]
+                        : (uint16_t)((row[((size_t)x * channels + c) * 2] << 8) | row[((size_t)x * channels + c) * 2 + 1]);
+                }
+            }
+
+            int shift = depth == 16 ? 8 : 0;
+            switch (colorType) {
+                case 3: {
+                    const uint8_t *entry = palette[sample[0] & 0xff];
+                    memcpy(out, entry, 4);
+                    break;
+                }
+                case 0: {
+                    uint8_t gray = depth < 8 ? (uint8_t)(sample[0] * 255 / ((1 << depth) - 1)) : (uint8_t)(sample[0] >> shift);
+                    out[0] = out[1] = out[2] = gray;
+                    out[3] = (hasColorKey && sample[0] == colorKey[0]) ? 0 : 255;
+                    break;
+                }
+                case 4:
+                    out[0] = out[1] = out[2] = (uint8_t)(sample[0] >> shift);
+                    out[3] = (uint8_t)(sample[1] >> shift);
+                    break;
+                case 2:
+                    for (int c=0; c < 3; c++) out[c] = (uint8_t)(sample[c] >> shift);
+                    out[3] = (hasColorKey && sample[0] == colorKey[0] && sample[1] == colorKey[1] && sample[2] == colorKey[2]) ? 0 : 255;
+                    break;
+                case 6:
+                    for (int c=0; c < 4; c++) out[c] = (uint8_t)(sample[c] >> shift);
+                    break;
+            }
+        }
+    }
+    free(raw);
+
+    decodedImage_t result = { width, height, pixels, NULL };
+    return result;
+}
+
+
+//
+// QOI (https://qoiformat.org)
+//
+
+decodedImage_t decodeQOI(const uint8_t *data, size_t length)
+{
+    if (length < 14 + 8 || memcmp(data, "qoif", 4) != 0) {
+        return decodeFailure("Not a QOI file");
+    }
+    uint32_t width = readBE32(data + 4);
+    uint32_t height = readBE32(data + 8);
+    if (width == 0 || height == 0 || (uint64_t)width * height > MAX_IMAGE_PIXELS) {
+        return decodeFailure("QOI dimensions out of range");
+    }
+
+    size_t pixelCount = (size_t)width * height;
+    uint8_t *pixels = malloc(pixelCount * 4);
+    if (pixels == NULL) {
+        return decodeFailure("out of memory");
+    }
+    uint8_t index[64][4];
+    memset(index, 0, sizeof(index));
+    uint8_t px[4] = { 0, 0, 0, 255 };
+    size_t pos = 14;
+    size_t end = length - 8;  // the stream ends with 8 bytes of padding
+    uint32_t run = 0;
+    int truncated = 0;
+
+    for (size_t p=0; p < pixelCount; p++) {
+        if (run > 0) {
+            run--;
+        }
+        else {
+            if (pos >= end) {
+                truncated = 1;
+                break;
+            }
+            uint8_t op = data[pos++];
+            size_t operands = op == 0xfe ? 3 : op == 0xff ? 4 : (op >> 6) == 2 ? 1 : 0;
+            if (pos + operands > end) {
+                truncated = 1;
+                break;
+            }
+            if (op == 0xfe) {
+                px[0] = data[pos]; px[1] = data[pos+1]; px[2] = data[pos+2];
+                pos += 3;
+            }
+            else if (op == 0xff) {
+                memcpy(px, data + pos, 4);
+                pos += 4;
+            }
+            else switch (op >> 6) {
+                case 0:
+                    memcpy(px, index[op & 0x3f], 4);
+                    break;
+                case 1:
+                    px[0] += ((op >> 4) & 3) - 2;
+                    px[1] += ((op >> 2) & 3) - 2;
+                    px[2] += (op & 3) - 2;
+                    break;
+                case 2: {
+                    uint8_t next = data[pos++];
+                    int dg = (op & 0x3f) - 32;
+                    px[0] += dg - 8 + ((next >> 4) & 0x0f);
+                    px[1] += dg;
+                    px[2] += dg - 8 + (next & 0x0f);
+                    break;
+                }
+                case 3:
+                    run = op & 0x3f;
+                    break;
+            }
+            memcpy(index[(px[0]*3 + px[1]*5 + px[2]*7 + px[3]*11) % 64], px, 4);
+        }
+        memcpy(pixels + p * 4, px, 4);
+    }
+    if (truncated) {
+        free(pixels);
+        return decodeFailure("QOI stream ends before the last pixel");
+    }
+
+    decodedImage_t result = { width, height, pixels, NULL };
+    return result;
+}
+
+decodedImage_t decodeImage(const uint8_t *data, size_t length)
+{
+    if (length >= 8 && data[0] == 0x89 && memcmp(data + 1, "PNG", 3) == 0) {
+        return decodePNG(data, length);
+    }
+    if (length >= 4 && memcmp(data, "qoif", 4) == 0) {
+        return decodeQOI(data, length);
+    }
+    return decodeFailure("Unrecognized image format (expected PNG or QOI)");
+}
@@ -0,0 +1,318 @@
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+
+#include "data_marshal.h"
+#include "image_decode.h"
+
+// POSIX threads, like the render thread and the upload workers: native on Linux and macOS, and
+// winpthreads on Windows, which mingw-w64 ships and the lakefile links with -lpthread
+#if defined(_MSC_VER)
+#error "image_decode_pool.c needs pthreads; build with mingw-w64 as the lakefile does"
+#endif
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Worker pool for texture loading. Files are read and decoded to RGBA8 staging memory on N
+// threads; the GL thread only creates the textures and issues the sub-image uploads for the
+// results that have finished.
+//
+
+typedef struct decodeJob {
+    uint64_t id;
+    char *path;           // file to read, or NULL when bytes were supplied
+    uint8_t *bytes;
+    size_t length;
+    decodedImage_t image;
+    struct decodeJob *next;
+} decodeJob_t;
+
+typedef struct {
+    pthread_t *threads;
+    uint32_t threadCount;
+    pthread_mutex_t lock;
+    pthread_cond_t workAvailable;
+    pthread_cond_t jobFinished;
+    decodeJob_t *queueHead, *queueTail;  // waiting for a worker
+    decodeJob_t *doneHead, *doneTail;    // decoded, waiting for upload
+    uint64_t nextId;
+    uint32_t inFlight;                   // submitted and not yet handed back
+    int shuttingDown;
+} decodePool_t;
+
+static void appendJob(decodeJob_t **head, decodeJob_t **tail, decodeJob_t *job)
+{
+    job->next = NULL;
+    if (*tail) {
+        (*tail)->next = job;
+    }
+    else {
+        *head = job;
+    }
+    *tail = job;
+}
+
+static decodeJob_t *popJob(decodeJob_t **head, decodeJob_t **tail)
+{
+    decodeJob_t *job = *head;
+    if (job) {
+        *head = job->next;
+        if (*head == NULL) {
+            *tail = NULL;
+        }
+    }
+    return job;
+}
+
+static uint8_t *readWholeFile(const char *path, size_t *length)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *data = size > 0 ? malloc((size_t)size) : NULL;
+    if (data && fread(data, 1, (size_t)size, file) != (size_t)size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    *length = (size_t)size;
+    return data;
+}
+
+static void *decodeWorker(void *arg)
+{
+    decodePool_t *pool = (decodePool_t *)arg;
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->queueHead == NULL && !pool->shuttingDown) {
+            pthread_cond_wait(&pool->workAvailable, &pool->lock);
+        }
+        if (pool->shuttingDown) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        decodeJob_t *job = popJob(&pool->queueHead, &pool->queueTail);
+        pthread_mutex_unlock(&pool->lock);
+
+        if (job->path) {
+            job->bytes = readWholeFile(job->path, &job->length);
+        }
+        if (job->bytes) {
+            job->image = decodeImage(job->bytes, job->length);
+        }
+        else {
+            job->image.pixels = NULL;
+            job->image.error = "Could not read image file";
+        }
+        free(job->bytes);
+        job->bytes = NULL;
+
+        pthread_mutex_lock(&pool->lock);
+        appendJob(&pool->doneHead, &pool->doneTail, job);
+        pthread_cond_broadcast(&pool->jobFinished);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+static void freeJob(decodeJob_t *job)
+{
+    free(job->path);
+    free(job->bytes);
+    free(job->image.pixels);
+    free(job);
+}
+
+static lean_obj_res poolError(const char *message)
+{
+    return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string(message)));
+}
+
+// createImageDecoder : (threads : UInt32) → IO ImageDecoder
+//
+lean_obj_res lean_imagedecoder_create(uint32_t threadCount)
+{
+    if (threadCount == 0) {
+        return poolError("createImageDecoder needs at least one thread");
+    }
+    decodePool_t *pool = calloc(1, sizeof(decodePool_t));
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->workAvailable, NULL);
+    pthread_cond_init(&pool->jobFinished, NULL);
+    pool->threads = calloc(threadCount, sizeof(pthread_t));
+    for (uint32_t ix=0; ix < threadCount; ix++) {
+        if (pthread_create(&pool->threads[ix], NULL, decodeWorker, pool) != 0) {
+            break;
+        }
+        pool->threadCount++;
+    }
+    if (pool->threadCount == 0) {
+        free(pool->threads);
+        free(pool);
+        return poolError("Could not start any image decoder threads");
+    }
+    return lean_io_result_mk_ok(lean_mk_ptr(pool));
+}
+
+// destroyImageDecoder : ImageDecoder → IO Unit
+//
+// stops the workers; queued and undelivered results are dropped
+lean_obj_res lean_imagedecoder_destroy(lean_obj_arg lpool)
+{
+    decodePool_t *pool = (decodePool_t *)lean_get_external_data(lpool);
+    if (pool == NULL) {
+        return poolError("NULL decoder passed to destroyImageDecoder");
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->shuttingDown = 1;
+    pthread_cond_broadcast(&pool->workAvailable);
+    pthread_mutex_unlock(&pool->lock);
+    for (uint32_t ix=0; ix < pool->threadCount; ix++) {
+        pthread_join(pool->threads[ix], NULL);
+    }
+
+    decodeJob_t *job;
+    while ((job = popJob(&pool->queueHead, &pool->queueTail)) != NULL) freeJob(job);
+    while ((job = popJob(&pool->doneHead, &pool->doneTail)) != NULL) freeJob(job);
+
+    pthread_cond_destroy(&pool->workAvailable);
+    pthread_cond_destroy(&pool->jobFinished);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+    lean_clear_ptr(lpool);
+    return lean_return_unit();
+}
+
+static uint64_t submitJob(decodePool_t *pool, decodeJob_t *job)
+{
+    pthread_mutex_lock(&pool->lock);
+    job->id = pool->nextId++;
+    pool->inFlight++;
+    appendJob(&pool->queueHead, &pool->queueTail, job);
+    pthread_cond_signal(&pool->workAvailable);
+    pthread_mutex_unlock(&pool->lock);
+    return job->id;
+}
+
+// imageDecoderSubmitFile : ImageDecoder → String → IO UInt64
+//
+lean_obj_res lean_imagedecoder_submitfile(b_lean_obj_arg lpool, b_lean_obj_arg path)
+{
+    decodePool_t *pool = (decodePool_t *)lean_get_external_data(lpool);
+    if (pool == NULL) {
+        return poolError("NULL decoder passed to imageDecoderSubmitFile");
+    }
+    decodeJob_t *job = calloc(1, sizeof(decodeJob_t));
+    job->path = strdup(lean_string_cstr(path));
+    return lean_io_result_mk_ok(lean_box_uint64(submitJob(pool, job)));
+}
+
+// imageDecoderSubmitBytes : ImageDecoder → ByteArray → IO UInt64
+//
+// the encoded bytes are copied, the workers never touch Lean objects
+lean_obj_res lean_imagedecoder_submitbytes(b_lean_obj_arg lpool, b_lean_obj_arg bytes)
+{
+    decodePool_t *pool = (decodePool_t *)lean_get_external_data(lpool);
+    if (pool == NULL) {
+        return poolError("NULL decoder passed to imageDecoderSubmitBytes");
+    }
+    decodeJob_t *job = calloc(1, sizeof(decodeJob_t));
+    job->length = lean_sarray_size(bytes);
+    job->bytes = malloc(job->length + 1);
+    memcpy(job->bytes, lean_sarray_cptr(bytes), job->length);
+    return lean_io_result_mk_ok(lean_box_uint64(submitJob(pool, job)));
+}
+
+// imageDecoderPending : ImageDecoder → IO UInt32
+//
+lean_obj_res lean_imagedecoder_pending(b_lean_obj_arg lpool)
+{
+    decodePool_t *pool = (decodePool_t *)lean_get_external_data(lpool);
+    if (pool == NULL) {
+        return poolError("NULL decoder passed to imageDecoderPending");
+    }
+    pthread_mutex_lock(&pool->lock);
+    uint32_t pending = pool->inFlight;
+    pthread_mutex_unlock(&pool->lock);
+    return lean_io_result_mk_ok(lean_box_uint32(pending));
+}
+
+/*
+structure DecodedTexture where
+  error : String
+  jobId : UInt64
+  texture : GLTextureObject
+  width : UInt32
+  height : UInt32
+*/
+static lean_object *mkDecodedTexture(const char *error, uint64_t jobId, uint32_t texture, uint32_t width, uint32_t height)
+{
+    lean_object *result = lean_alloc_ctor(0, 1, 8 + 3 * 4);
+    lean_ctor_set(result, 0, lean_mk_string(error ? error : ""));
+    lean_ctor_set_uint64(result, sizeof(void*), jobId);
+    lean_ctor_set_uint32(result, sizeof(void*) + 8, texture);
+    lean_ctor_set_uint32(result, sizeof(void*) + 12, width);
+    lean_ctor_set_uint32(result, sizeof(void*) + 16, height);
+    return result;
+}
+
+// imageDecoderUploadCompleted : ImageDecoder → (maxUploads : UInt32) → (levels : UInt32) → (wait : Bool) → IO (Array DecodedTexture)
+//
+// must run on the thread with the GL context. Creates an RGBA8 texture for each finished image;
+// with more than one level the rest of the chain is generated on the GPU. If wait is set and
+// nothing has finished yet this blocks until something does (unless nothing is in flight).
+lean_obj_res lean_imagedecoder_uploadcompleted(b_lean_obj_arg lpool, uint32_t maxUploads, uint32_t levels, uint8_t wait)
+{
+    decodePool_t *pool = (decodePool_t *)lean_get_external_data(lpool);
+    if (pool == NULL) {
+        return poolError("NULL decoder passed to imageDecoderUploadCompleted");
+    }
+    if (levels == 0) {
+        levels = 1;
+    }
+
+    // take the finished jobs off the shared list so the uploads run without holding the lock
+    pthread_mutex_lock(&pool->lock);
+    if (wait) {
+        while (pool->doneHead == NULL && pool->inFlight > 0) {
+            pthread_cond_wait(&pool->jobFinished, &pool->lock);
+        }
+    }
+    decodeJob_t *taken = NULL, *takenTail = NULL;
+    uint32_t takenCount = 0;
+    while (takenCount < maxUploads && pool->doneHead != NULL) {
+        appendJob(&taken, &takenTail, popJob(&pool->doneHead, &pool->doneTail));
+        takenCount++;
+    }
+    pool->inFlight -= takenCount;
+    pthread_mutex_unlock(&pool->lock);
+
+    lean_object *results = lean_alloc_array(takenCount, takenCount);
+    lean_object **resultCells = lean_array_cptr(results);
+    uint32_t ix = 0;
+    while (taken != NULL) {
+        decodeJob_t *job = popJob(&taken, &takenTail);
+        if (job->image.pixels == NULL) {
+            resultCells[ix++] = mkDecodedTexture(job->image.error, job->id, 0, 0, 0);
+        }
+        else {
+            GLuint texture;
+            glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+            glTextureStorage2D(texture, (GLsizei)levels, GL_RGBA8, (GLsizei)job->image.width, (GLsizei)job->image.height);
+            glTextureSubImage2D(texture, 0, 0, 0, (GLsizei)job->image.width, (GLsizei)job->image.height, GL_RGBA, GL_UNSIGNED_BYTE, job->image.pixels);
+            if (levels > 1) {
+                glGenerateTextureMipmap(texture);
+            }
+            resultCells[ix++] = mkDecodedTexture(NULL, job->id, texture, job->image.width, job->image.height);
+        }
+        freeJob(job);
+    }
+    return lean_io_result_mk_ok(results);
+}
@@ -0,0 +1,19 @@
+
+// bulk attribute compression kernels, defined in attrib_compress.c.
+// SIMD paths are picked at runtime (F16C on x86, NEON on aarch64) with scalar fallbacks.
+
+#include <stddef.h>
+#include <stdint.h>
+
+void convertDoublesToHalves(const double *src, uint16_t *dst, size_t count);
+void convertFloatsToHalves(const float *src, uint16_t *dst, size_t count);
+void convertHalvesToFloats(const uint16_t *src, float *dst, size_t count);
+
+// unit normals (x,y,z triplets) to octahedral snorm16 pairs
+void packOctahedralNormals(const double *src, int16_t *dst, size_t normalCount);
+
+// unit normals (x,y,z triplets) to GL_INT_2_10_10_10_REV with w = 0
+void packNormals10_10_10_2(const double *src, uint32_t *dst, size_t normalCount);
+
+// rgba quadruples in [0,1] to unorm8
+void packColorsUnorm8(const double *src, uint8_t *dst, size_t colorCount);
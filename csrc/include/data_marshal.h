@@ -63,6 +63,14 @@ lean_object *lean_mk_packptr(void *someptr);
  */
 lean_object *lean_mk_ptr(void *someptr);
 
+/**
+ * Clear the pointer inside an object made by lean_mk_ptr. Destroy functions call this after
+ * freeing, so later calls with the same handle find NULL instead of freed memory.
+ */
+static inline void lean_clear_ptr(b_lean_obj_arg a) {
+  lean_to_external(a)->m_data = NULL;
+}
+
 /**
  * Unwrap an Option of an external object as data for some
  * or NULL for none.
@@ -0,0 +1,37 @@
+// GL function table loading, the loader statistics and the context capabilities, defined in
+// gl_loader.c.
+
+#pragma once
+
+#include <glad/glad_context.h>
+#include <stdint.h>
+
+// fills gl for the context current on this thread with the loader glSetLoaderMode selected;
+// 0 if the context isn't usable
+int loadGLContextTable(GladGLContext *gl);
+
+// queried once, right after the function table is loaded; the fast path flags are set when
+// either the core version or the extension provides the feature
+typedef struct {
+    uint32_t major, minor;
+    uint32_t maxTextureSize;
+    uint32_t max3DTextureSize;
+    uint32_t maxArrayTextureLayers;
+    uint32_t maxSamples;
+    uint32_t maxColorAttachments;
+    uint32_t maxVertexAttribs;
+    uint32_t maxUniformBlockSize;
+    uint32_t maxShaderStorageBufferBindings;
+    uint32_t maxComputeWorkGroupInvocations;
+    uint32_t maxCombinedTextureImageUnits;
+    float maxAnisotropy;                // 0 without anisotropic filtering
+    uint32_t maxShaderCompilerThreads;  // 0 without KHR_parallel_shader_compile
+    uint8_t bindlessTexture;
+    uint8_t indirectParameters;
+    uint8_t parallelShaderCompile;
+    uint8_t spirv;
+    uint8_t anisotropicFiltering;
+} glCapabilities_t;
+
+// with the context's table current
+void queryCapabilities(glCapabilities_t *caps);
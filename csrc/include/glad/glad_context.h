@@ -0,0 +1,2250 @@
+// Per-context GL dispatch tables, generated from glad.h and glad_ext.h by
+// tools/gen_glad_context.py.
+// Do not edit; rerun the script instead.
+
+#ifndef __glad_context_h_
+#define __glad_context_h_
+
+#include <glad/glad_ext.h>
+
+#if defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#else
+#define GLAD_THREAD_LOCAL __thread
+#endif
+
+typedef struct GladGLContext {
+    int major;
+    int minor;
+    GLADloadproc load;             // kept for lazily resolved entry points
+    unsigned lazyResolved;         // entry points resolved by trampolines so far
+    unsigned extensionCount;
+    unsigned extensionMask;        // hash table size - 1
+    const char **extensionSlots;   // the driver's own strings, open addressed
+    int VERSION_1_0;
+    int VERSION_1_1;
+    int VERSION_1_2;
+    int VERSION_1_3;
+    int VERSION_1_4;
+    int VERSION_1_5;
+    int VERSION_2_0;
+    int VERSION_2_1;
+    int VERSION_3_0;
+    int VERSION_3_1;
+    int VERSION_3_2;
+    int VERSION_3_3;
+    int VERSION_4_0;
+    int VERSION_4_1;
+    int VERSION_4_2;
+    int VERSION_4_3;
+    int VERSION_4_4;
+    int VERSION_4_5;
+    int VERSION_4_6;
+    int ARB_bindless_texture;
+    int ARB_gl_spirv;
+    int ARB_indirect_parameters;
+    int EXT_texture_compression_s3tc;
+    int EXT_texture_filter_anisotropic;
+    int KHR_parallel_shader_compile;
+    PFNGLCULLFACEPROC CullFace;
+    PFNGLFRONTFACEPROC FrontFace;
+    PFNGLHINTPROC Hint;
+    PFNGLLINEWIDTHPROC LineWidth;
+    PFNGLPOINTSIZEPROC PointSize;
+    PFNGLPOLYGONMODEPROC PolygonMode;
+    PFNGLSCISSORPROC Scissor;
+    PFNGLTEXPARAMETERFPROC TexParameterf;
+    PFNGLTEXPARAMETERFVPROC TexParameterfv;
+    PFNGLTEXPARAMETERIPROC TexParameteri;
+    PFNGLTEXPARAMETERIVPROC TexParameteriv;
+    PFNGLTEXIMAGE1DPROC TexImage1D;
+    PFNGLTEXIMAGE2DPROC TexImage2D;
+    PFNGLDRAWBUFFERPROC DrawBuffer;
+    PFNGLCLEARPROC Clear;
+    PFNGLCLEARCOLORPROC ClearColor;
+    PFNGLCLEARSTENCILPROC ClearStencil;
+    PFNGLCLEARDEPTHPROC ClearDepth;
+    PFNGLSTENCILMASKPROC StencilMask;
+    PFNGLCOLORMASKPROC ColorMask;
+    PFNGLDEPTHMASKPROC DepthMask;
+    PFNGLDISABLEPROC Disable;
+    PFNGLENABLEPROC Enable;
+    PFNGLFINISHPROC Finish;
+    PFNGLFLUSHPROC Flush;
+    PFNGLBLENDFUNCPROC BlendFunc;
+    PFNGLLOGICOPPROC LogicOp;
+    PFNGLSTENCILFUNCPROC StencilFunc;
+    PFNGLSTENCILOPPROC StencilOp;
+    PFNGLDEPTHFUNCPROC DepthFunc;
+    PFNGLPIXELSTOREFPROC PixelStoref;
+    PFNGLPIXELSTOREIPROC PixelStorei;
+    PFNGLREADBUFFERPROC ReadBuffer;
+    PFNGLREADPIXELSPROC ReadPixels;
+    PFNGLGETBOOLEANVPROC GetBooleanv;
+    PFNGLGETDOUBLEVPROC GetDoublev;
+    PFNGLGETERRORPROC GetError;
+    PFNGLGETFLOATVPROC GetFloatv;
+    PFNGLGETINTEGERVPROC GetIntegerv;
+    PFNGLGETSTRINGPROC GetString;
+    PFNGLGETTEXIMAGEPROC GetTexImage;
+    PFNGLGETTEXPARAMETERFVPROC GetTexParameterfv;
+    PFNGLGETTEXPARAMETERIVPROC GetTexParameteriv;
+    PFNGLGETTEXLEVELPARAMETERFVPROC GetTexLevelParameterfv;
+    PFNGLGETTEXLEVELPARAMETERIVPROC GetTexLevelParameteriv;
+    PFNGLISENABLEDPROC IsEnabled;
+    PFNGLDEPTHRANGEPROC DepthRange;
+    PFNGLVIEWPORTPROC Viewport;
+    PFNGLDRAWARRAYSPROC DrawArrays;
+    PFNGLDRAWELEMENTSPROC DrawElements;
+    PFNGLPOLYGONOFFSETPROC PolygonOffset;
+    PFNGLCOPYTEXIMAGE1DPROC CopyTexImage1D;
+    PFNGLCOPYTEXIMAGE2DPROC CopyTexImage2D;
+    PFNGLCOPYTEXSUBIMAGE1DPROC CopyTexSubImage1D;
+    PFNGLCOPYTEXSUBIMAGE2DPROC CopyTexSubImage2D;
+    PFNGLTEXSUBIMAGE1DPROC TexSubImage1D;
+    PFNGLTEXSUBIMAGE2DPROC TexSubImage2D;
+    PFNGLBINDTEXTUREPROC BindTexture;
+    PFNGLDELETETEXTURESPROC DeleteTextures;
+    PFNGLGENTEXTURESPROC GenTextures;
+    PFNGLISTEXTUREPROC IsTexture;
+    PFNGLDRAWRANGEELEMENTSPROC DrawRangeElements;
+    PFNGLTEXIMAGE3DPROC TexImage3D;
+    PFNGLTEXSUBIMAGE3DPROC TexSubImage3D;
+    PFNGLCOPYTEXSUBIMAGE3DPROC CopyTexSubImage3D;
+    PFNGLACTIVETEXTUREPROC ActiveTexture;
+    PFNGLSAMPLECOVERAGEPROC SampleCoverage;
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC CompressedTexImage3D;
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC CompressedTexImage2D;
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC CompressedTexImage1D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC CompressedTexSubImage3D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC CompressedTexSubImage2D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC CompressedTexSubImage1D;
+    PFNGLGETCOMPRESSEDTEXIMAGEPROC GetCompressedTexImage;
+    PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+    PFNGLMULTIDRAWARRAYSPROC MultiDrawArrays;
+    PFNGLMULTIDRAWELEMENTSPROC MultiDrawElements;
+    PFNGLPOINTPARAMETERFPROC PointParameterf;
+    PFNGLPOINTPARAMETERFVPROC PointParameterfv;
+    PFNGLPOINTPARAMETERIPROC PointParameteri;
+    PFNGLPOINTPARAMETERIVPROC PointParameteriv;
+    PFNGLBLENDCOLORPROC BlendColor;
+    PFNGLBLENDEQUATIONPROC BlendEquation;
+    PFNGLGENQUERIESPROC GenQueries;
+    PFNGLDELETEQUERIESPROC DeleteQueries;
+    PFNGLISQUERYPROC IsQuery;
+    PFNGLBEGINQUERYPROC BeginQuery;
+    PFNGLENDQUERYPROC EndQuery;
+    PFNGLGETQUERYIVPROC GetQueryiv;
+    PFNGLGETQUERYOBJECTIVPROC GetQueryObjectiv;
+    PFNGLGETQUERYOBJECTUIVPROC GetQueryObjectuiv;
+    PFNGLBINDBUFFERPROC BindBuffer;
+    PFNGLDELETEBUFFERSPROC DeleteBuffers;
+    PFNGLGENBUFFERSPROC GenBuffers;
+    PFNGLISBUFFERPROC IsBuffer;
+    PFNGLBUFFERDATAPROC BufferData;
+    PFNGLBUFFERSUBDATAPROC BufferSubData;
+    PFNGLGETBUFFERSUBDATAPROC GetBufferSubData;
+    PFNGLMAPBUFFERPROC MapBuffer;
+    PFNGLUNMAPBUFFERPROC UnmapBuffer;
+    PFNGLGETBUFFERPARAMETERIVPROC GetBufferParameteriv;
+    PFNGLGETBUFFERPOINTERVPROC GetBufferPointerv;
+    PFNGLBLENDEQUATIONSEPARATEPROC BlendEquationSeparate;
+    PFNGLDRAWBUFFERSPROC DrawBuffers;
+    PFNGLSTENCILOPSEPARATEPROC StencilOpSeparate;
+    PFNGLSTENCILFUNCSEPARATEPROC StencilFuncSeparate;
+    PFNGLSTENCILMASKSEPARATEPROC StencilMaskSeparate;
+    PFNGLATTACHSHADERPROC AttachShader;
+    PFNGLBINDATTRIBLOCATIONPROC BindAttribLocation;
+    PFNGLCOMPILESHADERPROC CompileShader;
+    PFNGLCREATEPROGRAMPROC CreateProgram;
+    PFNGLCREATESHADERPROC CreateShader;
+    PFNGLDELETEPROGRAMPROC DeleteProgram;
+    PFNGLDELETESHADERPROC DeleteShader;
+    PFNGLDETACHSHADERPROC DetachShader;
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC DisableVertexAttribArray;
+    PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+    PFNGLGETACTIVEATTRIBPROC GetActiveAttrib;
+    PFNGLGETACTIVEUNIFORMPROC GetActiveUniform;
+    PFNGLGETATTACHEDSHADERSPROC GetAttachedShaders;
+    PFNGLGETATTRIBLOCATIONPROC GetAttribLocation;
+    PFNGLGETPROGRAMIVPROC GetProgramiv;
+    PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+    PFNGLGETSHADERIVPROC GetShaderiv;
+    PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+    PFNGLGETSHADERSOURCEPROC GetShaderSource;
+    PFNGLGETUNIFORMLOCATIONPROC GetUniformLocation;
+    PFNGLGETUNIFORMFVPROC GetUniformfv;
+    PFNGLGETUNIFORMIVPROC GetUniformiv;
+    PFNGLGETVERTEXATTRIBDVPROC GetVertexAttribdv;
+    PFNGLGETVERTEXATTRIBFVPROC GetVertexAttribfv;
+    PFNGLGETVERTEXATTRIBIVPROC GetVertexAttribiv;
+    PFNGLGETVERTEXATTRIBPOINTERVPROC GetVertexAttribPointerv;
+    PFNGLISPROGRAMPROC IsProgram;
+    PFNGLISSHADERPROC IsShader;
+    PFNGLLINKPROGRAMPROC LinkProgram;
+    PFNGLSHADERSOURCEPROC ShaderSource;
+    PFNGLUSEPROGRAMPROC UseProgram;
+    PFNGLUNIFORM1FPROC Uniform1f;
+    PFNGLUNIFORM2FPROC Uniform2f;
+    PFNGLUNIFORM3FPROC Uniform3f;
+    PFNGLUNIFORM4FPROC Uniform4f;
+    PFNGLUNIFORM1IPROC Uniform1i;
+    PFNGLUNIFORM2IPROC Uniform2i;
+    PFNGLUNIFORM3IPROC Uniform3i;
+    PFNGLUNIFORM4IPROC Uniform4i;
+    PFNGLUNIFORM1FVPROC Uniform1fv;
+    PFNGLUNIFORM2FVPROC Uniform2fv;
+    PFNGLUNIFORM3FVPROC Uniform3fv;
+    PFNGLUNIFORM4FVPROC Uniform4fv;
+    PFNGLUNIFORM1IVPROC Uniform1iv;
+    PFNGLUNIFORM2IVPROC Uniform2iv;
+    PFNGLUNIFORM3IVPROC Uniform3iv;
+    PFNGLUNIFORM4IVPROC Uniform4iv;
+    PFNGLUNIFORMMATRIX2FVPROC UniformMatrix2fv;
+    PFNGLUNIFORMMATRIX3FVPROC UniformMatrix3fv;
+    PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+    PFNGLVALIDATEPROGRAMPROC ValidateProgram;
+    PFNGLVERTEXATTRIB1DPROC VertexAttrib1d;
+    PFNGLVERTEXATTRIB1DVPROC VertexAttrib1dv;
+    PFNGLVERTEXATTRIB1FPROC VertexAttrib1f;
+    PFNGLVERTEXATTRIB1FVPROC VertexAttrib1fv;
+    PFNGLVERTEXATTRIB1SPROC VertexAttrib1s;
+    PFNGLVERTEXATTRIB1SVPROC VertexAttrib1sv;
+    PFNGLVERTEXATTRIB2DPROC VertexAttrib2d;
+    PFNGLVERTEXATTRIB2DVPROC VertexAttrib2dv;
+    PFNGLVERTEXATTRIB2FPROC VertexAttrib2f;
+    PFNGLVERTEXATTRIB2FVPROC VertexAttrib2fv;
+    PFNGLVERTEXATTRIB2SPROC VertexAttrib2s;
+    PFNGLVERTEXATTRIB2SVPROC VertexAttrib2sv;
+    PFNGLVERTEXATTRIB3DPROC VertexAttrib3d;
+    PFNGLVERTEXATTRIB3DVPROC VertexAttrib3dv;
+    PFNGLVERTEXATTRIB3FPROC VertexAttrib3f;
+    PFNGLVERTEXATTRIB3FVPROC VertexAttrib3fv;
+    PFNGLVERTEXATTRIB3SPROC VertexAttrib3s;
+    PFNGLVERTEXATTRIB3SVPROC VertexAttrib3sv;
+    PFNGLVERTEXATTRIB4NBVPROC VertexAttrib4Nbv;
+    PFNGLVERTEXATTRIB4NIVPROC VertexAttrib4Niv;
+    PFNGLVERTEXATTRIB4NSVPROC VertexAttrib4Nsv;
+    PFNGLVERTEXATTRIB4NUBPROC VertexAttrib4Nub;
+    PFNGLVERTEXATTRIB4NUBVPROC VertexAttrib4Nubv;
+    PFNGLVERTEXATTRIB4NUIVPROC VertexAttrib4Nuiv;
+    PFNGLVERTEXATTRIB4NUSVPROC VertexAttrib4Nusv;
+    PFNGLVERTEXATTRIB4BVPROC VertexAttrib4bv;
+    PFNGLVERTEXATTRIB4DPROC VertexAttrib4d;
+    PFNGLVERTEXATTRIB4DVPROC VertexAttrib4dv;
+    PFNGLVERTEXATTRIB4FPROC VertexAttrib4f;
+    PFNGLVERTEXATTRIB4FVPROC VertexAttrib4fv;
+    PFNGLVERTEXATTRIB4IVPROC VertexAttrib4iv;
+    PFNGLVERTEXATTRIB4SPROC VertexAttrib4s;
+    PFNGLVERTEXATTRIB4SVPROC VertexAttrib4sv;
+    PFNGLVERTEXATTRIB4UBVPROC VertexAttrib4ubv;
+    PFNGLVERTEXATTRIB4UIVPROC VertexAttrib4uiv;
+    PFNGLVERTEXATTRIB4USVPROC VertexAttrib4usv;
+    PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+    PFNGLUNIFORMMATRIX2X3FVPROC UniformMatrix2x3fv;
+    PFNGLUNIFORMMATRIX3X2FVPROC UniformMatrix3x2fv;
+    PFNGLUNIFORMMATRIX2X4FVPROC UniformMatrix2x4fv;
+    PFNGLUNIFORMMATRIX4X2FVPROC UniformMatrix4x2fv;
+    PFNGLUNIFORMMATRIX3X4FVPROC UniformMatrix3x4fv;
+    PFNGLUNIFORMMATRIX4X3FVPROC UniformMatrix4x3fv;
+    PFNGLCOLORMASKIPROC ColorMaski;
+    PFNGLGETBOOLEANI_VPROC GetBooleani_v;
+    PFNGLGETINTEGERI_VPROC GetIntegeri_v;
+    PFNGLENABLEIPROC Enablei;
+    PFNGLDISABLEIPROC Disablei;
+    PFNGLISENABLEDIPROC IsEnabledi;
+    PFNGLBEGINTRANSFORMFEEDBACKPROC BeginTransformFeedback;
+    PFNGLENDTRANSFORMFEEDBACKPROC EndTransformFeedback;
+    PFNGLBINDBUFFERRANGEPROC BindBufferRange;
+    PFNGLBINDBUFFERBASEPROC BindBufferBase;
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC TransformFeedbackVaryings;
+    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC GetTransformFeedbackVarying;
+    PFNGLCLAMPCOLORPROC ClampColor;
+    PFNGLBEGINCONDITIONALRENDERPROC BeginConditionalRender;
+    PFNGLENDCONDITIONALRENDERPROC EndConditionalRender;
+    PFNGLVERTEXATTRIBIPOINTERPROC VertexAttribIPointer;
+    PFNGLGETVERTEXATTRIBIIVPROC GetVertexAttribIiv;
+    PFNGLGETVERTEXATTRIBIUIVPROC GetVertexAttribIuiv;
+    PFNGLVERTEXATTRIBI1IPROC VertexAttribI1i;
+    PFNGLVERTEXATTRIBI2IPROC VertexAttribI2i;
+    PFNGLVERTEXATTRIBI3IPROC VertexAttribI3i;
+    PFNGLVERTEXATTRIBI4IPROC VertexAttribI4i;
+    PFNGLVERTEXATTRIBI1UIPROC VertexAttribI1ui;
+    PFNGLVERTEXATTRIBI2UIPROC VertexAttribI2ui;
+    PFNGLVERTEXATTRIBI3UIPROC VertexAttribI3ui;
+    PFNGLVERTEXATTRIBI4UIPROC VertexAttribI4ui;
+    PFNGLVERTEXATTRIBI1IVPROC VertexAttribI1iv;
+    PFNGLVERTEXATTRIBI2IVPROC VertexAttribI2iv;
+    PFNGLVERTEXATTRIBI3IVPROC VertexAttribI3iv;
+    PFNGLVERTEXATTRIBI4IVPROC VertexAttribI4iv;
+    PFNGLVERTEXATTRIBI1UIVPROC VertexAttribI1uiv;
+    PFNGLVERTEXATTRIBI2UIVPROC VertexAttribI2uiv;
+    PFNGLVERTEXATTRIBI3UIVPROC VertexAttribI3uiv;
+    PFNGLVERTEXATTRIBI4UIVPROC VertexAttribI4uiv;
+    PFNGLVERTEXATTRIBI4BVPROC VertexAttribI4bv;
+    PFNGLVERTEXATTRIBI4SVPROC VertexAttribI4sv;
+    PFNGLVERTEXATTRIBI4UBVPROC VertexAttribI4ubv;
+    PFNGLVERTEXATTRIBI4USVPROC VertexAttribI4usv;
+    PFNGLGETUNIFORMUIVPROC GetUniformuiv;
+    PFNGLBINDFRAGDATALOCATIONPROC BindFragDataLocation;
+    PFNGLGETFRAGDATALOCATIONPROC GetFragDataLocation;
+    PFNGLUNIFORM1UIPROC Uniform1ui;
+    PFNGLUNIFORM2UIPROC Uniform2ui;
+    PFNGLUNIFORM3UIPROC Uniform3ui;
+    PFNGLUNIFORM4UIPROC Uniform4ui;
+    PFNGLUNIFORM1UIVPROC Uniform1uiv;
+    PFNGLUNIFORM2UIVPROC Uniform2uiv;
+    PFNGLUNIFORM3UIVPROC Uniform3uiv;
+    PFNGLUNIFORM4UIVPROC Uniform4uiv;
+    PFNGLTEXPARAMETERIIVPROC TexParameterIiv;
+    PFNGLTEXPARAMETERIUIVPROC TexParameterIuiv;
+    PFNGLGETTEXPARAMETERIIVPROC GetTexParameterIiv;
+    PFNGLGETTEXPARAMETERIUIVPROC GetTexParameterIuiv;
+    PFNGLCLEARBUFFERIVPROC ClearBufferiv;
+    PFNGLCLEARBUFFERUIVPROC ClearBufferuiv;
+    PFNGLCLEARBUFFERFVPROC ClearBufferfv;
+    PFNGLCLEARBUFFERFIPROC ClearBufferfi;
+    PFNGLGETSTRINGIPROC GetStringi;
+    PFNGLISRENDERBUFFERPROC IsRenderbuffer;
+    PFNGLBINDRENDERBUFFERPROC BindRenderbuffer;
+    PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+    PFNGLGENRENDERBUFFERSPROC GenRenderbuffers;
+    PFNGLRENDERBUFFERSTORAGEPROC RenderbufferStorage;
+    PFNGLGETRENDERBUFFERPARAMETERIVPROC GetRenderbufferParameteriv;
+    PFNGLISFRAMEBUFFERPROC IsFramebuffer;
+    PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+    PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+    PFNGLGENFRAMEBUFFERSPROC GenFramebuffers;
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC CheckFramebufferStatus;
+    PFNGLFRAMEBUFFERTEXTURE1DPROC FramebufferTexture1D;
+    PFNGLFRAMEBUFFERTEXTURE2DPROC FramebufferTexture2D;
+    PFNGLFRAMEBUFFERTEXTURE3DPROC FramebufferTexture3D;
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC FramebufferRenderbuffer;
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetFramebufferAttachmentParameteriv;
+    PFNGLGENERATEMIPMAPPROC GenerateMipmap;
+    PFNGLBLITFRAMEBUFFERPROC BlitFramebuffer;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC RenderbufferStorageMultisample;
+    PFNGLFRAMEBUFFERTEXTURELAYERPROC FramebufferTextureLayer;
+    PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+    PFNGLFLUSHMAPPEDBUFFERRANGEPROC FlushMappedBufferRange;
+    PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+    PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+    PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
+    PFNGLISVERTEXARRAYPROC IsVertexArray;
+    PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced;
+    PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced;
+    PFNGLTEXBUFFERPROC TexBuffer;
+    PFNGLPRIMITIVERESTARTINDEXPROC PrimitiveRestartIndex;
+    PFNGLCOPYBUFFERSUBDATAPROC CopyBufferSubData;
+    PFNGLGETUNIFORMINDICESPROC GetUniformIndices;
+    PFNGLGETACTIVEUNIFORMSIVPROC GetActiveUniformsiv;
+    PFNGLGETACTIVEUNIFORMNAMEPROC GetActiveUniformName;
+    PFNGLGETUNIFORMBLOCKINDEXPROC GetUniformBlockIndex;
+    PFNGLGETACTIVEUNIFORMBLOCKIVPROC GetActiveUniformBlockiv;
+    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC GetActiveUniformBlockName;
+    PFNGLUNIFORMBLOCKBINDINGPROC UniformBlockBinding;
+    PFNGLDRAWELEMENTSBASEVERTEXPROC DrawElementsBaseVertex;
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC DrawRangeElementsBaseVertex;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC DrawElementsInstancedBaseVertex;
+    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC MultiDrawElementsBaseVertex;
+    PFNGLPROVOKINGVERTEXPROC ProvokingVertex;
+    PFNGLFENCESYNCPROC FenceSync;
+    PFNGLISSYNCPROC IsSync;
+    PFNGLDELETESYNCPROC DeleteSync;
+    PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+    PFNGLWAITSYNCPROC WaitSync;
+    PFNGLGETINTEGER64VPROC GetInteger64v;
+    PFNGLGETSYNCIVPROC GetSynciv;
+    PFNGLGETINTEGER64I_VPROC GetInteger64i_v;
+    PFNGLGETBUFFERPARAMETERI64VPROC GetBufferParameteri64v;
+    PFNGLFRAMEBUFFERTEXTUREPROC FramebufferTexture;
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC TexImage2DMultisample;
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC TexImage3DMultisample;
+    PFNGLGETMULTISAMPLEFVPROC GetMultisamplefv;
+    PFNGLSAMPLEMASKIPROC SampleMaski;
+    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC BindFragDataLocationIndexed;
+    PFNGLGETFRAGDATAINDEXPROC GetFragDataIndex;
+    PFNGLGENSAMPLERSPROC GenSamplers;
+    PFNGLDELETESAMPLERSPROC DeleteSamplers;
+    PFNGLISSAMPLERPROC IsSampler;
+    PFNGLBINDSAMPLERPROC BindSampler;
+    PFNGLSAMPLERPARAMETERIPROC SamplerParameteri;
+    PFNGLSAMPLERPARAMETERIVPROC SamplerParameteriv;
+    PFNGLSAMPLERPARAMETERFPROC SamplerParameterf;
+    PFNGLSAMPLERPARAMETERFVPROC SamplerParameterfv;
+    PFNGLSAMPLERPARAMETERIIVPROC SamplerParameterIiv;
+    PFNGLSAMPLERPARAMETERIUIVPROC SamplerParameterIuiv;
+    PFNGLGETSAMPLERPARAMETERIVPROC GetSamplerParameteriv;
+    PFNGLGETSAMPLERPARAMETERIIVPROC GetSamplerParameterIiv;
+    PFNGLGETSAMPLERPARAMETERFVPROC GetSamplerParameterfv;
+    PFNGLGETSAMPLERPARAMETERIUIVPROC GetSamplerParameterIuiv;
+    PFNGLQUERYCOUNTERPROC QueryCounter;
+    PFNGLGETQUERYOBJECTI64VPROC GetQueryObjecti64v;
+    PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+    PFNGLVERTEXATTRIBDIVISORPROC VertexAttribDivisor;
+    PFNGLVERTEXATTRIBP1UIPROC VertexAttribP1ui;
+    PFNGLVERTEXATTRIBP1UIVPROC VertexAttribP1uiv;
+    PFNGLVERTEXATTRIBP2UIPROC VertexAttribP2ui;
+    PFNGLVERTEXATTRIBP2UIVPROC VertexAttribP2uiv;
+    PFNGLVERTEXATTRIBP3UIPROC VertexAttribP3ui;
+    PFNGLVERTEXATTRIBP3UIVPROC VertexAttribP3uiv;
+    PFNGLVERTEXATTRIBP4UIPROC VertexAttribP4ui;
+    PFNGLVERTEXATTRIBP4UIVPROC VertexAttribP4uiv;
+    PFNGLVERTEXP2UIPROC VertexP2ui;
+    PFNGLVERTEXP2UIVPROC VertexP2uiv;
+    PFNGLVERTEXP3UIPROC VertexP3ui;
+    PFNGLVERTEXP3UIVPROC VertexP3uiv;
+    PFNGLVERTEXP4UIPROC VertexP4ui;
+    PFNGLVERTEXP4UIVPROC VertexP4uiv;
+    PFNGLTEXCOORDP1UIPROC TexCoordP1ui;
+    PFNGLTEXCOORDP1UIVPROC TexCoordP1uiv;
+    PFNGLTEXCOORDP2UIPROC TexCoordP2ui;
+    PFNGLTEXCOORDP2UIVPROC TexCoordP2uiv;
+    PFNGLTEXCOORDP3UIPROC TexCoordP3ui;
+    PFNGLTEXCOORDP3UIVPROC TexCoordP3uiv;
+    PFNGLTEXCOORDP4UIPROC TexCoordP4ui;
+    PFNGLTEXCOORDP4UIVPROC TexCoordP4uiv;
+    PFNGLMULTITEXCOORDP1UIPROC MultiTexCoordP1ui;
+    PFNGLMULTITEXCOORDP1UIVPROC MultiTexCoordP1uiv;
+    PFNGLMULTITEXCOORDP2UIPROC MultiTexCoordP2ui;
+    PFNGLMULTITEXCOORDP2UIVPROC MultiTexCoordP2uiv;
+    PFNGLMULTITEXCOORDP3UIPROC MultiTexCoordP3ui;
+    PFNGLMULTITEXCOORDP3UIVPROC MultiTexCoordP3uiv;
+    PFNGLMULTITEXCOORDP4UIPROC MultiTexCoordP4ui;
+    PFNGLMULTITEXCOORDP4UIVPROC MultiTexCoordP4uiv;
+    PFNGLNORMALP3UIPROC NormalP3ui;
+    PFNGLNORMALP3UIVPROC NormalP3uiv;
+    PFNGLCOLORP3UIPROC ColorP3ui;
+    PFNGLCOLORP3UIVPROC ColorP3uiv;
+    PFNGLCOLORP4UIPROC ColorP4ui;
+    PFNGLCOLORP4UIVPROC ColorP4uiv;
+    PFNGLSECONDARYCOLORP3UIPROC SecondaryColorP3ui;
+    PFNGLSECONDARYCOLORP3UIVPROC SecondaryColorP3uiv;
+    PFNGLMINSAMPLESHADINGPROC MinSampleShading;
+    PFNGLBLENDEQUATIONIPROC BlendEquationi;
+    PFNGLBLENDEQUATIONSEPARATEIPROC BlendEquationSeparatei;
+    PFNGLBLENDFUNCIPROC BlendFunci;
+    PFNGLBLENDFUNCSEPARATEIPROC BlendFuncSeparatei;
+    PFNGLDRAWARRAYSINDIRECTPROC DrawArraysIndirect;
+    PFNGLDRAWELEMENTSINDIRECTPROC DrawElementsIndirect;
+    PFNGLUNIFORM1DPROC Uniform1d;
+    PFNGLUNIFORM2DPROC Uniform2d;
+    PFNGLUNIFORM3DPROC Uniform3d;
+    PFNGLUNIFORM4DPROC Uniform4d;
+    PFNGLUNIFORM1DVPROC Uniform1dv;
+    PFNGLUNIFORM2DVPROC Uniform2dv;
+    PFNGLUNIFORM3DVPROC Uniform3dv;
+    PFNGLUNIFORM4DVPROC Uniform4dv;
+    PFNGLUNIFORMMATRIX2DVPROC UniformMatrix2dv;
+    PFNGLUNIFORMMATRIX3DVPROC UniformMatrix3dv;
+    PFNGLUNIFORMMATRIX4DVPROC UniformMatrix4dv;
+    PFNGLUNIFORMMATRIX2X3DVPROC UniformMatrix2x3dv;
+    PFNGLUNIFORMMATRIX2X4DVPROC UniformMatrix2x4dv;
+    PFNGLUNIFORMMATRIX3X2DVPROC UniformMatrix3x2dv;
+    PFNGLUNIFORMMATRIX3X4DVPROC UniformMatrix3x4dv;
+    PFNGLUNIFORMMATRIX4X2DVPROC UniformMatrix4x2dv;
+    PFNGLUNIFORMMATRIX4X3DVPROC UniformMatrix4x3dv;
+    PFNGLGETUNIFORMDVPROC GetUniformdv;
+    PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC GetSubroutineUniformLocation;
+    PFNGLGETSUBROUTINEINDEXPROC GetSubroutineIndex;
+    PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC GetActiveSubroutineUniformiv;
+    PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC GetActiveSubroutineUniformName;
+    PFNGLGETACTIVESUBROUTINENAMEPROC GetActiveSubroutineName;
+    PFNGLUNIFORMSUBROUTINESUIVPROC UniformSubroutinesuiv;
+    PFNGLGETUNIFORMSUBROUTINEUIVPROC GetUniformSubroutineuiv;
+    PFNGLGETPROGRAMSTAGEIVPROC GetProgramStageiv;
+    PFNGLPATCHPARAMETERIPROC PatchParameteri;
+    PFNGLPATCHPARAMETERFVPROC PatchParameterfv;
+    PFNGLBINDTRANSFORMFEEDBACKPROC BindTransformFeedback;
+    PFNGLDELETETRANSFORMFEEDBACKSPROC DeleteTransformFeedbacks;
+    PFNGLGENTRANSFORMFEEDBACKSPROC GenTransformFeedbacks;
+    PFNGLISTRANSFORMFEEDBACKPROC IsTransformFeedback;
+    PFNGLPAUSETRANSFORMFEEDBACKPROC PauseTransformFeedback;
+    PFNGLRESUMETRANSFORMFEEDBACKPROC ResumeTransformFeedback;
+    PFNGLDRAWTRANSFORMFEEDBACKPROC DrawTransformFeedback;
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC DrawTransformFeedbackStream;
+    PFNGLBEGINQUERYINDEXEDPROC BeginQueryIndexed;
+    PFNGLENDQUERYINDEXEDPROC EndQueryIndexed;
+    PFNGLGETQUERYINDEXEDIVPROC GetQueryIndexediv;
+    PFNGLRELEASESHADERCOMPILERPROC ReleaseShaderCompiler;
+    PFNGLSHADERBINARYPROC ShaderBinary;
+    PFNGLGETSHADERPRECISIONFORMATPROC GetShaderPrecisionFormat;
+    PFNGLDEPTHRANGEFPROC DepthRangef;
+    PFNGLCLEARDEPTHFPROC ClearDepthf;
+    PFNGLGETPROGRAMBINARYPROC GetProgramBinary;
+    PFNGLPROGRAMBINARYPROC ProgramBinary;
+    PFNGLPROGRAMPARAMETERIPROC ProgramParameteri;
+    PFNGLUSEPROGRAMSTAGESPROC UseProgramStages;
+    PFNGLACTIVESHADERPROGRAMPROC ActiveShaderProgram;
+    PFNGLCREATESHADERPROGRAMVPROC CreateShaderProgramv;
+    PFNGLBINDPROGRAMPIPELINEPROC BindProgramPipeline;
+    PFNGLDELETEPROGRAMPIPELINESPROC DeleteProgramPipelines;
+    PFNGLGENPROGRAMPIPELINESPROC GenProgramPipelines;
+    PFNGLISPROGRAMPIPELINEPROC IsProgramPipeline;
+    PFNGLGETPROGRAMPIPELINEIVPROC GetProgramPipelineiv;
+    PFNGLPROGRAMUNIFORM1IPROC ProgramUniform1i;
+    PFNGLPROGRAMUNIFORM1IVPROC ProgramUniform1iv;
+    PFNGLPROGRAMUNIFORM1FPROC ProgramUniform1f;
+    PFNGLPROGRAMUNIFORM1FVPROC ProgramUniform1fv;
+    PFNGLPROGRAMUNIFORM1DPROC ProgramUniform1d;
+    PFNGLPROGRAMUNIFORM1DVPROC ProgramUniform1dv;
+    PFNGLPROGRAMUNIFORM1UIPROC ProgramUniform1ui;
+    PFNGLPROGRAMUNIFORM1UIVPROC ProgramUniform1uiv;
+    PFNGLPROGRAMUNIFORM2IPROC ProgramUniform2i;
+    PFNGLPROGRAMUNIFORM2IVPROC ProgramUniform2iv;
+    PFNGLPROGRAMUNIFORM2FPROC ProgramUniform2f;
+    PFNGLPROGRAMUNIFORM2FVPROC ProgramUniform2fv;
+    PFNGLPROGRAMUNIFORM2DPROC ProgramUniform2d;
+    PFNGLPROGRAMUNIFORM2DVPROC ProgramUniform2dv;
+    PFNGLPROGRAMUNIFORM2UIPROC ProgramUniform2ui;
+    PFNGLPROGRAMUNIFORM2UIVPROC ProgramUniform2uiv;
+    PFNGLPROGRAMUNIFORM3IPROC ProgramUniform3i;
+    PFNGLPROGRAMUNIFORM3IVPROC ProgramUniform3iv;
+    PFNGLPROGRAMUNIFORM3FPROC ProgramUniform3f;
+    PFNGLPROGRAMUNIFORM3FVPROC ProgramUniform3fv;
+    PFNGLPROGRAMUNIFORM3DPROC ProgramUniform3d;
+    PFNGLPROGRAMUNIFORM3DVPROC ProgramUniform3dv;
+    PFNGLPROGRAMUNIFORM3UIPROC ProgramUniform3ui;
+    PFNGLPROGRAMUNIFORM3UIVPROC ProgramUniform3uiv;
+    PFNGLPROGRAMUNIFORM4IPROC ProgramUniform4i;
+    PFNGLPROGRAMUNIFORM4IVPROC ProgramUniform4iv;
+    PFNGLPROGRAMUNIFORM4FPROC ProgramUniform4f;
+    PFNGLPROGRAMUNIFORM4FVPROC ProgramUniform4fv;
+    PFNGLPROGRAMUNIFORM4DPROC ProgramUniform4d;
+    PFNGLPROGRAMUNIFORM4DVPROC ProgramUniform4dv;
+    PFNGLPROGRAMUNIFORM4UIPROC ProgramUniform4ui;
+    PFNGLPROGRAMUNIFORM4UIVPROC ProgramUniform4uiv;
+    PFNGLPROGRAMUNIFORMMATRIX2FVPROC ProgramUniformMatrix2fv;
+    PFNGLPROGRAMUNIFORMMATRIX3FVPROC ProgramUniformMatrix3fv;
+    PFNGLPROGRAMUNIFORMMATRIX4FVPROC ProgramUniformMatrix4fv;
+    PFNGLPROGRAMUNIFORMMATRIX2DVPROC ProgramUniformMatrix2dv;
+    PFNGLPROGRAMUNIFORMMATRIX3DVPROC ProgramUniformMatrix3dv;
+    PFNGLPROGRAMUNIFORMMATRIX4DVPROC ProgramUniformMatrix4dv;
+    PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC ProgramUniformMatrix2x3fv;
+    PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC ProgramUniformMatrix3x2fv;
+    PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC ProgramUniformMatrix2x4fv;
+    PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC ProgramUniformMatrix4x2fv;
+    PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC ProgramUniformMatrix3x4fv;
+    PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC ProgramUniformMatrix4x3fv;
+    PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC ProgramUniformMatrix2x3dv;
+    PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC ProgramUniformMatrix3x2dv;
+    PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC ProgramUniformMatrix2x4dv;
+    PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC ProgramUniformMatrix4x2dv;
+    PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC ProgramUniformMatrix3x4dv;
+    PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC ProgramUniformMatrix4x3dv;
+    PFNGLVALIDATEPROGRAMPIPELINEPROC ValidateProgramPipeline;
+    PFNGLGETPROGRAMPIPELINEINFOLOGPROC GetProgramPipelineInfoLog;
+    PFNGLVERTEXATTRIBL1DPROC VertexAttribL1d;
+    PFNGLVERTEXATTRIBL2DPROC VertexAttribL2d;
+    PFNGLVERTEXATTRIBL3DPROC VertexAttribL3d;
+    PFNGLVERTEXATTRIBL4DPROC VertexAttribL4d;
+    PFNGLVERTEXATTRIBL1DVPROC VertexAttribL1dv;
+    PFNGLVERTEXATTRIBL2DVPROC VertexAttribL2dv;
+    PFNGLVERTEXATTRIBL3DVPROC VertexAttribL3dv;
+    PFNGLVERTEXATTRIBL4DVPROC VertexAttribL4dv;
+    PFNGLVERTEXATTRIBLPOINTERPROC VertexAttribLPointer;
+    PFNGLGETVERTEXATTRIBLDVPROC GetVertexAttribLdv;
+    PFNGLVIEWPORTARRAYVPROC ViewportArrayv;
+    PFNGLVIEWPORTINDEXEDFPROC ViewportIndexedf;
+    PFNGLVIEWPORTINDEXEDFVPROC ViewportIndexedfv;
+    PFNGLSCISSORARRAYVPROC ScissorArrayv;
+    PFNGLSCISSORINDEXEDPROC ScissorIndexed;
+    PFNGLSCISSORINDEXEDVPROC ScissorIndexedv;
+    PFNGLDEPTHRANGEARRAYVPROC DepthRangeArrayv;
+    PFNGLDEPTHRANGEINDEXEDPROC DepthRangeIndexed;
+    PFNGLGETFLOATI_VPROC GetFloati_v;
+    PFNGLGETDOUBLEI_VPROC GetDoublei_v;
+    PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC DrawArraysInstancedBaseInstance;
+    PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC DrawElementsInstancedBaseInstance;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC DrawElementsInstancedBaseVertexBaseInstance;
+    PFNGLGETINTERNALFORMATIVPROC GetInternalformativ;
+    PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC GetActiveAtomicCounterBufferiv;
+    PFNGLBINDIMAGETEXTUREPROC BindImageTexture;
+    PFNGLMEMORYBARRIERPROC MemoryBarrier;
+    PFNGLTEXSTORAGE1DPROC TexStorage1D;
+    PFNGLTEXSTORAGE2DPROC TexStorage2D;
+    PFNGLTEXSTORAGE3DPROC TexStorage3D;
+    PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC DrawTransformFeedbackInstanced;
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC DrawTransformFeedbackStreamInstanced;
+    PFNGLCLEARBUFFERDATAPROC ClearBufferData;
+    PFNGLCLEARBUFFERSUBDATAPROC ClearBufferSubData;
+    PFNGLDISPATCHCOMPUTEPROC DispatchCompute;
+    PFNGLDISPATCHCOMPUTEINDIRECTPROC DispatchComputeIndirect;
+    PFNGLCOPYIMAGESUBDATAPROC CopyImageSubData;
+    PFNGLFRAMEBUFFERPARAMETERIPROC FramebufferParameteri;
+    PFNGLGETFRAMEBUFFERPARAMETERIVPROC GetFramebufferParameteriv;
+    PFNGLGETINTERNALFORMATI64VPROC GetInternalformati64v;
+    PFNGLINVALIDATETEXSUBIMAGEPROC InvalidateTexSubImage;
+    PFNGLINVALIDATETEXIMAGEPROC InvalidateTexImage;
+    PFNGLINVALIDATEBUFFERSUBDATAPROC InvalidateBufferSubData;
+    PFNGLINVALIDATEBUFFERDATAPROC InvalidateBufferData;
+    PFNGLINVALIDATEFRAMEBUFFERPROC InvalidateFramebuffer;
+    PFNGLINVALIDATESUBFRAMEBUFFERPROC InvalidateSubFramebuffer;
+    PFNGLMULTIDRAWARRAYSINDIRECTPROC MultiDrawArraysIndirect;
+    PFNGLMULTIDRAWELEMENTSINDIRECTPROC MultiDrawElementsIndirect;
+    PFNGLGETPROGRAMINTERFACEIVPROC GetProgramInterfaceiv;
+    PFNGLGETPROGRAMRESOURCEINDEXPROC GetProgramResourceIndex;
+    PFNGLGETPROGRAMRESOURCENAMEPROC GetProgramResourceName;
+    PFNGLGETPROGRAMRESOURCEIVPROC GetProgramResourceiv;
+    PFNGLGETPROGRAMRESOURCELOCATIONPROC GetProgramResourceLocation;
+    PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC GetProgramResourceLocationIndex;
+    PFNGLSHADERSTORAGEBLOCKBINDINGPROC ShaderStorageBlockBinding;
+    PFNGLTEXBUFFERRANGEPROC TexBufferRange;
+    PFNGLTEXSTORAGE2DMULTISAMPLEPROC TexStorage2DMultisample;
+    PFNGLTEXSTORAGE3DMULTISAMPLEPROC TexStorage3DMultisample;
+    PFNGLTEXTUREVIEWPROC TextureView;
+    PFNGLBINDVERTEXBUFFERPROC BindVertexBuffer;
+    PFNGLVERTEXATTRIBFORMATPROC VertexAttribFormat;
+    PFNGLVERTEXATTRIBIFORMATPROC VertexAttribIFormat;
+    PFNGLVERTEXATTRIBLFORMATPROC VertexAttribLFormat;
+    PFNGLVERTEXATTRIBBINDINGPROC VertexAttribBinding;
+    PFNGLVERTEXBINDINGDIVISORPROC VertexBindingDivisor;
+    PFNGLDEBUGMESSAGECONTROLPROC DebugMessageControl;
+    PFNGLDEBUGMESSAGEINSERTPROC DebugMessageInsert;
+    PFNGLDEBUGMESSAGECALLBACKPROC DebugMessageCallback;
+    PFNGLGETDEBUGMESSAGELOGPROC GetDebugMessageLog;
+    PFNGLPUSHDEBUGGROUPPROC PushDebugGroup;
+    PFNGLPOPDEBUGGROUPPROC PopDebugGroup;
+    PFNGLOBJECTLABELPROC ObjectLabel;
+    PFNGLGETOBJECTLABELPROC GetObjectLabel;
+    PFNGLOBJECTPTRLABELPROC ObjectPtrLabel;
+    PFNGLGETOBJECTPTRLABELPROC GetObjectPtrLabel;
+    PFNGLGETPOINTERVPROC GetPointerv;
+    PFNGLBUFFERSTORAGEPROC BufferStorage;
+    PFNGLCLEARTEXIMAGEPROC ClearTexImage;
+    PFNGLCLEARTEXSUBIMAGEPROC ClearTexSubImage;
+    PFNGLBINDBUFFERSBASEPROC BindBuffersBase;
+    PFNGLBINDBUFFERSRANGEPROC BindBuffersRange;
+    PFNGLBINDTEXTURESPROC BindTextures;
+    PFNGLBINDSAMPLERSPROC BindSamplers;
+    PFNGLBINDIMAGETEXTURESPROC BindImageTextures;
+    PFNGLBINDVERTEXBUFFERSPROC BindVertexBuffers;
+    PFNGLCLIPCONTROLPROC ClipControl;
+    PFNGLCREATETRANSFORMFEEDBACKSPROC CreateTransformFeedbacks;
+    PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC TransformFeedbackBufferBase;
+    PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC TransformFeedbackBufferRange;
+    PFNGLGETTRANSFORMFEEDBACKIVPROC GetTransformFeedbackiv;
+    PFNGLGETTRANSFORMFEEDBACKI_VPROC GetTransformFeedbacki_v;
+    PFNGLGETTRANSFORMFEEDBACKI64_VPROC GetTransformFeedbacki64_v;
+    PFNGLCREATEBUFFERSPROC CreateBuffers;
+    PFNGLNAMEDBUFFERSTORAGEPROC NamedBufferStorage;
+    PFNGLNAMEDBUFFERDATAPROC NamedBufferData;
+    PFNGLNAMEDBUFFERSUBDATAPROC NamedBufferSubData;
+    PFNGLCOPYNAMEDBUFFERSUBDATAPROC CopyNamedBufferSubData;
+    PFNGLCLEARNAMEDBUFFERDATAPROC ClearNamedBufferData;
+    PFNGLCLEARNAMEDBUFFERSUBDATAPROC ClearNamedBufferSubData;
+    PFNGLMAPNAMEDBUFFERPROC MapNamedBuffer;
+    PFNGLMAPNAMEDBUFFERRANGEPROC MapNamedBufferRange;
+    PFNGLUNMAPNAMEDBUFFERPROC UnmapNamedBuffer;
+    PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC FlushMappedNamedBufferRange;
+    PFNGLGETNAMEDBUFFERPARAMETERIVPROC GetNamedBufferParameteriv;
+    PFNGLGETNAMEDBUFFERPARAMETERI64VPROC GetNamedBufferParameteri64v;
+    PFNGLGETNAMEDBUFFERPOINTERVPROC GetNamedBufferPointerv;
+    PFNGLGETNAMEDBUFFERSUBDATAPROC GetNamedBufferSubData;
+    PFNGLCREATEFRAMEBUFFERSPROC CreateFramebuffers;
+    PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC NamedFramebufferRenderbuffer;
+    PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC NamedFramebufferParameteri;
+    PFNGLNAMEDFRAMEBUFFERTEXTUREPROC NamedFramebufferTexture;
+    PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC NamedFramebufferTextureLayer;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC NamedFramebufferDrawBuffer;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC NamedFramebufferDrawBuffers;
+    PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC NamedFramebufferReadBuffer;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC InvalidateNamedFramebufferData;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC InvalidateNamedFramebufferSubData;
+    PFNGLCLEARNAMEDFRAMEBUFFERIVPROC ClearNamedFramebufferiv;
+    PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC ClearNamedFramebufferuiv;
+    PFNGLCLEARNAMEDFRAMEBUFFERFVPROC ClearNamedFramebufferfv;
+    PFNGLCLEARNAMEDFRAMEBUFFERFIPROC ClearNamedFramebufferfi;
+    PFNGLBLITNAMEDFRAMEBUFFERPROC BlitNamedFramebuffer;
+    PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC CheckNamedFramebufferStatus;
+    PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC GetNamedFramebufferParameteriv;
+    PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetNamedFramebufferAttachmentParameteriv;
+    PFNGLCREATERENDERBUFFERSPROC CreateRenderbuffers;
+    PFNGLNAMEDRENDERBUFFERSTORAGEPROC NamedRenderbufferStorage;
+    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC NamedRenderbufferStorageMultisample;
+    PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC GetNamedRenderbufferParameteriv;
+    PFNGLCREATETEXTURESPROC CreateTextures;
+    PFNGLTEXTUREBUFFERPROC TextureBuffer;
+    PFNGLTEXTUREBUFFERRANGEPROC TextureBufferRange;
+    PFNGLTEXTURESTORAGE1DPROC TextureStorage1D;
+    PFNGLTEXTURESTORAGE2DPROC TextureStorage2D;
+    PFNGLTEXTURESTORAGE3DPROC TextureStorage3D;
+    PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC TextureStorage2DMultisample;
+    PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC TextureStorage3DMultisample;
+    PFNGLTEXTURESUBIMAGE1DPROC TextureSubImage1D;
+    PFNGLTEXTURESUBIMAGE2DPROC TextureSubImage2D;
+    PFNGLTEXTURESUBIMAGE3DPROC TextureSubImage3D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC CompressedTextureSubImage1D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC CompressedTextureSubImage2D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC CompressedTextureSubImage3D;
+    PFNGLCOPYTEXTURESUBIMAGE1DPROC CopyTextureSubImage1D;
+    PFNGLCOPYTEXTURESUBIMAGE2DPROC CopyTextureSubImage2D;
+    PFNGLCOPYTEXTURESUBIMAGE3DPROC CopyTextureSubImage3D;
+    PFNGLTEXTUREPARAMETERFPROC TextureParameterf;
+    PFNGLTEXTUREPARAMETERFVPROC TextureParameterfv;
+    PFNGLTEXTUREPARAMETERIPROC TextureParameteri;
+    PFNGLTEXTUREPARAMETERIIVPROC TextureParameterIiv;
+    PFNGLTEXTUREPARAMETERIUIVPROC TextureParameterIuiv;
+    PFNGLTEXTUREPARAMETERIVPROC TextureParameteriv;
+    PFNGLGENERATETEXTUREMIPMAPPROC GenerateTextureMipmap;
+    PFNGLBINDTEXTUREUNITPROC BindTextureUnit;
+    PFNGLGETTEXTUREIMAGEPROC GetTextureImage;
+    PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC GetCompressedTextureImage;
+    PFNGLGETTEXTURELEVELPARAMETERFVPROC GetTextureLevelParameterfv;
+    PFNGLGETTEXTURELEVELPARAMETERIVPROC GetTextureLevelParameteriv;
+    PFNGLGETTEXTUREPARAMETERFVPROC GetTextureParameterfv;
+    PFNGLGETTEXTUREPARAMETERIIVPROC GetTextureParameterIiv;
+    PFNGLGETTEXTUREPARAMETERIUIVPROC GetTextureParameterIuiv;
+    PFNGLGETTEXTUREPARAMETERIVPROC GetTextureParameteriv;
+    PFNGLCREATEVERTEXARRAYSPROC CreateVertexArrays;
+    PFNGLDISABLEVERTEXARRAYATTRIBPROC DisableVertexArrayAttrib;
+    PFNGLENABLEVERTEXARRAYATTRIBPROC EnableVertexArrayAttrib;
+    PFNGLVERTEXARRAYELEMENTBUFFERPROC VertexArrayElementBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERPROC VertexArrayVertexBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERSPROC VertexArrayVertexBuffers;
+    PFNGLVERTEXARRAYATTRIBBINDINGPROC VertexArrayAttribBinding;
+    PFNGLVERTEXARRAYATTRIBFORMATPROC VertexArrayAttribFormat;
+    PFNGLVERTEXARRAYATTRIBIFORMATPROC VertexArrayAttribIFormat;
+    PFNGLVERTEXARRAYATTRIBLFORMATPROC VertexArrayAttribLFormat;
+    PFNGLVERTEXARRAYBINDINGDIVISORPROC VertexArrayBindingDivisor;
+    PFNGLGETVERTEXARRAYIVPROC GetVertexArrayiv;
+    PFNGLGETVERTEXARRAYINDEXEDIVPROC GetVertexArrayIndexediv;
+    PFNGLGETVERTEXARRAYINDEXED64IVPROC GetVertexArrayIndexed64iv;
+    PFNGLCREATESAMPLERSPROC CreateSamplers;
+    PFNGLCREATEPROGRAMPIPELINESPROC CreateProgramPipelines;
+    PFNGLCREATEQUERIESPROC CreateQueries;
+    PFNGLGETQUERYBUFFEROBJECTI64VPROC GetQueryBufferObjecti64v;
+    PFNGLGETQUERYBUFFEROBJECTIVPROC GetQueryBufferObjectiv;
+    PFNGLGETQUERYBUFFEROBJECTUI64VPROC GetQueryBufferObjectui64v;
+    PFNGLGETQUERYBUFFEROBJECTUIVPROC GetQueryBufferObjectuiv;
+    PFNGLMEMORYBARRIERBYREGIONPROC MemoryBarrierByRegion;
+    PFNGLGETTEXTURESUBIMAGEPROC GetTextureSubImage;
+    PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC GetCompressedTextureSubImage;
+    PFNGLGETGRAPHICSRESETSTATUSPROC GetGraphicsResetStatus;
+    PFNGLGETNCOMPRESSEDTEXIMAGEPROC GetnCompressedTexImage;
+    PFNGLGETNTEXIMAGEPROC GetnTexImage;
+    PFNGLGETNUNIFORMDVPROC GetnUniformdv;
+    PFNGLGETNUNIFORMFVPROC GetnUniformfv;
+    PFNGLGETNUNIFORMIVPROC GetnUniformiv;
+    PFNGLGETNUNIFORMUIVPROC GetnUniformuiv;
+    PFNGLREADNPIXELSPROC ReadnPixels;
+    PFNGLGETNMAPDVPROC GetnMapdv;
+    PFNGLGETNMAPFVPROC GetnMapfv;
+    PFNGLGETNMAPIVPROC GetnMapiv;
+    PFNGLGETNPIXELMAPFVPROC GetnPixelMapfv;
+    PFNGLGETNPIXELMAPUIVPROC GetnPixelMapuiv;
+    PFNGLGETNPIXELMAPUSVPROC GetnPixelMapusv;
+    PFNGLGETNPOLYGONSTIPPLEPROC GetnPolygonStipple;
+    PFNGLGETNCOLORTABLEPROC GetnColorTable;
+    PFNGLGETNCONVOLUTIONFILTERPROC GetnConvolutionFilter;
+    PFNGLGETNSEPARABLEFILTERPROC GetnSeparableFilter;
+    PFNGLGETNHISTOGRAMPROC GetnHistogram;
+    PFNGLGETNMINMAXPROC GetnMinmax;
+    PFNGLTEXTUREBARRIERPROC TextureBarrier;
+    PFNGLSPECIALIZESHADERPROC SpecializeShader;
+    PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC MultiDrawArraysIndirectCount;
+    PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC MultiDrawElementsIndirectCount;
+    PFNGLPOLYGONOFFSETCLAMPPROC PolygonOffsetClamp;
+    PFNGLGETTEXTUREHANDLEARBPROC GetTextureHandleARB;
+    PFNGLGETTEXTURESAMPLERHANDLEARBPROC GetTextureSamplerHandleARB;
+    PFNGLMAKETEXTUREHANDLERESIDENTARBPROC MakeTextureHandleResidentARB;
+    PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC MakeTextureHandleNonResidentARB;
+    PFNGLGETIMAGEHANDLEARBPROC GetImageHandleARB;
+    PFNGLMAKEIMAGEHANDLERESIDENTARBPROC MakeImageHandleResidentARB;
+    PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC MakeImageHandleNonResidentARB;
+    PFNGLUNIFORMHANDLEUI64ARBPROC UniformHandleui64ARB;
+    PFNGLUNIFORMHANDLEUI64VARBPROC UniformHandleui64vARB;
+    PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC ProgramUniformHandleui64ARB;
+    PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC ProgramUniformHandleui64vARB;
+    PFNGLISTEXTUREHANDLERESIDENTARBPROC IsTextureHandleResidentARB;
+    PFNGLISIMAGEHANDLERESIDENTARBPROC IsImageHandleResidentARB;
+    PFNGLVERTEXATTRIBL1UI64ARBPROC VertexAttribL1ui64ARB;
+    PFNGLVERTEXATTRIBL1UI64VARBPROC VertexAttribL1ui64vARB;
+    PFNGLGETVERTEXATTRIBLUI64VARBPROC GetVertexAttribLui64vARB;
+    PFNGLSPECIALIZESHADERARBPROC SpecializeShaderARB;
+    PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC MultiDrawArraysIndirectCountARB;
+    PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC MultiDrawElementsIndirectCountARB;
+    PFNGLMAXSHADERCOMPILERTHREADSKHRPROC MaxShaderCompilerThreadsKHR;
+} GladGLContext;
+
+// the table of the context current on this thread, NULL if there is none
+extern GLAD_THREAD_LOCAL GladGLContext *gladCurrentContext;
+
+// fills the table for the context current on this thread; returns 0 if it isn't usable
+int gladLoadGLContext(GladGLContext *context, GLADloadproc load);
+
+// the same, but each entry point is a trampoline that resolves the real one the first time
+// it is called on this context
+int gladLoadGLContextLazy(GladGLContext *context, GLADloadproc load);
+
+// frees the extension set; the struct itself belongs to the caller
+void gladFreeGLContext(GladGLContext *context);
+
+int gladHasExtension(const GladGLContext *context, const char *name);
+
+#define GLAD_GL_VERSION_1_0 (gladCurrentContext->VERSION_1_0)
+#define GLAD_GL_VERSION_1_1 (gladCurrentContext->VERSION_1_1)
+#define GLAD_GL_VERSION_1_2 (gladCurrentContext->VERSION_1_2)
+#define GLAD_GL_VERSION_1_3 (gladCurrentContext->VERSION_1_3)
+#define GLAD_GL_VERSION_1_4 (gladCurrentContext->VERSION_1_4)
+#define GLAD_GL_VERSION_1_5 (gladCurrentContext->VERSION_1_5)
+#define GLAD_GL_VERSION_2_0 (gladCurrentContext->VERSION_2_0)
+#define GLAD_GL_VERSION_2_1 (gladCurrentContext->VERSION_2_1)
+#define GLAD_GL_VERSION_3_0 (gladCurrentContext->VERSION_3_0)
+#define GLAD_GL_VERSION_3_1 (gladCurrentContext->VERSION_3_1)
+#define GLAD_GL_VERSION_3_2 (gladCurrentContext->VERSION_3_2)
+#define GLAD_GL_VERSION_3_3 (gladCurrentContext->VERSION_3_3)
+#define GLAD_GL_VERSION_4_0 (gladCurrentContext->VERSION_4_0)
+#define GLAD_GL_VERSION_4_1 (gladCurrentContext->VERSION_4_1)
+#define GLAD_GL_VERSION_4_2 (gladCurrentContext->VERSION_4_2)
+#define GLAD_GL_VERSION_4_3 (gladCurrentContext->VERSION_4_3)
+#define GLAD_GL_VERSION_4_4 (gladCurrentContext->VERSION_4_4)
+#define GLAD_GL_VERSION_4_5 (gladCurrentContext->VERSION_4_5)
+#define GLAD_GL_VERSION_4_6 (gladCurrentContext->VERSION_4_6)
+#define GLAD_GL_ARB_bindless_texture (gladCurrentContext->ARB_bindless_texture)
+#define GLAD_GL_ARB_gl_spirv (gladCurrentContext->ARB_gl_spirv)
+#define GLAD_GL_ARB_indirect_parameters (gladCurrentContext->ARB_indirect_parameters)
+#define GLAD_GL_EXT_texture_compression_s3tc (gladCurrentContext->EXT_texture_compression_s3tc)
+#define GLAD_GL_EXT_texture_filter_anisotropic (gladCurrentContext->EXT_texture_filter_anisotropic)
+#define GLAD_GL_KHR_parallel_shader_compile (gladCurrentContext->KHR_parallel_shader_compile)
+
+#undef glCullFace
+#define glCullFace (gladCurrentContext->CullFace)
+#undef glFrontFace
+#define glFrontFace (gladCurrentContext->FrontFace)
+#undef glHint
+#define glHint (gladCurrentContext->Hint)
+#undef glLineWidth
+#define glLineWidth (gladCurrentContext->LineWidth)
+#undef glPointSize
+#define glPointSize (gladCurrentContext->PointSize)
+#undef glPolygonMode
+#define glPolygonMode (gladCurrentContext->PolygonMode)
+#undef glScissor
+#define glScissor (gladCurrentContext->Scissor)
+#undef glTexParameterf
+#define glTexParameterf (gladCurrentContext->TexParameterf)
+#undef glTexParameterfv
+#define glTexParameterfv (gladCurrentContext->TexParameterfv)
+#undef glTexParameteri
+#define glTexParameteri (gladCurrentContext->TexParameteri)
+#undef glTexParameteriv
+#define glTexParameteriv (gladCurrentContext->TexParameteriv)
+#undef glTexImage1D
+#define glTexImage1D (gladCurrentContext->TexImage1D)
+#undef glTexImage2D
+#define glTexImage2D (gladCurrentContext->TexImage2D)
+#undef glDrawBuffer
+#define glDrawBuffer (gladCurrentContext->DrawBuffer)
+#undef glClear
+#define glClear (gladCurrentContext->Clear)
+#undef glClearColor
+#define glClearColor (gladCurrentContext->ClearColor)
+#undef glClearStencil
+#define glClearStencil (gladCurrentContext->ClearStencil)
+#undef glClearDepth
+#define glClearDepth (gladCurrentContext->ClearDepth)
+#undef glStencilMask
+#define glStencilMask (gladCurrentContext->StencilMask)
+#undef glColorMask
+#define glColorMask (gladCurrentContext->ColorMask)
+#undef glDepthMask
+#define glDepthMask (gladCurrentContext->DepthMask)
+#undef glDisable
+#define glDisable (gladCurrentContext->Disable)
+#undef glEnable
+#define glEnable (gladCurrentContext->Enable)
+#undef glFinish
+#define glFinish (gladCurrentContext->Finish)
+#undef glFlush
+#define glFlush (gladCurrentContext->Flush)
+#undef glBlendFunc
+#define glBlendFunc (gladCurrentContext->BlendFunc)
+#undef glLogicOp
+#define glLogicOp (gladCurrentContext->LogicOp)
+#undef glStencilFunc
+#define glStencilFunc (gladCurrentContext->StencilFunc)
+#undef glStencilOp
+#define glStencilOp (gladCurrentContext->StencilOp)
+#undef glDepthFunc
+#define glDepthFunc (gladCurrentContext->DepthFunc)
+#undef glPixelStoref
+#define glPixelStoref (gladCurrentContext->PixelStoref)
+#undef glPixelStorei
+#define glPixelStorei (gladCurrentContext->PixelStorei)
+#undef glReadBuffer
+#define glReadBuffer (gladCurrentContext->ReadBuffer)
+#undef glReadPixels
+#define glReadPixels (gladCurrentContext->ReadPixels)
+#undef glGetBooleanv
+#define glGetBooleanv (gladCurrentContext->GetBooleanv)
+#undef glGetDoublev
+#define glGetDoublev (gladCurrentContext->GetDoublev)
+#undef glGetError
+#define glGetError (gladCurrentContext->GetError)
+#undef glGetFloatv
+#define glGetFloatv (gladCurrentContext->GetFloatv)
+#undef glGetIntegerv
+#define glGetIntegerv (gladCurrentContext->GetIntegerv)
+#undef glGetString
+#define glGetString (gladCurrentContext->GetString)
+#undef glGetTexImage
+#define glGetTexImage (gladCurrentContext->GetTexImage)
+#undef glGetTexParameterfv
+#define glGetTexParameterfv (gladCurrentContext->GetTexParameterfv)
+#undef glGetTexParameteriv
+#define glGetTexParameteriv (gladCurrentContext->GetTexParameteriv)
+#undef glGetTexLevelParameterfv
+#define glGetTexLevelParameterfv (gladCurrentContext->GetTexLevelParameterfv)
+#undef glGetTexLevelParameteriv
+#define glGetTexLevelParameteriv (gladCurrentContext->GetTexLevelParameteriv)
+#undef glIsEnabled
+#define glIsEnabled (gladCurrentContext->IsEnabled)
+#undef glDepthRange
+#define glDepthRange (gladCurrentContext->DepthRange)
+#undef glViewport
+#define glViewport (gladCurrentContext->Viewport)
+#undef glDrawArrays
+#define glDrawArrays (gladCurrentContext->DrawArrays)
+#undef glDrawElements
+#define glDrawElements (gladCurrentContext->DrawElements)
+#undef glPolygonOffset
+#define glPolygonOffset (gladCurrentContext->PolygonOffset)
+#undef glCopyTexImage1D
+#define glCopyTexImage1D (gladCurrentContext->CopyTexImage1D)
+#undef glCopyTexImage2D
+#define glCopyTexImage2D (gladCurrentContext->CopyTexImage2D)
+#undef glCopyTexSubImage1D
+#define glCopyTexSubImage1D (gladCurrentContext->CopyTexSubImage1D)
+#undef glCopyTexSubImage2D
+#define glCopyTexSubImage2D (gladCurrentContext->CopyTexSubImage2D)
+#undef glTexSubImage1D
+#define glTexSubImage1D (gladCurrentContext->TexSubImage1D)
+#undef glTexSubImage2D
+#define glTexSubImage2D (gladCurrentContext->TexSubImage2D)
+#undef glBindTexture
+#define glBindTexture (gladCurrentContext->BindTexture)
+#undef glDeleteTextures
+#define glDeleteTextures (gladCurrentContext->DeleteTextures)
+#undef glGenTextures
+#define glGenTextures (gladCurrentContext->GenTextures)
+#undef glIsTexture
+#define glIsTexture (gladCurrentContext->IsTexture)
+#undef glDrawRangeElements
+#define glDrawRangeElements (gladCurrentContext->DrawRangeElements)
+#undef glTexImage3D
+#define glTexImage3D (gladCurrentContext->TexImage3D)
+#undef glTexSubImage3D
+#define glTexSubImage3D (gladCurrentContext->TexSubImage3D)
+#undef glCopyTexSubImage3D
+#define glCopyTexSubImage3D (gladCurrentContext->CopyTexSubImage3D)
+#undef glActiveTexture
+#define glActiveTexture (gladCurrentContext->ActiveTexture)
+#undef glSampleCoverage
+#define glSampleCoverage (gladCurrentContext->SampleCoverage)
+#undef glCompressedTexImage3D
+#define glCompressedTexImage3D (gladCurrentContext->CompressedTexImage3D)
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D (gladCurrentContext->CompressedTexImage2D)
+#undef glCompressedTexImage1D
+#define glCompressedTexImage1D (gladCurrentContext->CompressedTexImage1D)
+#undef glCompressedTexSubImage3D
+#define glCompressedTexSubImage3D (gladCurrentContext->CompressedTexSubImage3D)
+#undef glCompressedTexSubImage2D
+#define glCompressedTexSubImage2D (gladCurrentContext->CompressedTexSubImage2D)
+#undef glCompressedTexSubImage1D
+#define glCompressedTexSubImage1D (gladCurrentContext->CompressedTexSubImage1D)
+#undef glGetCompressedTexImage
+#define glGetCompressedTexImage (gladCurrentContext->GetCompressedTexImage)
+#undef glBlendFuncSeparate
+#define glBlendFuncSeparate (gladCurrentContext->BlendFuncSeparate)
+#undef glMultiDrawArrays
+#define glMultiDrawArrays (gladCurrentContext->MultiDrawArrays)
+#undef glMultiDrawElements
+#define glMultiDrawElements (gladCurrentContext->MultiDrawElements)
+#undef glPointParameterf
+#define glPointParameterf (gladCurrentContext->PointParameterf)
+#undef glPointParameterfv
+#define glPointParameterfv (gladCurrentContext->PointParameterfv)
+#undef glPointParameteri
+#define glPointParameteri (gladCurrentContext->PointParameteri)
+#undef glPointParameteriv
+#define glPointParameteriv (gladCurrentContext->PointParameteriv)
+#undef glBlendColor
+#define glBlendColor (gladCurrentContext->BlendColor)
+#undef glBlendEquation
+#define glBlendEquation (gladCurrentContext->BlendEquation)
+#undef glGenQueries
+#define glGenQueries (gladCurrentContext->GenQueries)
+#undef glDeleteQueries
+#define glDeleteQueries (gladCurrentContext->DeleteQueries)
+#undef glIsQuery
+#define glIsQuery (gladCurrentContext->IsQuery)
+#undef glBeginQuery
+#define glBeginQuery (gladCurrentContext->BeginQuery)
+#undef glEndQuery
+#define glEndQuery (gladCurrentContext->EndQuery)
+#undef glGetQueryiv
+#define glGetQueryiv (gladCurrentContext->GetQueryiv)
+#undef glGetQueryObjectiv
+#define glGetQueryObjectiv (gladCurrentContext->GetQueryObjectiv)
+#undef glGetQueryObjectuiv
+#define glGetQueryObjectuiv (gladCurrentContext->GetQueryObjectuiv)
+#undef glBindBuffer
+#define glBindBuffer (gladCurrentContext->BindBuffer)
+#undef glDeleteBuffers
+#define glDeleteBuffers (gladCurrentContext->DeleteBuffers)
+#undef glGenBuffers
+#define glGenBuffers (gladCurrentContext->GenBuffers)
+#undef glIsBuffer
+#define glIsBuffer (gladCurrentContext->IsBuffer)
+#undef glBufferData
+#define glBufferData (gladCurrentContext->BufferData)
+#undef glBufferSubData
+#define glBufferSubData (gladCurrentContext->BufferSubData)
+#undef glGetBufferSubData
+#define glGetBufferSubData (gladCurrentContext->GetBufferSubData)
+#undef glMapBuffer
+#define glMapBuffer (gladCurrentContext->MapBuffer)
+#undef glUnmapBuffer
+#define glUnmapBuffer (gladCurrentContext->UnmapBuffer)
+#undef glGetBufferParameteriv
+#define glGetBufferParameteriv (gladCurrentContext->GetBufferParameteriv)
+#undef glGetBufferPointerv
+#define glGetBufferPointerv (gladCurrentContext->GetBufferPointerv)
+#undef glBlendEquationSeparate
+#define glBlendEquationSeparate (gladCurrentContext->BlendEquationSeparate)
+#undef glDrawBuffers
+#define glDrawBuffers (gladCurrentContext->DrawBuffers)
+#undef glStencilOpSeparate
+#define glStencilOpSeparate (gladCurrentContext->StencilOpSeparate)
+#undef glStencilFuncSeparate
+#define glStencilFuncSeparate (gladCurrentContext->StencilFuncSeparate)
+#undef glStencilMaskSeparate
+#define glStencilMaskSeparate (gladCurrentContext->StencilMaskSeparate)
+#undef glAttachShader
+#define glAttachShader (gladCurrentContext->AttachShader)
+#undef glBindAttribLocation
+#define glBindAttribLocation (gladCurrentContext->BindAttribLocation)
+#undef glCompileShader
+#define glCompileShader (gladCurrentContext->CompileShader)
+#undef glCreateProgram
+#define glCreateProgram (gladCurrentContext->CreateProgram)
+#undef glCreateShader
+#define glCreateShader (gladCurrentContext->CreateShader)
+#undef glDeleteProgram
+#define glDeleteProgram (gladCurrentContext->DeleteProgram)
+#undef glDeleteShader
+#define glDeleteShader (gladCurrentContext->DeleteShader)
+#undef glDetachShader
+#define glDetachShader (gladCurrentContext->DetachShader)
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray (gladCurrentContext->DisableVertexAttribArray)
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray (gladCurrentContext->EnableVertexAttribArray)
+#undef glGetActiveAttrib
+#define glGetActiveAttrib (gladCurrentContext->GetActiveAttrib)
+#undef glGetActiveUniform
+#define glGetActiveUniform (gladCurrentContext->GetActiveUniform)
+#undef glGetAttachedShaders
+#define glGetAttachedShaders (gladCurrentContext->GetAttachedShaders)
+#undef glGetAttribLocation
+#define glGetAttribLocation (gladCurrentContext->GetAttribLocation)
+#undef glGetProgramiv
+#define glGetProgramiv (gladCurrentContext->GetProgramiv)
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog (gladCurrentContext->GetProgramInfoLog)
+#undef glGetShaderiv
+#define glGetShaderiv (gladCurrentContext->GetShaderiv)
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog (gladCurrentContext->GetShaderInfoLog)
+#undef glGetShaderSource
+#define glGetShaderSource (gladCurrentContext->GetShaderSource)
+#undef glGetUniformLocation
+#define glGetUniformLocation (gladCurrentContext->GetUniformLocation)
+#undef glGetUniformfv
+#define glGetUniformfv (gladCurrentContext->GetUniformfv)
+#undef glGetUniformiv
+#define glGetUniformiv (gladCurrentContext->GetUniformiv)
+#undef glGetVertexAttribdv
+#define glGetVertexAttribdv (gladCurrentContext->GetVertexAttribdv)
+#undef glGetVertexAttribfv
+#define glGetVertexAttribfv (gladCurrentContext->GetVertexAttribfv)
+#undef glGetVertexAttribiv
+#define glGetVertexAttribiv (gladCurrentContext->GetVertexAttribiv)
+#undef glGetVertexAttribPointerv
+#define glGetVertexAttribPointerv (gladCurrentContext->GetVertexAttribPointerv)
+#undef glIsProgram
+#define glIsProgram (gladCurrentContext->IsProgram)
+#undef glIsShader
+#define glIsShader (gladCurrentContext->IsShader)
+#undef glLinkProgram
+#define glLinkProgram (gladCurrentContext->LinkProgram)
+#undef glShaderSource
+#define glShaderSource (gladCurrentContext->ShaderSource)
+#undef glUseProgram
+#define glUseProgram (gladCurrentContext->UseProgram)
+#undef glUniform1f
+#define glUniform1f (gladCurrentContext->Uniform1f)
+#undef glUniform2f
+#define glUniform2f (gladCurrentContext->Uniform2f)
+#undef glUniform3f
+#define glUniform3f (gladCurrentContext->Uniform3f)
+#undef glUniform4f
+#define glUniform4f (gladCurrentContext->Uniform4f)
+#undef glUniform1i
+#define glUniform1i (gladCurrentContext->Uniform1i)
+#undef glUniform2i
+#define glUniform2i (gladCurrentContext->Uniform2i)
+#undef glUniform3i
+#define glUniform3i (gladCurrentContext->Uniform3i)
+#undef glUniform4i
+#define glUniform4i (gladCurrentContext->Uniform4i)
+#undef glUniform1fv
+#define glUniform1fv (gladCurrentContext->Uniform1fv)
+#undef glUniform2fv
+#define glUniform2fv (gladCurrentContext->Uniform2fv)
+#undef glUniform3fv
+#define glUniform3fv (gladCurrentContext->Uniform3fv)
+#undef glUniform4fv
+#define glUniform4fv (gladCurrentContext->Uniform4fv)
+#undef glUniform1iv
+#define glUniform1iv (gladCurrentContext->Uniform1iv)
+#undef glUniform2iv
+#define glUniform2iv (gladCurrentContext->Uniform2iv)
+#undef glUniform3iv
+#define glUniform3iv (gladCurrentContext->Uniform3iv)
+#undef glUniform4iv
+#define glUniform4iv (gladCurrentContext->Uniform4iv)
+#undef glUniformMatrix2fv
+#define glUniformMatrix2fv (gladCurrentContext->UniformMatrix2fv)
+#undef glUniformMatrix3fv
+#define glUniformMatrix3fv (gladCurrentContext->UniformMatrix3fv)
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv (gladCurrentContext->UniformMatrix4fv)
+#undef glValidateProgram
+#define glValidateProgram (gladCurrentContext->ValidateProgram)
+#undef glVertexAttrib1d
+#define glVertexAttrib1d (gladCurrentContext->VertexAttrib1d)
+#undef glVertexAttrib1dv
+#define glVertexAttrib1dv (gladCurrentContext->VertexAttrib1dv)
+#undef glVertexAttrib1f
+#define glVertexAttrib1f (gladCurrentContext->VertexAttrib1f)
+#undef glVertexAttrib1fv
+#define glVertexAttrib1fv (gladCurrentContext->VertexAttrib1fv)
+#undef glVertexAttrib1s
+#define glVertexAttrib1s (gladCurrentContext->VertexAttrib1s)
+#undef glVertexAttrib1sv
+#define glVertexAttrib1sv (gladCurrentContext->VertexAttrib1sv)
+#undef glVertexAttrib2d
+#define glVertexAttrib2d (gladCurrentContext->VertexAttrib2d)
+#undef glVertexAttrib2dv
+#define glVertexAttrib2dv (gladCurrentContext->VertexAttrib2dv)
+#undef glVertexAttrib2f
+#define glVertexAttrib2f (gladCurrentContext->VertexAttrib2f)
+#undef glVertexAttrib2fv
+#define glVertexAttrib2fv (gladCurrentContext->VertexAttrib2fv)
+#undef glVertexAttrib2s
+#define glVertexAttrib2s (gladCurrentContext->VertexAttrib2s)
+#undef glVertexAttrib2sv
+#define glVertexAttrib2sv (gladCurrentContext->VertexAttrib2sv)
+#undef glVertexAttrib3d
+#define glVertexAttrib3d (gladCurrentContext->VertexAttrib3d)
+#undef glVertexAttrib3dv
+#define glVertexAttrib3dv (gladCurrentContext->VertexAttrib3dv)
+#undef glVertexAttrib3f
+#define glVertexAttrib3f (gladCurrentContext->VertexAttrib3f)
+#undef glVertexAttrib3fv
+#define glVertexAttrib3fv (gladCurrentContext->VertexAttrib3fv)
+#undef glVertexAttrib3s
+#define glVertexAttrib3s (gladCurrentContext->VertexAttrib3s)
+#undef glVertexAttrib3sv
+#define glVertexAttrib3sv (gladCurrentContext->VertexAttrib3sv)
+#undef glVertexAttrib4Nbv
+#define glVertexAttrib4Nbv (gladCurrentContext->VertexAttrib4Nbv)
+#undef glVertexAttrib4Niv
+#define glVertexAttrib4Niv (gladCurrentContext->VertexAttrib4Niv)
+#undef glVertexAttrib4Nsv
+#define glVertexAttrib4Nsv (gladCurrentContext->VertexAttrib4Nsv)
+#undef glVertexAttrib4Nub
+#define glVertexAttrib4Nub (gladCurrentContext->VertexAttrib4Nub)
+#undef glVertexAttrib4Nubv
+#define glVertexAttrib4Nubv (gladCurrentContext->VertexAttrib4Nubv)
+#undef glVertexAttrib4Nuiv
+#define glVertexAttrib4Nuiv (gladCurrentContext->VertexAttrib4Nuiv)
+#undef glVertexAttrib4Nusv
+#define glVertexAttrib4Nusv (gladCurrentContext->VertexAttrib4Nusv)
+#undef glVertexAttrib4bv
+#define glVertexAttrib4bv (gladCurrentContext->VertexAttrib4bv)
+#undef glVertexAttrib4d
+#define glVertexAttrib4d (gladCurrentContext->VertexAttrib4d)
+#undef glVertexAttrib4dv
+#define glVertexAttrib4dv (gladCurrentContext->VertexAttrib4dv)
+#undef glVertexAttrib4f
+#define glVertexAttrib4f (gladCurrentContext->VertexAttrib4f)
+#undef glVertexAttrib4fv
+#define glVertexAttrib4fv (gladCurrentContext->VertexAttrib4fv)
+#undef glVertexAttrib4iv
+#define glVertexAttrib4iv (gladCurrentContext->VertexAttrib4iv)
+#undef glVertexAttrib4s
+#define glVertexAttrib4s (gladCurrentContext->VertexAttrib4s)
+#undef glVertexAttrib4sv
+#define glVertexAttrib4sv (gladCurrentContext->VertexAttrib4sv)
+#undef glVertexAttrib4ubv
+#define glVertexAttrib4ubv (gladCurrentContext->VertexAttrib4ubv)
+#undef glVertexAttrib4uiv
+#define glVertexAttrib4uiv (gladCurrentContext->VertexAttrib4uiv)
+#undef glVertexAttrib4usv
+#define glVertexAttrib4usv (gladCurrentContext->VertexAttrib4usv)
+#undef glVertexAttribPointer
+#define glVertexAttribPointer (gladCurrentContext->VertexAttribPointer)
+#undef glUniformMatrix2x3fv
+#define glUniformMatrix2x3fv (gladCurrentContext->UniformMatrix2x3fv)
+#undef glUniformMatrix3x2fv
+#define glUniformMatrix3x2fv (gladCurrentContext->UniformMatrix3x2fv)
+#undef glUniformMatrix2x4fv
+#define glUniformMatrix2x4fv (gladCurrentContext->UniformMatrix2x4fv)
+#undef glUniformMatrix4x2fv
+#define glUniformMatrix4x2fv (gladCurrentContext->UniformMatrix4x2fv)
+#undef glUniformMatrix3x4fv
+#define glUniformMatrix3x4fv (gladCurrentContext->UniformMatrix3x4fv)
+#undef glUniformMatrix4x3fv
+#define glUniformMatrix4x3fv (gladCurrentContext->UniformMatrix4x3fv)
+#undef glColorMaski
+#define glColorMaski (gladCurrentContext->ColorMaski)
+#undef glGetBooleani_v
+#define glGetBooleani_v (gladCurrentContext->GetBooleani_v)
+#undef glGetIntegeri_v
+#define glGetIntegeri_v (gladCurrentContext->GetIntegeri_v)
+#undef glEnablei
+#define glEnablei (gladCurrentContext->Enablei)
+#undef glDisablei
+#define glDisablei (gladCurrentContext->Disablei)
+#undef glIsEnabledi
+#define glIsEnabledi (gladCurrentContext->IsEnabledi)
+#undef glBeginTransformFeedback
+#define glBeginTransformFeedback (gladCurrentContext->BeginTransformFeedback)
+#undef glEndTransformFeedback
+#define glEndTransformFeedback (gladCurrentContext->EndTransformFeedback)
+#undef glBindBufferRange
+#define glBindBufferRange (gladCurrentContext->BindBufferRange)
+#undef glBindBufferBase
+#define glBindBufferBase (gladCurrentContext->BindBufferBase)
+#undef glTransformFeedbackVaryings
+#define glTransformFeedbackVaryings (gladCurrentContext->TransformFeedbackVaryings)
+#undef glGetTransformFeedbackVarying
+#define glGetTransformFeedbackVarying (gladCurrentContext->GetTransformFeedbackVarying)
+#undef glClampColor
+#define glClampColor (gladCurrentContext->ClampColor)
+#undef glBeginConditionalRender
+#define glBeginConditionalRender (gladCurrentContext->BeginConditionalRender)
+#undef glEndConditionalRender
+#define glEndConditionalRender (gladCurrentContext->EndConditionalRender)
+#undef glVertexAttribIPointer
+#define glVertexAttribIPointer (gladCurrentContext->VertexAttribIPointer)
+#undef glGetVertexAttribIiv
+#define glGetVertexAttribIiv (gladCurrentContext->GetVertexAttribIiv)
+#undef glGetVertexAttribIuiv
+#define glGetVertexAttribIuiv (gladCurrentContext->GetVertexAttribIuiv)
+#undef glVertexAttribI1i
+#define glVertexAttribI1i (gladCurrentContext->VertexAttribI1i)
+#undef glVertexAttribI2i
+#define glVertexAttribI2i (gladCurrentContext->VertexAttribI2i)
+#undef glVertexAttribI3i
+#define glVertexAttribI3i (gladCurrentContext->VertexAttribI3i)
+#undef glVertexAttribI4i
+#define glVertexAttribI4i (gladCurrentContext->VertexAttribI4i)
+#undef glVertexAttribI1ui
+#define glVertexAttribI1ui (gladCurrentContext->VertexAttribI1ui)
+#undef glVertexAttribI2ui
+#define glVertexAttribI2ui (gladCurrentContext->VertexAttribI2ui)
+#undef glVertexAttribI3ui
+#define glVertexAttribI3ui (gladCurrentContext->VertexAttribI3ui)
+#undef glVertexAttribI4ui
+#define glVertexAttribI4ui (gladCurrentContext->VertexAttribI4ui)
+#undef glVertexAttribI1iv
+#define glVertexAttribI1iv (gladCurrentContext->VertexAttribI1iv)
+#undef glVertexAttribI2iv
+#define glVertexAttribI2iv (gladCurrentContext->VertexAttribI2iv)
+#undef glVertexAttribI3iv
+#define glVertexAttribI3iv (gladCurrentContext->VertexAttribI3iv)
+#undef glVertexAttribI4iv
+#define glVertexAttribI4iv (gladCurrentContext->VertexAttribI4iv)
+#undef glVertexAttribI1uiv
+#define glVertexAttribI1uiv (gladCurrentContext->VertexAttribI1uiv)
+#undef glVertexAttribI2uiv
+#define glVertexAttribI2uiv (gladCurrentContext->VertexAttribI2uiv)
+#undef glVertexAttribI3uiv
+#define glVertexAttribI3uiv (gladCurrentContext->VertexAttribI3uiv)
+#undef glVertexAttribI4uiv
+#define glVertexAttribI4uiv (gladCurrentContext->VertexAttribI4uiv)
+#undef glVertexAttribI4bv
+#define glVertexAttribI4bv (gladCurrentContext->VertexAttribI4bv)
+#undef glVertexAttribI4sv
+#define glVertexAttribI4sv (gladCurrentContext->VertexAttribI4sv)
+#undef glVertexAttribI4ubv
+#define glVertexAttribI4ubv (gladCurrentContext->VertexAttribI4ubv)
+#undef glVertexAttribI4usv
+#define glVertexAttribI4usv (gladCurrentContext->VertexAttribI4usv)
+#undef glGetUniformuiv
+#define glGetUniformuiv (gladCurrentContext->GetUniformuiv)
+#undef glBindFragDataLocation
+#define glBindFragDataLocation (gladCurrentContext->BindFragDataLocation)
+#undef glGetFragDataLocation
+#define glGetFragDataLocation (gladCurrentContext->GetFragDataLocation)
+#undef glUniform1ui
+#define glUniform1ui (gladCurrentContext->Uniform1ui)
+#undef glUniform2ui
+#define glUniform2ui (gladCurrentContext->Uniform2ui)
+#undef glUniform3ui
+#define glUniform3ui (gladCurrentContext->Uniform3ui)
+#undef glUniform4ui
+#define glUniform4ui (gladCurrentContext->Uniform4ui)
+#undef glUniform1uiv
+#define glUniform1uiv (gladCurrentContext->Uniform1uiv)
+#undef glUniform2uiv
+#define glUniform2uiv (gladCurrentContext->Uniform2uiv)
+#undef glUniform3uiv
+#define glUniform3uiv (gladCurrentContext->Uniform3uiv)
+#undef glUniform4uiv
+#define glUniform4uiv (gladCurrentContext->Uniform4uiv)
+#undef glTexParameterIiv
+#define glTexParameterIiv (gladCurrentContext->TexParameterIiv)
+#undef glTexParameterIuiv
+#define glTexParameterIuiv (gladCurrentContext->TexParameterIuiv)
+#undef glGetTexParameterIiv
+#define glGetTexParameterIiv (gladCurrentContext->GetTexParameterIiv)
+#undef glGetTexParameterIuiv
+#define glGetTexParameterIuiv (gladCurrentContext->GetTexParameterIuiv)
+#undef glClearBufferiv
+#define glClearBufferiv (gladCurrentContext->ClearBufferiv)
+#undef glClearBufferuiv
+#define glClearBufferuiv (gladCurrentContext->ClearBufferuiv)
+#undef glClearBufferfv
+#define glClearBufferfv (gladCurrentContext->ClearBufferfv)
+#undef glClearBufferfi
+#define glClearBufferfi (gladCurrentContext->ClearBufferfi)
+#undef glGetStringi
+#define glGetStringi (gladCurrentContext->GetStringi)
+#undef glIsRenderbuffer
+#define glIsRenderbuffer (gladCurrentContext->IsRenderbuffer)
+#undef glBindRenderbuffer
+#define glBindRenderbuffer (gladCurrentContext->BindRenderbuffer)
+#undef glDeleteRenderbuffers
+#define glDeleteRenderbuffers (gladCurrentContext->DeleteRenderbuffers)
+#undef glGenRenderbuffers
+#define glGenRenderbuffers (gladCurrentContext->GenRenderbuffers)
+#undef glRenderbufferStorage
+#define glRenderbufferStorage (gladCurrentContext->RenderbufferStorage)
+#undef glGetRenderbufferParameteriv
+#define glGetRenderbufferParameteriv (gladCurrentContext->GetRenderbufferParameteriv)
+#undef glIsFramebuffer
+#define glIsFramebuffer (gladCurrentContext->IsFramebuffer)
+#undef glBindFramebuffer
+#define glBindFramebuffer (gladCurrentContext->BindFramebuffer)
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers (gladCurrentContext->DeleteFramebuffers)
+#undef glGenFramebuffers
+#define glGenFramebuffers (gladCurrentContext->GenFramebuffers)
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus (gladCurrentContext->CheckFramebufferStatus)
+#undef glFramebufferTexture1D
+#define glFramebufferTexture1D (gladCurrentContext->FramebufferTexture1D)
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D (gladCurrentContext->FramebufferTexture2D)
+#undef glFramebufferTexture3D
+#define glFramebufferTexture3D (gladCurrentContext->FramebufferTexture3D)
+#undef glFramebufferRenderbuffer
+#define glFramebufferRenderbuffer (gladCurrentContext->FramebufferRenderbuffer)
+#undef glGetFramebufferAttachmentParameteriv
+#define glGetFramebufferAttachmentParameteriv (gladCurrentContext->GetFramebufferAttachmentParameteriv)
+#undef glGenerateMipmap
+#define glGenerateMipmap (gladCurrentContext->GenerateMipmap)
+#undef glBlitFramebuffer
+#define glBlitFramebuffer (gladCurrentContext->BlitFramebuffer)
+#undef glRenderbufferStorageMultisample
+#define glRenderbufferStorageMultisample (gladCurrentContext->RenderbufferStorageMultisample)
+#undef glFramebufferTextureLayer
+#define glFramebufferTextureLayer (gladCurrentContext->FramebufferTextureLayer)
+#undef glMapBufferRange
+#define glMapBufferRange (gladCurrentContext->MapBufferRange)
+#undef glFlushMappedBufferRange
+#define glFlushMappedBufferRange (gladCurrentContext->FlushMappedBufferRange)
+#undef glBindVertexArray
+#define glBindVertexArray (gladCurrentContext->BindVertexArray)
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays (gladCurrentContext->DeleteVertexArrays)
+#undef glGenVertexArrays
+#define glGenVertexArrays (gladCurrentContext->GenVertexArrays)
+#undef glIsVertexArray
+#define glIsVertexArray (gladCurrentContext->IsVertexArray)
+#undef glDrawArraysInstanced
+#define glDrawArraysInstanced (gladCurrentContext->DrawArraysInstanced)
+#undef glDrawElementsInstanced
+#define glDrawElementsInstanced (gladCurrentContext->DrawElementsInstanced)
+#undef glTexBuffer
+#define glTexBuffer (gladCurrentContext->TexBuffer)
+#undef glPrimitiveRestartIndex
+#define glPrimitiveRestartIndex (gladCurrentContext->PrimitiveRestartIndex)
+#undef glCopyBufferSubData
+#define glCopyBufferSubData (gladCurrentContext->CopyBufferSubData)
+#undef glGetUniformIndices
+#define glGetUniformIndices (gladCurrentContext->GetUniformIndices)
+#undef glGetActiveUniformsiv
+#define glGetActiveUniformsiv (gladCurrentContext->GetActiveUniformsiv)
+#undef glGetActiveUniformName
+#define glGetActiveUniformName (gladCurrentContext->GetActiveUniformName)
+#undef glGetUniformBlockIndex
+#define glGetUniformBlockIndex (gladCurrentContext->GetUniformBlockIndex)
+#undef glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockiv (gladCurrentContext->GetActiveUniformBlockiv)
+#undef glGetActiveUniformBlockName
+#define glGetActiveUniformBlockName (gladCurrentContext->GetActiveUniformBlockName)
+#undef glUniformBlockBinding
+#define glUniformBlockBinding (gladCurrentContext->UniformBlockBinding)
+#undef glDrawElementsBaseVertex
+#define glDrawElementsBaseVertex (gladCurrentContext->DrawElementsBaseVertex)
+#undef glDrawRangeElementsBaseVertex
+#define glDrawRangeElementsBaseVertex (gladCurrentContext->DrawRangeElementsBaseVertex)
+#undef glDrawElementsInstancedBaseVertex
+#define glDrawElementsInstancedBaseVertex (gladCurrentContext->DrawElementsInstancedBaseVertex)
+#undef glMultiDrawElementsBaseVertex
+#define glMultiDrawElementsBaseVertex (gladCurrentContext->MultiDrawElementsBaseVertex)
+#undef glProvokingVertex
+#define glProvokingVertex (gladCurrentContext->ProvokingVertex)
+#undef glFenceSync
+#define glFenceSync (gladCurrentContext->FenceSync)
+#undef glIsSync
+#define glIsSync (gladCurrentContext->IsSync)
+#undef glDeleteSync
+#define glDeleteSync (gladCurrentContext->DeleteSync)
+#undef glClientWaitSync
+#define glClientWaitSync (gladCurrentContext->ClientWaitSync)
+#undef glWaitSync
+#define glWaitSync (gladCurrentContext->WaitSync)
+#undef glGetInteger64v
+#define glGetInteger64v (gladCurrentContext->GetInteger64v)
+#undef glGetSynciv
+#define glGetSynciv (gladCurrentContext->GetSynciv)
+#undef glGetInteger64i_v
+#define glGetInteger64i_v (gladCurrentContext->GetInteger64i_v)
+#undef glGetBufferParameteri64v
+#define glGetBufferParameteri64v (gladCurrentContext->GetBufferParameteri64v)
+#undef glFramebufferTexture
+#define glFramebufferTexture (gladCurrentContext->FramebufferTexture)
+#undef glTexImage2DMultisample
+#define glTexImage2DMultisample (gladCurrentContext->TexImage2DMultisample)
+#undef glTexImage3DMultisample
+#define glTexImage3DMultisample (gladCurrentContext->TexImage3DMultisample)
+#undef glGetMultisamplefv
+#define glGetMultisamplefv (gladCurrentContext->GetMultisamplefv)
+#undef glSampleMaski
+#define glSampleMaski (gladCurrentContext->SampleMaski)
+#undef glBindFragDataLocationIndexed
+#define glBindFragDataLocationIndexed (gladCurrentContext->BindFragDataLocationIndexed)
+#undef glGetFragDataIndex
+#define glGetFragDataIndex (gladCurrentContext->GetFragDataIndex)
+#undef glGenSamplers
+#define glGenSamplers (gladCurrentContext->GenSamplers)
+#undef glDeleteSamplers
+#define glDeleteSamplers (gladCurrentContext->DeleteSamplers)
+#undef glIsSampler
+#define glIsSampler (gladCurrentContext->IsSampler)
+#undef glBindSampler
+#define glBindSampler (gladCurrentContext->BindSampler)
+#undef glSamplerParameteri
+#define glSamplerParameteri (gladCurrentContext->SamplerParameteri)
+#undef glSamplerParameteriv
+#define glSamplerParameteriv (gladCurrentContext->SamplerParameteriv)
+#undef glSamplerParameterf
+#define glSamplerParameterf (gladCurrentContext->SamplerParameterf)
+#undef glSamplerParameterfv
+#define glSamplerParameterfv (gladCurrentContext->SamplerParameterfv)
+#undef glSamplerParameterIiv
+#define glSamplerParameterIiv (gladCurrentContext->SamplerParameterIiv)
+#undef glSamplerParameterIuiv
+#define glSamplerParameterIuiv (gladCurrentContext->SamplerParameterIuiv)
+#undef glGetSamplerParameteriv
+#define glGetSamplerParameteriv (gladCurrentContext->GetSamplerParameteriv)
+#undef glGetSamplerParameterIiv
+#define glGetSamplerParameterIiv (gladCurrentContext->GetSamplerParameterIiv)
+#undef glGetSamplerParameterfv
+#define glGetSamplerParameterfv (gladCurrentContext->GetSamplerParameterfv)
+#undef glGetSamplerParameterIuiv
+#define glGetSamplerParameterIuiv (gladCurrentContext->GetSamplerParameterIuiv)
+#undef glQueryCounter
+#define glQueryCounter (gladCurrentContext->QueryCounter)
+#undef glGetQueryObjecti64v
+#define glGetQueryObjecti64v (gladCurrentContext->GetQueryObjecti64v)
+#undef glGetQueryObjectui64v
+#define glGetQueryObjectui64v (gladCurrentContext->GetQueryObjectui64v)
+#undef glVertexAttribDivisor
+#define glVertexAttribDivisor (gladCurrentContext->VertexAttribDivisor)
+#undef glVertexAttribP1ui
+#define glVertexAttribP1ui (gladCurrentContext->VertexAttribP1ui)
+#undef glVertexAttribP1uiv
+#define glVertexAttribP1uiv (gladCurrentContext->VertexAttribP1uiv)
+#undef glVertexAttribP2ui
+#define glVertexAttribP2ui (gladCurrentContext->VertexAttribP2ui)
+#undef glVertexAttribP2uiv
+#define glVertexAttribP2uiv (gladCurrentContext->VertexAttribP2uiv)
+#undef glVertexAttribP3ui
+#define glVertexAttribP3ui (gladCurrentContext->VertexAttribP3ui)
+#undef glVertexAttribP3uiv
+#define glVertexAttribP3uiv (gladCurrentContext->VertexAttribP3uiv)
+#undef glVertexAttribP4ui
+#define glVertexAttribP4ui (gladCurrentContext->VertexAttribP4ui)
+#undef glVertexAttribP4uiv
+#define glVertexAttribP4uiv (gladCurrentContext->VertexAttribP4uiv)
+#undef glVertexP2ui
+#define glVertexP2ui (gladCurrentContext->VertexP2ui)
+#undef glVertexP2uiv
+#define glVertexP2uiv (gladCurrentContext->VertexP2uiv)
+#undef glVertexP3ui
+#define glVertexP3ui (gladCurrentContext->VertexP3ui)
+#undef glVertexP3uiv
+#define glVertexP3uiv (gladCurrentContext->VertexP3uiv)
+#undef glVertexP4ui
+#define glVertexP4ui (gladCurrentContext->VertexP4ui)
+#undef glVertexP4uiv
+#define glVertexP4uiv (gladCurrentContext->VertexP4uiv)
+#undef glTexCoordP1ui
+#define glTexCoordP1ui (gladCurrentContext->TexCoordP1ui)
+#undef glTexCoordP1uiv
+#define glTexCoordP1uiv (gladCurrentContext->TexCoordP1uiv)
+#undef glTexCoordP2ui
+#define glTexCoordP2ui (gladCurrentContext->TexCoordP2ui)
+#undef glTexCoordP2uiv
+#define glTexCoordP2uiv (gladCurrentContext->TexCoordP2uiv)
+#undef glTexCoordP3ui
+#define glTexCoordP3ui (gladCurrentContext->TexCoordP3ui)
+#undef glTexCoordP3uiv
+#define glTexCoordP3uiv (gladCurrentContext->TexCoordP3uiv)
+#undef glTexCoordP4ui
+#define glTexCoordP4ui (gladCurrentContext->TexCoordP4ui)
+#undef glTexCoordP4uiv
+#define glTexCoordP4uiv (gladCurrentContext->TexCoordP4uiv)
+#undef glMultiTexCoordP1ui
+#define glMultiTexCoordP1ui (gladCurrentContext->MultiTexCoordP1ui)
+#undef glMultiTexCoordP1uiv
+#define glMultiTexCoordP1uiv (gladCurrentContext->MultiTexCoordP1uiv)
+#undef glMultiTexCoordP2ui
+#define glMultiTexCoordP2ui (gladCurrentContext->MultiTexCoordP2ui)
+#undef glMultiTexCoordP2uiv
+#define glMultiTexCoordP2uiv (gladCurrentContext->MultiTexCoordP2uiv)
+#undef glMultiTexCoordP3ui
+#define glMultiTexCoordP3ui (gladCurrentContext->MultiTexCoordP3ui)
+#undef glMultiTexCoordP3uiv
+#define glMultiTexCoordP3uiv (gladCurrentContext->MultiTexCoordP3uiv)
+#undef glMultiTexCoordP4ui
+#define glMultiTexCoordP4ui (gladCurrentContext->MultiTexCoordP4ui)
+#undef glMultiTexCoordP4uiv
+#define glMultiTexCoordP4uiv (gladCurrentContext->MultiTexCoordP4uiv)
+#undef glNormalP3ui
+#define glNormalP3ui (gladCurrentContext->NormalP3ui)
+#undef glNormalP3uiv
+#define glNormalP3uiv (gladCurrentContext->NormalP3uiv)
+#undef glColorP3ui
+#define glColorP3ui (gladCurrentContext->ColorP3ui)
+#undef glColorP3uiv
+#define glColorP3uiv (gladCurrentContext->ColorP3uiv)
+#undef glColorP4ui
+#define glColorP4ui (gladCurrentContext->ColorP4ui)
+#undef glColorP4uiv
+#define glColorP4uiv (gladCurrentContext->ColorP4uiv)
+#undef glSecondaryColorP3ui
+#define glSecondaryColorP3ui (gladCurrentContext->SecondaryColorP3ui)
+#undef glSecondaryColorP3uiv
+#define glSecondaryColorP3uiv (gladCurrentContext->SecondaryColorP3uiv)
+#undef glMinSampleShading
+#define glMinSampleShading (gladCurrentContext->MinSampleShading)
+#undef glBlendEquationi
+#define glBlendEquationi (gladCurrentContext->BlendEquationi)
+#undef glBlendEquationSeparatei
+#define glBlendEquationSeparatei (gladCurrentContext->BlendEquationSeparatei)
+#undef glBlendFunci
+#define glBlendFunci (gladCurrentContext->BlendFunci)
+#undef glBlendFuncSeparatei
+#define glBlendFuncSeparatei (gladCurrentContext->BlendFuncSeparatei)
+#undef glDrawArraysIndirect
+#define glDrawArraysIndirect (gladCurrentContext->DrawArraysIndirect)
+#undef glDrawElementsIndirect
+#define glDrawElementsIndirect (gladCurrentContext->DrawElementsIndirect)
+#undef glUniform1d
+#define glUniform1d (gladCurrentContext->Uniform1d)
+#undef glUniform2d
+#define glUniform2d (gladCurrentContext->Uniform2d)
+#undef glUniform3d
+#define glUniform3d (gladCurrentContext->Uniform3d)
+#undef glUniform4d
+#define glUniform4d (gladCurrentContext->Uniform4d)
+#undef glUniform1dv
+#define glUniform1dv (gladCurrentContext->Uniform1dv)
+#undef glUniform2dv
+#define glUniform2dv (gladCurrentContext->Uniform2dv)
+#undef glUniform3dv
+#define glUniform3dv (gladCurrentContext->Uniform3dv)
+#undef glUniform4dv
+#define glUniform4dv (gladCurrentContext->Uniform4dv)
+#undef glUniformMatrix2dv
+#define glUniformMatrix2dv (gladCurrentContext->UniformMatrix2dv)
+#undef glUniformMatrix3dv
+#define glUniformMatrix3dv (gladCurrentContext->UniformMatrix3dv)
+#undef glUniformMatrix4dv
+#define glUniformMatrix4dv (gladCurrentContext->UniformMatrix4dv)
+#undef glUniformMatrix2x3dv
+#define glUniformMatrix2x3dv (gladCurrentContext->UniformMatrix2x3dv)
+#undef glUniformMatrix2x4dv
+#define glUniformMatrix2x4dv (gladCurrentContext->UniformMatrix2x4dv)
+#undef glUniformMatrix3x2dv
+#define glUniformMatrix3x2dv (gladCurrentContext->UniformMatrix3x2dv)
+#undef glUniformMatrix3x4dv
+#define glUniformMatrix3x4dv (gladCurrentContext->UniformMatrix3x4dv)
+#undef glUniformMatrix4x2dv
+#define glUniformMatrix4x2dv (gladCurrentContext->UniformMatrix4x2dv)
+#undef glUniformMatrix4x3dv
+#define glUniformMatrix4x3dv (gladCurrentContext->UniformMatrix4x3dv)
+#undef glGetUniformdv
+#define glGetUniformdv (gladCurrentContext->GetUniformdv)
+#undef glGetSubroutineUniformLocation
+#define glGetSubroutineUniformLocation (gladCurrentContext->GetSubroutineUniformLocation)
+#undef glGetSubroutineIndex
+#define glGetSubroutineIndex (gladCurrentContext->GetSubroutineIndex)
+#undef glGetActiveSubroutineUniformiv
+#define glGetActiveSubroutineUniformiv (gladCurrentContext->GetActiveSubroutineUniformiv)
+#undef glGetActiveSubroutineUniformName
+#define glGetActiveSubroutineUniformName (gladCurrentContext->GetActiveSubroutineUniformName)
+#undef glGetActiveSubroutineName
+#define glGetActiveSubroutineName (gladCurrentContext->GetActiveSubroutineName)
+#undef glUniformSubroutinesuiv
+#define glUniformSubroutinesuiv (gladCurrentContext->UniformSubroutinesuiv)
+#undef glGetUniformSubroutineuiv
+#define glGetUniformSubroutineuiv (gladCurrentContext->GetUniformSubroutineuiv)
+#undef glGetProgramStageiv
+#define glGetProgramStageiv (gladCurrentContext->GetProgramStageiv)
+#undef glPatchParameteri
+#define glPatchParameteri (gladCurrentContext->PatchParameteri)
+#undef glPatchParameterfv
+#define glPatchParameterfv (gladCurrentContext->PatchParameterfv)
+#undef glBindTransformFeedback
+#define glBindTransformFeedback (gladCurrentContext->BindTransformFeedback)
+#undef glDeleteTransformFeedbacks
+#define glDeleteTransformFeedbacks (gladCurrentContext->DeleteTransformFeedbacks)
+#undef glGenTransformFeedbacks
+#define glGenTransformFeedbacks (gladCurrentContext->GenTransformFeedbacks)
+#undef glIsTransformFeedback
+#define glIsTransformFeedback (gladCurrentContext->IsTransformFeedback)
+#undef glPauseTransformFeedback
+#define glPauseTransformFeedback (gladCurrentContext->PauseTransformFeedback)
+#undef glResumeTransformFeedback
+#define glResumeTransformFeedback (gladCurrentContext->ResumeTransformFeedback)
+#undef glDrawTransformFeedback
+#define glDrawTransformFeedback (gladCurrentContext->DrawTransformFeedback)
+#undef glDrawTransformFeedbackStream
+#define glDrawTransformFeedbackStream (gladCurrentContext->DrawTransformFeedbackStream)
+#undef glBeginQueryIndexed
+#define glBeginQueryIndexed (gladCurrentContext->BeginQueryIndexed)
+#undef glEndQueryIndexed
+#define glEndQueryIndexed (gladCurrentContext->EndQueryIndexed)
+#undef glGetQueryIndexediv
+#define glGetQueryIndexediv (gladCurrentContext->GetQueryIndexediv)
+#undef glReleaseShaderCompiler
+#define glReleaseShaderCompiler (gladCurrentContext->ReleaseShaderCompiler)
+#undef glShaderBinary
+#define glShaderBinary (gladCurrentContext->ShaderBinary)
+#undef glGetShaderPrecisionFormat
+#define glGetShaderPrecisionFormat (gladCurrentContext->GetShaderPrecisionFormat)
+#undef glDepthRangef
+#define glDepthRangef (gladCurrentContext->DepthRangef)
+#undef glClearDepthf
+#define glClearDepthf (gladCurrentContext->ClearDepthf)
+#undef glGetProgramBinary
+#define glGetProgramBinary (gladCurrentContext->GetProgramBinary)
+#undef glProgramBinary
+#define glProgramBinary (gladCurrentContext->ProgramBinary)
+#undef glProgramParameteri
+#define glProgramParameteri (gladCurrentContext->ProgramParameteri)
+#undef glUseProgramStages
+#define glUseProgramStages (gladCurrentContext->UseProgramStages)
+#undef glActiveShaderProgram
+#define glActiveShaderProgram (gladCurrentContext->ActiveShaderProgram)
+#undef glCreateShaderProgramv
+#define glCreateShaderProgramv (gladCurrentContext->CreateShaderProgramv)
+#undef glBindProgramPipeline
+#define glBindProgramPipeline (gladCurrentContext->BindProgramPipeline)
+#undef glDeleteProgramPipelines
+#define glDeleteProgramPipelines (gladCurrentContext->DeleteProgramPipelines)
+#undef glGenProgramPipelines
+#define glGenProgramPipelines (gladCurrentContext->GenProgramPipelines)
+#undef glIsProgramPipeline
+#define glIsProgramPipeline (gladCurrentContext->IsProgramPipeline)
+#undef glGetProgramPipelineiv
+#define glGetProgramPipelineiv (gladCurrentContext->GetProgramPipelineiv)
+#undef glProgramUniform1i
+#define glProgramUniform1i (gladCurrentContext->ProgramUniform1i)
+#undef glProgramUniform1iv
+#define glProgramUniform1iv (gladCurrentContext->ProgramUniform1iv)
+#undef glProgramUniform1f
+#define glProgramUniform1f (gladCurrentContext->ProgramUniform1f)
+#undef glProgramUniform1fv
+#define glProgramUniform1fv (gladCurrentContext->ProgramUniform1fv)
+#undef glProgramUniform1d
+#define glProgramUniform1d (gladCurrentContext->ProgramUniform1d)
+#undef glProgramUniform1dv
+#define glProgramUniform1dv (gladCurrentContext->ProgramUniform1dv)
+#undef glProgramUniform1ui
+#define glProgramUniform1ui (gladCurrentContext->ProgramUniform1ui)
+#undef glProgramUniform1uiv
+#define glProgramUniform1uiv (gladCurrentContext->ProgramUniform1uiv)
+#undef glProgramUniform2i
+#define glProgramUniform2i (gladCurrentContext->ProgramUniform2i)
+#undef glProgramUniform2iv
+#define glProgramUniform2iv (gladCurrentContext->ProgramUniform2iv)
+#undef glProgramUniform2f
+#define glProgramUniform2f (gladCurrentContext->ProgramUniform2f)
+#undef glProgramUniform2fv
+#define glProgramUniform2fv (gladCurrentContext->ProgramUniform2fv)
+#undef glProgramUniform2d
+#define glProgramUniform2d (gladCurrentContext->ProgramUniform2d)
+#undef glProgramUniform2dv
+#define glProgramUniform2dv (gladCurrentContext->ProgramUniform2dv)
+#undef glProgramUniform2ui
+#define glProgramUniform2ui (gladCurrentContext->ProgramUniform2ui)
+#undef glProgramUniform2uiv
+#define glProgramUniform2uiv (gladCurrentContext->ProgramUniform2uiv)
+#undef glProgramUniform3i
+#define glProgramUniform3i (gladCurrentContext->ProgramUniform3i)
+#undef glProgramUniform3iv
+#define glProgramUniform3iv (gladCurrentContext->ProgramUniform3iv)
+#undef glProgramUniform3f
+#define glProgramUniform3f (gladCurrentContext->ProgramUniform3f)
+#undef glProgramUniform3fv
+#define glProgramUniform3fv (gladCurrentContext->ProgramUniform3fv)
+#undef glProgramUniform3d
+#define glProgramUniform3d (gladCurrentContext->ProgramUniform3d)
+#undef glProgramUniform3dv
+#define glProgramUniform3dv (gladCurrentContext->ProgramUniform3dv)
+#undef glProgramUniform3ui
+#define glProgramUniform3ui (gladCurrentContext->ProgramUniform3ui)
+#undef glProgramUniform3uiv
+#define glProgramUniform3uiv (gladCurrentContext->ProgramUniform3uiv)
+#undef glProgramUniform4i
+#define glProgramUniform4i (gladCurrentContext->ProgramUniform4i)
+#undef glProgramUniform4iv
+#define glProgramUniform4iv (gladCurrentContext->ProgramUniform4iv)
+#undef glProgramUniform4f
+#define glProgramUniform4f (gladCurrentContext->ProgramUniform4f)
+#undef glProgramUniform4fv
+#define glProgramUniform4fv (gladCurrentContext->ProgramUniform4fv)
+#undef glProgramUniform4d
+#define glProgramUniform4d (gladCurrentContext->ProgramUniform4d)
+#undef glProgramUniform4dv
+#define glProgramUniform4dv (gladCurrentContext->ProgramUniform4dv)
+#undef glProgramUniform4ui
+#define glProgramUniform4ui (gladCurrentContext->ProgramUniform4ui)
+#undef glProgramUniform4uiv
+#define glProgramUniform4uiv (gladCurrentContext->ProgramUniform4uiv)
+#undef glProgramUniformMatrix2fv
+#define glProgramUniformMatrix2fv (gladCurrentContext->ProgramUniformMatrix2fv)
+#undef glProgramUniformMatrix3fv
+#define glProgramUniformMatrix3fv (gladCurrentContext->ProgramUniformMatrix3fv)
+#undef glProgramUniformMatrix4fv
+#define glProgramUniformMatrix4fv (gladCurrentContext->ProgramUniformMatrix4fv)
+#undef glProgramUniformMatrix2dv
+#define glProgramUniformMatrix2dv (gladCurrentContext->ProgramUniformMatrix2dv)
+#undef glProgramUniformMatrix3dv
+#define glProgramUniformMatrix3dv (gladCurrentContext->ProgramUniformMatrix3dv)
+#undef glProgramUniformMatrix4dv
+#define glProgramUniformMatrix4dv (gladCurrentContext->ProgramUniformMatrix4dv)
+#undef glProgramUniformMatrix2x3fv
+#define glProgramUniformMatrix2x3fv (gladCurrentContext->ProgramUniformMatrix2x3fv)
+#undef glProgramUniformMatrix3x2fv
+#define glProgramUniformMatrix3x2fv (gladCurrentContext->ProgramUniformMatrix3x2fv)
+#undef glProgramUniformMatrix2x4fv
+#define glProgramUniformMatrix2x4fv (gladCurrentContext->ProgramUniformMatrix2x4fv)
+#undef glProgramUniformMatrix4x2fv
+#define glProgramUniformMatrix4x2fv (gladCurrentContext->ProgramUniformMatrix4x2fv)
+#undef glProgramUniformMatrix3x4fv
+#define glProgramUniformMatrix3x4fv (gladCurrentContext->ProgramUniformMatrix3x4fv)
+#undef glProgramUniformMatrix4x3fv
+#define glProgramUniformMatrix4x3fv (gladCurrentContext->ProgramUniformMatrix4x3fv)
+#undef glProgramUniformMatrix2x3dv
+#define glProgramUniformMatrix2x3dv (gladCurrentContext->ProgramUniformMatrix2x3dv)
+#undef glProgramUniformMatrix3x2dv
+#define glProgramUniformMatrix3x2dv (gladCurrentContext->ProgramUniformMatrix3x2dv)
+#undef glProgramUniformMatrix2x4dv
+#define glProgramUniformMatrix2x4dv (gladCurrentContext->ProgramUniformMatrix2x4dv)
+#undef glProgramUniformMatrix4x2dv
+#define glProgramUniformMatrix4x2dv (gladCurrentContext->ProgramUniformMatrix4x2dv)
+#undef glProgramUniformMatrix3x4dv
+#define glProgramUniformMatrix3x4dv (gladCurrentContext->ProgramUniformMatrix3x4dv)
+#undef glProgramUniformMatrix4x3dv
+#define glProgramUniformMatrix4x3dv (gladCurrentContext->ProgramUniformMatrix4x3dv)
+#undef glValidateProgramPipeline
+#define glValidateProgramPipeline (gladCurrentContext->ValidateProgramPipeline)
+#undef glGetProgramPipelineInfoLog
+#define glGetProgramPipelineInfoLog (gladCurrentContext->GetProgramPipelineInfoLog)
+#undef glVertexAttribL1d
+#define glVertexAttribL1d (gladCurrentContext->VertexAttribL1d)
+#undef glVertexAttribL2d
+#define glVertexAttribL2d (gladCurrentContext->VertexAttribL2d)
+#undef glVertexAttribL3d
+#define glVertexAttribL3d (gladCurrentContext->VertexAttribL3d)
+#undef glVertexAttribL4d
+#define glVertexAttribL4d (gladCurrentContext->VertexAttribL4d)
+#undef glVertexAttribL1dv
+#define glVertexAttribL1dv (gladCurrentContext->VertexAttribL1dv)
+#undef glVertexAttribL2dv
+#define glVertexAttribL2dv (gladCurrentContext->VertexAttribL2dv)
+#undef glVertexAttribL3dv
+#define glVertexAttribL3dv (gladCurrentContext->VertexAttribL3dv)
+#undef glVertexAttribL4dv
+#define glVertexAttribL4dv (gladCurrentContext->VertexAttribL4dv)
+#undef glVertexAttribLPointer
+#define glVertexAttribLPointer (gladCurrentContext->VertexAttribLPointer)
+#undef glGetVertexAttribLdv
+#define glGetVertexAttribLdv (gladCurrentContext->GetVertexAttribLdv)
+#undef glViewportArrayv
+#define glViewportArrayv (gladCurrentContext->ViewportArrayv)
+#undef glViewportIndexedf
+#define glViewportIndexedf (gladCurrentContext->ViewportIndexedf)
+#undef glViewportIndexedfv
+#define glViewportIndexedfv (gladCurrentContext->ViewportIndexedfv)
+#undef glScissorArrayv
+#define glScissorArrayv (gladCurrentContext->ScissorArrayv)
+#undef glScissorIndexed
+#define glScissorIndexed (gladCurrentContext->ScissorIndexed)
+#undef glScissorIndexedv
+#define glScissorIndexedv (gladCurrentContext->ScissorIndexedv)
+#undef glDepthRangeArrayv
+#define glDepthRangeArrayv (gladCurrentContext->DepthRangeArrayv)
+#undef glDepthRangeIndexed
+#define glDepthRangeIndexed (gladCurrentContext->DepthRangeIndexed)
+#undef glGetFloati_v
+#define glGetFloati_v (gladCurrentContext->GetFloati_v)
+#undef glGetDoublei_v
+#define glGetDoublei_v (gladCurrentContext->GetDoublei_v)
+#undef glDrawArraysInstancedBaseInstance
+#define glDrawArraysInstancedBaseInstance (gladCurrentContext->DrawArraysInstancedBaseInstance)
+#undef glDrawElementsInstancedBaseInstance
+#define glDrawElementsInstancedBaseInstance (gladCurrentContext->DrawElementsInstancedBaseInstance)
+#undef glDrawElementsInstancedBaseVertexBaseInstance
+#define glDrawElementsInstancedBaseVertexBaseInstance (gladCurrentContext->DrawElementsInstancedBaseVertexBaseInstance)
+#undef glGetInternalformativ
+#define glGetInternalformativ (gladCurrentContext->GetInternalformativ)
+#undef glGetActiveAtomicCounterBufferiv
+#define glGetActiveAtomicCounterBufferiv (gladCurrentContext->GetActiveAtomicCounterBufferiv)
+#undef glBindImageTexture
+#define glBindImageTexture (gladCurrentContext->BindImageTexture)
+#undef glMemoryBarrier
+#define glMemoryBarrier (gladCurrentContext->MemoryBarrier)
+#undef glTexStorage1D
+#define glTexStorage1D (gladCurrentContext->TexStorage1D)
+#undef glTexStorage2D
+#define glTexStorage2D (gladCurrentContext->TexStorage2D)
+#undef glTexStorage3D
+#define glTexStorage3D (gladCurrentContext->TexStorage3D)
+#undef glDrawTransformFeedbackInstanced
+#define glDrawTransformFeedbackInstanced (gladCurrentContext->DrawTransformFeedbackInstanced)
+#undef glDrawTransformFeedbackStreamInstanced
+#define glDrawTransformFeedbackStreamInstanced (gladCurrentContext->DrawTransformFeedbackStreamInstanced)
+#undef glClearBufferData
+#define glClearBufferData (gladCurrentContext->ClearBufferData)
+#undef glClearBufferSubData
+#define glClearBufferSubData (gladCurrentContext->ClearBufferSubData)
+#undef glDispatchCompute
+#define glDispatchCompute (gladCurrentContext->DispatchCompute)
+#undef glDispatchComputeIndirect
+#define glDispatchComputeIndirect (gladCurrentContext->DispatchComputeIndirect)
+#undef glCopyImageSubData
+#define glCopyImageSubData (gladCurrentContext->CopyImageSubData)
+#undef glFramebufferParameteri
+#define glFramebufferParameteri (gladCurrentContext->FramebufferParameteri)
+#undef glGetFramebufferParameteriv
+#define glGetFramebufferParameteriv (gladCurrentContext->GetFramebufferParameteriv)
+#undef glGetInternalformati64v
+#define glGetInternalformati64v (gladCurrentContext->GetInternalformati64v)
+#undef glInvalidateTexSubImage
+#define glInvalidateTexSubImage (gladCurrentContext->InvalidateTexSubImage)
+#undef glInvalidateTexImage
+#define glInvalidateTexImage (gladCurrentContext->InvalidateTexImage)
+#undef glInvalidateBufferSubData
+#define glInvalidateBufferSubData (gladCurrentContext->InvalidateBufferSubData)
+#undef glInvalidateBufferData
+#define glInvalidateBufferData (gladCurrentContext->InvalidateBufferData)
+#undef glInvalidateFramebuffer
+#define glInvalidateFramebuffer (gladCurrentContext->InvalidateFramebuffer)
+#undef glInvalidateSubFramebuffer
+#define glInvalidateSubFramebuffer (gladCurrentContext->InvalidateSubFramebuffer)
+#undef glMultiDrawArraysIndirect
+#define glMultiDrawArraysIndirect (gladCurrentContext->MultiDrawArraysIndirect)
+#undef glMultiDrawElementsIndirect
+#define glMultiDrawElementsIndirect (gladCurrentContext->MultiDrawElementsIndirect)
+#undef glGetProgramInterfaceiv
+#define glGetProgramInterfaceiv (gladCurrentContext->GetProgramInterfaceiv)
+#undef glGetProgramResourceIndex
+#define glGetProgramResourceIndex (gladCurrentContext->GetProgramResourceIndex)
+#undef glGetProgramResourceName
+#define glGetProgramResourceName (gladCurrentContext->GetProgramResourceName)
+#undef glGetProgramResourceiv
+#define glGetProgramResourceiv (gladCurrentContext->GetProgramResourceiv)
+#undef glGetProgramResourceLocation
+#define glGetProgramResourceLocation (gladCurrentContext->GetProgramResourceLocation)
+#undef glGetProgramResourceLocationIndex
+#define glGetProgramResourceLocationIndex (gladCurrentContext->GetProgramResourceLocationIndex)
+#undef glShaderStorageBlockBinding
+#define glShaderStorageBlockBinding (gladCurrentContext->ShaderStorageBlockBinding)
+#undef glTexBufferRange
+#define glTexBufferRange (gladCurrentContext->TexBufferRange)
+#undef glTexStorage2DMultisample
+#define glTexStorage2DMultisample (gladCurrentContext->TexStorage2DMultisample)
+#undef glTexStorage3DMultisample
+#define glTexStorage3DMultisample (gladCurrentContext->TexStorage3DMultisample)
+#undef glTextureView
+#define glTextureView (gladCurrentContext->TextureView)
+#undef glBindVertexBuffer
+#define glBindVertexBuffer (gladCurrentContext->BindVertexBuffer)
+#undef glVertexAttribFormat
+#define glVertexAttribFormat (gladCurrentContext->VertexAttribFormat)
+#undef glVertexAttribIFormat
+#define glVertexAttribIFormat (gladCurrentContext->VertexAttribIFormat)
+#undef glVertexAttribLFormat
+#define glVertexAttribLFormat (gladCurrentContext->VertexAttribLFormat)
+#undef glVertexAttribBinding
+#define glVertexAttribBinding (gladCurrentContext->VertexAttribBinding)
+#undef glVertexBindingDivisor
+#define glVertexBindingDivisor (gladCurrentContext->VertexBindingDivisor)
+#undef glDebugMessageControl
+#define glDebugMessageControl (gladCurrentContext->DebugMessageControl)
+#undef glDebugMessageInsert
+#define glDebugMessageInsert (gladCurrentContext->DebugMessageInsert)
+#undef glDebugMessageCallback
+#define glDebugMessageCallback (gladCurrentContext->DebugMessageCallback)
+#undef glGetDebugMessageLog
+#define glGetDebugMessageLog (gladCurrentContext->GetDebugMessageLog)
+#undef glPushDebugGroup
+#define glPushDebugGroup (gladCurrentContext->PushDebugGroup)
+#undef glPopDebugGroup
+#define glPopDebugGroup (gladCurrentContext->PopDebugGroup)
+#undef glObjectLabel
+#define glObjectLabel (gladCurrentContext->ObjectLabel)
+#undef glGetObjectLabel
+#define glGetObjectLabel (gladCurrentContext->GetObjectLabel)
+#undef glObjectPtrLabel
+#define glObjectPtrLabel (gladCurrentContext->ObjectPtrLabel)
+#undef glGetObjectPtrLabel
+#define glGetObjectPtrLabel (gladCurrentContext->GetObjectPtrLabel)
+#undef glGetPointerv
+#define glGetPointerv (gladCurrentContext->GetPointerv)
+#undef glBufferStorage
+#define glBufferStorage (gladCurrentContext->BufferStorage)
+#undef glClearTexImage
+#define glClearTexImage (gladCurrentContext->ClearTexImage)
+#undef glClearTexSubImage
+#define glClearTexSubImage (gladCurrentContext->ClearTexSubImage)
+#undef glBindBuffersBase
+#define glBindBuffersBase (gladCurrentContext->BindBuffersBase)
+#undef glBindBuffersRange
+#define glBindBuffersRange (gladCurrentContext->BindBuffersRange)
+#undef glBindTextures
+#define glBindTextures (gladCurrentContext->BindTextures)
+#undef glBindSamplers
+#define glBindSamplers (gladCurrentContext->BindSamplers)
+#undef glBindImageTextures
+#define glBindImageTextures (gladCurrentContext->BindImageTextures)
+#undef glBindVertexBuffers
+#define glBindVertexBuffers (gladCurrentContext->BindVertexBuffers)
+#undef glClipControl
+#define glClipControl (gladCurrentContext->ClipControl)
+#undef glCreateTransformFeedbacks
+#define glCreateTransformFeedbacks (gladCurrentContext->CreateTransformFeedbacks)
+#undef glTransformFeedbackBufferBase
+#define glTransformFeedbackBufferBase (gladCurrentContext->TransformFeedbackBufferBase)
+#undef glTransformFeedbackBufferRange
+#define glTransformFeedbackBufferRange (gladCurrentContext->TransformFeedbackBufferRange)
+#undef glGetTransformFeedbackiv
+#define glGetTransformFeedbackiv (gladCurrentContext->GetTransformFeedbackiv)
+#undef glGetTransformFeedbacki_v
+#define glGetTransformFeedbacki_v (gladCurrentContext->GetTransformFeedbacki_v)
+#undef glGetTransformFeedbacki64_v
+#define glGetTransformFeedbacki64_v (gladCurrentContext->GetTransformFeedbacki64_v)
+#undef glCreateBuffers
+#define glCreateBuffers (gladCurrentContext->CreateBuffers)
+#undef glNamedBufferStorage
+#define glNamedBufferStorage (gladCurrentContext->NamedBufferStorage)
+#undef glNamedBufferData
+#define glNamedBufferData (gladCurrentContext->NamedBufferData)
+#undef glNamedBufferSubData
+#define glNamedBufferSubData (gladCurrentContext->NamedBufferSubData)
+#undef glCopyNamedBufferSubData
+#define glCopyNamedBufferSubData (gladCurrentContext->CopyNamedBufferSubData)
+#undef glClearNamedBufferData
+#define glClearNamedBufferData (gladCurrentContext->ClearNamedBufferData)
+#undef glClearNamedBufferSubData
+#define glClearNamedBufferSubData (gladCurrentContext->ClearNamedBufferSubData)
+#undef glMapNamedBuffer
+#define glMapNamedBuffer (gladCurrentContext->MapNamedBuffer)
+#undef glMapNamedBufferRange
+#define glMapNamedBufferRange (gladCurrentContext->MapNamedBufferRange)
+#undef glUnmapNamedBuffer
+#define glUnmapNamedBuffer (gladCurrentContext->UnmapNamedBuffer)
+#undef glFlushMappedNamedBufferRange
+#define glFlushMappedNamedBufferRange (gladCurrentContext->FlushMappedNamedBufferRange)
+#undef glGetNamedBufferParameteriv
+#define glGetNamedBufferParameteriv (gladCurrentContext->GetNamedBufferParameteriv)
+#undef glGetNamedBufferParameteri64v
+#define glGetNamedBufferParameteri64v (gladCurrentContext->GetNamedBufferParameteri64v)
+#undef glGetNamedBufferPointerv
+#define glGetNamedBufferPointerv (gladCurrentContext->GetNamedBufferPointerv)
+#undef glGetNamedBufferSubData
+#define glGetNamedBufferSubData (gladCurrentContext->GetNamedBufferSubData)
+#undef glCreateFramebuffers
+#define glCreateFramebuffers (gladCurrentContext->CreateFramebuffers)
+#undef glNamedFramebufferRenderbuffer
+#define glNamedFramebufferRenderbuffer (gladCurrentContext->NamedFramebufferRenderbuffer)
+#undef glNamedFramebufferParameteri
+#define glNamedFramebufferParameteri (gladCurrentContext->NamedFramebufferParameteri)
+#undef glNamedFramebufferTexture
+#define glNamedFramebufferTexture (gladCurrentContext->NamedFramebufferTexture)
+#undef glNamedFramebufferTextureLayer
+#define glNamedFramebufferTextureLayer (gladCurrentContext->NamedFramebufferTextureLayer)
+#undef glNamedFramebufferDrawBuffer
+#define glNamedFramebufferDrawBuffer (gladCurrentContext->NamedFramebufferDrawBuffer)
+#undef glNamedFramebufferDrawBuffers
+#define glNamedFramebufferDrawBuffers (gladCurrentContext->NamedFramebufferDrawBuffers)
+#undef glNamedFramebufferReadBuffer
+#define glNamedFramebufferReadBuffer (gladCurrentContext->NamedFramebufferReadBuffer)
+#undef glInvalidateNamedFramebufferData
+#define glInvalidateNamedFramebufferData (gladCurrentContext->InvalidateNamedFramebufferData)
+#undef glInvalidateNamedFramebufferSubData
+#define glInvalidateNamedFramebufferSubData (gladCurrentContext->InvalidateNamedFramebufferSubData)
+#undef glClearNamedFramebufferiv
+#define glClearNamedFramebufferiv (gladCurrentContext->ClearNamedFramebufferiv)
+#undef glClearNamedFramebufferuiv
+#define glClearNamedFramebufferuiv (gladCurrentContext->ClearNamedFramebufferuiv)
+#undef glClearNamedFramebufferfv
+#define glClearNamedFramebufferfv (gladCurrentContext->ClearNamedFramebufferfv)
+#undef glClearNamedFramebufferfi
+#define glClearNamedFramebufferfi (gladCurrentContext->ClearNamedFramebufferfi)
+#undef glBlitNamedFramebuffer
+#define glBlitNamedFramebuffer (gladCurrentContext->BlitNamedFramebuffer)
+#undef glCheckNamedFramebufferStatus
+#define glCheckNamedFramebufferStatus (gladCurrentContext->CheckNamedFramebufferStatus)
+#undef glGetNamedFramebufferParameteriv
+#define glGetNamedFramebufferParameteriv (gladCurrentContext->GetNamedFramebufferParameteriv)
+#undef glGetNamedFramebufferAttachmentParameteriv
+#define glGetNamedFramebufferAttachmentParameteriv (gladCurrentContext->GetNamedFramebufferAttachmentParameteriv)
+#undef glCreateRenderbuffers
+#define glCreateRenderbuffers (gladCurrentContext->CreateRenderbuffers)
+#undef glNamedRenderbufferStorage
+#define glNamedRenderbufferStorage (gladCurrentContext->NamedRenderbufferStorage)
+#undef glNamedRenderbufferStorageMultisample
+#define glNamedRenderbufferStorageMultisample (gladCurrentContext->NamedRenderbufferStorageMultisample)
+#undef glGetNamedRenderbufferParameteriv
+#define glGetNamedRenderbufferParameteriv (gladCurrentContext->GetNamedRenderbufferParameteriv)
+#undef glCreateTextures
+#define glCreateTextures (gladCurrentContext->CreateTextures)
+#undef glTextureBuffer
+#define glTextureBuffer (gladCurrentContext->TextureBuffer)
+#undef glTextureBufferRange
+#define glTextureBufferRange (gladCurrentContext->TextureBufferRange)
+#undef glTextureStorage1D
+#define glTextureStorage1D (gladCurrentContext->TextureStorage1D)
+#undef glTextureStorage2D
+#define glTextureStorage2D (gladCurrentContext->TextureStorage2D)
+#undef glTextureStorage3D
+#define glTextureStorage3D (gladCurrentContext->TextureStorage3D)
+#undef glTextureStorage2DMultisample
+#define glTextureStorage2DMultisample (gladCurrentContext->TextureStorage2DMultisample)
+#undef glTextureStorage3DMultisample
+#define glTextureStorage3DMultisample (gladCurrentContext->TextureStorage3DMultisample)
+#undef glTextureSubImage1D
+#define glTextureSubImage1D (gladCurrentContext->TextureSubImage1D)
+#undef glTextureSubImage2D
+#define glTextureSubImage2D (gladCurrentContext->TextureSubImage2D)
+#undef glTextureSubImage3D
+#define glTextureSubImage3D (gladCurrentContext->TextureSubImage3D)
+#undef glCompressedTextureSubImage1D
+#define glCompressedTextureSubImage1D (gladCurrentContext->CompressedTextureSubImage1D)
+#undef glCompressedTextureSubImage2D
+#define glCompressedTextureSubImage2D (gladCurrentContext->CompressedTextureSubImage2D)
+#undef glCompressedTextureSubImage3D
+#define glCompressedTextureSubImage3D (gladCurrentContext->CompressedTextureSubImage3D)
+#undef glCopyTextureSubImage1D
+#define glCopyTextureSubImage1D (gladCurrentContext->CopyTextureSubImage1D)
+#undef glCopyTextureSubImage2D
+#define glCopyTextureSubImage2D (gladCurrentContext->CopyTextureSubImage2D)
+#undef glCopyTextureSubImage3D
+#define glCopyTextureSubImage3D (gladCurrentContext->CopyTextureSubImage3D)
+#undef glTextureParameterf
+#define glTextureParameterf (gladCurrentContext->TextureParameterf)
+#undef glTextureParameterfv
+#define glTextureParameterfv (gladCurrentContext->TextureParameterfv)
+#undef glTextureParameteri
+#define glTextureParameteri (gladCurrentContext->TextureParameteri)
+#undef glTextureParameterIiv
+#define glTextureParameterIiv (gladCurrentContext->TextureParameterIiv)
+#undef glTextureParameterIuiv
+#define glTextureParameterIuiv (gladCurrentContext->TextureParameterIuiv)
+#undef glTextureParameteriv
+#define glTextureParameteriv (gladCurrentContext->TextureParameteriv)
+#undef glGenerateTextureMipmap
+#define glGenerateTextureMipmap (gladCurrentContext->GenerateTextureMipmap)
+#undef glBindTextureUnit
+#define glBindTextureUnit (gladCurrentContext->BindTextureUnit)
+#undef glGetTextureImage
+#define glGetTextureImage (gladCurrentContext->GetTextureImage)
+#undef glGetCompressedTextureImage
+#define glGetCompressedTextureImage (gladCurrentContext->GetCompressedTextureImage)
+#undef glGetTextureLevelParameterfv
+#define glGetTextureLevelParameterfv (gladCurrentContext->GetTextureLevelParameterfv)
+#undef glGetTextureLevelParameteriv
+#define glGetTextureLevelParameteriv (gladCurrentContext->GetTextureLevelParameteriv)
+#undef glGetTextureParameterfv
+#define glGetTextureParameterfv (gladCurrentContext->GetTextureParameterfv)
+#undef glGetTextureParameterIiv
+#define glGetTextureParameterIiv (gladCurrentContext->GetTextureParameterIiv)
+#undef glGetTextureParameterIuiv
+#define glGetTextureParameterIuiv (gladCurrentContext->GetTextureParameterIuiv)
+#undef glGetTextureParameteriv
+#define glGetTextureParameteriv (gladCurrentContext->GetTextureParameteriv)
+#undef glCreateVertexArrays
+#define glCreateVertexArrays (gladCurrentContext->CreateVertexArrays)
+#undef glDisableVertexArrayAttrib
+#define glDisableVertexArrayAttrib (gladCurrentContext->DisableVertexArrayAttrib)
+#undef glEnableVertexArrayAttrib
+#define glEnableVertexArrayAttrib (gladCurrentContext->EnableVertexArrayAttrib)
+#undef glVertexArrayElementBuffer
+#define glVertexArrayElementBuffer (gladCurrentContext->VertexArrayElementBuffer)
+#undef glVertexArrayVertexBuffer
+#define glVertexArrayVertexBuffer (gladCurrentContext->VertexArrayVertexBuffer)
+#undef glVertexArrayVertexBuffers
+#define glVertexArrayVertexBuffers (gladCurrentContext->VertexArrayVertexBuffers)
+#undef glVertexArrayAttribBinding
+#define glVertexArrayAttribBinding (gladCurrentContext->VertexArrayAttribBinding)
+#undef glVertexArrayAttribFormat
+#define glVertexArrayAttribFormat (gladCurrentContext->VertexArrayAttribFormat)
+#undef glVertexArrayAttribIFormat
+#define glVertexArrayAttribIFormat (gladCurrentContext->VertexArrayAttribIFormat)
+#undef glVertexArrayAttribLFormat
+#define glVertexArrayAttribLFormat (gladCurrentContext->VertexArrayAttribLFormat)
+#undef glVertexArrayBindingDivisor
+#define glVertexArrayBindingDivisor (gladCurrentContext->VertexArrayBindingDivisor)
+#undef glGetVertexArrayiv
+#define glGetVertexArrayiv (gladCurrentContext->GetVertexArrayiv)
+#undef glGetVertexArrayIndexediv
+#define glGetVertexArrayIndexediv (gladCurrentContext->GetVertexArrayIndexediv)
+#undef glGetVertexArrayIndexed64iv
+#define glGetVertexArrayIndexed64iv (gladCurrentContext->GetVertexArrayIndexed64iv)
+#undef glCreateSamplers
+#define glCreateSamplers (gladCurrentContext->CreateSamplers)
+#undef glCreateProgramPipelines
+#define glCreateProgramPipelines (gladCurrentContext->CreateProgramPipelines)
+#undef glCreateQueries
+#define glCreateQueries (gladCurrentContext->CreateQueries)
+#undef glGetQueryBufferObjecti64v
+#define glGetQueryBufferObjecti64v (gladCurrentContext->GetQueryBufferObjecti64v)
+#undef glGetQueryBufferObjectiv
+#define glGetQueryBufferObjectiv (gladCurrentContext->GetQueryBufferObjectiv)
+#undef glGetQueryBufferObjectui64v
+#define glGetQueryBufferObjectui64v (gladCurrentContext->GetQueryBufferObjectui64v)
+#undef glGetQueryBufferObjectuiv
+#define glGetQueryBufferObjectuiv (gladCurrentContext->GetQueryBufferObjectuiv)
+#undef glMemoryBarrierByRegion
+#define glMemoryBarrierByRegion (gladCurrentContext->MemoryBarrierByRegion)
+#undef glGetTextureSubImage
+#define glGetTextureSubImage (gladCurrentContext->GetTextureSubImage)
+#undef glGetCompressedTextureSubImage
+#define glGetCompressedTextureSubImage (gladCurrentContext->GetCompressedTextureSubImage)
+#undef glGetGraphicsResetStatus
+#define glGetGraphicsResetStatus (gladCurrentContext->GetGraphicsResetStatus)
+#undef glGetnCompressedTexImage
+#define glGetnCompressedTexImage (gladCurrentContext->GetnCompressedTexImage)
+#undef glGetnTexImage
+#define glGetnTexImage (gladCurrentContext->GetnTexImage)
+#undef glGetnUniformdv
+#define glGetnUniformdv (gladCurrentContext->GetnUniformdv)
+#undef glGetnUniformfv
+#define glGetnUniformfv (gladCurrentContext->GetnUniformfv)
+#undef glGetnUniformiv
+#define glGetnUniformiv (gladCurrentContext->GetnUniformiv)
+#undef glGetnUniformuiv
+#define glGetnUniformuiv (gladCurrentContext->GetnUniformuiv)
+#undef glReadnPixels
+#define glReadnPixels (gladCurrentContext->ReadnPixels)
+#undef glGetnMapdv
+#define glGetnMapdv (gladCurrentContext->GetnMapdv)
+#undef glGetnMapfv
+#define glGetnMapfv (gladCurrentContext->GetnMapfv)
+#undef glGetnMapiv
+#define glGetnMapiv (gladCurrentContext->GetnMapiv)
+#undef glGetnPixelMapfv
+#define glGetnPixelMapfv (gladCurrentContext->GetnPixelMapfv)
+#undef glGetnPixelMapuiv
+#define glGetnPixelMapuiv (gladCurrentContext->GetnPixelMapuiv)
+#undef glGetnPixelMapusv
+#define glGetnPixelMapusv (gladCurrentContext->GetnPixelMapusv)
+#undef glGetnPolygonStipple
+#define glGetnPolygonStipple (gladCurrentContext->GetnPolygonStipple)
+#undef glGetnColorTable
+#define glGetnColorTable (gladCurrentContext->GetnColorTable)
+#undef glGetnConvolutionFilter
+#define glGetnConvolutionFilter (gladCurrentContext->GetnConvolutionFilter)
+#undef glGetnSeparableFilter
+#define glGetnSeparableFilter (gladCurrentContext->GetnSeparableFilter)
+#undef glGetnHistogram
+#define glGetnHistogram (gladCurrentContext->GetnHistogram)
+#undef glGetnMinmax
+#define glGetnMinmax (gladCurrentContext->GetnMinmax)
+#undef glTextureBarrier
+#define glTextureBarrier (gladCurrentContext->TextureBarrier)
+#undef glSpecializeShader
+#define glSpecializeShader (gladCurrentContext->SpecializeShader)
+#undef glMultiDrawArraysIndirectCount
+#define glMultiDrawArraysIndirectCount (gladCurrentContext->MultiDrawArraysIndirectCount)
+#undef glMultiDrawElementsIndirectCount
+#define glMultiDrawElementsIndirectCount (gladCurrentContext->MultiDrawElementsIndirectCount)
+#undef glPolygonOffsetClamp
+#define glPolygonOffsetClamp (gladCurrentContext->PolygonOffsetClamp)
+#undef glGetTextureHandleARB
+#define glGetTextureHandleARB (gladCurrentContext->GetTextureHandleARB)
+#undef glGetTextureSamplerHandleARB
+#define glGetTextureSamplerHandleARB (gladCurrentContext->GetTextureSamplerHandleARB)
+#undef glMakeTextureHandleResidentARB
+#define glMakeTextureHandleResidentARB (gladCurrentContext->MakeTextureHandleResidentARB)
+#undef glMakeTextureHandleNonResidentARB
+#define glMakeTextureHandleNonResidentARB (gladCurrentContext->MakeTextureHandleNonResidentARB)
+#undef glGetImageHandleARB
+#define glGetImageHandleARB (gladCurrentContext->GetImageHandleARB)
+#undef glMakeImageHandleResidentARB
+#define glMakeImageHandleResidentARB (gladCurrentContext->MakeImageHandleResidentARB)
+#undef glMakeImageHandleNonResidentARB
+#define glMakeImageHandleNonResidentARB (gladCurrentContext->MakeImageHandleNonResidentARB)
+#undef glUniformHandleui64ARB
+#define glUniformHandleui64ARB (gladCurrentContext->UniformHandleui64ARB)
+#undef glUniformHandleui64vARB
+#define glUniformHandleui64vARB (gladCurrentContext->UniformHandleui64vARB)
+#undef glProgramUniformHandleui64ARB
+#define glProgramUniformHandleui64ARB (gladCurrentContext->ProgramUniformHandleui64ARB)
+#undef glProgramUniformHandleui64vARB
+#define glProgramUniformHandleui64vARB (gladCurrentContext->ProgramUniformHandleui64vARB)
+#undef glIsTextureHandleResidentARB
+#define glIsTextureHandleResidentARB (gladCurrentContext->IsTextureHandleResidentARB)
+#undef glIsImageHandleResidentARB
+#define glIsImageHandleResidentARB (gladCurrentContext->IsImageHandleResidentARB)
+#undef glVertexAttribL1ui64ARB
+#define glVertexAttribL1ui64ARB (gladCurrentContext->VertexAttribL1ui64ARB)
+#undef glVertexAttribL1ui64vARB
+#define glVertexAttribL1ui64vARB (gladCurrentContext->VertexAttribL1ui64vARB)
+#undef glGetVertexAttribLui64vARB
+#define glGetVertexAttribLui64vARB (gladCurrentContext->GetVertexAttribLui64vARB)
+#undef glSpecializeShaderARB
+#define glSpecializeShaderARB (gladCurrentContext->SpecializeShaderARB)
+#undef glMultiDrawArraysIndirectCountARB
+#define glMultiDrawArraysIndirectCountARB (gladCurrentContext->MultiDrawArraysIndirectCountARB)
+#undef glMultiDrawElementsIndirectCountARB
+#define glMultiDrawElementsIndirectCountARB (gladCurrentContext->MultiDrawElementsIndirectCountARB)
+#undef glMaxShaderCompilerThreadsKHR
+#define glMaxShaderCompilerThreadsKHR (gladCurrentContext->MaxShaderCompilerThreadsKHR)
+
+#endif
@@ -0,0 +1,19 @@
+
+// PNG and QOI decoding to RGBA8, defined in image_decode.c.
+// Thread safe: no global state, so any number of workers can decode at once.
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    uint32_t width;
+    uint32_t height;
+    uint8_t *pixels;   // width * height * 4 bytes of RGBA8, malloc'd; NULL on failure
+    const char *error; // static string describing the failure, NULL on success
+} decodedImage_t;
+
+// picks the decoder from the file signature
+decodedImage_t decodeImage(const uint8_t *data, size_t length);
+
+decodedImage_t decodePNG(const uint8_t *data, size_t length);
+decodedImage_t decodeQOI(const uint8_t *data, size_t length);
@@ -0,0 +1,33 @@
+
+// conversions from Lean enum tags to GL constants, defined in opengl_ffi.c and
+// shared with the other C files that issue GL calls.
+
+#pragma once
+
+#include <lean/lean.h>
+#include <glad/glad_context.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// anisotropic filtering is core in 4.6 (EXT/ARB_texture_filter_anisotropic before that)
+#ifndef GL_TEXTURE_MAX_ANISOTROPY
+#define GL_TEXTURE_MAX_ANISOTROPY 0x84FE
+#endif
+
+GLenum convertGLDataType(uint8_t dataType);
+GLenum convertGLDrawMode(uint8_t mode);
+uint32_t lean_convert_gl_buffer_target(uint8_t leanTarget);
+GLbitfield processStorageFlags(lean_obj_arg flagList);
+GLenum convertGLTextureTarget(uint8_t tt);
+GLenum convertSizedTextureFormat(uint8_t fmt);
+GLenum convertPixelFormat(uint8_t fmt);
+GLenum convertPixelType(uint8_t pType);
+GLenum convertTextureFilter(uint8_t filter);
+GLenum convertTextureWrap(uint8_t wrap);
+GLenum convertCompareFunc(uint8_t func);
+
+// sizes of uncompressed pixel data in client memory
+size_t pixelChannelCount(uint8_t fmt);
+size_t pixelTypeSize(uint8_t pType);
+// bytes GL reads for a width x height image, with rows padded to GL_UNPACK_ALIGNMENT
+size_t unpackedImageSize(uint8_t fmt, uint8_t pType, uint32_t width, uint32_t height);
@@ -0,0 +1,19 @@
+// sRGB transfer function lookup tables shared by the mip generator and the pixel converters,
+// defined in srgb_tables.c. Built once on first use; safe to call from any thread.
+
+#pragma once
+
+#include <stdint.h>
+
+#define LINEAR_TO_SRGB_ENTRIES 16384
+
+typedef struct {
+    float srgbToLinear[256];
+    // indexed by linear value * LINEAR_TO_SRGB_ENTRIES, each entry encodes its bucket's centre
+    uint8_t linearToSrgb[LINEAR_TO_SRGB_ENTRIES];
+    // 8 bit to 8 bit, for converting pixels in place
+    uint8_t srgbToLinear8[256];
+    uint8_t linearToSrgb8[256];
+} srgbTables_t;
+
+const srgbTables_t *getSrgbTables(void);
@@ -0,0 +1,39 @@
+
+// C side of the Lean VertexLayout structure, shared by the VAO cache and the vertex writer.
+
+#include <glad/glad_context.h>
+#include <stdint.h>
+
+#define MAX_VERTEX_LAYOUT_ATTRIBUTES 16
+#define MAX_VERTEX_LAYOUT_BINDINGS 16
+
+typedef struct {
+    uint32_t attribIndex;
+    uint32_t bindingIndex;
+    uint32_t size;           // component count, 1-4
+    uint32_t relativeOffset;
+    uint8_t dataType;        // GLDataType tag
+    uint8_t normalized;
+    uint8_t padding[2];      // keeps the struct free of uninitialized bytes for hashing
+} vertexAttribute_t;
+
+typedef struct {
+    uint32_t bindingIndex;
+    uint32_t stride;
+    uint32_t divisor;
+} vertexBinding_t;
+
+typedef struct {
+    uint32_t attributeCount;
+    uint32_t bindingCount;
+    vertexAttribute_t attributes[MAX_VERTEX_LAYOUT_ATTRIBUTES];
+    vertexBinding_t bindings[MAX_VERTEX_LAYOUT_BINDINGS];
+} vertexLayout_t;
+
+// fills in layout from a Lean VertexLayout. Returns 0 if there are too many attributes or bindings.
+int unpackVertexLayout(b_lean_obj_arg layoutL, vertexLayout_t *layout);
+
+uint64_t hashVertexLayout(const vertexLayout_t *layout);
+
+// enables, formats and binds every attribute and sets the binding divisors on vao
+void applyVertexLayout(GLuint vao, const vertexLayout_t *layout);
@@ -0,0 +1,86 @@
+
+// scalar packing helpers for vertex attribute encodings. All static inline since they
+// sit in the inner loop of the vertex writer.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+// float to IEEE half, round to nearest even. Overflow goes to infinity. NaNs are quieted and
+// keep the top 9 payload bits, as F16C's vcvtps2ph does.
+static inline uint16_t packHalf(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+    bits &= 0x7fffffff;
+
+    if (bits > 0x7f800000) {
+        return sign | 0x7e00 | (uint16_t)((bits >> 13) & 0x1ff);
+    }
+    if (bits >= 0x47800000) {
+        // too big for a half, or already infinity
+        return sign | 0x7c00;
+    }
+    if (bits < 0x38800000) {
+        // result is a half denormal: adding 0.5 lines the float mantissa up with the
+        // denormal so the FPU does the rounding for us
+        float magnitude;
+        memcpy(&magnitude, &bits, sizeof(bits));
+        magnitude += 0.5f;
+        memcpy(&bits, &magnitude, sizeof(bits));
+        return sign | (uint16_t)(bits - 0x3f000000);
+    }
+    // normal: rebias the exponent and round the mantissa to nearest even
+    uint32_t mantissaOdd = (bits >> 13) & 1;
+    bits += 0xc8000fff + mantissaOdd;
+    return sign | (uint16_t)(bits >> 13);
+}
+
+static inline float clampUnit(float value, float low)
+{
+    // also maps NaN to low
+    return value > 1.0f ? 1.0f : (value >= low ? value : low);
+}
+
+static inline uint8_t packUnorm8(float value)
+{
+    return (uint8_t)lrintf(clampUnit(value, 0.0f) * 255.0f);
+}
+
+static inline int8_t packSnorm8(float value)
+{
+    return (int8_t)lrintf(clampUnit(value, -1.0f) * 127.0f);
+}
+
+static inline uint16_t packUnorm16(float value)
+{
+    return (uint16_t)lrintf(clampUnit(value, 0.0f) * 65535.0f);
+}
+
+static inline int16_t packSnorm16(float value)
+{
+    return (int16_t)lrintf(clampUnit(value, -1.0f) * 32767.0f);
+}
+
+// GL_INT_2_10_10_10_REV, normalized: x in the low bits, w in the top two
+static inline uint32_t packSnorm10_10_10_2(float x, float y, float z, float w)
+{
+    uint32_t px = (uint32_t)lrintf(clampUnit(x, -1.0f) * 511.0f) & 0x3ff;
+    uint32_t py = (uint32_t)lrintf(clampUnit(y, -1.0f) * 511.0f) & 0x3ff;
+    uint32_t pz = (uint32_t)lrintf(clampUnit(z, -1.0f) * 511.0f) & 0x3ff;
+    uint32_t pw = (uint32_t)lrintf(clampUnit(w, -1.0f)) & 0x3;
+    return px | (py << 10) | (pz << 20) | (pw << 30);
+}
+
+// GL_UNSIGNED_INT_2_10_10_10_REV, normalized
+static inline uint32_t packUnorm10_10_10_2(float x, float y, float z, float w)
+{
+    uint32_t px = (uint32_t)lrintf(clampUnit(x, 0.0f) * 1023.0f);
+    uint32_t py = (uint32_t)lrintf(clampUnit(y, 0.0f) * 1023.0f);
+    uint32_t pz = (uint32_t)lrintf(clampUnit(z, 0.0f) * 1023.0f);
+    uint32_t pw = (uint32_t)lrintf(clampUnit(w, 0.0f) * 3.0f);
+    return px | (py << 10) | (pz << 20) | (pw << 30);
+}
@@ -0,0 +1,55 @@
+// per-window state hung off the GLFW window user pointer, defined in window_events.c.
+// Created on first use and freed by glfwDestroyWindow.
+
+#pragma once
+
+#include <glad/glad_context.h>
+#include <GLFW/glfw3.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "gl_loader.h"
+
+typedef struct {
+    uint64_t time;    // glfwGetTimerValue ticks
+    double x, y;      // cursor position or scroll offset
+    uint32_t code;    // key, mouse button, codepoint, width, or 0/1 for enter/focus/iconify
+    uint32_t detail;  // scancode or height
+    uint32_t mods;
+    uint8_t kind;
+    uint8_t action;
+} inputEvent_t;
+
+// single producer (the GLFW callbacks, on the thread that polls) and single consumer (drainEvents)
+typedef struct {
+    inputEvent_t *events;
+    uint32_t mask;           // capacity - 1, capacity is a power of two
+    _Atomic uint32_t head;   // next slot to write, only advanced by the producer
+    _Atomic uint32_t tail;   // next slot to read, only advanced by the consumer
+    _Atomic uint64_t dropped;
+} eventRing_t;
+
+typedef struct {
+    eventRing_t ring;        // events is NULL until glfwEnableEventQueue
+    _Atomic int redrawRequested;
+    // waitForRedraw bookkeeping, in timer ticks
+    uint64_t statsStart;
+    uint64_t waitTicks;
+    uint64_t wakeups;
+    uint64_t redraws;
+    // framebuffer size as of the last frameTick, to report changes
+    int tickWidth, tickHeight;
+    // the context's GL function table, loaded the first time it is made current
+    GladGLContext *gl;
+    glCapabilities_t caps;   // valid once gl is set
+} windowState_t;
+
+windowState_t *getWindowState(GLFWwindow *window);
+void destroyWindowState(GLFWwindow *window);
+
+// makes the window's context current on the calling thread and selects its function table,
+// loading the table the first time; defined in glfw_ffi.c. 0 if the context can't be used
+int makeWindowContextCurrent(GLFWwindow *window);
+
+// a hidden window for a context sharing objects with `share`, defined in glfw_ffi.c; NULL on failure
+GLFWwindow *createSharedContextWindow(GLFWwindow *share);
@@ -0,0 +1,313 @@
+#include <lean/lean.h>
+
+#include "data_marshal.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Index buffer optimization for triangle lists:
+// - triangle order is optimized for the post-transform vertex cache (Tom Forsyth's
+//   "Linear-Speed Vertex Cache Optimisation")
+// - vertices are renumbered in order of first use so vertex fetch walks memory linearly
+// - indices are packed as 16 bit when the vertex count allows
+//
+
+#define FORSYTH_CACHE_SIZE 32
+#define FORSYTH_CACHE_DECAY_POWER 1.5f
+#define FORSYTH_LAST_TRI_SCORE 0.75f
+#define FORSYTH_VALENCE_BOOST_SCALE 2.0f
+#define FORSYTH_VALENCE_BOOST_POWER 0.5f
+
+// size of the FIFO cache used to report ACMR
+#define ACMR_CACHE_SIZE 16
+
+static float forsythVertexScore(int cachePosition, uint32_t remainingTriangles)
+{
+    if (remainingTriangles == 0) {
+        // no triangles left need this vertex
+        return -1.0f;
+    }
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // used by the last triangle: fixed score so the next triangle doesn't simply reuse the same edge
+            score = FORSYTH_LAST_TRI_SCORE;
+        }
+        else {
+            const float scaler = 1.0f / (FORSYTH_CACHE_SIZE - 3);
+            score = 1.0f - (cachePosition - 3) * scaler;
+            score = powf(score, FORSYTH_CACHE_DECAY_POWER);
+        }
+    }
+    // boost vertices with few triangles left so lone triangles get finished off
+    score += FORSYTH_VALENCE_BOOST_SCALE * powf((float)remainingTriangles, -FORSYTH_VALENCE_BOOST_POWER);
+    return score;
+}
+
+// reorders triangles in place. indices must all be < vertexCount.
+static void optimizeVertexCache(uint32_t *indices, size_t indexCount, uint32_t vertexCount)
+{
+    size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) {
+        return;
+    }
+
+    // triangle adjacency for each vertex, as offsets into one array
+    uint32_t *remaining = calloc(vertexCount, sizeof(uint32_t));
+    uint32_t *adjacencyStart = malloc((vertexCount + 1) * sizeof(uint32_t));
+    uint32_t *adjacency = malloc(triangleCount * 3 * sizeof(uint32_t));
+    for (size_t ix=0; ix < triangleCount * 3; ix++) {
+        remaining[indices[ix]]++;
+    }
+    uint32_t offset = 0;
+    for (uint32_t v=0; v < vertexCount; v++) {
+        adjacencyStart[v] = offset;
+        offset += remaining[v];
+    }
+    adjacencyStart[vertexCount] = offset;
+    uint32_t *fill = malloc(vertexCount * sizeof(uint32_t));
+    memcpy(fill, adjacencyStart, vertexCount * sizeof(uint32_t));
+    for (size_t t=0; t < triangleCount; t++) {
+        for (int c=0; c < 3; c++) {
+            uint32_t v = indices[t*3 + c];
+            adjacency[fill[v]++] = (uint32_t)t;
+        }
+    }
+    free(fill);
+
+    int *cachePosition = malloc(vertexCount * sizeof(int));
+    float *vertexScore = malloc(vertexCount * sizeof(float));
+    for (uint32_t v=0; v < vertexCount; v++) {
+        cachePosition[v] = -1;
+        vertexScore[v] = forsythVertexScore(-1, remaining[v]);
+    }
+
+    uint8_t *emitted = calloc(triangleCount, 1);
+
+    uint32_t *output = malloc(triangleCount * 3 * sizeof(uint32_t));
+    // LRU cache, with room for the 3 vertices pushed in before trimming
+    uint32_t cache[FORSYTH_CACHE_SIZE + 3];
+    int cacheCount = 0;
+    size_t scanCursor = 0;
+    int64_t bestTriangle = -1;
+
+    for (size_t outTri=0; outTri < triangleCount; outTri++) {
+        if (bestTriangle < 0) {
+            // nothing adjacent to the cache: take the best remaining triangle from a linear scan.
+            // Scores of triangles away from the cache only change through valence, so the first
+            // unemitted triangle is a good enough restart point and keeps this linear overall.
+            while (emitted[scanCursor]) {
+                scanCursor++;
+            }
+            bestTriangle = (int64_t)scanCursor;
+        }
+
+        size_t t = (size_t)bestTriangle;
+        emitted[t] = 1;
+        uint32_t tri[3] = { indices[t*3], indices[t*3+1], indices[t*3+2] };
+        memcpy(output + outTri*3, tri, sizeof(tri));
+
+        // remove the triangle from its vertices' adjacency lists
+        for (int c=0; c < 3; c++) {
+            uint32_t v = tri[c];
+            uint32_t *list = adjacency + adjacencyStart[v];
+            for (uint32_t ax=0; ax < remaining[v]; ax++) {
+                if (list[ax] == t) {
+                    list[ax] = list[remaining[v] - 1];
+                    break;
+                }
+            }
+            remaining[v]--;
+        }
+
+        // move the triangle's vertices to the front of the LRU cache
+        uint32_t newCache[FORSYTH_CACHE_SIZE + 3];
+        int newCount = 0;
+        for (int c=0; c < 3; c++) {
+            newCache[newCount++] = tri[c];
+        }
+        for (int ix=0; ix < cacheCount; ix++) {
+            uint32_t v = cache[ix];
+            if (v != tri[0] && v != tri[1] && v != tri[2]) {
+                newCache[newCount++] = v;
+            }
+        }
+        // vertices that fell out of the cache
+        for (int ix=FORSYTH_CACHE_SIZE; ix < newCount; ix++) {
+            cachePosition[newCache[ix]] = -1;
+            vertexScore[newCache[ix]] = forsythVertexScore(-1, remaining[newCache[ix]]);
+        }
+        cacheCount = newCount < FORSYTH_CACHE_SIZE ? newCount : FORSYTH_CACHE_SIZE;
+        memcpy(cache, newCache, cacheCount * sizeof(uint32_t));
+
+        // rescore everything in the cache and the triangles that use it, picking the next triangle
+        for (int ix=0; ix < cacheCount; ix++) {
+            cachePosition[cache[ix]] = ix;
+            vertexScore[cache[ix]] = forsythVertexScore(ix, remaining[cache[ix]]);
+        }
+        bestTriangle = -1;
+        float bestScore = -1.0f;
+        for (int ix=0; ix < cacheCount; ix++) {
+            uint32_t v = cache[ix];
+            uint32_t *list = adjacency + adjacencyStart[v];
+            for (uint32_t ax=0; ax < remaining[v]; ax++) {
+                uint32_t at = list[ax];
+                float score = vertexScore[indices[at*3]] + vertexScore[indices[at*3+1]] + vertexScore[indices[at*3+2]];
+                if (score > bestScore) {
+                    bestScore = score;
+                    bestTriangle = at;
+                }
+            }
+        }
+    }
+
+    memcpy(indices, output, triangleCount * 3 * sizeof(uint32_t));
+
+    free(output);
+    free(emitted);
+    free(vertexScore);
+    free(cachePosition);
+    free(adjacency);
+    free(adjacencyStart);
+    free(remaining);
+}
+
+// average cache miss ratio: transformed vertices per triangle with a FIFO cache
+static double computeACMR(const uint32_t *indices, size_t indexCount, uint32_t vertexCount, unsigned cacheSize)
+{
+    size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) {
+        return 0.0;
+    }
+    // a vertex is in the FIFO if it was inserted less than cacheSize misses ago
+    uint64_t *insertedAt = malloc(vertexCount * sizeof(uint64_t));
+    for (uint32_t v=0; v < vertexCount; v++) {
+        insertedAt[v] = UINT64_MAX;
+    }
+    uint64_t misses = 0;
+    for (size_t ix=0; ix < triangleCount * 3; ix++) {
+        uint32_t v = indices[ix];
+        if (insertedAt[v] == UINT64_MAX || misses - insertedAt[v] >= cacheSize) {
+            insertedAt[v] = misses;
+            misses++;
+        }
+    }
+    free(insertedAt);
+    return (double)misses / (double)triangleCount;
+}
+
+// renumbers vertices in order of first use. remap[old] = new, or UINT32_MAX for unused vertices.
+// Returns the number of used vertices.
+static uint32_t optimizeVertexFetch(uint32_t *indices, size_t indexCount, uint32_t vertexCount, uint32_t *remap)
+{
+    for (uint32_t v=0; v < vertexCount; v++) {
+        remap[v] = UINT32_MAX;
+    }
+    uint32_t next = 0;
+    for (size_t ix=0; ix < indexCount; ix++) {
+        uint32_t v = indices[ix];
+        if (remap[v] == UINT32_MAX) {
+            remap[v] = next++;
+        }
+        indices[ix] = remap[v];
+    }
+    return next;
+}
+
+/*
+structure OptimizedIndices where
+  indices : ByteArray
+  vertexRemap : Array UInt32
+  acmrBefore : Float
+  acmrAfter : Float
+  vertexCount : UInt32
+  indexType : GLDataType
+*/
+
+static lean_object *mkOptimizedIndices(lean_object *packed, lean_object *remapArray, double acmrBefore, double acmrAfter, uint32_t usedVertices, int shortIndices)
+{
+    lean_object *result = lean_alloc_ctor(0, 2, 8 + 8 + 4 + 1);
+    lean_ctor_set(result, 0, packed);
+    lean_ctor_set(result, 1, remapArray);
+    lean_ctor_set_float(result, 2*sizeof(void*), acmrBefore);
+    lean_ctor_set_float(result, 2*sizeof(void*) + 8, acmrAfter);
+    lean_ctor_set_uint32(result, 2*sizeof(void*) + 16, usedVertices);
+    lean_ctor_set_uint8(result, 2*sizeof(void*) + 20, shortIndices ? 3 : 5); // GLUnsignedShort : GLUnsignedInt
+    return result;
+}
+
+// optimizeIndices : Array UInt32 → (vertexCount : UInt32) → IO OptimizedIndices
+//
+lean_obj_res lean_optimize_indices(b_lean_obj_arg indexArray, uint32_t vertexCount)
+{
+    size_t indexCount = lean_array_size(indexArray);
+    if (indexCount % 3 != 0) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("optimizeIndices needs a triangle list (index count divisible by 3)")));
+    }
+    // no triangles: nothing to reorder, and every vertex is unused
+    if (indexCount == 0) {
+        lean_object *remapArray = lean_alloc_array(vertexCount, vertexCount);
+        for (uint32_t v=0; v < vertexCount; v++) {
+            lean_array_cptr(remapArray)[v] = lean_box_uint32(UINT32_MAX);
+        }
+        return lean_io_result_mk_ok(mkOptimizedIndices(lean_alloc_sarray(1, 0, 0), remapArray, 0.0, 0.0, 0, 1));
+    }
+
+    uint32_t *indices = malloc(indexCount * sizeof(uint32_t));
+    for (size_t ix=0; ix < indexCount; ix++) {
+        indices[ix] = lean_unbox_uint32(lean_array_get_core(indexArray, ix));
+        if (indices[ix] >= vertexCount) {
+            free(indices);
+            return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("optimizeIndices: index out of range of vertexCount")));
+        }
+    }
+
+    double acmrBefore = computeACMR(indices, indexCount, vertexCount, ACMR_CACHE_SIZE);
+    optimizeVertexCache(indices, indexCount, vertexCount);
+    double acmrAfter = computeACMR(indices, indexCount, vertexCount, ACMR_CACHE_SIZE);
+
+    uint32_t *remap = malloc(vertexCount * sizeof(uint32_t));
+    uint32_t usedVertices = optimizeVertexFetch(indices, indexCount, vertexCount, remap);
+
+    // 16 bit indices when every index fits
+    int shortIndices = usedVertices <= 65536;
+    size_t indexBytes = indexCount * (shortIndices ? 2 : 4);
+    lean_object *packed = lean_alloc_sarray(1, indexBytes, indexBytes);
+    if (shortIndices) {
+        uint16_t *out = (uint16_t *)lean_sarray_cptr(packed);
+        for (size_t ix=0; ix < indexCount; ix++) {
+            out[ix] = (uint16_t)indices[ix];
+        }
+    }
+    else {
+        memcpy(lean_sarray_cptr(packed), indices, indexBytes);
+    }
+
+    lean_object *remapArray = lean_convert_uint32_array(vertexCount, remap);
+    free(remap);
+    free(indices);
+    return lean_io_result_mk_ok(mkOptimizedIndices(packed, remapArray, acmrBefore, acmrAfter, usedVertices, shortIndices));
+}
+
+// remapVertices : ByteArray → (stride : UInt32) → Array UInt32 → (newVertexCount : UInt32) → ByteArray
+//
+// reorders interleaved vertex data to match OptimizedIndices.vertexRemap, dropping unused vertices
+lean_obj_res lean_remap_vertices(b_lean_obj_arg vertexBytes, uint32_t stride, b_lean_obj_arg remapArray, uint32_t newVertexCount)
+{
+    size_t outBytes = (size_t)newVertexCount * stride;
+    lean_object *remapped = lean_alloc_sarray(1, outBytes, outBytes);
+    const uint8_t *src = lean_sarray_cptr(vertexBytes);
+    uint8_t *dst = lean_sarray_cptr(remapped);
+    size_t oldVertexCount = stride > 0 ? lean_sarray_size(vertexBytes) / stride : 0;
+    size_t remapCount = lean_array_size(remapArray);
+    for (size_t v=0; v < remapCount && v < oldVertexCount; v++) {
+        uint32_t target = lean_unbox_uint32(lean_array_get_core(remapArray, v));
+        if (target < newVertexCount) {
+            memcpy(dst + (size_t)target * stride, src + v * stride, stride);
+        }
+    }
+    return remapped;
+}
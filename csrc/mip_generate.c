@@ -0,0 +1,283 @@
+#include <lean/lean.h>
+
+#include "data_marshal.h"
+#include "srgb_tables.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// CPU mip chain generation for offline and asset pipeline use, where glGenerateTextureMipmap's
+// unspecified filter isn't good enough. Levels are filtered separably in linear float RGBA, each
+// level from the unquantized previous one, and only rounded to 8 bits on output. With sRGB
+// data the colour channels are decoded before filtering and re-encoded afterwards.
+//
+// An RGBA float pixel is exactly one SSE/NEON register, so each filter tap is one multiply-add.
+//
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+typedef __m128 pixel4_t;
+#define pixelZero() _mm_setzero_ps()
+#define pixelLoad(p) _mm_loadu_ps(p)
+#define pixelStore(p, v) _mm_storeu_ps((p), (v))
+#define pixelMulAdd(acc, v, w) _mm_add_ps((acc), _mm_mul_ps((v), _mm_set1_ps(w)))
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+typedef float32x4_t pixel4_t;
+#define pixelZero() vdupq_n_f32(0.0f)
+#define pixelLoad(p) vld1q_f32(p)
+#define pixelStore(p, v) vst1q_f32((p), (v))
+#define pixelMulAdd(acc, v, w) vfmaq_n_f32((acc), (v), (w))
+#else
+typedef struct { float c[4]; } pixel4_t;
+static inline pixel4_t pixelZero(void) { pixel4_t r = {{0, 0, 0, 0}}; return r; }
+static inline pixel4_t pixelLoad(const float *p) { pixel4_t r = {{p[0], p[1], p[2], p[3]}}; return r; }
+static inline void pixelStore(float *p, pixel4_t v) { memcpy(p, v.c, sizeof(v.c)); }
+static inline pixel4_t pixelMulAdd(pixel4_t acc, pixel4_t v, float w)
+{
+    for (int c=0; c < 4; c++) acc.c[c] += v.c[c] * w;
+    return acc;
+}
+#endif
+
+// Kaiser windowed sinc, the NVTT defaults: half width 3 (in destination texels), alpha 4
+#define KAISER_WIDTH 3.0f
+#define KAISER_ALPHA 4.0f
+
+// modified Bessel function of the first kind, order 0
+static float besselI0(float x)
+{
+    float sum = 1.0f, term = 1.0f;
+    for (int k=1; k < 32; k++) {
+        float t = x / (2.0f * (float)k);
+        term *= t * t;
+        sum += term;
+        if (term < sum * 1e-8f) break;
+    }
+    return sum;
+}
+
+static float kaiserWeight(float x)
+{
+    float ax = fabsf(x);
+    if (ax >= KAISER_WIDTH) {
+        return 0.0f;
+    }
+    float sinc = ax < 1e-6f ? 1.0f : sinf((float)M_PI * ax) / ((float)M_PI * ax);
+    float t = ax / KAISER_WIDTH;
+    return sinc * besselI0(KAISER_ALPHA * sqrtf(1.0f - t * t)) / besselI0(KAISER_ALPHA);
+}
+
+// per destination texel: first source texel and normalized weights for `taps` source texels
+typedef struct {
+    int taps;
+    int *first;
+    float *weights;
+} filterTable_t;
+
+// returns 0, with nothing left allocated, when out of memory
+static int buildFilterTable(filterTable_t *table, int srcSize, int dstSize, int kaiser)
+{
+    float scale = (float)srcSize / (float)dstSize;
+    float support = kaiser ? KAISER_WIDTH * scale : 0.5f * scale;
+    table->taps = (int)ceilf(support * 2.0f) + 1;
+    table->first = malloc(sizeof(int) * dstSize);
+    table->weights = malloc(sizeof(float) * dstSize * table->taps);
+    if (table->first == NULL || table->weights == NULL) {
+        free(table->first);
+        free(table->weights);
+        return 0;
+    }
+
+    for (int x=0; x < dstSize; x++) {
+        float center = ((float)x + 0.5f) * scale;
+        int first = (int)floorf(center - support);
+        float *weights = table->weights + x * table->taps;
+        float total = 0.0f;
+        for (int t=0; t < table->taps; t++) {
+            float srcCenter = (float)(first + t) + 0.5f;
+            float w;
+            if (kaiser) {
+                w = kaiserWeight((srcCenter - center) / scale);
+            }
+            else {
+                // coverage of the source texel by the destination texel's footprint
+                float lo = fmaxf((float)(first + t), center - support);
+                float hi = fminf((float)(first + t + 1), center + support);
+                w = hi > lo ? hi - lo : 0.0f;
+            }
+            weights[t] = w;
+            total += w;
+        }
+        for (int t=0; t < table->taps; t++) {
+            weights[t] /= total;
+        }
+        table->first[x] = first;
+    }
+    return 1;
+}
+
+static void freeFilterTable(filterTable_t *table)
+{
+    free(table->first);
+    free(table->weights);
+}
+
+static inline int clampIndex(int i, int size)
+{
+    return i < 0 ? 0 : (i >= size ? size - 1 : i);
+}
+
+// src is srcWidth x height, dst is dstWidth x height
+static void filterRows(const float *src, int srcWidth, float *dst, int dstWidth, int height, const filterTable_t *table)
+{
+    for (int y=0; y < height; y++) {
+        const float *row = src + (size_t)y * srcWidth * 4;
+        float *out = dst + (size_t)y * dstWidth * 4;
+        for (int x=0; x < dstWidth; x++) {
+            const float *weights = table->weights + x * table->taps;
+            pixel4_t acc = pixelZero();
+            for (int t=0; t < table->taps; t++) {
+                int sx = clampIndex(table->first[x] + t, srcWidth);
+                acc = pixelMulAdd(acc, pixelLoad(row + sx * 4), weights[t]);
+            }
+            pixelStore(out + x * 4, acc);
+        }
+    }
+}
+
+// src is width x srcHeight, dst is width x dstHeight
+static void filterColumns(const float *src, int srcHeight, float *dst, int dstHeight, int width, const filterTable_t *table)
+{
+    for (int y=0; y < dstHeight; y++) {
+        const float *weights = table->weights + y * table->taps;
+        float *out = dst + (size_t)y * width * 4;
+        for (int x=0; x < width; x++) {
+            pixel4_t acc = pixelZero();
+            for (int t=0; t < table->taps; t++) {
+                int sy = clampIndex(table->first[y] + t, srcHeight);
+                acc = pixelMulAdd(acc, pixelLoad(src + ((size_t)sy * width + x) * 4), weights[t]);
+            }
+            pixelStore(out + x * 4, acc);
+        }
+    }
+}
+
+static inline float clamp01(float v)
+{
+    return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+}
+
+static void decodeRGBA8(const uint8_t *src, float *dst, size_t pixelCount, int srgb)
+{
+    const float *srgbToLinearTable = getSrgbTables()->srgbToLinear;
+    for (size_t ix=0; ix < pixelCount * 4; ix++) {
+        int alpha = (ix & 3) == 3;
+        dst[ix] = (srgb && !alpha) ? srgbToLinearTable[src[ix]] : (float)src[ix] * (1.0f / 255.0f);
+    }
+}
+
+// Kaiser overshoots, so everything is clamped before quantizing
+static void encodeRGBA8(const float *src, uint8_t *dst, size_t pixelCount, int srgb)
+{
+    const uint8_t *linearToSrgbTable = getSrgbTables()->linearToSrgb;
+    for (size_t ix=0; ix < pixelCount * 4; ix++) {
+        float v = clamp01(src[ix]);
+        int alpha = (ix & 3) == 3;
+        if (srgb && !alpha) {
+            int entry = (int)(v * (float)LINEAR_TO_SRGB_ENTRIES);
+            dst[ix] = linearToSrgbTable[entry < LINEAR_TO_SRGB_ENTRIES ? entry : LINEAR_TO_SRGB_ENTRIES - 1];
+        }
+        else {
+            dst[ix] = (uint8_t)(v * 255.0f + 0.5f);
+        }
+    }
+}
+
+static int mipDimension(int size)
+{
+    return size > 1 ? size / 2 : 1;
+}
+
+static lean_obj_res mipOutOfMemory(void)
+{
+    return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("generateMipChain: out of memory")));
+}
+
+/*inductive MipFilter
+  | Box
+  | Kaiser
+*/
+
+// generateMipChain : @& ByteArray → (width : UInt32) → (height : UInt32) → (levels : UInt32) → MipFilter → (srgb : Bool) → IO (Array ByteArray)
+//
+lean_obj_res lean_generate_mip_chain(b_lean_obj_arg base, uint32_t width, uint32_t height, uint32_t levels, uint8_t filter, uint8_t srgb)
+{
+    if (width == 0 || height == 0 || width > 65536 || height > 65536) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("generateMipChain: image size out of range")));
+    }
+    if (lean_sarray_size(base) < (size_t)width * height * 4) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("generateMipChain: base level is smaller than width * height * 4")));
+    }
+    uint32_t maxLevels = 1;
+    while (((width > height ? width : height) >> maxLevels) > 0) maxLevels++;
+    if (levels > maxLevels) {
+        levels = maxLevels;
+    }
+
+    int srcWidth = (int)width, srcHeight = (int)height;
+    float *src = malloc(sizeof(float) * 4 * (size_t)srcWidth * srcHeight);
+    float *tmp = malloc(sizeof(float) * 4 * (size_t)mipDimension(srcWidth) * srcHeight);
+    float *dst = malloc(sizeof(float) * 4 * (size_t)mipDimension(srcWidth) * mipDimension(srcHeight));
+    if (src == NULL || tmp == NULL || dst == NULL) {
+        free(src);
+        free(tmp);
+        free(dst);
+        return mipOutOfMemory();
+    }
+    decodeRGBA8(lean_sarray_cptr(base), src, (size_t)srcWidth * srcHeight, srgb);
+
+    uint32_t outCount = levels > 1 ? levels - 1 : 0;
+    lean_object *chain = lean_alloc_array(0, outCount);
+    for (uint32_t level=0; level < outCount; level++) {
+        int dstWidth = mipDimension(srcWidth), dstHeight = mipDimension(srcHeight);
+        filterTable_t rows, columns;
+        if (!buildFilterTable(&rows, srcWidth, dstWidth, filter == 1)) {
+            lean_dec(chain);
+            free(src);
+            free(tmp);
+            free(dst);
+            return mipOutOfMemory();
+        }
+        if (!buildFilterTable(&columns, srcHeight, dstHeight, filter == 1)) {
+            freeFilterTable(&rows);
+            lean_dec(chain);
+            free(src);
+            free(tmp);
+            free(dst);
+            return mipOutOfMemory();
+        }
+        filterRows(src, srcWidth, tmp, dstWidth, srcHeight, &rows);
+        filterColumns(tmp, srcHeight, dst, dstHeight, dstWidth, &columns);
+        freeFilterTable(&rows);
+        freeFilterTable(&columns);
+
+        size_t bytes = (size_t)dstWidth * dstHeight * 4;
+        lean_object *levelBytes = lean_alloc_sarray(1, bytes, bytes);
+        encodeRGBA8(dst, lean_sarray_cptr(levelBytes), (size_t)dstWidth * dstHeight, srgb);
+        chain = lean_array_push(chain, levelBytes);
+
+        // the next level filters the unquantized result; the buffers only ever shrink
+        float *swap = src;
+        src = dst;
+        dst = swap;
+        srcWidth = dstWidth;
+        srcHeight = dstHeight;
+    }
+    free(src);
+    free(tmp);
+    free(dst);
+    return lean_io_result_mk_ok(chain);
+}
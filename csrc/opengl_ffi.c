@@ -1,8 +1,9 @@
 #include <lean/lean.h>
 
-#include <glad/glad.h>
+#include <glad/glad_context.h>
 
 #include "data_marshal.h"
+#include "opengl_ffi.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -143,6 +144,11 @@ lean_obj_res lean_opengl_gldeletebuffers(lean_obj_arg bufferList)
  * | ElementBuffer
  * | TextureBuffer
  * | UniformBuffer
+ * | ShaderStorageBuffer
+ * | AtomicCounterBuffer
+ * | DrawIndirectBuffer
+ * | DispatchIndirectBuffer
+ * | ParameterBuffer
  */
 typedef uint8_t bufferTarget_t;
 
@@ -156,6 +162,11 @@ uint32_t lean_convert_gl_buffer_target(bufferTarget_t leanTarget)
         case 1: return GL_ELEMENT_ARRAY_BUFFER;
         case 2: return GL_TEXTURE_BUFFER;
         case 3: return GL_UNIFORM_BUFFER;
+        case 4: return GL_SHADER_STORAGE_BUFFER;
+        case 5: return GL_ATOMIC_COUNTER_BUFFER;
+        case 6: return GL_DRAW_INDIRECT_BUFFER;
+        case 7: return GL_DISPATCH_INDIRECT_BUFFER;
+        case 8: return GL_PARAMETER_BUFFER;
     }
     return GL_ARRAY_BUFFER;
 }
@@ -169,6 +180,23 @@ lean_obj_res lean_opengl_glbindbuffer(bufferTarget_t bufferTarget, bufferObject_
     return lean_return_unit();
 }
 
+// glBindBufferBase : BufferTarget → (index : UInt32) → GLBufferObject → IO Unit
+//
+lean_obj_res lean_opengl_glbindbufferbase(bufferTarget_t bufferTarget, uint32_t index, bufferObject_t bufferName)
+{
+    // only valid for indexed targets: uniform, shader storage, atomic counter and transform feedback
+    glBindBufferBase(lean_convert_gl_buffer_target(bufferTarget), (GLuint)index, (GLuint)bufferName);
+    return lean_return_unit();
+}
+
+// glBindBufferRange : BufferTarget → (index : UInt32) → GLBufferObject → (offset : UInt64) → (size : UInt64) → IO Unit
+//
+lean_obj_res lean_opengl_glbindbufferrange(bufferTarget_t bufferTarget, uint32_t index, bufferObject_t bufferName, uint64_t offset, uint64_t size)
+{
+    glBindBufferRange(lean_convert_gl_buffer_target(bufferTarget), (GLuint)index, (GLuint)bufferName, (GLintptr)offset, (GLsizeiptr)size);
+    return lean_return_unit();
+}
+
 
 /**
  * inductive BufferFrequency
@@ -421,8 +449,10 @@ lean_obj_res lean_opengl_glcreateshader(shaderType_t shaderType)
     GLuint cShaderType=0;
     switch (shaderType) {
         case 0: // ComputeShader (ONLY in 4.3 or later)
-          //cShaderType = GL_COMPUTE_SHADER; break;
-          return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Compute shader is only supported in OpenGL 4.3 or later")));
+          if (!GLAD_GL_VERSION_4_3) {
+              return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Compute shader is only supported in OpenGL 4.3 or later")));
+          }
+          cShaderType = GL_COMPUTE_SHADER; break;
         case 1: // VertexShader
           cShaderType = GL_VERTEX_SHADER; break;
         case 2: // TessellationControlShader
@@ -617,6 +647,84 @@ lean_obj_res lean_opengl_programuniformmatrix4fv(glProgramObject_t programID, ui
 
 
 
+// glDispatchCompute : (groupsX : UInt32) → (groupsY : UInt32) → (groupsZ : UInt32) → IO Unit
+//
+lean_obj_res lean_opengl_dispatchcompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ)
+{
+    glDispatchCompute((GLuint)groupsX, (GLuint)groupsY, (GLuint)groupsZ);
+    return lean_return_unit();
+}
+
+// glDispatchComputeIndirect : (offset : UInt64) → IO Unit
+//
+// reads the group counts from the buffer bound to BufferTarget.DispatchIndirectBuffer
+lean_obj_res lean_opengl_dispatchcomputeindirect(uint64_t offset)
+{
+    glDispatchComputeIndirect((GLintptr)offset);
+    return lean_return_unit();
+}
+
+/*
+inductive MemoryBarrierFlags
+| VertexAttribArrayBarrier
+| ElementArrayBarrier
+| UniformBarrier
+| TextureFetchBarrier
+| ShaderImageAccessBarrier
+| CommandBarrier
+| PixelBufferBarrier
+| TextureUpdateBarrier
+| BufferUpdateBarrier
+| FramebufferBarrier
+| AtomicCounterBarrier
+| ShaderStorageBarrier
+| ClientMappedBufferBarrier
+| QueryBufferBarrier
+| AllBarriers
+*/
+GLbitfield processMemoryBarrierFlags(lean_obj_arg flagList)
+{
+    GLbitfield barrierBits = 0;
+    // walk the list
+    lean_object *current_element = flagList;
+    while (!lean_is_scalar(current_element)) {
+        // element is a "cons head tail" object
+        lean_object * head = lean_ctor_get(current_element, 0);
+        lean_object * tail = lean_ctor_get(current_element, 1);
+        switch ((uint8_t)lean_unbox(head))
+        {
+            case 0: barrierBits |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT; break;
+            case 1: barrierBits |= GL_ELEMENT_ARRAY_BARRIER_BIT; break;
+            case 2: barrierBits |= GL_UNIFORM_BARRIER_BIT; break;
+            case 3: barrierBits |= GL_TEXTURE_FETCH_BARRIER_BIT; break;
+            case 4: barrierBits |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT; break;
+            case 5: barrierBits |= GL_COMMAND_BARRIER_BIT; break;
+            case 6: barrierBits |= GL_PIXEL_BUFFER_BARRIER_BIT; break;
+            case 7: barrierBits |= GL_TEXTURE_UPDATE_BARRIER_BIT; break;
+            case 8: barrierBits |= GL_BUFFER_UPDATE_BARRIER_BIT; break;
+            case 9: barrierBits |= GL_FRAMEBUFFER_BARRIER_BIT; break;
+            case 10: barrierBits |= GL_ATOMIC_COUNTER_BARRIER_BIT; break;
+            case 11: barrierBits |= GL_SHADER_STORAGE_BARRIER_BIT; break;
+            case 12: barrierBits |= GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT; break;
+            case 13: barrierBits |= GL_QUERY_BUFFER_BARRIER_BIT; break;
+            case 14: barrierBits |= GL_ALL_BARRIER_BITS; break;
+        }
+
+        // advance to next element
+        current_element = tail;
+    }
+    return barrierBits;
+}
+
+// glMemoryBarrier : List MemoryBarrierFlags → IO Unit
+//
+lean_obj_res lean_opengl_memorybarrier(lean_obj_arg flagList)
+{
+    glMemoryBarrier(processMemoryBarrierFlags(flagList));
+    return lean_return_unit();
+}
+
+
 // def GLVertexArrayObject := UInt32
 typedef uint32_t vertexArrayObject_t;
 
@@ -701,6 +809,15 @@ lean_obj_res lean_opengl_glvertexarrayvertexbuffer(vertexArrayObject_t vao, uint
 }
 
 
+// glVertexArrayElementBuffer : GLVertexArrayObject → GLBufferObject → IO Unit
+//
+lean_obj_res lean_opengl_glvertexarrayelementbuffer(vertexArrayObject_t vao, bufferObject_t bufferObject)
+{
+    glVertexArrayElementBuffer((GLuint)vao, (GLuint)bufferObject);
+    return lean_return_unit();
+}
+
+
 // glEnableVertexAttribArray : (attribIndex : UInt32) → IO Unit
 //
 lean_obj_res lean_opengl_enablevertexattribarray(uint32_t attribindex)
@@ -743,6 +860,9 @@ inductive GLDataType where
 | GLUnsignedInt
 | GLFloat
 | GLDouble
+| GLHalfFloat
+| GLInt2_10_10_10Rev
+| GLUnsignedInt2_10_10_10Rev
 */
 typedef uint8_t dataType_t;
 
@@ -758,6 +878,9 @@ GLenum convertGLDataType(dataType_t dataType)
         case 5: return GL_UNSIGNED_INT;
         case 6: return GL_FLOAT;
         case 7: return GL_DOUBLE;
+        case 8: return GL_HALF_FLOAT;
+        case 9: return GL_INT_2_10_10_10_REV;
+        case 10: return GL_UNSIGNED_INT_2_10_10_10_REV;
     }
     // error
     return GL_BYTE;
@@ -835,6 +958,30 @@ lean_obj_res lean_opengl_drawarrays(glDrawMode_t mode, uint64_t first, uint64_t
 }
 
 
+// glDrawElements : GLDrawMode → (count : UInt64) → (indexType : GLDataType) → (offset : UInt64) → IO Unit
+//
+// indices come from the element buffer of the bound VAO, starting at byte offset
+lean_obj_res lean_opengl_drawelements(glDrawMode_t mode, uint64_t count, dataType_t indexType, uint64_t offset)
+{
+    glDrawElements(convertGLDrawMode(mode), (GLsizei)count, convertGLDataType(indexType), (const void *)(uintptr_t)offset);
+    return lean_return_unit();
+}
+
+// glMultiDrawElementsIndirect : GLDrawMode → (indexType : GLDataType) → (indirectOffset : UInt64) → (drawCount : UInt32) → (stride : UInt32) → IO Unit
+//
+// commands are read from the buffer bound to BufferTarget.DrawIndirectBuffer
+lean_obj_res lean_opengl_multidrawelementsindirect(glDrawMode_t mode, dataType_t indexType, uint64_t indirectOffset, uint32_t drawCount, uint32_t stride)
+{
+    glMultiDrawElementsIndirect(
+        convertGLDrawMode(mode),
+        convertGLDataType(indexType),
+        (const void *)(uintptr_t)indirectOffset,
+        (GLsizei)drawCount,
+        (GLsizei)stride);
+    return lean_return_unit();
+}
+
+
 //def GLTextureObject := UInt32
 typedef uint32_t glTextureObject_t;
 
@@ -842,6 +989,12 @@ typedef uint32_t glTextureObject_t;
 | GLTexture1D
 | GLTexture2D
 | GLTexture3D
+| GLTexture1DArray
+| GLTexture2DArray
+| GLTextureCubeMap
+| GLTextureCubeMapArray
+| GLTexture2DMultisample
+| GLTexture2DMultisampleArray
 */
 typedef uint8_t glTextureTarget_t;
 
@@ -853,6 +1006,12 @@ GLenum convertGLTextureTarget(glTextureTarget_t tt)
         case 0: return GL_TEXTURE_1D;
         case 1: return GL_TEXTURE_2D;
         case 2: return GL_TEXTURE_3D;
+        case 3: return GL_TEXTURE_1D_ARRAY;
+        case 4: return GL_TEXTURE_2D_ARRAY;
+        case 5: return GL_TEXTURE_CUBE_MAP;
+        case 6: return GL_TEXTURE_CUBE_MAP_ARRAY;
+        case 7: return GL_TEXTURE_2D_MULTISAMPLE;
+        case 8: return GL_TEXTURE_2D_MULTISAMPLE_ARRAY;
     }
     return GL_INVALID_VALUE;
 }
@@ -897,6 +1056,33 @@ lean_obj_res lean_opengl_deletetextures(lean_obj_arg textureArray)
   | RGBA8
   | R16F
   | R32F
+  | SRGB8Alpha8
+  | RGBA16F
+  | BC1RGB
+  | BC1RGBA
+  | BC1SRGB
+  | BC1SRGBAlpha
+  | BC2
+  | BC2SRGB
+  | BC3
+  | BC3SRGB
+  | BC4
+  | BC4Signed
+  | BC5
+  | BC5Signed
+  | BC6HUnsignedFloat
+  | BC6HSignedFloat
+  | BC7
+  | BC7SRGB
+  | Depth16
+  | Depth24
+  | Depth32F
+  | Depth24Stencil8
+  | Depth32FStencil8
+  | Stencil8
+  | RGBA32F
+  | R11FG11FB10F
+  | RGB10A2
 */
 typedef uint8_t glSizedTextureFormat_t;
 
@@ -910,6 +1096,33 @@ GLenum convertSizedTextureFormat(glSizedTextureFormat_t fmt)
         case 3: return GL_RGBA8;
         case 4: return GL_R16F;
         case 5: return GL_R32F;
+        case 6: return GL_SRGB8_ALPHA8;
+        case 7: return GL_RGBA16F;
+        case 8: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case 9: return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        case 10: return GL_COMPRESSED_SRGB_S3TC_DXT1_EXT;
+        case 11: return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT;
+        case 12: return GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+        case 13: return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT;
+        case 14: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case 15: return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+        case 16: return GL_COMPRESSED_RED_RGTC1;
+        case 17: return GL_COMPRESSED_SIGNED_RED_RGTC1;
+        case 18: return GL_COMPRESSED_RG_RGTC2;
+        case 19: return GL_COMPRESSED_SIGNED_RG_RGTC2;
+        case 20: return GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT;
+        case 21: return GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT;
+        case 22: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case 23: return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+        case 24: return GL_DEPTH_COMPONENT16;
+        case 25: return GL_DEPTH_COMPONENT24;
+        case 26: return GL_DEPTH_COMPONENT32F;
+        case 27: return GL_DEPTH24_STENCIL8;
+        case 28: return GL_DEPTH32F_STENCIL8;
+        case 29: return GL_STENCIL_INDEX8;
+        case 30: return GL_RGBA32F;
+        case 31: return GL_R11F_G11F_B10F;
+        case 32: return GL_RGB10_A2;
     }
     return GL_INVALID_VALUE;
 }
@@ -926,6 +1139,52 @@ lean_obj_res lean_opengl_texturestorage2d(
     return lean_return_unit();
 }
 
+// glTextureStorage1D : GLTextureObject → (levels : UInt32) → GLSizedTextureFormat → (width : UInt32) → IO Unit
+//
+lean_obj_res lean_opengl_texturestorage1d(
+    glTextureObject_t textureObject, uint32_t levels, glSizedTextureFormat_t fmt, uint32_t width)
+{
+    glTextureStorage1D((GLuint)textureObject, (GLsizei)levels, convertSizedTextureFormat(fmt), (GLsizei)width);
+
+    return lean_return_unit();
+}
+
+// glTextureStorage3D : GLTextureObject → (levels : UInt32) → GLSizedTextureFormat → (width : UInt32) → (height : UInt32) → (depth : UInt32) → IO Unit
+//
+// depth is the layer count for array textures, and layers * 6 for cube map arrays
+lean_obj_res lean_opengl_texturestorage3d(
+    glTextureObject_t textureObject, uint32_t levels, glSizedTextureFormat_t fmt,
+    uint32_t width, uint32_t height, uint32_t depth)
+{
+    glTextureStorage3D((GLuint)textureObject, (GLsizei)levels, convertSizedTextureFormat(fmt), (GLsizei)width, (GLsizei)height, (GLsizei)depth);
+
+    return lean_return_unit();
+}
+
+// glTextureStorage2DMultisample : GLTextureObject → (samples : UInt32) → GLSizedTextureFormat → (width : UInt32) → (height : UInt32) → (fixedSampleLocations : Bool) → IO Unit
+//
+lean_obj_res lean_opengl_texturestorage2dmultisample(
+    glTextureObject_t textureObject, uint32_t samples, glSizedTextureFormat_t fmt,
+    uint32_t width, uint32_t height, uint8_t fixedSampleLocations)
+{
+    glTextureStorage2DMultisample((GLuint)textureObject, (GLsizei)samples, convertSizedTextureFormat(fmt),
+        (GLsizei)width, (GLsizei)height, fixedSampleLocations ? GL_TRUE : GL_FALSE);
+
+    return lean_return_unit();
+}
+
+// glTextureStorage3DMultisample : GLTextureObject → (samples : UInt32) → GLSizedTextureFormat → (width : UInt32) → (height : UInt32) → (depth : UInt32) → (fixedSampleLocations : Bool) → IO Unit
+//
+lean_obj_res lean_opengl_texturestorage3dmultisample(
+    glTextureObject_t textureObject, uint32_t samples, glSizedTextureFormat_t fmt,
+    uint32_t width, uint32_t height, uint32_t depth, uint8_t fixedSampleLocations)
+{
+    glTextureStorage3DMultisample((GLuint)textureObject, (GLsizei)samples, convertSizedTextureFormat(fmt),
+        (GLsizei)width, (GLsizei)height, (GLsizei)depth, fixedSampleLocations ? GL_TRUE : GL_FALSE);
+
+    return lean_return_unit();
+}
+
 /*inductive GLPixelFormat
 | Red
 | RG
@@ -963,6 +1222,7 @@ GLenum convertPixelFormat(glPixelFormat_t fmt)
 | UInt
 | Int
 | Float
+| HalfFloat
 */
 typedef uint8_t glPixelType_t;
 
@@ -977,6 +1237,7 @@ GLenum convertPixelType(glPixelType_t pType)
         case 4: return GL_UNSIGNED_INT;
         case 5: return GL_INT;
         case 6: return GL_FLOAT;
+        case 7: return GL_HALF_FLOAT;
     }
     return GL_INVALID_VALUE;
 }
@@ -993,19 +1254,57 @@ lean_obj_res lean_opengl_texturesubimage2d(
     int xoffset = lean_unbox(xoffsetL);
     int yoffset = lean_unbox(yoffsetL);
 
-    fprintf(stderr, "textureObject=%d\n", textureObject);
-    fprintf(stderr, "level=%d\n", level);
-    fprintf(stderr, "xoffset=%d\n", xoffset);
-    fprintf(stderr, "width=%d\n", width);
+    glTextureSubImage2D(
+        (GLuint)textureObject,
+        (GLint)level,
+        (GLint)xoffset,
+        (GLint)yoffset,
+        (GLsizei)width,
+        (GLsizei)height,
+        convertPixelFormat(pixelFormat),
+        convertPixelType(pixelType),
+        lean_sarray_cptr(pixelData)
+    );
+
+    return lean_return_unit();
+}
 
+// glTextureSubImage1D : GLTextureObject → (level : UInt32) → (xoffset : UInt32) → (width : UInt32) → GLPixelFormat → GLPixelType → @& ByteArray → IO Unit
+//
+lean_obj_res lean_opengl_texturesubimage1d(
+    glTextureObject_t textureObject, uint32_t level, uint32_t xoffset, uint32_t width,
+    glPixelFormat_t pixelFormat, glPixelType_t pixelType, b_lean_obj_arg pixelData)
+{
+    glTextureSubImage1D(
+        (GLuint)textureObject,
+        (GLint)level,
+        (GLint)xoffset,
+        (GLsizei)width,
+        convertPixelFormat(pixelFormat),
+        convertPixelType(pixelType),
+        lean_sarray_cptr(pixelData)
+    );
 
-    glTextureSubImage2D(
+    return lean_return_unit();
+}
+
+// glTextureSubImage3D : GLTextureObject → (level : UInt32) → (xoffset : UInt32) → (yoffset : UInt32) → (zoffset : UInt32) → (width : UInt32) → (height : UInt32) → (depth : UInt32) → GLPixelFormat → GLPixelType → @& ByteArray → IO Unit
+//
+// zoffset/depth select array layers, or cube map faces (layer * 6 + face) for cube textures
+lean_obj_res lean_opengl_texturesubimage3d(
+    glTextureObject_t textureObject, uint32_t level, uint32_t xoffset, uint32_t yoffset, uint32_t zoffset,
+    uint32_t width, uint32_t height, uint32_t depth,
+    glPixelFormat_t pixelFormat, glPixelType_t pixelType, b_lean_obj_arg pixelData)
+{
+    glTextureSubImage3D(
         (GLuint)textureObject,
         (GLint)level,
         (GLint)xoffset,
         (GLint)yoffset,
+        (GLint)zoffset,
         (GLsizei)width,
         (GLsizei)height,
+        (GLsizei)depth,
         convertPixelFormat(pixelFormat),
         convertPixelType(pixelType),
         lean_sarray_cptr(pixelData)
@@ -1014,6 +1313,58 @@ lean_obj_res lean_opengl_texturesubimage2d(
     return lean_return_unit();
 }
 
+// glCompressedTextureSubImage2D : GLTextureObject → (level : UInt32) → (xoffset : UInt32) → (yoffset : UInt32) → (width : UInt32) → (height : UInt32) → GLSizedTextureFormat → @& ByteArray → IO Unit
+//
+lean_obj_res lean_opengl_compressedtexturesubimage2d(
+    glTextureObject_t textureObject, uint32_t level, uint32_t xoffset, uint32_t yoffset,
+    uint32_t width, uint32_t height, glSizedTextureFormat_t fmt, b_lean_obj_arg blockData)
+{
+    glCompressedTextureSubImage2D(
+        (GLuint)textureObject,
+        (GLint)level,
+        (GLint)xoffset,
+        (GLint)yoffset,
+        (GLsizei)width,
+        (GLsizei)height,
+        convertSizedTextureFormat(fmt),
+        (GLsizei)lean_sarray_size(blockData),
+        lean_sarray_cptr(blockData)
+    );
+
+    return lean_return_unit();
+}
+
+// glCompressedTextureSubImage3D : GLTextureObject → (level : UInt32) → (xoffset : UInt32) → (yoffset : UInt32) → (zoffset : UInt32) → (width : UInt32) → (height : UInt32) → (depth : UInt32) → GLSizedTextureFormat → @& ByteArray → IO Unit
+//
+lean_obj_res lean_opengl_compressedtexturesubimage3d(
+    glTextureObject_t textureObject, uint32_t level, uint32_t xoffset, uint32_t yoffset, uint32_t zoffset,
+    uint32_t width, uint32_t height, uint32_t depth, glSizedTextureFormat_t fmt, b_lean_obj_arg blockData)
+{
+    glCompressedTextureSubImage3D(
+        (GLuint)textureObject,
+        (GLint)level,
+        (GLint)xoffset,
+        (GLint)yoffset,
+        (GLint)zoffset,
+        (GLsizei)width,
+        (GLsizei)height,
+        (GLsizei)depth,
+        convertSizedTextureFormat(fmt),
+        (GLsizei)lean_sarray_size(blockData),
+        lean_sarray_cptr(blockData)
+    );
+
+    return lean_return_unit();
+}
+
+// glGenerateTextureMipmap : GLTextureObject → IO Unit
+//
+lean_obj_res lean_opengl_generatetexturemipmap(glTextureObject_t textureObject)
+{
+    glGenerateTextureMipmap((GLuint)textureObject);
+    return lean_return_unit();
+}
+
 // glBindTextureUnit : (unit : UInt32) → GLTextureObject → IO Unit
 //
 lean_obj_res lean_opengl_bindtextureunit(uint32_t unit, glTextureObject_t textureObject)
@@ -1021,3 +1372,720 @@ lean_obj_res lean_opengl_bindtextureunit(uint32_t unit, glTextureObject_t textur
     glBindTextureUnit((GLuint)unit, (GLuint)textureObject);
     return lean_return_unit();
 }
+
+/*inductive GLTextureFilter
+  | Nearest
+  | Linear
+  | NearestMipmapNearest
+  | LinearMipmapNearest
+  | NearestMipmapLinear
+  | LinearMipmapLinear
+*/
+typedef uint8_t glTextureFilter_t;
+
+GLenum convertTextureFilter(glTextureFilter_t filter)
+{
+    switch (filter)
+    {
+        case 0: return GL_NEAREST;
+        case 1: return GL_LINEAR;
+        case 2: return GL_NEAREST_MIPMAP_NEAREST;
+        case 3: return GL_LINEAR_MIPMAP_NEAREST;
+        case 4: return GL_NEAREST_MIPMAP_LINEAR;
+        case 5: return GL_LINEAR_MIPMAP_LINEAR;
+    }
+    return GL_INVALID_VALUE;
+}
+
+/*inductive GLTextureWrap
+  | Repeat
+  | MirroredRepeat
+  | ClampToEdge
+  | ClampToBorder
+  | MirrorClampToEdge
+*/
+typedef uint8_t glTextureWrap_t;
+
+GLenum convertTextureWrap(glTextureWrap_t wrap)
+{
+    switch (wrap)
+    {
+        case 0: return GL_REPEAT;
+        case 1: return GL_MIRRORED_REPEAT;
+        case 2: return GL_CLAMP_TO_EDGE;
+        case 3: return GL_CLAMP_TO_BORDER;
+        case 4: return GL_MIRROR_CLAMP_TO_EDGE;
+    }
+    return GL_INVALID_VALUE;
+}
+
+/*inductive GLCompareFunc
+  | Never
+  | Less
+  | Equal
+  | LessEqual
+  | Greater
+  | NotEqual
+  | GreaterEqual
+  | Always
+*/
+typedef uint8_t glCompareFunc_t;
+
+GLenum convertCompareFunc(glCompareFunc_t func)
+{
+    switch (func)
+    {
+        case 0: return GL_NEVER;
+        case 1: return GL_LESS;
+        case 2: return GL_EQUAL;
+        case 3: return GL_LEQUAL;
+        case 4: return GL_GREATER;
+        case 5: return GL_NOTEQUAL;
+        case 6: return GL_GEQUAL;
+        case 7: return GL_ALWAYS;
+    }
+    return GL_INVALID_VALUE;
+}
+
+// glTextureParameterFilter : GLTextureObject → (minFilter : GLTextureFilter) → (magFilter : GLTextureFilter) → IO Unit
+//
+lean_obj_res lean_opengl_textureparameterfilter(glTextureObject_t textureObject, glTextureFilter_t minFilter, glTextureFilter_t magFilter)
+{
+    glTextureParameteri((GLuint)textureObject, GL_TEXTURE_MIN_FILTER, (GLint)convertTextureFilter(minFilter));
+    glTextureParameteri((GLuint)textureObject, GL_TEXTURE_MAG_FILTER, (GLint)convertTextureFilter(magFilter));
+    return lean_return_unit();
+}
+
+// glTextureParameterWrap : GLTextureObject → (s : GLTextureWrap) → (t : GLTextureWrap) → (r : GLTextureWrap) → IO Unit
+//
+lean_obj_res lean_opengl_textureparameterwrap(glTextureObject_t textureObject, glTextureWrap_t s, glTextureWrap_t t, glTextureWrap_t r)
+{
+    glTextureParameteri((GLuint)textureObject, GL_TEXTURE_WRAP_S, (GLint)convertTextureWrap(s));
+    glTextureParameteri((GLuint)textureObject, GL_TEXTURE_WRAP_T, (GLint)convertTextureWrap(t));
+    glTextureParameteri((GLuint)textureObject, GL_TEXTURE_WRAP_R, (GLint)convertTextureWrap(r));
+    return lean_return_unit();
+}
+
+// glTextureParameterLevels : GLTextureObject → (baseLevel : UInt32) → (maxLevel : UInt32) → IO Unit
+//
+lean_obj_res lean_opengl_textureparameterlevels(glTextureObject_t textureObject, uint32_t baseLevel, uint32_t maxLevel)
+{
+    glTextureParameteri((GLuint)textureObject, GL_TEXTURE_BASE_LEVEL, (GLint)baseLevel);
+    glTextureParameteri((GLuint)textureObject, GL_TEXTURE_MAX_LEVEL, (GLint)maxLevel);
+    return lean_return_unit();
+}
+
+// glTextureParameterAnisotropy : GLTextureObject → Float → IO Unit
+//
+lean_obj_res lean_opengl_textureparameteranisotropy(glTextureObject_t textureObject, double maxAnisotropy)
+{
+    glTextureParameterf((GLuint)textureObject, GL_TEXTURE_MAX_ANISOTROPY, (GLfloat)maxAnisotropy);
+    return lean_return_unit();
+}
+
+//def GLSamplerObject := UInt32
+typedef uint32_t glSamplerObject_t;
+
+// glCreateSamplers : (count : UInt32) → IO (Array GLSamplerObject)
+//
+lean_obj_res lean_opengl_createsamplers(uint32_t count)
+{
+    GLuint *samplers = calloc(count, sizeof(GLuint));
+    glCreateSamplers((GLsizei)count, samplers);
+
+    lean_object *leanSamplers = lean_convert_uint32_array(count, samplers);
+
+    free(samplers);
+
+    return lean_io_result_mk_ok(leanSamplers);
+}
+
+// glDeleteSamplers : Array GLSamplerObject → IO Unit
+//
+lean_obj_res lean_opengl_deletesamplers(lean_obj_arg samplerArray)
+{
+    GLsizei samplerCount = lean_array_size(samplerArray);
+    GLuint *samplers = calloc(samplerCount, sizeof(GLuint));
+
+    for (int ix=0; ix < samplerCount; ix++) {
+        samplers[ix] = (uint32_t)lean_unbox_uint32(lean_array_get_core(samplerArray, ix));
+    }
+
+    glDeleteSamplers(samplerCount, samplers);
+
+    free(samplers);
+
+    return lean_return_unit();
+}
+
+// glSamplerParameterFilter : GLSamplerObject → (minFilter : GLTextureFilter) → (magFilter : GLTextureFilter) → IO Unit
+//
+lean_obj_res lean_opengl_samplerparameterfilter(glSamplerObject_t sampler, glTextureFilter_t minFilter, glTextureFilter_t magFilter)
+{
+    glSamplerParameteri((GLuint)sampler, GL_TEXTURE_MIN_FILTER, (GLint)convertTextureFilter(minFilter));
+    glSamplerParameteri((GLuint)sampler, GL_TEXTURE_MAG_FILTER, (GLint)convertTextureFilter(magFilter));
+    return lean_return_unit();
+}
+
+// glSamplerParameterWrap : GLSamplerObject → (s : GLTextureWrap) → (t : GLTextureWrap) → (r : GLTextureWrap) → IO Unit
+//
+lean_obj_res lean_opengl_samplerparameterwrap(glSamplerObject_t sampler, glTextureWrap_t s, glTextureWrap_t t, glTextureWrap_t r)
+{
+    glSamplerParameteri((GLuint)sampler, GL_TEXTURE_WRAP_S, (GLint)convertTextureWrap(s));
+    glSamplerParameteri((GLuint)sampler, GL_TEXTURE_WRAP_T, (GLint)convertTextureWrap(t));
+    glSamplerParameteri((GLuint)sampler, GL_TEXTURE_WRAP_R, (GLint)convertTextureWrap(r));
+    return lean_return_unit();
+}
+
+// glSamplerParameterAnisotropy : GLSamplerObject → Float → IO Unit
+//
+lean_obj_res lean_opengl_samplerparameteranisotropy(glSamplerObject_t sampler, double maxAnisotropy)
+{
+    glSamplerParameterf((GLuint)sampler, GL_TEXTURE_MAX_ANISOTROPY, (GLfloat)maxAnisotropy);
+    return lean_return_unit();
+}
+
+// glSamplerParameterLod : GLSamplerObject → (minLod : Float) → (maxLod : Float) → (lodBias : Float) → IO Unit
+//
+lean_obj_res lean_opengl_samplerparameterlod(glSamplerObject_t sampler, double minLod, double maxLod, double lodBias)
+{
+    glSamplerParameterf((GLuint)sampler, GL_TEXTURE_MIN_LOD, (GLfloat)minLod);
+    glSamplerParameterf((GLuint)sampler, GL_TEXTURE_MAX_LOD, (GLfloat)maxLod);
+    glSamplerParameterf((GLuint)sampler, GL_TEXTURE_LOD_BIAS, (GLfloat)lodBias);
+    return lean_return_unit();
+}
+
+// glSamplerParameterCompare : GLSamplerObject → (enabled : Bool) → GLCompareFunc → IO Unit
+//
+lean_obj_res lean_opengl_samplerparametercompare(glSamplerObject_t sampler, uint8_t enabled, glCompareFunc_t func)
+{
+    glSamplerParameteri((GLuint)sampler, GL_TEXTURE_COMPARE_MODE, enabled ? GL_COMPARE_REF_TO_TEXTURE : GL_NONE);
+    glSamplerParameteri((GLuint)sampler, GL_TEXTURE_COMPARE_FUNC, (GLint)convertCompareFunc(func));
+    return lean_return_unit();
+}
+
+// glBindSampler : (unit : UInt32) → GLSamplerObject → IO Unit
+//
+lean_obj_res lean_opengl_bindsampler(uint32_t unit, glSamplerObject_t sampler)
+{
+    glBindSampler((GLuint)unit, (GLuint)sampler);
+    return lean_return_unit();
+}
+
+// the multi-bind calls copy their names to the stack unless there are more than this
+#define MULTI_BIND_STACK_NAMES 32
+
+// glBindTextures : (first : UInt32) → @& Array GLTextureObject → IO Unit
+//
+// 0 entries unbind their unit
+lean_obj_res lean_opengl_bindtextures(uint32_t first, b_lean_obj_arg textureArray)
+{
+    size_t count = lean_array_size(textureArray);
+    GLuint stackNames[MULTI_BIND_STACK_NAMES];
+    GLuint *names = count <= MULTI_BIND_STACK_NAMES ? stackNames : malloc(count * sizeof(GLuint));
+    for (size_t ix=0; ix < count; ix++) {
+        names[ix] = (GLuint)lean_unbox_uint32(lean_array_get_core(textureArray, ix));
+    }
+    glBindTextures((GLuint)first, (GLsizei)count, names);
+    if (names != stackNames) {
+        free(names);
+    }
+    return lean_return_unit();
+}
+
+// glBindSamplers : (first : UInt32) → @& Array GLSamplerObject → IO Unit
+//
+lean_obj_res lean_opengl_bindsamplers(uint32_t first, b_lean_obj_arg samplerArray)
+{
+    size_t count = lean_array_size(samplerArray);
+    GLuint stackNames[MULTI_BIND_STACK_NAMES];
+    GLuint *names = count <= MULTI_BIND_STACK_NAMES ? stackNames : malloc(count * sizeof(GLuint));
+    for (size_t ix=0; ix < count; ix++) {
+        names[ix] = (GLuint)lean_unbox_uint32(lean_array_get_core(samplerArray, ix));
+    }
+    glBindSamplers((GLuint)first, (GLsizei)count, names);
+    if (names != stackNames) {
+        free(names);
+    }
+    return lean_return_unit();
+}
+
+//def GLFramebufferObject := UInt32
+typedef uint32_t glFramebufferObject_t;
+//def GLRenderbufferObject := UInt32
+typedef uint32_t glRenderbufferObject_t;
+
+/*inductive GLFramebufferTarget
+  | DrawFramebuffer
+  | ReadFramebuffer
+  | Framebuffer
+*/
+typedef uint8_t glFramebufferTarget_t;
+
+static GLenum convertFramebufferTarget(glFramebufferTarget_t target)
+{
+    switch (target)
+    {
+        case 0: return GL_DRAW_FRAMEBUFFER;
+        case 1: return GL_READ_FRAMEBUFFER;
+        case 2: return GL_FRAMEBUFFER;
+    }
+    return GL_INVALID_VALUE;
+}
+
+/*inductive GLFramebufferAttachment
+  | Color0 .. Color7
+  | Depth
+  | Stencil
+  | DepthStencil
+  | BackColor
+  | BackDepth
+  | BackStencil
+*/
+typedef uint8_t glFramebufferAttachment_t;
+
+static GLenum convertFramebufferAttachment(glFramebufferAttachment_t attachment)
+{
+    if (attachment < 8) {
+        return GL_COLOR_ATTACHMENT0 + attachment;
+    }
+    switch (attachment)
+    {
+        case 8: return GL_DEPTH_ATTACHMENT;
+        case 9: return GL_STENCIL_ATTACHMENT;
+        case 10: return GL_DEPTH_STENCIL_ATTACHMENT;
+        // the default framebuffer's buffers, only valid for glInvalidateNamedFramebufferData on
+        // framebuffer 0
+        case 11: return GL_COLOR;
+        case 12: return GL_DEPTH;
+        case 13: return GL_STENCIL;
+    }
+    return GL_INVALID_VALUE;
+}
+
+/*inductive GLDrawBuffer
+  | Color0 .. Color7
+  | None
+  | Back
+*/
+typedef uint8_t glDrawBuffer_t;
+
+// glDrawBuffers takes GL_BACK_LEFT for the default framebuffer's back buffer, glReadBuffer
+// takes GL_BACK
+static GLenum convertDrawBuffer(glDrawBuffer_t buffer, GLenum back)
+{
+    if (buffer < 8) {
+        return GL_COLOR_ATTACHMENT0 + buffer;
+    }
+    switch (buffer)
+    {
+        case 8: return GL_NONE;
+        case 9: return back;
+    }
+    return GL_INVALID_VALUE;
+}
+
+#define MAX_ATTACHMENT_LIST 16
+
+// unboxes an Array GLFramebufferAttachment, returns the count or -1 if there are too many
+static int convertAttachmentArray(b_lean_obj_arg attachmentArray, GLenum *attachments)
+{
+    size_t count = lean_array_size(attachmentArray);
+    if (count > MAX_ATTACHMENT_LIST) {
+        return -1;
+    }
+    for (size_t ix=0; ix < count; ix++) {
+        attachments[ix] = convertFramebufferAttachment((uint8_t)lean_unbox(lean_array_get_core(attachmentArray, ix)));
+    }
+    return (int)count;
+}
+
+// glCreateFramebuffers : (count : UInt32) → IO (Array GLFramebufferObject)
+//
+lean_obj_res lean_opengl_createframebuffers(uint32_t count)
+{
+    GLuint *framebuffers = calloc(count, sizeof(GLuint));
+    glCreateFramebuffers((GLsizei)count, framebuffers);
+
+    lean_object *leanFramebuffers = lean_convert_uint32_array(count, framebuffers);
+
+    free(framebuffers);
+
+    return lean_io_result_mk_ok(leanFramebuffers);
+}
+
+// glDeleteFramebuffers : Array GLFramebufferObject → IO Unit
+//
+lean_obj_res lean_opengl_deleteframebuffers(lean_obj_arg framebufferArray)
+{
+    GLsizei framebufferCount = lean_array_size(framebufferArray);
+    GLuint *framebuffers = calloc(framebufferCount, sizeof(GLuint));
+
+    for (int ix=0; ix < framebufferCount; ix++) {
+        framebuffers[ix] = (uint32_t)lean_unbox_uint32(lean_array_get_core(framebufferArray, ix));
+    }
+
+    glDeleteFramebuffers(framebufferCount, framebuffers);
+
+    free(framebuffers);
+
+    return lean_return_unit();
+}
+
+// glBindFramebuffer : GLFramebufferTarget → GLFramebufferObject → IO Unit
+//
+lean_obj_res lean_opengl_bindframebuffer(glFramebufferTarget_t target, glFramebufferObject_t framebuffer)
+{
+    glBindFramebuffer(convertFramebufferTarget(target), (GLuint)framebuffer);
+    return lean_return_unit();
+}
+
+// glNamedFramebufferTexture : GLFramebufferObject → GLFramebufferAttachment → GLTextureObject → (level : UInt32) → IO Unit
+//
+lean_obj_res lean_opengl_namedframebuffertexture(
+    glFramebufferObject_t framebuffer, glFramebufferAttachment_t attachment, glTextureObject_t texture, uint32_t level)
+{
+    glNamedFramebufferTexture((GLuint)framebuffer, convertFramebufferAttachment(attachment), (GLuint)texture, (GLint)level);
+    return lean_return_unit();
+}
+
+// glNamedFramebufferTextureLayer : GLFramebufferObject → GLFramebufferAttachment → GLTextureObject → (level : UInt32) → (layer : UInt32) → IO Unit
+//
+lean_obj_res lean_opengl_namedframebuffertexturelayer(
+    glFramebufferObject_t framebuffer, glFramebufferAttachment_t attachment, glTextureObject_t texture, uint32_t level, uint32_t layer)
+{
+    glNamedFramebufferTextureLayer((GLuint)framebuffer, convertFramebufferAttachment(attachment), (GLuint)texture, (GLint)level, (GLint)layer);
+    return lean_return_unit();
+}
+
+// glNamedFramebufferRenderbuffer : GLFramebufferObject → GLFramebufferAttachment → GLRenderbufferObject → IO Unit
+//
+lean_obj_res lean_opengl_namedframebufferrenderbuffer(
+    glFramebufferObject_t framebuffer, glFramebufferAttachment_t attachment, glRenderbufferObject_t renderbuffer)
+{
+    glNamedFramebufferRenderbuffer((GLuint)framebuffer, convertFramebufferAttachment(attachment), GL_RENDERBUFFER, (GLuint)renderbuffer);
+    return lean_return_unit();
+}
+
+// glNamedFramebufferDrawBuffers : GLFramebufferObject → @& Array GLDrawBuffer → IO Unit
+//
+lean_obj_res lean_opengl_namedframebufferdrawbuffers(glFramebufferObject_t framebuffer, b_lean_obj_arg bufferArray)
+{
+    size_t count = lean_array_size(bufferArray);
+    if (count > MAX_ATTACHMENT_LIST) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Too many draw buffers passed to glNamedFramebufferDrawBuffers")));
+    }
+    GLenum buffers[MAX_ATTACHMENT_LIST];
+    for (size_t ix=0; ix < count; ix++) {
+        buffers[ix] = convertDrawBuffer((uint8_t)lean_unbox(lean_array_get_core(bufferArray, ix)), GL_BACK_LEFT);
+    }
+    glNamedFramebufferDrawBuffers((GLuint)framebuffer, (GLsizei)count, buffers);
+    return lean_return_unit();
+}
+
+// glNamedFramebufferReadBuffer : GLFramebufferObject → GLDrawBuffer → IO Unit
+//
+lean_obj_res lean_opengl_namedframebufferreadbuffer(glFramebufferObject_t framebuffer, glDrawBuffer_t buffer)
+{
+    glNamedFramebufferReadBuffer((GLuint)framebuffer, convertDrawBuffer(buffer, GL_BACK));
+    return lean_return_unit();
+}
+
+/*inductive GLFramebufferStatus
+  | Complete
+  | Undefined
+  | IncompleteAttachment
+  | MissingAttachment
+  | IncompleteDrawBuffer
+  | IncompleteReadBuffer
+  | Unsupported
+  | IncompleteMultisample
+  | IncompleteLayerTargets
+  | UnknownStatus
+*/
+
+// glCheckNamedFramebufferStatus : GLFramebufferObject → GLFramebufferTarget → IO GLFramebufferStatus
+//
+lean_obj_res lean_opengl_checknamedframebufferstatus(glFramebufferObject_t framebuffer, glFramebufferTarget_t target)
+{
+    uint8_t status;
+    switch (glCheckNamedFramebufferStatus((GLuint)framebuffer, convertFramebufferTarget(target)))
+    {
+        case GL_FRAMEBUFFER_COMPLETE: status = 0; break;
+        case GL_FRAMEBUFFER_UNDEFINED: status = 1; break;
+        case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: status = 2; break;
+        case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: status = 3; break;
+        case GL_FRAMEBUFFER_INCOMPLETE_DRAW_BUFFER: status = 4; break;
+        case GL_FRAMEBUFFER_INCOMPLETE_READ_BUFFER: status = 5; break;
+        case GL_FRAMEBUFFER_UNSUPPORTED: status = 6; break;
+        case GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE: status = 7; break;
+        case GL_FRAMEBUFFER_INCOMPLETE_LAYER_TARGETS: status = 8; break;
+        default: status = 9; break;
+    }
+    return lean_io_result_mk_ok(lean_box(status));
+}
+
+// glClearNamedFramebufferColor : GLFramebufferObject → (drawBuffer : UInt32) → (r g b a : Float) → IO Unit
+//
+lean_obj_res lean_opengl_clearnamedframebuffercolor(glFramebufferObject_t framebuffer, uint32_t drawBuffer, double r, double g, double b, double a)
+{
+    GLfloat color[4] = { (GLfloat)r, (GLfloat)g, (GLfloat)b, (GLfloat)a };
+    glClearNamedFramebufferfv((GLuint)framebuffer, GL_COLOR, (GLint)drawBuffer, color);
+    return lean_return_unit();
+}
+
+// glClearNamedFramebufferDepth : GLFramebufferObject → (depth : Float) → IO Unit
+//
+lean_obj_res lean_opengl_clearnamedframebufferdepth(glFramebufferObject_t framebuffer, double depth)
+{
+    GLfloat value = (GLfloat)depth;
+    glClearNamedFramebufferfv((GLuint)framebuffer, GL_DEPTH, 0, &value);
+    return lean_return_unit();
+}
+
+// glClearNamedFramebufferDepthStencil : GLFramebufferObject → (depth : Float) → (stencil : UInt32) → IO Unit
+//
+lean_obj_res lean_opengl_clearnamedframebufferdepthstencil(glFramebufferObject_t framebuffer, double depth, uint32_t stencil)
+{
+    glClearNamedFramebufferfi((GLuint)framebuffer, GL_DEPTH_STENCIL, 0, (GLfloat)depth, (GLint)stencil);
+    return lean_return_unit();
+}
+
+// glInvalidateNamedFramebufferData : GLFramebufferObject → @& Array GLFramebufferAttachment → IO Unit
+//
+lean_obj_res lean_opengl_invalidatenamedframebufferdata(glFramebufferObject_t framebuffer, b_lean_obj_arg attachmentArray)
+{
+    GLenum attachments[MAX_ATTACHMENT_LIST];
+    int count = convertAttachmentArray(attachmentArray, attachments);
+    if (count < 0) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Too many attachments passed to glInvalidateNamedFramebufferData")));
+    }
+    glInvalidateNamedFramebufferData((GLuint)framebuffer, count, attachments);
+    return lean_return_unit();
+}
+
+// glBlitNamedFramebuffer : (read : GLFramebufferObject) → (draw : GLFramebufferObject) → (srcX0 srcY0 srcX1 srcY1 dstX0 dstY0 dstX1 dstY1 : UInt32) → (bits : UInt64) → GLTextureFilter → IO Unit
+//
+lean_obj_res lean_opengl_blitnamedframebuffer(
+    glFramebufferObject_t readFramebuffer, glFramebufferObject_t drawFramebuffer,
+    uint32_t srcX0, uint32_t srcY0, uint32_t srcX1, uint32_t srcY1,
+    uint32_t dstX0, uint32_t dstY0, uint32_t dstX1, uint32_t dstY1,
+    uint64_t bits, glTextureFilter_t filter)
+{
+    glBlitNamedFramebuffer((GLuint)readFramebuffer, (GLuint)drawFramebuffer,
+        (GLint)srcX0, (GLint)srcY0, (GLint)srcX1, (GLint)srcY1,
+        (GLint)dstX0, (GLint)dstY0, (GLint)dstX1, (GLint)dstY1,
+        (GLbitfield)bits, convertTextureFilter(filter));
+    return lean_return_unit();
+}
+
+// glCreateRenderbuffers : (count : UInt32) → IO (Array GLRenderbufferObject)
+//
+lean_obj_res lean_opengl_createrenderbuffers(uint32_t count)
+{
+    GLuint *renderbuffers = calloc(count, sizeof(GLuint));
+    glCreateRenderbuffers((GLsizei)count, renderbuffers);
+
+    lean_object *leanRenderbuffers = lean_convert_uint32_array(count, renderbuffers);
+
+    free(renderbuffers);
+
+    return lean_io_result_mk_ok(leanRenderbuffers);
+}
+
+// glDeleteRenderbuffers : Array GLRenderbufferObject → IO Unit
+//
+lean_obj_res lean_opengl_deleterenderbuffers(lean_obj_arg renderbufferArray)
+{
+    GLsizei renderbufferCount = lean_array_size(renderbufferArray);
+    GLuint *renderbuffers = calloc(renderbufferCount, sizeof(GLuint));
+
+    for (int ix=0; ix < renderbufferCount; ix++) {
+        renderbuffers[ix] = (uint32_t)lean_unbox_uint32(lean_array_get_core(renderbufferArray, ix));
+    }
+
+    glDeleteRenderbuffers(renderbufferCount, renderbuffers);
+
+    free(renderbuffers);
+
+    return lean_return_unit();
+}
+
+// glNamedRenderbufferStorage : GLRenderbufferObject → GLSizedTextureFormat → (width : UInt32) → (height : UInt32) → IO Unit
+//
+lean_obj_res lean_opengl_namedrenderbufferstorage(glRenderbufferObject_t renderbuffer, glSizedTextureFormat_t fmt, uint32_t width, uint32_t height)
+{
+    glNamedRenderbufferStorage((GLuint)renderbuffer, convertSizedTextureFormat(fmt), (GLsizei)width, (GLsizei)height);
+    return lean_return_unit();
+}
+
+// glNamedRenderbufferStorageMultisample : GLRenderbufferObject → (samples : UInt32) → GLSizedTextureFormat → (width : UInt32) → (height : UInt32) → IO Unit
+//
+lean_obj_res lean_opengl_namedrenderbufferstoragemultisample(glRenderbufferObject_t renderbuffer, uint32_t samples, glSizedTextureFormat_t fmt, uint32_t width, uint32_t height)
+{
+    glNamedRenderbufferStorageMultisample((GLuint)renderbuffer, (GLsizei)samples, convertSizedTextureFormat(fmt), (GLsizei)width, (GLsizei)height);
+    return lean_return_unit();
+}
+
+size_t pixelChannelCount(glPixelFormat_t fmt)
+{
+    switch (fmt)
+    {
+        case 0: return 1;
+        case 1: return 2;
+        case 2: case 3: return 3;
+        case 4: case 5: return 4;
+    }
+    return 1;
+}
+
+size_t pixelTypeSize(glPixelType_t pType)
+{
+    switch (pType)
+    {
+        case 0: case 1: return 1;
+        case 2: case 3: case 7: return 2;
+    }
+    return 4;
+}
+
+size_t unpackedImageSize(glPixelFormat_t fmt, glPixelType_t pType, uint32_t width, uint32_t height)
+{
+    if (width == 0 || height == 0) {
+        return 0;
+    }
+    GLint alignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+    size_t rowBytes = (size_t)width * pixelChannelCount(fmt) * pixelTypeSize(pType);
+    size_t rowStride = (rowBytes + (size_t)alignment - 1) / (size_t)alignment * (size_t)alignment;
+    return rowStride * (height - 1) + rowBytes;
+}
+
+// glFinish : IO Unit
+//
+lean_obj_res lean_opengl_finish()
+{
+    glFinish();
+    return lean_return_unit();
+}
+
+// glReadPixels : (x : UInt32) → (y : UInt32) → (width : UInt32) → (height : UInt32) → GLPixelFormat → GLPixelType → IO ByteArray
+//
+// reads from the read buffer of the bound read framebuffer, rows tightly packed bottom-up
+lean_obj_res lean_opengl_readpixels(uint32_t x, uint32_t y, uint32_t width, uint32_t height, glPixelFormat_t fmt, glPixelType_t pType)
+{
+    size_t bytes = (size_t)width * height * pixelChannelCount(fmt) * pixelTypeSize(pType);
+    lean_object *pixels = lean_alloc_sarray(1, bytes, bytes);
+
+    GLint alignment = 4;
+    glGetIntegerv(GL_PACK_ALIGNMENT, &alignment);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels((GLint)x, (GLint)y, (GLsizei)width, (GLsizei)height, convertPixelFormat(fmt), convertPixelType(pType), lean_sarray_cptr(pixels));
+    glPixelStorei(GL_PACK_ALIGNMENT, alignment);
+
+    return lean_io_result_mk_ok(pixels);
+}
+
+// glGetTextureImage : GLTextureObject → (level : UInt32) → GLPixelFormat → GLPixelType → IO ByteArray
+//
+// the whole level (all layers or faces for array and cube textures), rows tightly packed
+lean_obj_res lean_opengl_gettextureimage(glTextureObject_t texture, uint32_t level, glPixelFormat_t fmt, glPixelType_t pType)
+{
+    GLint width = 0, height = 0, depth = 0;
+    glGetTextureLevelParameteriv((GLuint)texture, (GLint)level, GL_TEXTURE_WIDTH, &width);
+    glGetTextureLevelParameteriv((GLuint)texture, (GLint)level, GL_TEXTURE_HEIGHT, &height);
+    glGetTextureLevelParameteriv((GLuint)texture, (GLint)level, GL_TEXTURE_DEPTH, &depth);
+    if (width <= 0 || height <= 0 || depth <= 0) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("glGetTextureImage: texture level has no storage")));
+    }
+
+    GLint target = 0;
+    glGetTextureParameteriv((GLuint)texture, GL_TEXTURE_TARGET, &target);
+    if (target == GL_TEXTURE_CUBE_MAP) {
+        depth = 6;
+    }
+
+    size_t bytes = (size_t)width * height * depth * pixelChannelCount(fmt) * pixelTypeSize(pType);
+    lean_object *pixels = lean_alloc_sarray(1, bytes, bytes);
+
+    GLint alignment = 4;
+    glGetIntegerv(GL_PACK_ALIGNMENT, &alignment);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glGetTextureImage((GLuint)texture, (GLint)level, convertPixelFormat(fmt), convertPixelType(pType), (GLsizei)bytes, lean_sarray_cptr(pixels));
+    glPixelStorei(GL_PACK_ALIGNMENT, alignment);
+
+    return lean_io_result_mk_ok(pixels);
+}
+
+// glGetNamedBufferSubData : GLBufferObject → (offset : UInt64) → (size : UInt64) → IO ByteArray
+//
+// waits for the GPU to finish writing the range; meant for tests and debugging
+lean_obj_res lean_opengl_getnamedbuffersubdata(bufferObject_t buffer, uint64_t offset, uint64_t size)
+{
+    GLint64 bufferSize = 0;
+    glGetNamedBufferParameteri64v(buffer, GL_BUFFER_SIZE, &bufferSize);
+    if (offset > (uint64_t)bufferSize || size > (uint64_t)bufferSize - offset) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("glGetNamedBufferSubData: range is outside the buffer")));
+    }
+    lean_object *bytes = lean_alloc_sarray(1, size, size);
+    glGetNamedBufferSubData(buffer, (GLintptr)offset, (GLsizeiptr)size, lean_sarray_cptr(bytes));
+    return lean_io_result_mk_ok(bytes);
+}
+
+//def GLSyncObject := UInt64
+// the GLsync pointer; sync objects are shared between contexts in a share group
+
+// glFlush : IO Unit
+//
+lean_obj_res lean_opengl_flush()
+{
+    glFlush();
+    return lean_return_unit();
+}
+
+// glFenceSync : IO GLSyncObject
+//
+lean_obj_res lean_opengl_fencesync()
+{
+    GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    return lean_io_result_mk_ok(lean_box_uint64((uint64_t)(uintptr_t)sync));
+}
+
+// glDeleteSync : GLSyncObject → IO Unit
+//
+lean_obj_res lean_opengl_deletesync(uint64_t sync)
+{
+    glDeleteSync((GLsync)(uintptr_t)sync);
+    return lean_return_unit();
+}
+
+/*inductive GLSyncStatus
+  | AlreadySignaled
+  | TimeoutExpired
+  | ConditionSatisfied
+  | WaitFailed
+*/
+
+// glClientWaitSync : GLSyncObject → (flush : Bool) → (timeoutNanos : UInt64) → IO GLSyncStatus
+//
+lean_obj_res lean_opengl_clientwaitsync(uint64_t sync, uint8_t flush, uint64_t timeoutNanos)
+{
+    uint8_t status;
+    switch (glClientWaitSync((GLsync)(uintptr_t)sync, flush ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, (GLuint64)timeoutNanos))
+    {
+        case GL_ALREADY_SIGNALED: status = 0; break;
+        case GL_TIMEOUT_EXPIRED: status = 1; break;
+        case GL_CONDITION_SATISFIED: status = 2; break;
+        default: status = 3; break;
+    }
+    return lean_io_result_mk_ok(lean_box(status));
+}
+
+// glWaitSync : GLSyncObject → IO Unit
+//
+// makes the server wait; returns immediately
+lean_obj_res lean_opengl_waitsync(uint64_t sync)
+{
+    glWaitSync((GLsync)(uintptr_t)sync, 0, GL_TIMEOUT_IGNORED);
+    return lean_return_unit();
+}
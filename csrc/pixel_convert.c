@@ -0,0 +1,398 @@
+#include <lean/lean.h>
+
+#include "data_marshal.h"
+#include "attrib_compress.h"
+#include "srgb_tables.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Pixel format conversion ahead of texture uploads: RGB <-> RGBA, red/blue swizzle, alpha
+// premultiplication, sRGB <-> linear, 16 -> 8 bit and float -> half. Conversions that don't
+// grow the data run in place when Lean holds the only reference to the ByteArray; they all
+// process front to back, loading each block before storing its (no larger) result.
+//
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define HAVE_SSSE3_DISPATCH 1
+
+static int hasSSSE3()
+{
+    static int cached = -1;
+    if (cached < 0) {
+        __builtin_cpu_init();
+        cached = __builtin_cpu_supports("ssse3");
+    }
+    return cached;
+}
+
+// RGBA <-> BGRA, 4 pixels per shuffle
+__attribute__((target("ssse3")))
+static size_t swapRedBlueSSSE3(uint8_t *pixels, size_t pixelCount)
+{
+    const __m128i shuffle = _mm_setr_epi8(2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15);
+    size_t ix = 0;
+    for (; ix + 4 <= pixelCount; ix += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(pixels + ix * 4));
+        _mm_storeu_si128((__m128i *)(pixels + ix * 4), _mm_shuffle_epi8(v, shuffle));
+    }
+    return ix;
+}
+
+// 4 RGB pixels (12 bytes of a 16 byte load) to 4 RGBA pixels. src and dst are separate.
+__attribute__((target("ssse3")))
+static size_t expandRGBSSSE3(const uint8_t *src, uint8_t *dst, size_t pixelCount, uint8_t alpha)
+{
+    const __m128i shuffle = _mm_setr_epi8(0,1,2,-1, 3,4,5,-1, 6,7,8,-1, 9,10,11,-1);
+    const __m128i alphaBits = _mm_set1_epi32((int)((uint32_t)alpha << 24));
+    size_t ix = 0;
+    // the 16 byte load reads 4 bytes past the 4th pixel, so stop one group early
+    for (; ix + 6 <= pixelCount; ix += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + ix * 3));
+        _mm_storeu_si128((__m128i *)(dst + ix * 4), _mm_or_si128(_mm_shuffle_epi8(v, shuffle), alphaBits));
+    }
+    return ix;
+}
+
+// 4 RGBA pixels to 12 bytes of RGB, safe in place
+__attribute__((target("ssse3")))
+static size_t dropAlphaSSSE3(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+    const __m128i shuffle = _mm_setr_epi8(0,1,2, 4,5,6, 8,9,10, 12,13,14, -1,-1,-1,-1);
+    size_t ix = 0;
+    for (; ix + 4 <= pixelCount; ix += 4) {
+        __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src + ix * 4)), shuffle);
+        _mm_storel_epi64((__m128i *)(dst + ix * 3), v);
+        uint32_t tail = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(v, 8));
+        memcpy(dst + ix * 3 + 8, &tail, 4);
+    }
+    return ix;
+}
+
+// SSE2 is baseline on x86_64 but not on i386, where these only build with -msse2 or better
+#if defined(__SSE2__)
+#define HAVE_SSE2_PIXELS 1
+
+// x * a / 255 rounded, exact for all 8 bit inputs: t = x*a + 128, (t + (t >> 8)) >> 8
+static size_t premultiplySSE2(uint8_t *pixels, size_t pixelCount)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rounding = _mm_set1_epi16(128);
+    // keeps alpha itself: multiply it by 255 instead of by alpha
+    const __m128i alphaLanes = _mm_setr_epi16(0,0,0,-1, 0,0,0,-1);
+    const __m128i alpha255 = _mm_setr_epi16(0,0,0,255, 0,0,0,255);
+    size_t ix = 0;
+    for (; ix + 4 <= pixelCount; ix += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(pixels + ix * 4));
+        __m128i halves[2] = { _mm_unpacklo_epi8(v, zero), _mm_unpackhi_epi8(v, zero) };
+        for (int h=0; h < 2; h++) {
+            __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(halves[h], 0xFF), 0xFF);
+            a = _mm_or_si128(_mm_andnot_si128(alphaLanes, a), alpha255);
+            __m128i t = _mm_add_epi16(_mm_mullo_epi16(halves[h], a), rounding);
+            halves[h] = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+        }
+        _mm_storeu_si128((__m128i *)(pixels + ix * 4), _mm_packus_epi16(halves[0], halves[1]));
+    }
+    return ix;
+}
+
+// v / 257 rounded, exact for all 16 bit inputs: m = (v * 0xFF01) >> 16, then (m + 128) >> 8.
+// Safe in place.
+static size_t unorm16To8SSE2(const uint16_t *src, uint8_t *dst, size_t count)
+{
+    const __m128i scale = _mm_set1_epi16((short)0xFF01);
+    const __m128i rounding = _mm_set1_epi16(128);
+    size_t ix = 0;
+    for (; ix + 16 <= count; ix += 16) {
+        __m128i a = _mm_mulhi_epu16(_mm_loadu_si128((const __m128i *)(src + ix)), scale);
+        __m128i b = _mm_mulhi_epu16(_mm_loadu_si128((const __m128i *)(src + ix + 8)), scale);
+        a = _mm_srli_epi16(_mm_add_epi16(a, rounding), 8);
+        b = _mm_srli_epi16(_mm_add_epi16(b, rounding), 8);
+        _mm_storeu_si128((__m128i *)(dst + ix), _mm_packus_epi16(a, b));
+    }
+    return ix;
+}
+#endif
+
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define HAVE_NEON_PIXELS 1
+
+static size_t swapRedBlueNEON(uint8_t *pixels, size_t pixelCount)
+{
+    size_t ix = 0;
+    for (; ix + 16 <= pixelCount; ix += 16) {
+        uint8x16x4_t v = vld4q_u8(pixels + ix * 4);
+        uint8x16_t red = v.val[0];
+        v.val[0] = v.val[2];
+        v.val[2] = red;
+        vst4q_u8(pixels + ix * 4, v);
+    }
+    return ix;
+}
+
+static size_t expandRGBNEON(const uint8_t *src, uint8_t *dst, size_t pixelCount, uint8_t alpha)
+{
+    size_t ix = 0;
+    for (; ix + 16 <= pixelCount; ix += 16) {
+        uint8x16x3_t rgb = vld3q_u8(src + ix * 3);
+        uint8x16x4_t rgba = { { rgb.val[0], rgb.val[1], rgb.val[2], vdupq_n_u8(alpha) } };
+        vst4q_u8(dst + ix * 4, rgba);
+    }
+    return ix;
+}
+
+static size_t dropAlphaNEON(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+    size_t ix = 0;
+    for (; ix + 16 <= pixelCount; ix += 16) {
+        uint8x16x4_t rgba = vld4q_u8(src + ix * 4);
+        uint8x16x3_t rgb = { { rgba.val[0], rgba.val[1], rgba.val[2] } };
+        vst3q_u8(dst + ix * 3, rgb);
+    }
+    return ix;
+}
+
+static inline uint8x16_t mulDiv255NEON(uint8x16_t x, uint8x16_t a)
+{
+    uint16x8_t lo = vmull_u8(vget_low_u8(x), vget_low_u8(a));
+    uint16x8_t hi = vmull_u8(vget_high_u8(x), vget_high_u8(a));
+    return vcombine_u8(vraddhn_u16(lo, vrshrq_n_u16(lo, 8)), vraddhn_u16(hi, vrshrq_n_u16(hi, 8)));
+}
+
+static size_t premultiplyNEON(uint8_t *pixels, size_t pixelCount)
+{
+    size_t ix = 0;
+    for (; ix + 16 <= pixelCount; ix += 16) {
+        uint8x16x4_t v = vld4q_u8(pixels + ix * 4);
+        v.val[0] = mulDiv255NEON(v.val[0], v.val[3]);
+        v.val[1] = mulDiv255NEON(v.val[1], v.val[3]);
+        v.val[2] = mulDiv255NEON(v.val[2], v.val[3]);
+        vst4q_u8(pixels + ix * 4, v);
+    }
+    return ix;
+}
+
+static size_t unorm16To8NEON(const uint16_t *src, uint8_t *dst, size_t count)
+{
+    const uint16x4_t scale = vdup_n_u16(0xFF01);
+    size_t ix = 0;
+    for (; ix + 8 <= count; ix += 8) {
+        uint16x8_t v = vld1q_u16(src + ix);
+        uint16x8_t m = vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(v), scale), 16),
+                                    vshrn_n_u32(vmull_u16(vget_high_u16(v), scale), 16));
+        vst1_u8(dst + ix, vrshrn_n_u16(m, 8));
+    }
+    return ix;
+}
+#endif
+
+static inline uint8_t mulDiv255(uint32_t x, uint32_t a)
+{
+    uint32_t t = x * a + 128;
+    return (uint8_t)((t + (t >> 8)) >> 8);
+}
+
+static void swapRedBlue(uint8_t *pixels, size_t pixelCount)
+{
+    size_t ix = 0;
+#if defined(HAVE_SSSE3_DISPATCH)
+    if (hasSSSE3()) ix = swapRedBlueSSSE3(pixels, pixelCount);
+#elif defined(HAVE_NEON_PIXELS)
+    ix = swapRedBlueNEON(pixels, pixelCount);
+#endif
+    for (; ix < pixelCount; ix++) {
+        uint8_t red = pixels[ix*4];
+        pixels[ix*4] = pixels[ix*4+2];
+        pixels[ix*4+2] = red;
+    }
+}
+
+static void expandRGB(const uint8_t *src, uint8_t *dst, size_t pixelCount, uint8_t alpha)
+{
+    size_t ix = 0;
+#if defined(HAVE_SSSE3_DISPATCH)
+    if (hasSSSE3()) ix = expandRGBSSSE3(src, dst, pixelCount, alpha);
+#elif defined(HAVE_NEON_PIXELS)
+    ix = expandRGBNEON(src, dst, pixelCount, alpha);
+#endif
+    for (; ix < pixelCount; ix++) {
+        dst[ix*4] = src[ix*3];
+        dst[ix*4+1] = src[ix*3+1];
+        dst[ix*4+2] = src[ix*3+2];
+        dst[ix*4+3] = alpha;
+    }
+}
+
+static void dropAlpha(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+    size_t ix = 0;
+#if defined(HAVE_SSSE3_DISPATCH)
+    if (hasSSSE3()) ix = dropAlphaSSSE3(src, dst, pixelCount);
+#elif defined(HAVE_NEON_PIXELS)
+    ix = dropAlphaNEON(src, dst, pixelCount);
+#endif
+    for (; ix < pixelCount; ix++) {
+        dst[ix*3] = src[ix*4];
+        dst[ix*3+1] = src[ix*4+1];
+        dst[ix*3+2] = src[ix*4+2];
+    }
+}
+
+static void premultiplyAlpha(uint8_t *pixels, size_t pixelCount)
+{
+    size_t ix = 0;
+#if defined(HAVE_SSE2_PIXELS)
+    ix = premultiplySSE2(pixels, pixelCount);
+#elif defined(HAVE_NEON_PIXELS)
+    ix = premultiplyNEON(pixels, pixelCount);
+#endif
+    for (; ix < pixelCount; ix++) {
+        uint32_t a = pixels[ix*4+3];
+        pixels[ix*4] = mulDiv255(pixels[ix*4], a);
+        pixels[ix*4+1] = mulDiv255(pixels[ix*4+1], a);
+        pixels[ix*4+2] = mulDiv255(pixels[ix*4+2], a);
+    }
+}
+
+static void unorm16To8(const uint16_t *src, uint8_t *dst, size_t count)
+{
+    size_t ix = 0;
+#if defined(HAVE_SSE2_PIXELS)
+    ix = unorm16To8SSE2(src, dst, count);
+#elif defined(HAVE_NEON_PIXELS)
+    ix = unorm16To8NEON(src, dst, count);
+#endif
+    for (; ix < count; ix++) {
+        uint32_t m = ((uint32_t)src[ix] * 0xFF01) >> 16;
+        dst[ix] = (uint8_t)((m + 128) >> 8);
+    }
+}
+
+// channels 4 leaves every 4th byte (alpha) alone, anything else converts every byte
+static void applyTable(uint8_t *bytes, size_t count, const uint8_t *table, uint32_t channels)
+{
+    if (channels == 4) {
+        for (size_t ix=0; ix + 4 <= count; ix += 4) {
+            bytes[ix] = table[bytes[ix]];
+            bytes[ix+1] = table[bytes[ix+1]];
+            bytes[ix+2] = table[bytes[ix+2]];
+        }
+    }
+    else {
+        for (size_t ix=0; ix < count; ix++) {
+            bytes[ix] = table[bytes[ix]];
+        }
+    }
+}
+
+// the input buffer when Lean holds the only reference to it, a new one otherwise
+static lean_object *outputBuffer(lean_obj_arg src, size_t bytes)
+{
+    if (lean_is_exclusive(src) && lean_sarray_capacity(src) >= bytes) {
+        return src;
+    }
+    return lean_alloc_sarray(1, bytes, bytes);
+}
+
+// copies src into a fresh buffer unless it can be modified in place
+static lean_object *exclusiveBuffer(lean_obj_arg src)
+{
+    if (lean_is_exclusive(src)) {
+        return src;
+    }
+    size_t bytes = lean_sarray_size(src);
+    lean_object *copy = lean_alloc_sarray(1, bytes, bytes);
+    memcpy(lean_sarray_cptr(copy), lean_sarray_cptr(src), bytes);
+    lean_dec(src);
+    return copy;
+}
+
+static lean_object *finishOutput(lean_obj_arg src, lean_object *dst, size_t bytes)
+{
+    lean_sarray_set_size(dst, bytes);
+    if (dst != src) {
+        lean_dec(src);
+    }
+    return dst;
+}
+
+// pixelsRGBToRGBA : ByteArray → (alpha : UInt8) → ByteArray
+//
+// grows the data, so this always allocates
+lean_obj_res lean_pixels_rgb_to_rgba(b_lean_obj_arg src, uint8_t alpha)
+{
+    size_t pixelCount = lean_sarray_size(src) / 3;
+    lean_object *dst = lean_alloc_sarray(1, pixelCount * 4, pixelCount * 4);
+    expandRGB(lean_sarray_cptr(src), lean_sarray_cptr(dst), pixelCount, alpha);
+    return dst;
+}
+
+// pixelsRGBAToRGB : ByteArray → ByteArray
+//
+lean_obj_res lean_pixels_rgba_to_rgb(lean_obj_arg src)
+{
+    size_t pixelCount = lean_sarray_size(src) / 4;
+    lean_object *dst = outputBuffer(src, pixelCount * 3);
+    dropAlpha(lean_sarray_cptr(src), lean_sarray_cptr(dst), pixelCount);
+    return finishOutput(src, dst, pixelCount * 3);
+}
+
+// pixelsSwapRedBlue : ByteArray → ByteArray
+//
+lean_obj_res lean_pixels_swap_red_blue(lean_obj_arg src)
+{
+    lean_object *pixels = exclusiveBuffer(src);
+    swapRedBlue(lean_sarray_cptr(pixels), lean_sarray_size(pixels) / 4);
+    return pixels;
+}
+
+// pixelsPremultiplyAlpha : ByteArray → ByteArray
+//
+lean_obj_res lean_pixels_premultiply_alpha(lean_obj_arg src)
+{
+    lean_object *pixels = exclusiveBuffer(src);
+    premultiplyAlpha(lean_sarray_cptr(pixels), lean_sarray_size(pixels) / 4);
+    return pixels;
+}
+
+// pixelsSrgbToLinear : ByteArray → (channels : UInt32) → ByteArray
+//
+lean_obj_res lean_pixels_srgb_to_linear(lean_obj_arg src, uint32_t channels)
+{
+    lean_object *pixels = exclusiveBuffer(src);
+    applyTable(lean_sarray_cptr(pixels), lean_sarray_size(pixels), getSrgbTables()->srgbToLinear8, channels);
+    return pixels;
+}
+
+// pixelsLinearToSrgb : ByteArray → (channels : UInt32) → ByteArray
+//
+lean_obj_res lean_pixels_linear_to_srgb(lean_obj_arg src, uint32_t channels)
+{
+    lean_object *pixels = exclusiveBuffer(src);
+    applyTable(lean_sarray_cptr(pixels), lean_sarray_size(pixels), getSrgbTables()->linearToSrgb8, channels);
+    return pixels;
+}
+
+// pixelsUnorm16ToUnorm8 : ByteArray → ByteArray
+//
+lean_obj_res lean_pixels_unorm16_to_unorm8(lean_obj_arg src)
+{
+    size_t count = lean_sarray_size(src) / 2;
+    lean_object *dst = outputBuffer(src, count);
+    unorm16To8((const uint16_t *)lean_sarray_cptr(src), lean_sarray_cptr(dst), count);
+    return finishOutput(src, dst, count);
+}
+
+// pixelsFloatToHalf : ByteArray → ByteArray
+//
+// 32 bit floats to GLPixelType.HalfFloat texels
+lean_obj_res lean_pixels_float_to_half(lean_obj_arg src)
+{
+    size_t count = lean_sarray_size(src) / 4;
+    lean_object *dst = outputBuffer(src, count * 2);
+    convertFloatsToHalves((const float *)lean_sarray_cptr(src), (uint16_t *)lean_sarray_cptr(dst), count);
+    return finishOutput(src, dst, count * 2);
+}
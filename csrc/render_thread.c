@@ -0,0 +1,585 @@
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+#include <GLFW/glfw3.h>
+
+#include "data_marshal.h"
+#include "opengl_ffi.h"
+#include "window_state.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Optional render thread. The window's context is made current on a C-owned thread, and Lean
+// threads hand it command buffers: a compact binary encoding of the GL calls for (part of) a
+// frame, built with the cmd* functions. Submission copies the buffer into a queue slot, so the
+// simulation of frame N+1 can carry on while the render thread executes frame N.
+//
+// The queue is a bounded single-consumer ring with lock-free indices; submitters are serialized
+// by a mutex, and the mutex/condition pair is only touched when one side has to sleep (queue
+// empty or full). A full queue is the backpressure: submit blocks until a slot frees up.
+//
+
+// each command starts with a header word: opcode in the low 8 bits, length in words (header
+// included) above it. Floats are stored as their 32-bit patterns.
+enum {
+    OP_VIEWPORT = 1,           // x y width height
+    OP_CLEAR,                  // framebuffer, r g b a depth
+    OP_BIND_FRAMEBUFFER,       // framebuffer
+    OP_USE_PROGRAM,            // program
+    OP_BIND_VERTEX_ARRAY,      // vao
+    OP_BIND_TEXTURE_UNIT,      // unit texture
+    OP_BIND_SAMPLER,           // unit sampler
+    OP_UNIFORM_4F,             // program location, x y z w
+    OP_UNIFORM_MATRIX_4F,      // program location, 16 floats
+    OP_DRAW_ARRAYS,            // mode first count instances
+    OP_DRAW_ELEMENTS,          // mode indexType count offsetLow offsetHigh instances
+    OP_BUFFER_SUB_DATA,        // buffer offsetLow offsetHigh byteCount, bytes padded to words
+    OP_SWAP,
+    OP_COUNT
+};
+
+static const uint32_t opWords[OP_COUNT] = {
+    [OP_VIEWPORT] = 5,
+    [OP_CLEAR] = 7,
+    [OP_BIND_FRAMEBUFFER] = 2,
+    [OP_USE_PROGRAM] = 2,
+    [OP_BIND_VERTEX_ARRAY] = 2,
+    [OP_BIND_TEXTURE_UNIT] = 3,
+    [OP_BIND_SAMPLER] = 3,
+    [OP_UNIFORM_4F] = 7,
+    [OP_UNIFORM_MATRIX_4F] = 19,
+    [OP_DRAW_ARRAYS] = 5,
+    [OP_DRAW_ELEMENTS] = 7,
+    [OP_BUFFER_SUB_DATA] = 5,  // plus the data
+    [OP_SWAP] = 1,
+};
+
+// the header has 24 bits for the length in words
+#define MAX_COMMAND_WORDS ((1u << 24) - 1)
+#define MAX_SUB_DATA_BYTES ((size_t)(MAX_COMMAND_WORDS - 5) * 4)  // less the OP_BUFFER_SUB_DATA words
+
+static inline uint32_t floatBits(double value)
+{
+    float f = (float)value;
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+static inline float bitsFloat(uint32_t bits)
+{
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// appends a command to the buffer, in place when it is exclusive and has room
+static lean_object *appendCommand(lean_obj_arg buffer, uint32_t op, const uint32_t *args, uint32_t argCount, const void *data, size_t dataBytes)
+{
+    size_t dataWords = (dataBytes + 3) / 4;
+    size_t commandBytes = 4 * (1 + argCount + dataWords);
+    size_t size = lean_sarray_size(buffer);
+    size_t needed = size + commandBytes;
+
+    lean_object *out = buffer;
+    if (!lean_is_exclusive(buffer) || lean_sarray_capacity(buffer) < needed) {
+        size_t capacity = lean_sarray_capacity(buffer) * 2;
+        if (capacity < needed) capacity = needed;
+        if (capacity < 256) capacity = 256;
+        out = lean_alloc_sarray(1, size, capacity);
+        memcpy(lean_sarray_cptr(out), lean_sarray_cptr(buffer), size);
+        lean_dec(buffer);
+    }
+
+    uint8_t *dst = lean_sarray_cptr(out) + size;
+    uint32_t header = op | (uint32_t)((1 + argCount + dataWords) << 8);
+    memcpy(dst, &header, 4);
+    memcpy(dst + 4, args, 4 * argCount);
+    if (dataBytes > 0) {
+        memset(dst + 4 * (1 + argCount) + 4 * dataWords - 4, 0, 4);
+        memcpy(dst + 4 * (1 + argCount), data, dataBytes);
+    }
+    lean_sarray_set_size(out, needed);
+    return out;
+}
+
+// cmdViewport : CommandBuffer → (x y width height : UInt32) → CommandBuffer
+lean_obj_res lean_cmd_viewport(lean_obj_arg buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    uint32_t args[] = { x, y, width, height };
+    return appendCommand(buffer, OP_VIEWPORT, args, 4, NULL, 0);
+}
+
+// cmdClear : CommandBuffer → GLFramebufferObject → (r g b a depth : Float) → CommandBuffer
+lean_obj_res lean_cmd_clear(lean_obj_arg buffer, uint32_t framebuffer, double r, double g, double b, double a, double depth)
+{
+    uint32_t args[] = { framebuffer, floatBits(r), floatBits(g), floatBits(b), floatBits(a), floatBits(depth) };
+    return appendCommand(buffer, OP_CLEAR, args, 6, NULL, 0);
+}
+
+// cmdBindFramebuffer : CommandBuffer → GLFramebufferObject → CommandBuffer
+lean_obj_res lean_cmd_bind_framebuffer(lean_obj_arg buffer, uint32_t framebuffer)
+{
+    return appendCommand(buffer, OP_BIND_FRAMEBUFFER, &framebuffer, 1, NULL, 0);
+}
+
+// cmdUseProgram : CommandBuffer → GLProgramObject → CommandBuffer
+lean_obj_res lean_cmd_use_program(lean_obj_arg buffer, uint32_t program)
+{
+    return appendCommand(buffer, OP_USE_PROGRAM, &program, 1, NULL, 0);
+}
+
+// cmdBindVertexArray : CommandBuffer → GLVertexArrayObject → CommandBuffer
+lean_obj_res lean_cmd_bind_vertex_array(lean_obj_arg buffer, uint32_t vao)
+{
+    return appendCommand(buffer, OP_BIND_VERTEX_ARRAY, &vao, 1, NULL, 0);
+}
+
+// cmdBindTextureUnit : CommandBuffer → (unit : UInt32) → GLTextureObject → CommandBuffer
+lean_obj_res lean_cmd_bind_texture_unit(lean_obj_arg buffer, uint32_t unit, uint32_t texture)
+{
+    uint32_t args[] = { unit, texture };
+    return appendCommand(buffer, OP_BIND_TEXTURE_UNIT, args, 2, NULL, 0);
+}
+
+// cmdBindSampler : CommandBuffer → (unit : UInt32) → GLSamplerObject → CommandBuffer
+lean_obj_res lean_cmd_bind_sampler(lean_obj_arg buffer, uint32_t unit, uint32_t sampler)
+{
+    uint32_t args[] = { unit, sampler };
+    return appendCommand(buffer, OP_BIND_SAMPLER, args, 2, NULL, 0);
+}
+
+// cmdUniform4f : CommandBuffer → GLProgramObject → (location : UInt32) → (x y z w : Float) → CommandBuffer
+lean_obj_res lean_cmd_uniform_4f(lean_obj_arg buffer, uint32_t program, uint32_t location, double x, double y, double z, double w)
+{
+    uint32_t args[] = { program, location, floatBits(x), floatBits(y), floatBits(z), floatBits(w) };
+    return appendCommand(buffer, OP_UNIFORM_4F, args, 6, NULL, 0);
+}
+
+// cmdUniformMatrix4f : CommandBuffer → GLProgramObject → (location : UInt32) → @& FloatArray → CommandBuffer
+//
+// takes the first 16 values, column major; missing ones are zero
+lean_obj_res lean_cmd_uniform_matrix_4f(lean_obj_arg buffer, uint32_t program, uint32_t location, b_lean_obj_arg matrix)
+{
+    uint32_t args[18] = { program, location };
+    size_t count = lean_sarray_size(matrix);
+    const double *values = (const double *)lean_sarray_cptr(matrix);
+    for (size_t ix=0; ix < 16; ix++) {
+        args[2 + ix] = ix < count ? floatBits(values[ix]) : 0;
+    }
+    return appendCommand(buffer, OP_UNIFORM_MATRIX_4F, args, 18, NULL, 0);
+}
+
+// cmdDrawArrays : CommandBuffer → GLDrawMode → (first count instances : UInt32) → CommandBuffer
+lean_obj_res lean_cmd_draw_arrays(lean_obj_arg buffer, uint8_t mode, uint32_t first, uint32_t count, uint32_t instances)
+{
+    uint32_t args[] = { mode, first, count, instances };
+    return appendCommand(buffer, OP_DRAW_ARRAYS, args, 4, NULL, 0);
+}
+
+// cmdDrawElements : CommandBuffer → GLDrawMode → (indexType : GLDataType) → (count : UInt32) → (offset : UInt64) → (instances : UInt32) → CommandBuffer
+lean_obj_res lean_cmd_draw_elements(lean_obj_arg buffer, uint8_t mode, uint8_t indexType, uint32_t count, uint64_t offset, uint32_t instances)
+{
+    uint32_t args[] = { mode, indexType, count, (uint32_t)offset, (uint32_t)(offset >> 32), instances };
+    return appendCommand(buffer, OP_DRAW_ELEMENTS, args, 6, NULL, 0);
+}
+
+// cmdBufferSubData : CommandBuffer → GLBufferObject → (offset : UInt64) → @& ByteArray → IO CommandBuffer
+//
+// the data is copied into the command buffer
+lean_obj_res lean_cmd_buffer_sub_data(lean_obj_arg buffer, uint32_t bufferObject, uint64_t offset, b_lean_obj_arg data)
+{
+    size_t bytes = lean_sarray_size(data);
+    if (bytes > MAX_SUB_DATA_BYTES) {
+        lean_dec(buffer);
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("cmdBufferSubData: 64 MiB or more of data does not fit in one command")));
+    }
+    uint32_t args[] = { bufferObject, (uint32_t)offset, (uint32_t)(offset >> 32), (uint32_t)bytes };
+    return lean_io_result_mk_ok(appendCommand(buffer, OP_BUFFER_SUB_DATA, args, 4, lean_sarray_cptr(data), bytes));
+}
+
+// cmdSwap : CommandBuffer → CommandBuffer
+lean_obj_res lean_cmd_swap(lean_obj_arg buffer)
+{
+    return appendCommand(buffer, OP_SWAP, NULL, 0, NULL, 0);
+}
+
+// checks every header so the render thread can trust the stream; NULL if it is well formed
+static const char *validateCommands(const uint8_t *bytes, size_t size)
+{
+    if (size % 4 != 0) {
+        return "submitCommands: command buffer size is not a multiple of 4";
+    }
+    size_t words = size / 4, at = 0;
+    while (at < words) {
+        uint32_t header;
+        memcpy(&header, bytes + 4 * at, 4);
+        uint32_t op = header & 0xFF, length = header >> 8;
+        if (op == 0 || op >= OP_COUNT) {
+            return "submitCommands: unknown opcode in command buffer";
+        }
+        if (length > words - at || length < opWords[op]) {
+            return "submitCommands: command runs past the end of the buffer";
+        }
+        if (op == OP_BUFFER_SUB_DATA) {
+            uint32_t byteCount;
+            memcpy(&byteCount, bytes + 4 * (at + 4), 4);
+            size_t dataWords = ((size_t)byteCount + 3) / 4;
+            if (dataWords > words - at - opWords[op]) {
+                return "submitCommands: buffer data runs past the end of the buffer";
+            }
+            if (length != opWords[op] + dataWords) {
+                return "submitCommands: buffer data length doesn't match its command";
+            }
+        }
+        else if (length != opWords[op]) {
+            return "submitCommands: command has the wrong length";
+        }
+        at += length;
+    }
+    return NULL;
+}
+
+typedef struct {
+    uint8_t *bytes;
+    size_t size;
+    size_t capacity;     // slot buffers are kept and grown, so steady state doesn't allocate
+    uint64_t submittedAt;
+} renderSlot_t;
+
+typedef struct {
+    GLFWwindow *window;
+    pthread_t thread;
+    renderSlot_t *slots;
+    uint32_t mask;
+    _Atomic uint32_t head;          // next slot to fill, advanced by submitters
+    _Atomic uint32_t tail;          // slot being executed, advanced when it is done
+    _Atomic int consumerWaiting;
+    _Atomic int producerWaiting;
+    _Atomic int stopping;
+    pthread_mutex_t lock;
+    pthread_cond_t notEmpty;
+    pthread_cond_t notFull;
+    pthread_mutex_t submitLock;
+    int started;                    // 1 once the context is current, -1 if that failed
+    // updated by submitters, under submitLock
+    uint64_t submitted;
+    uint64_t backpressureWaits;
+    uint64_t backpressureTicks;
+    // updated by the render thread
+    _Atomic uint64_t executed;
+    _Atomic uint64_t totalLatencyTicks;
+    _Atomic uint64_t maxLatencyTicks;
+    _Atomic uint64_t executeTicks;
+} renderThread_t;
+
+static void executeCommands(renderThread_t *rt, const uint8_t *bytes, size_t size)
+{
+    size_t words = size / 4, at = 0;
+    uint32_t w[19];
+    while (at < words) {
+        uint32_t header;
+        memcpy(&header, bytes + 4 * at, 4);
+        uint32_t op = header & 0xFF, length = header >> 8;
+        memcpy(w, bytes + 4 * at, 4 * opWords[op]);
+        switch (op)
+        {
+            case OP_VIEWPORT:
+                glViewport((GLint)w[1], (GLint)w[2], (GLsizei)w[3], (GLsizei)w[4]);
+                break;
+            case OP_CLEAR: {
+                GLfloat color[4] = { bitsFloat(w[2]), bitsFloat(w[3]), bitsFloat(w[4]), bitsFloat(w[5]) };
+                GLfloat depth = bitsFloat(w[6]);
+                glClearNamedFramebufferfv(w[1], GL_COLOR, 0, color);
+                glClearNamedFramebufferfv(w[1], GL_DEPTH, 0, &depth);
+                break;
+            }
+            case OP_BIND_FRAMEBUFFER:
+                glBindFramebuffer(GL_FRAMEBUFFER, w[1]);
+                break;
+            case OP_USE_PROGRAM:
+                glUseProgram(w[1]);
+                break;
+            case OP_BIND_VERTEX_ARRAY:
+                glBindVertexArray(w[1]);
+                break;
+            case OP_BIND_TEXTURE_UNIT:
+                glBindTextureUnit(w[1], w[2]);
+                break;
+            case OP_BIND_SAMPLER:
+                glBindSampler(w[1], w[2]);
+                break;
+            case OP_UNIFORM_4F:
+                glProgramUniform4f(w[1], (GLint)w[2], bitsFloat(w[3]), bitsFloat(w[4]), bitsFloat(w[5]), bitsFloat(w[6]));
+                break;
+            case OP_UNIFORM_MATRIX_4F:
+                glProgramUniformMatrix4fv(w[1], (GLint)w[2], 1, GL_FALSE, (const GLfloat *)&w[3]);
+                break;
+            case OP_DRAW_ARRAYS:
+                glDrawArraysInstanced(convertGLDrawMode((uint8_t)w[1]), (GLint)w[2], (GLsizei)w[3], (GLsizei)w[4]);
+                break;
+            case OP_DRAW_ELEMENTS: {
+                uint64_t offset = (uint64_t)w[4] | ((uint64_t)w[5] << 32);
+                glDrawElementsInstanced(convertGLDrawMode((uint8_t)w[1]), (GLsizei)w[3], convertGLDataType((uint8_t)w[2]),
+                    (const void *)(uintptr_t)offset, (GLsizei)w[6]);
+                break;
+            }
+            case OP_BUFFER_SUB_DATA: {
+                uint64_t offset = (uint64_t)w[2] | ((uint64_t)w[3] << 32);
+                glNamedBufferSubData(w[1], (GLintptr)offset, (GLsizeiptr)w[4], bytes + 4 * (at + opWords[op]));
+                break;
+            }
+            case OP_SWAP:
+                glfwSwapBuffers(rt->window);
+                break;
+        }
+        at += length;
+    }
+}
+
+// sleeps until the ring holds at most `limit` unfinished buffers
+static void waitForSlots(renderThread_t *rt, uint32_t limit)
+{
+    uint32_t head = atomic_load(&rt->head);
+    if (head - atomic_load(&rt->tail) <= limit) {
+        return;
+    }
+    pthread_mutex_lock(&rt->lock);
+    atomic_store(&rt->producerWaiting, 1);
+    while (head - atomic_load(&rt->tail) > limit) {
+        pthread_cond_wait(&rt->notFull, &rt->lock);
+    }
+    atomic_store(&rt->producerWaiting, 0);
+    pthread_mutex_unlock(&rt->lock);
+}
+
+static void *renderThreadMain(void *arg)
+{
+    renderThread_t *rt = arg;
+
+    int loaded = makeWindowContextCurrent(rt->window);
+    pthread_mutex_lock(&rt->lock);
+    rt->started = loaded ? 1 : -1;
+    pthread_cond_broadcast(&rt->notFull);
+    pthread_mutex_unlock(&rt->lock);
+    if (!loaded) {
+        glfwMakeContextCurrent(NULL);
+        return NULL;
+    }
+
+    for (;;) {
+        uint32_t tail = atomic_load(&rt->tail);
+        if (atomic_load(&rt->head) == tail) {
+            pthread_mutex_lock(&rt->lock);
+            atomic_store(&rt->consumerWaiting, 1);
+            while (atomic_load(&rt->head) == tail && !atomic_load(&rt->stopping)) {
+                pthread_cond_wait(&rt->notEmpty, &rt->lock);
+            }
+            atomic_store(&rt->consumerWaiting, 0);
+            pthread_mutex_unlock(&rt->lock);
+            if (atomic_load(&rt->head) == tail) {
+                break;  // stopping, and everything submitted has run
+            }
+        }
+
+        renderSlot_t *slot = &rt->slots[tail & rt->mask];
+        uint64_t start = glfwGetTimerValue();
+        uint64_t latency = start - slot->submittedAt;
+        executeCommands(rt, slot->bytes, slot->size);
+
+        atomic_fetch_add(&rt->executeTicks, glfwGetTimerValue() - start);
+        atomic_fetch_add(&rt->totalLatencyTicks, latency);
+        if (latency > atomic_load(&rt->maxLatencyTicks)) {
+            atomic_store(&rt->maxLatencyTicks, latency);
+        }
+        atomic_fetch_add(&rt->executed, 1);
+
+        atomic_store(&rt->tail, tail + 1);
+        if (atomic_load(&rt->producerWaiting)) {
+            pthread_mutex_lock(&rt->lock);
+            pthread_cond_broadcast(&rt->notFull);
+            pthread_mutex_unlock(&rt->lock);
+        }
+    }
+
+    glfwMakeContextCurrent(NULL);
+    return NULL;
+}
+
+static void wakeRenderThread(renderThread_t *rt)
+{
+    pthread_mutex_lock(&rt->lock);
+    pthread_cond_signal(&rt->notEmpty);
+    pthread_mutex_unlock(&rt->lock);
+}
+
+static void freeRenderThread(renderThread_t *rt)
+{
+    for (uint32_t ix=0; ix <= rt->mask; ix++) {
+        free(rt->slots[ix].bytes);
+    }
+    free(rt->slots);
+    pthread_mutex_destroy(&rt->lock);
+    pthread_mutex_destroy(&rt->submitLock);
+    pthread_cond_destroy(&rt->notEmpty);
+    pthread_cond_destroy(&rt->notFull);
+    free(rt);
+}
+
+// createRenderThread : @& Window → (queueDepth : UInt32) → IO RenderThread
+//
+// releases the context on the calling thread and makes it current on the new one
+lean_obj_res lean_renderthread_create(b_lean_obj_arg lw, uint32_t queueDepth)
+{
+    GLFWwindow *window = (GLFWwindow *)(lean_get_external_data(lw));
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to createRenderThread")));
+    }
+
+    uint32_t capacity = 2;
+    while (capacity < queueDepth && capacity < 64) capacity <<= 1;
+
+    renderThread_t *rt = calloc(1, sizeof(renderThread_t));
+    rt->window = window;
+    rt->slots = calloc(capacity, sizeof(renderSlot_t));
+    rt->mask = capacity - 1;
+    pthread_mutex_init(&rt->lock, NULL);
+    pthread_mutex_init(&rt->submitLock, NULL);
+    pthread_cond_init(&rt->notEmpty, NULL);
+    pthread_cond_init(&rt->notFull, NULL);
+
+    // the state has to exist before the render thread looks the table up
+    getWindowState(window);
+    if (glfwGetCurrentContext() == window) {
+        glfwMakeContextCurrent(NULL);
+        gladCurrentContext = NULL;
+    }
+    if (pthread_create(&rt->thread, NULL, renderThreadMain, rt) != 0) {
+        freeRenderThread(rt);
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("createRenderThread: could not start the thread")));
+    }
+
+    pthread_mutex_lock(&rt->lock);
+    while (rt->started == 0) {
+        pthread_cond_wait(&rt->notFull, &rt->lock);
+    }
+    pthread_mutex_unlock(&rt->lock);
+    if (rt->started < 0) {
+        pthread_join(rt->thread, NULL);
+        freeRenderThread(rt);
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("createRenderThread: loading the GL function table failed on the render thread")));
+    }
+    return lean_io_result_mk_ok(lean_mk_ptr(rt));
+}
+
+// destroyRenderThread : RenderThread → IO Unit
+//
+// runs everything already submitted, then stops; the context is left current nowhere
+lean_obj_res lean_renderthread_destroy(lean_obj_arg lrt)
+{
+    renderThread_t *rt = (renderThread_t *)(lean_get_external_data(lrt));
+    if (rt == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL render thread passed to destroyRenderThread")));
+    }
+    atomic_store(&rt->stopping, 1);
+    wakeRenderThread(rt);
+    pthread_join(rt->thread, NULL);
+    freeRenderThread(rt);
+    lean_clear_ptr(lrt);
+    return lean_return_unit();
+}
+
+// submitCommands : @& RenderThread → @& CommandBuffer → IO Unit
+//
+lean_obj_res lean_renderthread_submit(b_lean_obj_arg lrt, b_lean_obj_arg commands)
+{
+    renderThread_t *rt = (renderThread_t *)(lean_get_external_data(lrt));
+    if (rt == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL render thread passed to submitCommands")));
+    }
+    const uint8_t *bytes = lean_sarray_cptr(commands);
+    size_t size = lean_sarray_size(commands);
+
+    const char *error = validateCommands(bytes, size);
+    if (error != NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string(error)));
+    }
+
+    pthread_mutex_lock(&rt->submitLock);
+    uint32_t head = atomic_load(&rt->head);
+    if (head - atomic_load(&rt->tail) > rt->mask) {
+        uint64_t before = glfwGetTimerValue();
+        waitForSlots(rt, rt->mask);
+        rt->backpressureWaits++;
+        rt->backpressureTicks += glfwGetTimerValue() - before;
+    }
+
+    renderSlot_t *slot = &rt->slots[head & rt->mask];
+    if (slot->capacity < size) {
+        free(slot->bytes);
+        slot->capacity = size * 2;
+        slot->bytes = malloc(slot->capacity);
+    }
+    memcpy(slot->bytes, bytes, size);
+    slot->size = size;
+    slot->submittedAt = glfwGetTimerValue();
+    rt->submitted++;
+
+    atomic_store(&rt->head, head + 1);
+    if (atomic_load(&rt->consumerWaiting)) {
+        wakeRenderThread(rt);
+    }
+    pthread_mutex_unlock(&rt->submitLock);
+    return lean_return_unit();
+}
+
+// waitRenderIdle : @& RenderThread → IO Unit
+//
+lean_obj_res lean_renderthread_wait_idle(b_lean_obj_arg lrt)
+{
+    renderThread_t *rt = (renderThread_t *)(lean_get_external_data(lrt));
+    if (rt == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL render thread passed to waitRenderIdle")));
+    }
+    pthread_mutex_lock(&rt->submitLock);
+    waitForSlots(rt, 0);
+    pthread_mutex_unlock(&rt->submitLock);
+    return lean_return_unit();
+}
+
+/*structure RenderThreadStats where
+  submitted : UInt64
+  executed : UInt64
+  queued : UInt64
+  backpressureWaits : UInt64
+  backpressureTicks : UInt64
+  totalLatencyTicks : UInt64
+  maxLatencyTicks : UInt64
+  executeTicks : UInt64
+*/
+
+// renderThreadStats : @& RenderThread → IO RenderThreadStats
+//
+lean_obj_res lean_renderthread_stats(b_lean_obj_arg lrt)
+{
+    renderThread_t *rt = (renderThread_t *)(lean_get_external_data(lrt));
+    if (rt == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL render thread passed to renderThreadStats")));
+    }
+    pthread_mutex_lock(&rt->submitLock);
+    lean_object *stats = lean_alloc_ctor(0, 0, 64);
+    lean_ctor_set_uint64(stats, 0, rt->submitted);
+    lean_ctor_set_uint64(stats, 8, atomic_load(&rt->executed));
+    lean_ctor_set_uint64(stats, 16, atomic_load(&rt->head) - atomic_load(&rt->tail));
+    lean_ctor_set_uint64(stats, 24, rt->backpressureWaits);
+    lean_ctor_set_uint64(stats, 32, rt->backpressureTicks);
+    lean_ctor_set_uint64(stats, 40, atomic_load(&rt->totalLatencyTicks));
+    lean_ctor_set_uint64(stats, 48, atomic_load(&rt->maxLatencyTicks));
+    lean_ctor_set_uint64(stats, 56, atomic_load(&rt->executeTicks));
+    pthread_mutex_unlock(&rt->submitLock);
+    return lean_io_result_mk_ok(stats);
+}
@@ -0,0 +1,219 @@
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+
+#include "data_marshal.h"
+#include "opengl_ffi.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Sampler cache. Sampler descriptions are unpacked into a small C struct and looked up with
+// open addressing, so every material asking for the same filtering and wrapping shares one
+// GL sampler object.
+//
+
+/*
+structure SamplerDescription where
+  minFilter : GLTextureFilter
+  magFilter : GLTextureFilter
+  wrapS : GLTextureWrap
+  wrapT : GLTextureWrap
+  wrapR : GLTextureWrap
+  maxAnisotropy : Float
+  minLod : Float
+  maxLod : Float
+  lodBias : Float
+  depthCompare : Bool
+  compareFunc : GLCompareFunc
+
+no object fields; the four Floats come first, then the seven one byte fields in order
+*/
+typedef struct {
+    double maxAnisotropy;
+    double minLod;
+    double maxLod;
+    double lodBias;
+    uint8_t minFilter;
+    uint8_t magFilter;
+    uint8_t wrapS;
+    uint8_t wrapT;
+    uint8_t wrapR;
+    uint8_t depthCompare;
+    uint8_t compareFunc;
+} samplerDescription_t;
+
+static void unpackSamplerDescription(b_lean_obj_arg descriptionL, samplerDescription_t *description)
+{
+    // zeroed so the padding compares and hashes equal
+    memset(description, 0, sizeof(samplerDescription_t));
+    description->maxAnisotropy = lean_ctor_get_float(descriptionL, 0);
+    description->minLod = lean_ctor_get_float(descriptionL, 8);
+    description->maxLod = lean_ctor_get_float(descriptionL, 16);
+    description->lodBias = lean_ctor_get_float(descriptionL, 24);
+    description->minFilter = lean_ctor_get_uint8(descriptionL, 32);
+    description->magFilter = lean_ctor_get_uint8(descriptionL, 33);
+    description->wrapS = lean_ctor_get_uint8(descriptionL, 34);
+    description->wrapT = lean_ctor_get_uint8(descriptionL, 35);
+    description->wrapR = lean_ctor_get_uint8(descriptionL, 36);
+    description->depthCompare = lean_ctor_get_uint8(descriptionL, 37);
+    description->compareFunc = lean_ctor_get_uint8(descriptionL, 38);
+}
+
+// FNV-1a over the whole (zero padded) struct
+static uint64_t hashSamplerDescription(const samplerDescription_t *description)
+{
+    const uint8_t *bytes = (const uint8_t *)description;
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t ix=0; ix < sizeof(samplerDescription_t); ix++) {
+        hash ^= bytes[ix];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static GLuint createSampler(const samplerDescription_t *description)
+{
+    GLuint sampler;
+    glCreateSamplers(1, &sampler);
+    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, (GLint)convertTextureFilter(description->minFilter));
+    glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, (GLint)convertTextureFilter(description->magFilter));
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, (GLint)convertTextureWrap(description->wrapS));
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, (GLint)convertTextureWrap(description->wrapT));
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_R, (GLint)convertTextureWrap(description->wrapR));
+    glSamplerParameterf(sampler, GL_TEXTURE_MIN_LOD, (GLfloat)description->minLod);
+    glSamplerParameterf(sampler, GL_TEXTURE_MAX_LOD, (GLfloat)description->maxLod);
+    glSamplerParameterf(sampler, GL_TEXTURE_LOD_BIAS, (GLfloat)description->lodBias);
+    // setting 1.0 on a driver without anisotropic filtering would just raise an error
+    if (description->maxAnisotropy > 1.0) {
+        glSamplerParameterf(sampler, GL_TEXTURE_MAX_ANISOTROPY, (GLfloat)description->maxAnisotropy);
+    }
+    if (description->depthCompare) {
+        glSamplerParameteri(sampler, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glSamplerParameteri(sampler, GL_TEXTURE_COMPARE_FUNC, (GLint)convertCompareFunc(description->compareFunc));
+    }
+    return sampler;
+}
+
+typedef struct {
+    uint64_t hash;
+    samplerDescription_t description;
+    GLuint sampler;  // 0 for an empty slot
+} samplerCacheEntry_t;
+
+typedef struct {
+    samplerCacheEntry_t *entries;
+    uint32_t capacity;  // always a power of two
+    uint32_t count;
+    uint64_t hits;
+    uint64_t misses;
+} samplerCache_t;
+
+static void samplerCacheInsert(samplerCacheEntry_t *entries, uint32_t capacity, samplerCacheEntry_t entry)
+{
+    uint32_t slot = (uint32_t)entry.hash & (capacity - 1);
+    while (entries[slot].sampler != 0) {
+        slot = (slot + 1) & (capacity - 1);
+    }
+    entries[slot] = entry;
+}
+
+static void samplerCacheGrow(samplerCache_t *cache)
+{
+    uint32_t newCapacity = cache->capacity * 2;
+    samplerCacheEntry_t *newEntries = calloc(newCapacity, sizeof(samplerCacheEntry_t));
+    for (uint32_t ix=0; ix < cache->capacity; ix++) {
+        if (cache->entries[ix].sampler != 0) {
+            samplerCacheInsert(newEntries, newCapacity, cache->entries[ix]);
+        }
+    }
+    free(cache->entries);
+    cache->entries = newEntries;
+    cache->capacity = newCapacity;
+}
+
+// createSamplerCache : IO SamplerCache
+//
+lean_obj_res lean_samplercache_create()
+{
+    samplerCache_t *cache = calloc(1, sizeof(samplerCache_t));
+    cache->capacity = 16;
+    cache->entries = calloc(cache->capacity, sizeof(samplerCacheEntry_t));
+    return lean_io_result_mk_ok(lean_mk_ptr(cache));
+}
+
+// destroySamplerCache : SamplerCache → IO Unit
+//
+// deletes every sampler the cache created
+lean_obj_res lean_samplercache_destroy(lean_obj_arg lcache)
+{
+    samplerCache_t *cache = (samplerCache_t *)lean_get_external_data(lcache);
+    if (cache == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL cache passed to destroySamplerCache")));
+    }
+    for (uint32_t ix=0; ix < cache->capacity; ix++) {
+        if (cache->entries[ix].sampler != 0) {
+            glDeleteSamplers(1, &cache->entries[ix].sampler);
+        }
+    }
+    free(cache->entries);
+    free(cache);
+    lean_clear_ptr(lcache);
+    return lean_return_unit();
+}
+
+// getCachedSampler : SamplerCache → SamplerDescription → IO GLSamplerObject
+//
+lean_obj_res lean_samplercache_get(b_lean_obj_arg lcache, b_lean_obj_arg descriptionL)
+{
+    samplerCache_t *cache = (samplerCache_t *)lean_get_external_data(lcache);
+    if (cache == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL cache passed to getCachedSampler")));
+    }
+
+    samplerDescription_t description;
+    unpackSamplerDescription(descriptionL, &description);
+    uint64_t hash = hashSamplerDescription(&description);
+
+    uint32_t slot = (uint32_t)hash & (cache->capacity - 1);
+    while (cache->entries[slot].sampler != 0) {
+        samplerCacheEntry_t *entry = &cache->entries[slot];
+        if (entry->hash == hash && memcmp(&entry->description, &description, sizeof(samplerDescription_t)) == 0) {
+            cache->hits++;
+            return lean_io_result_mk_ok(lean_box_uint32(entry->sampler));
+        }
+        slot = (slot + 1) & (cache->capacity - 1);
+    }
+
+    // miss: create and configure a new sampler
+    cache->misses++;
+    samplerCacheEntry_t entry;
+    entry.hash = hash;
+    entry.description = description;
+    entry.sampler = createSampler(&description);
+
+    // keep the load factor under 1/2
+    if ((cache->count + 1) * 2 > cache->capacity) {
+        samplerCacheGrow(cache);
+    }
+    samplerCacheInsert(cache->entries, cache->capacity, entry);
+    cache->count++;
+
+    return lean_io_result_mk_ok(lean_box_uint32(entry.sampler));
+}
+
+// samplerCacheStats : SamplerCache → IO (UInt64 × UInt64)
+//
+// (hits, misses)
+lean_obj_res lean_samplercache_stats(b_lean_obj_arg lcache)
+{
+    samplerCache_t *cache = (samplerCache_t *)lean_get_external_data(lcache);
+    if (cache == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL cache passed to samplerCacheStats")));
+    }
+    lean_object* tuple = lean_alloc_ctor(0, 2, 0);
+    lean_ctor_set(tuple, 0, lean_box_uint64(cache->hits));
+    lean_ctor_set(tuple, 1, lean_box_uint64(cache->misses));
+    return lean_io_result_mk_ok(tuple);
+}
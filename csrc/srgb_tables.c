@@ -0,0 +1,31 @@
+#include "srgb_tables.h"
+
+#include <math.h>
+#include <pthread.h>
+
+static srgbTables_t tables;
+static pthread_once_t tablesOnce = PTHREAD_ONCE_INIT;
+
+static void buildSrgbTables(void)
+{
+    for (int i=0; i < 256; i++) {
+        float c = (float)i / 255.0f;
+        float l = c <= 0.04045f ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+        float s = c <= 0.0031308f ? c * 12.92f : 1.055f * powf(c, 1.0f / 2.4f) - 0.055f;
+        tables.srgbToLinear[i] = l;
+        tables.srgbToLinear8[i] = (uint8_t)(l * 255.0f + 0.5f);
+        tables.linearToSrgb8[i] = (uint8_t)(s * 255.0f + 0.5f);
+    }
+    for (int i=0; i < LINEAR_TO_SRGB_ENTRIES; i++) {
+        float l = ((float)i + 0.5f) / (float)LINEAR_TO_SRGB_ENTRIES;
+        float c = l <= 0.0031308f ? l * 12.92f : 1.055f * powf(l, 1.0f / 2.4f) - 0.055f;
+        tables.linearToSrgb[i] = (uint8_t)(c * 255.0f + 0.5f);
+    }
+}
+
+// pthread_once orders the table stores before any caller's reads
+const srgbTables_t *getSrgbTables(void)
+{
+    pthread_once(&tablesOnce, buildSrgbTables);
+    return &tables;
+}
@@ -0,0 +1,465 @@
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+
+#include "data_marshal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Runtime texture atlas for small images (icons, glyphs). Images are packed into the layers of
+// one RGBA8 2D array texture with a bottom-left skyline packer and uploaded as they arrive, so
+// everything in the atlas can be drawn with a single texture binding.
+//
+// Removing an image only marks its space dead; the skyline can't reuse holes. When an add
+// doesn't fit and there is dead space, the atlas is repacked from the CPU copies it keeps of
+// every live image, which moves images around: callers re-query their regions whenever
+// atlasGeneration changes.
+//
+
+typedef struct {
+    uint32_t x, y, width;
+} skylineNode_t;
+
+typedef struct {
+    skylineNode_t *nodes;
+    uint32_t count;
+    uint32_t capacity;
+} skyline_t;
+
+typedef struct {
+    uint32_t layer, x, y;
+    uint32_t width, height;
+    uint8_t *pixels;  // CPU copy for repacking, NULL once removed
+} atlasEntry_t;
+
+typedef struct {
+    GLuint texture;
+    uint32_t size;      // width and height of each layer
+    uint32_t layers;
+    uint32_t padding;   // empty texels kept right of and below each image
+    skyline_t *skylines;
+    atlasEntry_t *entries;
+    uint32_t entryCount;
+    uint32_t entryCapacity;
+    uint32_t *freeIds;  // ids of removed entries, reused by later adds
+    uint32_t freeIdCount;
+    uint64_t liveArea;
+    uint64_t deadArea;
+    uint64_t generation;
+    uint64_t repacks;
+    uint64_t bytesUploaded;
+} textureAtlas_t;
+
+static void resetSkyline(skyline_t *skyline, uint32_t size)
+{
+    skyline->count = 1;
+    skyline->nodes[0].x = 0;
+    skyline->nodes[0].y = 0;
+    skyline->nodes[0].width = size;
+}
+
+// lowest y at which a width w rectangle can sit when its left edge is at node `index`,
+// or UINT32_MAX if it runs off the right edge
+static uint32_t skylineFitY(const skyline_t *skyline, uint32_t index, uint32_t w, uint32_t size)
+{
+    uint32_t x = skyline->nodes[index].x;
+    if (x + w > size) {
+        return UINT32_MAX;
+    }
+    uint32_t y = 0;
+    uint32_t remaining = w;
+    for (uint32_t ix=index; remaining > 0; ix++) {
+        if (skyline->nodes[ix].y > y) {
+            y = skyline->nodes[ix].y;
+        }
+        remaining = skyline->nodes[ix].width >= remaining ? 0 : remaining - skyline->nodes[ix].width;
+    }
+    return y;
+}
+
+// bottom-left rule: lowest top edge, then the narrowest node. Returns the node index or -1.
+static int skylineFind(const skyline_t *skyline, uint32_t w, uint32_t h, uint32_t size, uint32_t *outY)
+{
+    int best = -1;
+    uint32_t bestTop = UINT32_MAX, bestWidth = UINT32_MAX;
+    for (uint32_t ix=0; ix < skyline->count; ix++) {
+        uint32_t y = skylineFitY(skyline, ix, w, size);
+        if (y == UINT32_MAX || y + h > size) {
+            continue;
+        }
+        if (y + h < bestTop || (y + h == bestTop && skyline->nodes[ix].width < bestWidth)) {
+            best = (int)ix;
+            bestTop = y + h;
+            bestWidth = skyline->nodes[ix].width;
+            *outY = y;
+        }
+    }
+    return best;
+}
+
+static void skylineInsert(skyline_t *skyline, uint32_t index, uint32_t w, uint32_t h, uint32_t y)
+{
+    if (skyline->count + 1 > skyline->capacity) {
+        skyline->capacity *= 2;
+        skyline->nodes = realloc(skyline->nodes, sizeof(skylineNode_t) * skyline->capacity);
+    }
+    skylineNode_t node = { skyline->nodes[index].x, y + h, w };
+    memmove(&skyline->nodes[index + 1], &skyline->nodes[index], sizeof(skylineNode_t) * (skyline->count - index));
+    skyline->nodes[index] = node;
+    skyline->count++;
+
+    // trim or drop the nodes now covered by the new one
+    uint32_t right = node.x + node.width;
+    uint32_t ix = index + 1;
+    while (ix < skyline->count && skyline->nodes[ix].x < right) {
+        uint32_t nodeRight = skyline->nodes[ix].x + skyline->nodes[ix].width;
+        if (nodeRight <= right) {
+            memmove(&skyline->nodes[ix], &skyline->nodes[ix + 1], sizeof(skylineNode_t) * (skyline->count - ix - 1));
+            skyline->count--;
+        }
+        else {
+            skyline->nodes[ix].width = nodeRight - right;
+            skyline->nodes[ix].x = right;
+            break;
+        }
+    }
+
+    // merge neighbours at the same height
+    for (ix=0; ix + 1 < skyline->count; ) {
+        if (skyline->nodes[ix].y == skyline->nodes[ix + 1].y) {
+            skyline->nodes[ix].width += skyline->nodes[ix + 1].width;
+            memmove(&skyline->nodes[ix + 1], &skyline->nodes[ix + 2], sizeof(skylineNode_t) * (skyline->count - ix - 2));
+            skyline->count--;
+        }
+        else {
+            ix++;
+        }
+    }
+}
+
+// finds space for an entry in any layer and records its position
+static int atlasPlace(textureAtlas_t *atlas, atlasEntry_t *entry)
+{
+    uint32_t w = entry->width + atlas->padding, h = entry->height + atlas->padding;
+    // images that fill a layer edge to edge don't need padding on that side
+    if (w > atlas->size) w = atlas->size;
+    if (h > atlas->size) h = atlas->size;
+    for (uint32_t layer=0; layer < atlas->layers; layer++) {
+        uint32_t y;
+        int node = skylineFind(&atlas->skylines[layer], w, h, atlas->size, &y);
+        if (node >= 0) {
+            entry->layer = layer;
+            entry->x = atlas->skylines[layer].nodes[node].x;
+            entry->y = y;
+            skylineInsert(&atlas->skylines[layer], (uint32_t)node, w, h, y);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void atlasUpload(textureAtlas_t *atlas, const atlasEntry_t *entry)
+{
+    glTextureSubImage3D(atlas->texture, 0, (GLint)entry->x, (GLint)entry->y, (GLint)entry->layer,
+        (GLsizei)entry->width, (GLsizei)entry->height, 1, GL_RGBA, GL_UNSIGNED_BYTE, entry->pixels);
+    atlas->bytesUploaded += (uint64_t)entry->width * entry->height * 4;
+}
+
+typedef struct {
+    uint32_t height, width, id;
+} packOrder_t;
+
+// tallest first, then widest, gives the skyline its tightest packing
+static int comparePackOrder(const void *a, const void *b)
+{
+    const packOrder_t *oa = (const packOrder_t *)a, *ob = (const packOrder_t *)b;
+    if (oa->height != ob->height) return oa->height > ob->height ? -1 : 1;
+    if (oa->width != ob->width) return oa->width > ob->width ? -1 : 1;
+    return oa->id < ob->id ? -1 : (oa->id > ob->id);
+}
+
+// re-places every live image from scratch and uploads them all again. Returns 0 (leaving the
+// old layout in place) if the live images no longer fit.
+static int atlasRepack(textureAtlas_t *atlas)
+{
+    packOrder_t *order = malloc(sizeof(packOrder_t) * (atlas->entryCount + 1));
+    atlasEntry_t *placed = malloc(sizeof(atlasEntry_t) * (atlas->entryCount + 1));
+    skyline_t *saved = malloc(sizeof(skyline_t) * atlas->layers);
+    uint32_t liveCount = 0;
+    for (uint32_t ix=0; ix < atlas->entryCount; ix++) {
+        if (atlas->entries[ix].pixels) {
+            packOrder_t item = { atlas->entries[ix].height, atlas->entries[ix].width, ix };
+            order[liveCount++] = item;
+        }
+    }
+    qsort(order, liveCount, sizeof(packOrder_t), comparePackOrder);
+
+    // pack into fresh skylines, keeping the old ones in case it fails
+    for (uint32_t layer=0; layer < atlas->layers; layer++) {
+        saved[layer] = atlas->skylines[layer];
+        atlas->skylines[layer].capacity = 16;
+        atlas->skylines[layer].nodes = malloc(sizeof(skylineNode_t) * 16);
+        resetSkyline(&atlas->skylines[layer], atlas->size);
+    }
+    int fits = 1;
+    memcpy(placed, atlas->entries, sizeof(atlasEntry_t) * atlas->entryCount);
+    for (uint32_t ix=0; ix < liveCount && fits; ix++) {
+        fits = atlasPlace(atlas, &placed[order[ix].id]);
+    }
+
+    skyline_t *discard = fits ? saved : atlas->skylines;
+    for (uint32_t layer=0; layer < atlas->layers; layer++) {
+        free(discard[layer].nodes);
+        if (!fits) {
+            atlas->skylines[layer] = saved[layer];
+        }
+    }
+    if (fits) {
+        memcpy(atlas->entries, placed, sizeof(atlasEntry_t) * atlas->entryCount);
+        uint8_t zero[4] = { 0, 0, 0, 0 };
+        glClearTexImage(atlas->texture, 0, GL_RGBA, GL_UNSIGNED_BYTE, zero);
+        for (uint32_t ix=0; ix < liveCount; ix++) {
+            atlasUpload(atlas, &atlas->entries[order[ix].id]);
+        }
+        atlas->deadArea = 0;
+        atlas->generation++;
+        atlas->repacks++;
+    }
+    free(saved);
+    free(placed);
+    free(order);
+    return fits;
+}
+
+/*
+structure AtlasRegion where
+  u0 : Float
+  v0 : Float
+  u1 : Float
+  v1 : Float
+  id : UInt32
+  layer : UInt32
+*/
+static lean_object *mkAtlasRegion(const textureAtlas_t *atlas, uint32_t id)
+{
+    const atlasEntry_t *entry = &atlas->entries[id];
+    double scale = 1.0 / (double)atlas->size;
+    lean_object *region = lean_alloc_ctor(0, 0, 4 * 8 + 2 * 4);
+    lean_ctor_set_float(region, 0, entry->x * scale);
+    lean_ctor_set_float(region, 8, entry->y * scale);
+    lean_ctor_set_float(region, 16, (entry->x + entry->width) * scale);
+    lean_ctor_set_float(region, 24, (entry->y + entry->height) * scale);
+    lean_ctor_set_uint32(region, 32, id);
+    lean_ctor_set_uint32(region, 36, entry->layer);
+    return region;
+}
+
+static lean_obj_res atlasError(const char *message)
+{
+    return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string(message)));
+}
+
+// createTextureAtlas : (size : UInt32) → (layers : UInt32) → (padding : UInt32) → IO TextureAtlas
+//
+lean_obj_res lean_textureatlas_create(uint32_t size, uint32_t layers, uint32_t padding)
+{
+    if (size == 0 || layers == 0) {
+        return atlasError("createTextureAtlas needs a non-zero size and layer count");
+    }
+    textureAtlas_t *atlas = calloc(1, sizeof(textureAtlas_t));
+    atlas->size = size;
+    atlas->layers = layers;
+    atlas->padding = padding;
+    atlas->skylines = calloc(layers, sizeof(skyline_t));
+    for (uint32_t layer=0; layer < layers; layer++) {
+        atlas->skylines[layer].capacity = 16;
+        atlas->skylines[layer].nodes = malloc(sizeof(skylineNode_t) * 16);
+        resetSkyline(&atlas->skylines[layer], size);
+    }
+    atlas->entryCapacity = 64;
+    atlas->entries = calloc(atlas->entryCapacity, sizeof(atlasEntry_t));
+    atlas->freeIds = malloc(sizeof(uint32_t) * atlas->entryCapacity);
+
+    glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &atlas->texture);
+    glTextureStorage3D(atlas->texture, 1, GL_RGBA8, (GLsizei)size, (GLsizei)size, (GLsizei)layers);
+    glTextureParameteri(atlas->texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTextureParameteri(atlas->texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTextureParameteri(atlas->texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTextureParameteri(atlas->texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    uint8_t zero[4] = { 0, 0, 0, 0 };
+    glClearTexImage(atlas->texture, 0, GL_RGBA, GL_UNSIGNED_BYTE, zero);
+    return lean_io_result_mk_ok(lean_mk_ptr(atlas));
+}
+
+// destroyTextureAtlas : TextureAtlas → IO Unit
+//
+lean_obj_res lean_textureatlas_destroy(lean_obj_arg latlas)
+{
+    textureAtlas_t *atlas = (textureAtlas_t *)lean_get_external_data(latlas);
+    if (atlas == NULL) {
+        return atlasError("NULL atlas passed to destroyTextureAtlas");
+    }
+    glDeleteTextures(1, &atlas->texture);
+    for (uint32_t layer=0; layer < atlas->layers; layer++) {
+        free(atlas->skylines[layer].nodes);
+    }
+    for (uint32_t ix=0; ix < atlas->entryCount; ix++) {
+        free(atlas->entries[ix].pixels);
+    }
+    free(atlas->skylines);
+    free(atlas->entries);
+    free(atlas->freeIds);
+    free(atlas);
+    lean_clear_ptr(latlas);
+    return lean_return_unit();
+}
+
+// atlasTexture : TextureAtlas → GLTextureObject
+//
+uint32_t lean_textureatlas_texture(b_lean_obj_arg latlas)
+{
+    textureAtlas_t *atlas = (textureAtlas_t *)lean_get_external_data(latlas);
+    return atlas != NULL ? atlas->texture : 0;
+}
+
+// atlasAdd : TextureAtlas → (width : UInt32) → (height : UInt32) → ByteArray → IO (Option AtlasRegion)
+//
+// none when the image doesn't fit even after repacking
+lean_obj_res lean_textureatlas_add(b_lean_obj_arg latlas, uint32_t width, uint32_t height, b_lean_obj_arg pixels)
+{
+    textureAtlas_t *atlas = (textureAtlas_t *)lean_get_external_data(latlas);
+    if (atlas == NULL) {
+        return atlasError("NULL atlas passed to atlasAdd");
+    }
+    if (width == 0 || height == 0) {
+        return atlasError("atlasAdd: empty image");
+    }
+    size_t bytes = (size_t)width * height * 4;
+    if (lean_sarray_size(pixels) < bytes) {
+        return atlasError("atlasAdd: pixel data is smaller than width * height * 4");
+    }
+    if (width > atlas->size || height > atlas->size) {
+        return lean_io_result_mk_ok(lean_box(0));
+    }
+
+    atlasEntry_t entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.width = width;
+    entry.height = height;
+    if (!atlasPlace(atlas, &entry)) {
+        if (atlas->deadArea == 0 || !atlasRepack(atlas) || !atlasPlace(atlas, &entry)) {
+            return lean_io_result_mk_ok(lean_box(0));
+        }
+    }
+    entry.pixels = malloc(bytes);
+    memcpy(entry.pixels, lean_sarray_cptr(pixels), bytes);
+
+    uint32_t id;
+    if (atlas->freeIdCount > 0) {
+        id = atlas->freeIds[--atlas->freeIdCount];
+    }
+    else {
+        if (atlas->entryCount == atlas->entryCapacity) {
+            atlas->entryCapacity *= 2;
+            atlas->entries = realloc(atlas->entries, sizeof(atlasEntry_t) * atlas->entryCapacity);
+            atlas->freeIds = realloc(atlas->freeIds, sizeof(uint32_t) * atlas->entryCapacity);
+        }
+        id = atlas->entryCount++;
+    }
+    atlas->entries[id] = entry;
+    atlas->liveArea += (uint64_t)width * height;
+    atlasUpload(atlas, &atlas->entries[id]);
+
+    lean_object *some = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(some, 0, mkAtlasRegion(atlas, id));
+    return lean_io_result_mk_ok(some);
+}
+
+// atlasRemove : TextureAtlas → (id : UInt32) → IO Unit
+//
+lean_obj_res lean_textureatlas_remove(b_lean_obj_arg latlas, uint32_t id)
+{
+    textureAtlas_t *atlas = (textureAtlas_t *)lean_get_external_data(latlas);
+    if (atlas == NULL) {
+        return atlasError("NULL atlas passed to atlasRemove");
+    }
+    if (id >= atlas->entryCount || atlas->entries[id].pixels == NULL) {
+        return atlasError("atlasRemove: unknown atlas id");
+    }
+    atlasEntry_t *entry = &atlas->entries[id];
+    free(entry->pixels);
+    entry->pixels = NULL;
+    atlas->liveArea -= (uint64_t)entry->width * entry->height;
+    atlas->deadArea += (uint64_t)entry->width * entry->height;
+    atlas->freeIds[atlas->freeIdCount++] = id;
+    return lean_return_unit();
+}
+
+// atlasRegion : TextureAtlas → (id : UInt32) → IO AtlasRegion
+//
+lean_obj_res lean_textureatlas_region(b_lean_obj_arg latlas, uint32_t id)
+{
+    textureAtlas_t *atlas = (textureAtlas_t *)lean_get_external_data(latlas);
+    if (atlas == NULL) {
+        return atlasError("NULL atlas passed to atlasRegion");
+    }
+    if (id >= atlas->entryCount || atlas->entries[id].pixels == NULL) {
+        return atlasError("atlasRegion: unknown atlas id");
+    }
+    return lean_io_result_mk_ok(mkAtlasRegion(atlas, id));
+}
+
+// atlasRepack : TextureAtlas → IO Bool
+//
+lean_obj_res lean_textureatlas_repack(b_lean_obj_arg latlas)
+{
+    textureAtlas_t *atlas = (textureAtlas_t *)lean_get_external_data(latlas);
+    if (atlas == NULL) {
+        return atlasError("NULL atlas passed to atlasRepack");
+    }
+    return lean_io_result_mk_ok(lean_box(atlasRepack(atlas)));
+}
+
+// atlasGeneration : TextureAtlas → IO UInt64
+//
+lean_obj_res lean_textureatlas_generation(b_lean_obj_arg latlas)
+{
+    textureAtlas_t *atlas = (textureAtlas_t *)lean_get_external_data(latlas);
+    if (atlas == NULL) {
+        return atlasError("NULL atlas passed to atlasGeneration");
+    }
+    return lean_io_result_mk_ok(lean_box_uint64(atlas->generation));
+}
+
+/*
+structure TextureAtlasStats where
+  liveImages : UInt64
+  liveTexels : UInt64
+  deadTexels : UInt64
+  repacks : UInt64
+  bytesUploaded : UInt64
+  occupancy : Float
+*/
+
+// textureAtlasStats : TextureAtlas → IO TextureAtlasStats
+//
+lean_obj_res lean_textureatlas_stats(b_lean_obj_arg latlas)
+{
+    textureAtlas_t *atlas = (textureAtlas_t *)lean_get_external_data(latlas);
+    if (atlas == NULL) {
+        return atlasError("NULL atlas passed to textureAtlasStats");
+    }
+    uint64_t liveImages = atlas->entryCount - atlas->freeIdCount;
+    double capacity = (double)atlas->size * atlas->size * atlas->layers;
+
+    lean_object *stats = lean_alloc_ctor(0, 0, 6 * 8);
+    lean_ctor_set_uint64(stats, 0, liveImages);
+    lean_ctor_set_uint64(stats, 8, atlas->liveArea);
+    lean_ctor_set_uint64(stats, 16, atlas->deadArea);
+    lean_ctor_set_uint64(stats, 24, atlas->repacks);
+    lean_ctor_set_uint64(stats, 32, atlas->bytesUploaded);
+    lean_ctor_set_float(stats, 40, (double)atlas->liveArea / capacity);
+    return lean_io_result_mk_ok(stats);
+}
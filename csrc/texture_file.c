@@ -0,0 +1,503 @@
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+
+#include "data_marshal.h"
+#include "opengl_ffi.h"
+
+#include <stdio.h>
+#include <string.h>
+
+//
+// KTX2 and DDS texture loading. The file is memory mapped and every mip level is handed to
+// glCompressedTextureSubImage* straight from the mapping, so the only copy is the one the
+// driver makes. Supports BC1-BC7 plus RGBA8/sRGB8_A8/RGBA16F, 2D, 3D, array and cube textures.
+// Supercompressed (zstd/basis) KTX2 files are rejected.
+//
+
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+} mappedFile_t;
+
+static int mapFile(const char *path, mappedFile_t *mapped)
+{
+#ifdef _WIN32
+    mapped->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (mapped->file == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(mapped->file, &size) || size.QuadPart == 0) {
+        CloseHandle(mapped->file);
+        return 0;
+    }
+    mapped->mapping = CreateFileMappingA(mapped->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapped->mapping == NULL) {
+        CloseHandle(mapped->file);
+        return 0;
+    }
+    mapped->data = (const uint8_t *)MapViewOfFile(mapped->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (mapped->data == NULL) {
+        CloseHandle(mapped->mapping);
+        CloseHandle(mapped->file);
+        return 0;
+    }
+    mapped->size = (size_t)size.QuadPart;
+    return 1;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return 0;
+    }
+    void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return 0;
+    }
+    // levels are read front to back exactly once
+    madvise(data, (size_t)info.st_size, MADV_SEQUENTIAL);
+    mapped->data = (const uint8_t *)data;
+    mapped->size = (size_t)info.st_size;
+    return 1;
+#endif
+}
+
+static void unmapFile(mappedFile_t *mapped)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(mapped->data);
+    CloseHandle(mapped->mapping);
+    CloseHandle(mapped->file);
+#else
+    munmap((void *)mapped->data, mapped->size);
+#endif
+}
+
+typedef struct {
+    uint8_t leanFormat;   // GLSizedTextureFormat tag
+    uint32_t vkFormat;    // KTX2
+    uint32_t dxgiFormat;  // DDS DX10 header, 0 if there is no equivalent
+    uint8_t blockBytes;   // bytes per 4x4 block, 0 for uncompressed formats
+    uint8_t pixelBytes;
+    GLenum pixelType;     // uncompressed upload type
+} textureFileFormat_t;
+
+static const textureFileFormat_t fileFormats[] = {
+    {  3,  37, 28, 0, 4, GL_UNSIGNED_BYTE },  // RGBA8
+    {  6,  43, 29, 0, 4, GL_UNSIGNED_BYTE },  // SRGB8Alpha8
+    {  7,  97, 10, 0, 8, GL_HALF_FLOAT },     // RGBA16F
+    {  8, 131,  0, 8, 0, 0 },                 // BC1RGB
+    {  9, 133, 71, 8, 0, 0 },                 // BC1RGBA
+    { 10, 132,  0, 8, 0, 0 },                 // BC1SRGB
+    { 11, 134, 72, 8, 0, 0 },                 // BC1SRGBAlpha
+    { 12, 135, 74, 16, 0, 0 },                // BC2
+    { 13, 136, 75, 16, 0, 0 },                // BC2SRGB
+    { 14, 137, 77, 16, 0, 0 },                // BC3
+    { 15, 138, 78, 16, 0, 0 },                // BC3SRGB
+    { 16, 139, 80, 8, 0, 0 },                 // BC4
+    { 17, 140, 81, 8, 0, 0 },                 // BC4Signed
+    { 18, 141, 83, 16, 0, 0 },                // BC5
+    { 19, 142, 84, 16, 0, 0 },                // BC5Signed
+    { 20, 143, 95, 16, 0, 0 },                // BC6HUnsignedFloat
+    { 21, 144, 96, 16, 0, 0 },                // BC6HSignedFloat
+    { 22, 145, 98, 16, 0, 0 },                // BC7
+    { 23, 146, 99, 16, 0, 0 },                // BC7SRGB
+};
+#define FILE_FORMAT_COUNT (sizeof(fileFormats) / sizeof(fileFormats[0]))
+
+static const textureFileFormat_t *formatFromLean(uint8_t leanFormat)
+{
+    for (size_t ix=0; ix < FILE_FORMAT_COUNT; ix++) {
+        if (fileFormats[ix].leanFormat == leanFormat) return &fileFormats[ix];
+    }
+    return NULL;
+}
+
+static const textureFileFormat_t *formatFromVk(uint32_t vkFormat)
+{
+    for (size_t ix=0; ix < FILE_FORMAT_COUNT; ix++) {
+        if (fileFormats[ix].vkFormat == vkFormat) return &fileFormats[ix];
+    }
+    return NULL;
+}
+
+static const textureFileFormat_t *formatFromDXGI(uint32_t dxgiFormat)
+{
+    for (size_t ix=0; ix < FILE_FORMAT_COUNT; ix++) {
+        if (dxgiFormat != 0 && fileFormats[ix].dxgiFormat == dxgiFormat) return &fileFormats[ix];
+    }
+    return NULL;
+}
+
+// size of one 2D image (one layer, face or z slice) of a mip level
+static size_t sliceBytes(const textureFileFormat_t *format, uint32_t width, uint32_t height)
+{
+    if (format->blockBytes) {
+        return (size_t)((width + 3) / 4) * ((height + 3) / 4) * format->blockBytes;
+    }
+    return (size_t)width * height * format->pixelBytes;
+}
+
+static uint32_t mipSize(uint32_t size, uint32_t level)
+{
+    uint32_t s = size >> level;
+    return s ? s : 1;
+}
+
+typedef struct {
+    const textureFileFormat_t *format;
+    uint32_t width, height, depth;
+    uint32_t layers, faces, levels;
+    GLenum target;
+    uint8_t leanTarget;
+    GLuint texture;
+} textureFileInfo_t;
+
+// far beyond any GL implementation's limits, keeps the size arithmetic from overflowing
+#define MAX_FILE_DIMENSION 65536
+#define MAX_FILE_LAYERS 4096
+
+static int dimensionsInRange(const textureFileInfo_t *info)
+{
+    return info->width <= MAX_FILE_DIMENSION && info->height <= MAX_FILE_DIMENSION &&
+           info->depth <= MAX_FILE_DIMENSION && info->layers <= MAX_FILE_LAYERS &&
+           (info->faces == 1 || info->faces == 6);
+}
+
+static uint32_t readU32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t readU64(const uint8_t *p)
+{
+    return (uint64_t)readU32(p) | ((uint64_t)readU32(p + 4) << 32);
+}
+
+// picks the texture target and allocates immutable storage for the whole chain
+static const char *createStorage(textureFileInfo_t *info)
+{
+    if (info->width == 0 || info->height == 0 || info->levels == 0 || info->layers == 0) {
+        return "texture has a zero dimension";
+    }
+    uint32_t largest = info->width > info->height ? info->width : info->height;
+    if (info->depth > largest) largest = info->depth;
+    uint32_t maxLevels = 1;
+    while ((largest >> maxLevels) > 0) maxLevels++;
+    if (info->levels > maxLevels) {
+        return "texture has more mip levels than its size allows";
+    }
+    if (info->depth > 1 && (info->layers > 1 || info->faces > 1)) {
+        return "3D array and 3D cube textures are not supported";
+    }
+
+    // BC4-BC7 are core, BC1-BC3 (S3TC) only come with the extension
+    if (info->format->leanFormat >= 8 && info->format->leanFormat <= 15 && !GLAD_GL_EXT_texture_compression_s3tc) {
+        return "the driver does not support S3TC (BC1-BC3) textures";
+    }
+
+    GLenum internalFormat = convertSizedTextureFormat(info->format->leanFormat);
+    if (info->depth > 1) {
+        info->target = GL_TEXTURE_3D;
+        info->leanTarget = 2;
+    }
+    else if (info->faces == 6) {
+        info->target = info->layers > 1 ? GL_TEXTURE_CUBE_MAP_ARRAY : GL_TEXTURE_CUBE_MAP;
+        info->leanTarget = info->layers > 1 ? 6 : 5;
+    }
+    else if (info->layers > 1) {
+        info->target = GL_TEXTURE_2D_ARRAY;
+        info->leanTarget = 4;
+    }
+    else {
+        info->target = GL_TEXTURE_2D;
+        info->leanTarget = 1;
+    }
+
+    glCreateTextures(info->target, 1, &info->texture);
+    switch (info->target) {
+        case GL_TEXTURE_2D:
+        case GL_TEXTURE_CUBE_MAP:
+            glTextureStorage2D(info->texture, (GLsizei)info->levels, internalFormat, (GLsizei)info->width, (GLsizei)info->height);
+            break;
+        case GL_TEXTURE_3D:
+            glTextureStorage3D(info->texture, (GLsizei)info->levels, internalFormat, (GLsizei)info->width, (GLsizei)info->height, (GLsizei)info->depth);
+            break;
+        default:
+            glTextureStorage3D(info->texture, (GLsizei)info->levels, internalFormat, (GLsizei)info->width, (GLsizei)info->height, (GLsizei)(info->layers * info->faces));
+            break;
+    }
+    return NULL;
+}
+
+// uploads `count` consecutive slices (layers/faces, or z slices of a 3D texture) of one level
+static void uploadSlices(const textureFileInfo_t *info, uint32_t level, uint32_t zoffset, uint32_t count, const uint8_t *data)
+{
+    const textureFileFormat_t *format = info->format;
+    GLsizei width = (GLsizei)mipSize(info->width, level);
+    GLsizei height = (GLsizei)mipSize(info->height, level);
+    GLenum internalFormat = convertSizedTextureFormat(format->leanFormat);
+    GLsizei bytes = (GLsizei)(sliceBytes(format, (uint32_t)width, (uint32_t)height) * count);
+
+    if (info->target == GL_TEXTURE_2D) {
+        if (format->blockBytes) {
+            glCompressedTextureSubImage2D(info->texture, (GLint)level, 0, 0, width, height, internalFormat, bytes, data);
+        }
+        else {
+            glTextureSubImage2D(info->texture, (GLint)level, 0, 0, width, height, GL_RGBA, format->pixelType, data);
+        }
+    }
+    else {
+        if (format->blockBytes) {
+            glCompressedTextureSubImage3D(info->texture, (GLint)level, 0, 0, (GLint)zoffset, width, height, (GLsizei)count, internalFormat, bytes, data);
+        }
+        else {
+            glTextureSubImage3D(info->texture, (GLint)level, 0, 0, (GLint)zoffset, width, height, (GLsizei)count, GL_RGBA, format->pixelType, data);
+        }
+    }
+}
+
+static const uint8_t ktx2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+#define KTX2_HEADER_BYTES 80
+#define KTX2_LEVEL_ENTRY_BYTES 24
+
+static const char *loadKTX2(const mappedFile_t *file, textureFileInfo_t *info)
+{
+    const uint8_t *data = file->data;
+    if (file->size < KTX2_HEADER_BYTES) {
+        return "truncated KTX2 header";
+    }
+    info->format = formatFromVk(readU32(data + 12));
+    if (info->format == NULL) {
+        return "unsupported KTX2 vkFormat";
+    }
+    info->width = readU32(data + 20);
+    info->height = readU32(data + 24);
+    info->depth = readU32(data + 28);
+    info->layers = readU32(data + 32);
+    info->faces = readU32(data + 36);
+    info->levels = readU32(data + 40);
+    if (readU32(data + 44) != 0) {
+        return "supercompressed KTX2 files are not supported";
+    }
+    // zero means "not an array" / "2D" / "1D" / "generate the mips" in KTX2
+    if (info->height == 0) info->height = 1;
+    if (info->depth == 0) info->depth = 1;
+    if (info->layers == 0) info->layers = 1;
+    if (info->levels == 0) info->levels = 1;
+
+    if (!dimensionsInRange(info)) {
+        return "KTX2 dimensions are out of range";
+    }
+    if (info->levels > 32 || file->size < KTX2_HEADER_BYTES + (size_t)info->levels * KTX2_LEVEL_ENTRY_BYTES) {
+        return "truncated KTX2 level index";
+    }
+    // check every level range before creating anything
+    for (uint32_t level=0; level < info->levels; level++) {
+        const uint8_t *entry = data + KTX2_HEADER_BYTES + level * KTX2_LEVEL_ENTRY_BYTES;
+        uint64_t offset = readU64(entry);
+        uint64_t length = readU64(entry + 8);
+        uint32_t slices = info->depth > 1 ? mipSize(info->depth, level) : info->layers * info->faces;
+        size_t needed = sliceBytes(info->format, mipSize(info->width, level), mipSize(info->height, level)) * slices;
+        if (offset > file->size || length > file->size - offset || length < needed) {
+            return "KTX2 level data is out of range";
+        }
+    }
+
+    const char *error = createStorage(info);
+    if (error) {
+        return error;
+    }
+    // each level holds all of its layers/faces (or z slices) contiguously
+    for (uint32_t level=0; level < info->levels; level++) {
+        const uint8_t *entry = data + KTX2_HEADER_BYTES + level * KTX2_LEVEL_ENTRY_BYTES;
+        uint32_t slices = info->depth > 1 ? mipSize(info->depth, level) : info->layers * info->faces;
+        uploadSlices(info, level, 0, slices, data + readU64(entry));
+    }
+    return NULL;
+}
+
+#define DDS_HEADER_BYTES 128
+#define DDS_DX10_HEADER_BYTES 20
+#define DDS_FOURCC(a,b,c,d) ((uint32_t)(a) | ((uint32_t)(b) << 8) | ((uint32_t)(c) << 16) | ((uint32_t)(d) << 24))
+#define DDPF_FOURCC 0x4
+#define DDPF_RGB 0x40
+#define DDSCAPS2_CUBEMAP 0x200
+#define DDSCAPS2_VOLUME 0x200000
+#define DDS_RESOURCE_MISC_TEXTURECUBE 0x4
+#define DDS_DIMENSION_TEXTURE3D 4
+
+static const char *loadDDS(const mappedFile_t *file, textureFileInfo_t *info)
+{
+    const uint8_t *data = file->data;
+    if (file->size < DDS_HEADER_BYTES) {
+        return "truncated DDS header";
+    }
+    info->height = readU32(data + 12);
+    info->width = readU32(data + 16);
+    info->depth = 1;
+    info->levels = readU32(data + 28);
+    if (info->levels == 0) info->levels = 1;
+    info->layers = 1;
+    info->faces = 1;
+    uint32_t caps2 = readU32(data + 112);
+    if (caps2 & DDSCAPS2_VOLUME) {
+        info->depth = readU32(data + 24);
+    }
+    if (caps2 & DDSCAPS2_CUBEMAP) {
+        info->faces = 6;
+    }
+
+    uint32_t pixelFlags = readU32(data + 80);
+    uint32_t fourCC = readU32(data + 84);
+    size_t dataOffset = DDS_HEADER_BYTES;
+    info->format = NULL;
+    if ((pixelFlags & DDPF_FOURCC) && fourCC == DDS_FOURCC('D','X','1','0')) {
+        if (file->size < DDS_HEADER_BYTES + DDS_DX10_HEADER_BYTES) {
+            return "truncated DDS DX10 header";
+        }
+        info->format = formatFromDXGI(readU32(data + 128));
+        uint32_t dimension = readU32(data + 132);
+        uint32_t miscFlag = readU32(data + 136);
+        uint32_t arraySize = readU32(data + 140);
+        info->layers = arraySize ? arraySize : 1;
+        info->faces = (miscFlag & DDS_RESOURCE_MISC_TEXTURECUBE) ? 6 : 1;
+        if (dimension != DDS_DIMENSION_TEXTURE3D) {
+            info->depth = 1;
+        }
+        dataOffset += DDS_DX10_HEADER_BYTES;
+    }
+    else if (pixelFlags & DDPF_FOURCC) {
+        uint8_t leanFormat = 0xFF;
+        switch (fourCC) {
+            case DDS_FOURCC('D','X','T','1'): leanFormat = 9; break;
+            case DDS_FOURCC('D','X','T','3'): leanFormat = 12; break;
+            case DDS_FOURCC('D','X','T','5'): leanFormat = 14; break;
+            case DDS_FOURCC('A','T','I','1'):
+            case DDS_FOURCC('B','C','4','U'): leanFormat = 16; break;
+            case DDS_FOURCC('B','C','4','S'): leanFormat = 17; break;
+            case DDS_FOURCC('A','T','I','2'):
+            case DDS_FOURCC('B','C','5','U'): leanFormat = 18; break;
+            case DDS_FOURCC('B','C','5','S'): leanFormat = 19; break;
+        }
+        info->format = formatFromLean(leanFormat);
+    }
+    else if ((pixelFlags & DDPF_RGB) && readU32(data + 88) == 32 &&
+             readU32(data + 92) == 0x000000FF && readU32(data + 96) == 0x0000FF00 &&
+             readU32(data + 100) == 0x00FF0000) {
+        info->format = formatFromLean(3);
+    }
+    if (info->format == NULL) {
+        return "unsupported DDS pixel format";
+    }
+
+    if (!dimensionsInRange(info) || info->levels > 32) {
+        return "DDS dimensions are out of range";
+    }
+
+    // DDS stores each layer/face with its whole mip chain, one after another
+    size_t offset = dataOffset;
+    uint32_t elements = info->layers * info->faces;
+    for (uint32_t element=0; element < elements; element++) {
+        for (uint32_t level=0; level < info->levels; level++) {
+            size_t bytes = sliceBytes(info->format, mipSize(info->width, level), mipSize(info->height, level)) * mipSize(info->depth, level);
+            if (bytes > file->size - offset) {
+                return "DDS image data is truncated";
+            }
+            offset += bytes;
+        }
+    }
+
+    const char *error = createStorage(info);
+    if (error) {
+        return error;
+    }
+    offset = dataOffset;
+    for (uint32_t element=0; element < elements; element++) {
+        for (uint32_t level=0; level < info->levels; level++) {
+            uint32_t slices = mipSize(info->depth, level);
+            uploadSlices(info, level, info->depth > 1 ? 0 : element, info->depth > 1 ? slices : 1, data + offset);
+            offset += sliceBytes(info->format, mipSize(info->width, level), mipSize(info->height, level)) * slices;
+        }
+    }
+    return NULL;
+}
+
+/*
+structure LoadedTexture where
+  texture : GLTextureObject
+  width : UInt32
+  height : UInt32
+  depth : UInt32
+  layers : UInt32
+  levels : UInt32
+  target : GLTextureTarget
+  format : GLSizedTextureFormat
+*/
+
+// loadTextureFile : String → IO LoadedTexture
+//
+lean_obj_res lean_texturefile_load(b_lean_obj_arg lpath)
+{
+    const char *path = lean_string_cstr(lpath);
+    mappedFile_t file;
+    char message[512];
+    if (!mapFile(path, &file)) {
+        snprintf(message, sizeof(message), "loadTextureFile: could not map %s", path);
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string(message)));
+    }
+
+    textureFileInfo_t info;
+    memset(&info, 0, sizeof(info));
+    const char *error;
+    if (file.size >= sizeof(ktx2Identifier) && memcmp(file.data, ktx2Identifier, sizeof(ktx2Identifier)) == 0) {
+        error = loadKTX2(&file, &info);
+    }
+    else if (file.size >= 4 && readU32(file.data) == DDS_FOURCC('D','D','S',' ')) {
+        error = loadDDS(&file, &info);
+    }
+    else {
+        error = "not a KTX2 or DDS file";
+    }
+    // the driver has copied everything it needs by the time the upload calls return
+    unmapFile(&file);
+
+    if (error) {
+        if (info.texture) {
+            glDeleteTextures(1, &info.texture);
+        }
+        snprintf(message, sizeof(message), "loadTextureFile: %s: %s", path, error);
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string(message)));
+    }
+
+    lean_object *result = lean_alloc_ctor(0, 0, 6 * 4 + 2);
+    lean_ctor_set_uint32(result, 0, info.texture);
+    lean_ctor_set_uint32(result, 4, info.width);
+    lean_ctor_set_uint32(result, 8, info.height);
+    lean_ctor_set_uint32(result, 12, info.depth);
+    lean_ctor_set_uint32(result, 16, info.layers * info.faces);
+    lean_ctor_set_uint32(result, 20, info.levels);
+    lean_ctor_set_uint8(result, 24, info.leanTarget);
+    lean_ctor_set_uint8(result, 25, info.format->leanFormat);
+    return lean_io_result_mk_ok(result);
+}
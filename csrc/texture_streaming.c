@@ -0,0 +1,234 @@
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+#include <GLFW/glfw3.h>
+
+#include "data_marshal.h"
+#include "opengl_ffi.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Texture streaming through a persistently mapped pixel unpack buffer. Pixel data is copied
+// into a ring buffer and glTextureSubImage2D sources it from the buffer offset, so the driver
+// doesn't have to copy synchronously from client memory. Each frame's region of the ring is
+// fenced; the CPU only waits when it laps a region the GPU hasn't finished reading.
+//
+
+#define STREAMER_MAX_FENCES 64
+#define STREAMER_ALIGNMENT 16
+
+typedef struct {
+    GLsync fence;
+    size_t start;
+    size_t end;
+} streamFence_t;
+
+typedef struct {
+    GLuint buffer;
+    uint8_t *mapped;
+    size_t size;
+    size_t head;           // next write offset
+    size_t pendingStart;   // start of the region written since the last fence
+    streamFence_t fences[STREAMER_MAX_FENCES];  // oldest first, as a ring
+    int fenceFirst;
+    int fenceCount;
+    uint64_t bytesUploaded;
+    uint64_t uploads;
+    uint64_t stalls;
+    uint64_t stallTicks;
+    uint64_t createdAt;
+} textureStreamer_t;
+
+static lean_obj_res streamerError(const char *message)
+{
+    return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string(message)));
+}
+
+static void waitOldestFence(textureStreamer_t *streamer)
+{
+    streamFence_t *oldest = &streamer->fences[streamer->fenceFirst];
+    GLenum status = glClientWaitSync(oldest->fence, 0, 0);
+    if (status == GL_TIMEOUT_EXPIRED) {
+        // the GPU is still reading this region: a real stall
+        uint64_t before = glfwGetTimerValue();
+        while (glClientWaitSync(oldest->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED) {
+        }
+        streamer->stalls++;
+        streamer->stallTicks += glfwGetTimerValue() - before;
+    }
+    glDeleteSync(oldest->fence);
+    streamer->fenceFirst = (streamer->fenceFirst + 1) % STREAMER_MAX_FENCES;
+    streamer->fenceCount--;
+}
+
+// fence everything written since the last fence
+static void fencePending(textureStreamer_t *streamer)
+{
+    if (streamer->head == streamer->pendingStart) {
+        return;
+    }
+    if (streamer->fenceCount == STREAMER_MAX_FENCES) {
+        waitOldestFence(streamer);
+    }
+    int slot = (streamer->fenceFirst + streamer->fenceCount) % STREAMER_MAX_FENCES;
+    streamer->fences[slot].fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    streamer->fences[slot].start = streamer->pendingStart;
+    streamer->fences[slot].end = streamer->head;
+    streamer->fenceCount++;
+    streamer->pendingStart = streamer->head;
+}
+
+// reserve byteCount contiguous bytes of the ring, waiting on any fenced region they overlap
+static size_t reserveRing(textureStreamer_t *streamer, size_t byteCount)
+{
+    size_t start = (streamer->head + STREAMER_ALIGNMENT - 1) & ~(size_t)(STREAMER_ALIGNMENT - 1);
+    if (start + byteCount > streamer->size) {
+        // wrap. Fence what we have so every fenced region is one unbroken interval.
+        fencePending(streamer);
+        start = 0;
+        streamer->pendingStart = 0;
+    }
+    size_t end = start + byteCount;
+
+    // regions are written in ring order, so the oldest fence is always the next one in our way
+    while (streamer->fenceCount > 0) {
+        streamFence_t *oldest = &streamer->fences[streamer->fenceFirst];
+        if (oldest->start < end && start < oldest->end) {
+            waitOldestFence(streamer);
+        }
+        else {
+            break;
+        }
+    }
+
+    if (streamer->head == streamer->pendingStart) {
+        streamer->pendingStart = start;
+    }
+    streamer->head = end;
+    return start;
+}
+
+// createTextureStreamer : (ringBytes : UInt64) → IO TextureStreamer
+//
+lean_obj_res lean_texturestreamer_create(uint64_t ringBytes)
+{
+    if (!GLAD_GL_VERSION_4_4) {
+        return streamerError("Persistent mapped buffers need OpenGL 4.4 or later");
+    }
+    if (ringBytes == 0) {
+        return streamerError("createTextureStreamer needs a non-empty ring");
+    }
+
+    textureStreamer_t *streamer = calloc(1, sizeof(textureStreamer_t));
+    streamer->size = (size_t)ringBytes;
+
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glCreateBuffers(1, &streamer->buffer);
+    glNamedBufferStorage(streamer->buffer, (GLsizeiptr)ringBytes, NULL, flags);
+    streamer->mapped = glMapNamedBufferRange(streamer->buffer, 0, (GLsizeiptr)ringBytes, flags);
+    if (streamer->mapped == NULL) {
+        glDeleteBuffers(1, &streamer->buffer);
+        free(streamer);
+        return streamerError("Could not map the texture streaming buffer");
+    }
+    streamer->createdAt = glfwGetTimerValue();
+
+    return lean_io_result_mk_ok(lean_mk_ptr(streamer));
+}
+
+// destroyTextureStreamer : TextureStreamer → IO Unit
+//
+lean_obj_res lean_texturestreamer_destroy(lean_obj_arg lstreamer)
+{
+    textureStreamer_t *streamer = (textureStreamer_t *)lean_get_external_data(lstreamer);
+    if (streamer == NULL) {
+        return streamerError("NULL streamer passed to destroyTextureStreamer");
+    }
+    // the buffer can't be released while the GPU may still be reading it
+    while (streamer->fenceCount > 0) {
+        waitOldestFence(streamer);
+    }
+    glUnmapNamedBuffer(streamer->buffer);
+    glDeleteBuffers(1, &streamer->buffer);
+    free(streamer);
+    lean_clear_ptr(lstreamer);
+    return lean_return_unit();
+}
+
+// streamTextureSubImage2D : TextureStreamer → GLTextureObject → (level : UInt32) → (xoffset : UInt32) → (yoffset : UInt32) → (width : UInt32) → (height : UInt32) → GLPixelFormat → GLPixelType → ByteArray → IO Unit
+//
+lean_obj_res lean_texturestreamer_subimage2d(
+    b_lean_obj_arg lstreamer, uint32_t textureObject, uint32_t level, uint32_t xoffset, uint32_t yoffset,
+    uint32_t width, uint32_t height, uint8_t pixelFormat, uint8_t pixelType, b_lean_obj_arg pixelData)
+{
+    textureStreamer_t *streamer = (textureStreamer_t *)lean_get_external_data(lstreamer);
+    if (streamer == NULL) {
+        return streamerError("NULL streamer passed to streamTextureSubImage2D");
+    }
+    // GL reads this many bytes from the ring whatever the array holds
+    size_t byteCount = unpackedImageSize(pixelFormat, pixelType, width, height);
+    if (lean_sarray_size(pixelData) < byteCount) {
+        return streamerError("streamTextureSubImage2D: pixel data is smaller than width * height * bytes per pixel");
+    }
+    if (byteCount > streamer->size) {
+        return streamerError("Image is larger than the texture streaming ring");
+    }
+
+    size_t offset = reserveRing(streamer, byteCount);
+    memcpy(streamer->mapped + offset, lean_sarray_cptr(pixelData), byteCount);
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, streamer->buffer);
+    glTextureSubImage2D(
+        (GLuint)textureObject, (GLint)level, (GLint)xoffset, (GLint)yoffset,
+        (GLsizei)width, (GLsizei)height,
+        convertPixelFormat(pixelFormat), convertPixelType(pixelType),
+        (const void *)(uintptr_t)offset);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    streamer->bytesUploaded += byteCount;
+    streamer->uploads++;
+    return lean_return_unit();
+}
+
+// textureStreamerEndFrame : TextureStreamer → IO Unit
+//
+lean_obj_res lean_texturestreamer_endframe(b_lean_obj_arg lstreamer)
+{
+    textureStreamer_t *streamer = (textureStreamer_t *)lean_get_external_data(lstreamer);
+    if (streamer == NULL) {
+        return streamerError("NULL streamer passed to textureStreamerEndFrame");
+    }
+    fencePending(streamer);
+    return lean_return_unit();
+}
+
+/*
+structure TextureStreamerStats where
+  bytesUploaded : UInt64
+  uploads : UInt64
+  stalls : UInt64
+  stallNanos : UInt64
+  bytesPerSecond : Float
+*/
+
+// textureStreamerStats : TextureStreamer → IO TextureStreamerStats
+//
+lean_obj_res lean_texturestreamer_stats(b_lean_obj_arg lstreamer)
+{
+    textureStreamer_t *streamer = (textureStreamer_t *)lean_get_external_data(lstreamer);
+    if (streamer == NULL) {
+        return streamerError("NULL streamer passed to textureStreamerStats");
+    }
+    double frequency = (double)glfwGetTimerFrequency();
+    double elapsed = (double)(glfwGetTimerValue() - streamer->createdAt) / frequency;
+
+    lean_object *stats = lean_alloc_ctor(0, 0, 5 * 8);
+    lean_ctor_set_uint64(stats, 0, streamer->bytesUploaded);
+    lean_ctor_set_uint64(stats, 8, streamer->uploads);
+    lean_ctor_set_uint64(stats, 16, streamer->stalls);
+    lean_ctor_set_uint64(stats, 24, (uint64_t)((double)streamer->stallTicks * 1e9 / frequency));
+    lean_ctor_set_float(stats, 32, elapsed > 0.0 ? (double)streamer->bytesUploaded / elapsed : 0.0);
+    return lean_io_result_mk_ok(stats);
+}
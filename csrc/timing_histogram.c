@@ -0,0 +1,208 @@
+#include <lean/lean.h>
+
+#include <GLFW/glfw3.h>
+
+#include "data_marshal.h"
+
+#include <stdlib.h>
+
+//
+// Interval timing for profiling hot paths. glfwGetTime boxes a Float on every call, and even a
+// UInt64 tick count comes back to Lean boxed, so timingBegin/timingEnd keep the start ticks on a
+// small stack inside the histogram and record the elapsed time straight into preallocated
+// buckets: a timed scope costs two timer reads and no allocation beyond the IO results.
+//
+// Buckets are log-linear in nanoseconds: one per value below 16 ns, then 8 per power of two, so
+// any recorded value is within 12.5% of its bucket's lower bound.
+//
+
+#define TIMING_EXACT 16
+#define TIMING_SUB_BITS 3
+#define TIMING_SUB_BUCKETS (1 << TIMING_SUB_BITS)
+#define TIMING_BUCKETS (TIMING_EXACT + (64 - 4) * TIMING_SUB_BUCKETS)
+#define TIMING_MAX_DEPTH 16
+
+typedef struct {
+    double nanosPerTick;
+    uint64_t count;
+    uint64_t totalNanos;
+    uint64_t minNanos;
+    uint64_t maxNanos;
+    uint32_t depth;                    // open timingBegin scopes
+    uint64_t starts[TIMING_MAX_DEPTH];
+    uint64_t buckets[TIMING_BUCKETS];
+} timingHistogram_t;
+
+static uint32_t bucketIndex(uint64_t nanos)
+{
+    if (nanos < TIMING_EXACT) {
+        return (uint32_t)nanos;
+    }
+    uint32_t exponent = 63 - (uint32_t)__builtin_clzll(nanos);
+    uint32_t sub = (uint32_t)(nanos >> (exponent - TIMING_SUB_BITS)) & (TIMING_SUB_BUCKETS - 1);
+    return TIMING_EXACT + (exponent - 4) * TIMING_SUB_BUCKETS + sub;
+}
+
+static uint64_t bucketLowerBound(uint32_t ix)
+{
+    if (ix < TIMING_EXACT) {
+        return ix;
+    }
+    uint32_t exponent = (ix - TIMING_EXACT) / TIMING_SUB_BUCKETS + 4;
+    uint64_t sub = (ix - TIMING_EXACT) % TIMING_SUB_BUCKETS;
+    return (TIMING_SUB_BUCKETS + sub) << (exponent - TIMING_SUB_BITS);
+}
+
+static void resetHistogram(timingHistogram_t *histogram)
+{
+    histogram->count = 0;
+    histogram->totalNanos = 0;
+    histogram->minNanos = UINT64_MAX;
+    histogram->maxNanos = 0;
+    for (uint32_t ix=0; ix < TIMING_BUCKETS; ix++) {
+        histogram->buckets[ix] = 0;
+    }
+}
+
+static void recordTicks(timingHistogram_t *histogram, uint64_t ticks)
+{
+    // converting a double at or above 2^64 is undefined, so saturate first
+    double exact = (double)ticks * histogram->nanosPerTick;
+    uint64_t nanos = exact >= 18446744073709551616.0 ? UINT64_MAX : (uint64_t)exact;
+    histogram->count++;
+    histogram->totalNanos += nanos;
+    if (nanos < histogram->minNanos) histogram->minNanos = nanos;
+    if (nanos > histogram->maxNanos) histogram->maxNanos = nanos;
+    histogram->buckets[bucketIndex(nanos)]++;
+}
+
+// the lower bound of the bucket holding the value at `fraction` of the recorded count, clamped
+// to the recorded range
+static uint64_t percentile(const timingHistogram_t *histogram, double fraction)
+{
+    if (histogram->count == 0) {
+        return 0;
+    }
+    uint64_t rank = (uint64_t)(fraction * (double)(histogram->count - 1)) + 1;
+    uint64_t seen = 0;
+    for (uint32_t ix=0; ix < TIMING_BUCKETS; ix++) {
+        seen += histogram->buckets[ix];
+        if (seen >= rank) {
+            uint64_t value = bucketLowerBound(ix);
+            if (value < histogram->minNanos) value = histogram->minNanos;
+            if (value > histogram->maxNanos) value = histogram->maxNanos;
+            return value;
+        }
+    }
+    return histogram->maxNanos;
+}
+
+static lean_obj_res timingError(const char *message)
+{
+    return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string(message)));
+}
+
+// createTimingHistogram : IO TimingHistogram
+//
+// after glfwInit, which the tick frequency comes from
+lean_obj_res lean_timing_histogram_create()
+{
+    timingHistogram_t *histogram = malloc(sizeof(timingHistogram_t));
+    if (histogram == NULL) {
+        return timingError("createTimingHistogram: out of memory");
+    }
+    histogram->nanosPerTick = 1e9 / (double)glfwGetTimerFrequency();
+    histogram->depth = 0;
+    resetHistogram(histogram);
+    return lean_io_result_mk_ok(lean_mk_ptr(histogram));
+}
+
+// destroyTimingHistogram : TimingHistogram → IO Unit
+//
+lean_obj_res lean_timing_histogram_destroy(lean_obj_arg lhistogram)
+{
+    timingHistogram_t *histogram = (timingHistogram_t *)lean_get_external_data(lhistogram);
+    if (histogram == NULL) {
+        return timingError("NULL histogram passed to destroyTimingHistogram");
+    }
+    free(histogram);
+    lean_clear_ptr(lhistogram);
+    return lean_return_unit();
+}
+
+// timingBegin : @& TimingHistogram → IO Unit
+//
+lean_obj_res lean_timing_begin(b_lean_obj_arg lhistogram)
+{
+    timingHistogram_t *histogram = (timingHistogram_t *)lean_get_external_data(lhistogram);
+    if (histogram == NULL) {
+        return timingError("NULL histogram passed to timingBegin");
+    }
+    if (histogram->depth == TIMING_MAX_DEPTH) {
+        return timingError("timingBegin: more than 16 nested scopes on one histogram");
+    }
+    histogram->starts[histogram->depth++] = glfwGetTimerValue();
+    return lean_return_unit();
+}
+
+// timingEnd : @& TimingHistogram → IO Unit
+//
+// records the time since the innermost open timingBegin
+lean_obj_res lean_timing_end(b_lean_obj_arg lhistogram)
+{
+    uint64_t now = glfwGetTimerValue();
+    timingHistogram_t *histogram = (timingHistogram_t *)lean_get_external_data(lhistogram);
+    if (histogram == NULL) {
+        return timingError("NULL histogram passed to timingEnd");
+    }
+    if (histogram->depth == 0) {
+        return timingError("timingEnd without a matching timingBegin");
+    }
+    recordTicks(histogram, now - histogram->starts[--histogram->depth]);
+    return lean_return_unit();
+}
+
+// recordTiming : @& TimingHistogram → (ticks : UInt64) → IO Unit
+//
+lean_obj_res lean_timing_record(b_lean_obj_arg lhistogram, uint64_t ticks)
+{
+    timingHistogram_t *histogram = (timingHistogram_t *)lean_get_external_data(lhistogram);
+    if (histogram == NULL) {
+        return timingError("NULL histogram passed to recordTiming");
+    }
+    recordTicks(histogram, ticks);
+    return lean_return_unit();
+}
+
+/*structure TimingSummary where
+  count : UInt64
+  totalNanos : UInt64
+  minNanos : UInt64
+  maxNanos : UInt64
+  p50Nanos : UInt64
+  p90Nanos : UInt64
+  p99Nanos : UInt64
+*/
+
+// timingSummary : @& TimingHistogram → (reset : Bool) → IO TimingSummary
+//
+// reset clears the recorded values but leaves open scopes alone
+lean_obj_res lean_timing_summary(b_lean_obj_arg lhistogram, uint8_t reset)
+{
+    timingHistogram_t *histogram = (timingHistogram_t *)lean_get_external_data(lhistogram);
+    if (histogram == NULL) {
+        return timingError("NULL histogram passed to timingSummary");
+    }
+    lean_object *summary = lean_alloc_ctor(0, 0, 7 * sizeof(uint64_t));
+    lean_ctor_set_uint64(summary, 0, histogram->count);
+    lean_ctor_set_uint64(summary, 8, histogram->totalNanos);
+    lean_ctor_set_uint64(summary, 16, histogram->count ? histogram->minNanos : 0);
+    lean_ctor_set_uint64(summary, 24, histogram->maxNanos);
+    lean_ctor_set_uint64(summary, 32, percentile(histogram, 0.50));
+    lean_ctor_set_uint64(summary, 40, percentile(histogram, 0.90));
+    lean_ctor_set_uint64(summary, 48, percentile(histogram, 0.99));
+    if (reset) {
+        resetHistogram(histogram);
+    }
+    return lean_io_result_mk_ok(summary);
+}
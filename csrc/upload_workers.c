@@ -0,0 +1,347 @@
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+#include <GLFW/glfw3.h>
+
+#include "data_marshal.h"
+#include "window_state.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+//
+// Background resource creation on shared contexts. Each worker thread owns a hidden window
+// whose context shares objects with the main one, and runs Lean upload jobs (buffer storage,
+// texture uploads, shader compiles...) on it. After a job the worker sets a fence and flushes;
+// the main thread collects the object names a job returns only once its fence has signalled,
+// so nothing is used before the upload has actually happened and the render thread never
+// blocks on the copies.
+//
+
+// defined in Lean (IO.Error.toString)
+extern lean_object *lean_io_error_to_string(lean_object *err);
+
+typedef struct uploadJob {
+    uint64_t id;
+    lean_object *action;    // IO (Array UInt32), marked multi-threaded
+    lean_object *names;     // result, or NULL if the job failed
+    lean_object *error;     // error message string, or NULL
+    GLsync fence;
+    struct uploadJob *next;
+} uploadJob_t;
+
+typedef struct {
+    pthread_t *threads;
+    GLFWwindow **contexts;
+    uint32_t workerCount;
+    uint32_t started;
+    int failed;
+    pthread_mutex_t lock;
+    pthread_cond_t workAvailable;
+    pthread_cond_t workerStarted;
+    pthread_cond_t jobFinished;
+    uploadJob_t *queueHead, *queueTail;  // waiting for a worker
+    uploadJob_t *doneHead, *doneTail;    // run and fenced, waiting for collectUploads
+    uint64_t nextId;
+    uint32_t inFlight;                   // submitted and not yet collected
+    int shuttingDown;
+} uploadWorkers_t;
+
+typedef struct {
+    uploadWorkers_t *workers;
+    GLFWwindow *context;
+} workerStart_t;
+
+static void appendJob(uploadJob_t **head, uploadJob_t **tail, uploadJob_t *job)
+{
+    job->next = NULL;
+    if (*tail) {
+        (*tail)->next = job;
+    }
+    else {
+        *head = job;
+    }
+    *tail = job;
+}
+
+static uploadJob_t *popJob(uploadJob_t **head, uploadJob_t **tail)
+{
+    uploadJob_t *job = *head;
+    if (job) {
+        *head = job->next;
+        if (*head == NULL) {
+            *tail = NULL;
+        }
+    }
+    return job;
+}
+
+static void *uploadWorker(void *arg)
+{
+    workerStart_t start = *(workerStart_t *)arg;
+    free(arg);
+    uploadWorkers_t *workers = start.workers;
+
+    lean_initialize_thread();
+    // each worker context gets its own function table
+    int loaded = makeWindowContextCurrent(start.context);
+
+    pthread_mutex_lock(&workers->lock);
+    workers->started++;
+    if (!loaded) {
+        workers->failed = 1;
+    }
+    pthread_cond_broadcast(&workers->workerStarted);
+    pthread_mutex_unlock(&workers->lock);
+
+    for (;;) {
+        pthread_mutex_lock(&workers->lock);
+        while (workers->queueHead == NULL && !workers->shuttingDown) {
+            pthread_cond_wait(&workers->workAvailable, &workers->lock);
+        }
+        uploadJob_t *job = popJob(&workers->queueHead, &workers->queueTail);
+        pthread_mutex_unlock(&workers->lock);
+        if (job == NULL) {
+            break;
+        }
+
+        lean_object *result = lean_apply_1(job->action, lean_io_mk_world());
+        job->action = NULL;
+        if (lean_io_result_is_ok(result)) {
+            job->names = lean_io_result_get_value(result);
+            lean_inc(job->names);
+            lean_mark_mt(job->names);
+        }
+        else {
+            lean_object *err = lean_io_result_get_error(result);
+            lean_inc(err);
+            job->error = lean_io_error_to_string(err);
+            lean_mark_mt(job->error);
+        }
+        lean_dec(result);
+
+        // the flush makes sure the fence (and the work before it) reaches the GPU even though
+        // nothing else will be submitted on this context for a while
+        job->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        pthread_mutex_lock(&workers->lock);
+        appendJob(&workers->doneHead, &workers->doneTail, job);
+        pthread_cond_signal(&workers->jobFinished);
+        pthread_mutex_unlock(&workers->lock);
+    }
+
+    glfwMakeContextCurrent(NULL);
+    lean_finalize_thread();
+    return NULL;
+}
+
+static void stopWorkers(uploadWorkers_t *workers, uint32_t threadCount)
+{
+    pthread_mutex_lock(&workers->lock);
+    workers->shuttingDown = 1;
+    pthread_cond_broadcast(&workers->workAvailable);
+    pthread_mutex_unlock(&workers->lock);
+    for (uint32_t ix=0; ix < threadCount; ix++) {
+        pthread_join(workers->threads[ix], NULL);
+    }
+    for (uint32_t ix=0; ix < workers->workerCount; ix++) {
+        if (workers->contexts[ix] != NULL) {
+            destroyWindowState(workers->contexts[ix]);
+            glfwDestroyWindow(workers->contexts[ix]);
+        }
+    }
+}
+
+static void freeWorkers(uploadWorkers_t *workers)
+{
+    pthread_mutex_destroy(&workers->lock);
+    pthread_cond_destroy(&workers->workAvailable);
+    pthread_cond_destroy(&workers->workerStarted);
+    pthread_cond_destroy(&workers->jobFinished);
+    free(workers->threads);
+    free(workers->contexts);
+    free(workers);
+}
+
+// createUploadWorkers : @& Window → (workerCount : UInt32) → IO UploadWorkers
+//
+// call on the main thread with the window's context current
+lean_obj_res lean_uploadworkers_create(b_lean_obj_arg lw, uint32_t workerCount)
+{
+    GLFWwindow *window = (GLFWwindow *)(lean_get_external_data(lw));
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to createUploadWorkers")));
+    }
+    if (workerCount == 0 || workerCount > 16) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("createUploadWorkers: worker count must be between 1 and 16")));
+    }
+
+    uploadWorkers_t *workers = calloc(1, sizeof(uploadWorkers_t));
+    workers->threads = calloc(workerCount, sizeof(pthread_t));
+    workers->contexts = calloc(workerCount, sizeof(GLFWwindow *));
+    workers->workerCount = workerCount;
+    workers->nextId = 1;
+    pthread_mutex_init(&workers->lock, NULL);
+    pthread_cond_init(&workers->workAvailable, NULL);
+    pthread_cond_init(&workers->workerStarted, NULL);
+    pthread_cond_init(&workers->jobFinished, NULL);
+
+    // the windows have to be created here, on the main thread
+    for (uint32_t ix=0; ix < workerCount; ix++) {
+        workers->contexts[ix] = createSharedContextWindow(window);
+        if (workers->contexts[ix] != NULL) {
+            getWindowState(workers->contexts[ix]);
+        }
+        else {
+            stopWorkers(workers, 0);
+            freeWorkers(workers);
+            return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("createUploadWorkers: could not create a shared context")));
+        }
+    }
+
+    uint32_t threadCount = 0;
+    for (; threadCount < workerCount; threadCount++) {
+        workerStart_t *start = malloc(sizeof(workerStart_t));
+        start->workers = workers;
+        start->context = workers->contexts[threadCount];
+        if (pthread_create(&workers->threads[threadCount], NULL, uploadWorker, start) != 0) {
+            free(start);
+            break;
+        }
+    }
+
+    pthread_mutex_lock(&workers->lock);
+    while (workers->started < threadCount) {
+        pthread_cond_wait(&workers->workerStarted, &workers->lock);
+    }
+    int failed = workers->failed || threadCount < workerCount;
+    pthread_mutex_unlock(&workers->lock);
+
+    if (failed) {
+        stopWorkers(workers, threadCount);
+        freeWorkers(workers);
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("createUploadWorkers: a worker could not start or load GL on its context")));
+    }
+    return lean_io_result_mk_ok(lean_mk_ptr(workers));
+}
+
+// destroyUploadWorkers : UploadWorkers → IO Unit
+//
+// waits for queued jobs to run; completions that weren't collected are dropped, but the objects
+// they created stay alive in the share group
+lean_obj_res lean_uploadworkers_destroy(lean_obj_arg lworkers)
+{
+    uploadWorkers_t *workers = (uploadWorkers_t *)(lean_get_external_data(lworkers));
+    if (workers == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL upload workers passed to destroyUploadWorkers")));
+    }
+
+    // queued jobs still run: stopping only takes effect once the queue is empty
+    stopWorkers(workers, workers->workerCount);
+
+    uploadJob_t *job;
+    while ((job = popJob(&workers->doneHead, &workers->doneTail)) != NULL) {
+        glDeleteSync(job->fence);
+        if (job->names) lean_dec(job->names);
+        if (job->error) lean_dec(job->error);
+        free(job);
+    }
+    freeWorkers(workers);
+    lean_clear_ptr(lworkers);
+    return lean_return_unit();
+}
+
+// submitUpload : @& UploadWorkers → IO (Array UInt32) → IO UInt64
+//
+lean_obj_res lean_uploadworkers_submit(b_lean_obj_arg lworkers, lean_obj_arg action)
+{
+    uploadWorkers_t *workers = (uploadWorkers_t *)(lean_get_external_data(lworkers));
+    if (workers == NULL) {
+        lean_dec(action);
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL upload workers passed to submitUpload")));
+    }
+
+    uploadJob_t *job = calloc(1, sizeof(uploadJob_t));
+    lean_mark_mt(action);
+    job->action = action;
+
+    pthread_mutex_lock(&workers->lock);
+    job->id = workers->nextId++;
+    workers->inFlight++;
+    appendJob(&workers->queueHead, &workers->queueTail, job);
+    pthread_cond_signal(&workers->workAvailable);
+    pthread_mutex_unlock(&workers->lock);
+
+    return lean_io_result_mk_ok(lean_box_uint64(job->id));
+}
+
+/*structure UploadCompletion where
+  names : Array UInt32
+  error : String
+  jobId : UInt64
+*/
+static lean_object *mkCompletion(uploadJob_t *job)
+{
+    lean_object *completion = lean_alloc_ctor(0, 2, 8);
+    lean_ctor_set(completion, 0, job->names ? job->names : lean_alloc_array(0, 0));
+    lean_ctor_set(completion, 1, job->error ? job->error : lean_mk_string(""));
+    lean_ctor_set_uint64(completion, sizeof(void*) * 2, job->id);
+    return completion;
+}
+
+// collectUploads : @& UploadWorkers → (wait : Bool) → IO (Array UploadCompletion)
+//
+// Completions whose fence has signalled, in the order the jobs finished. With wait, blocks
+// until every submitted job has completed. Call on the main thread with its context current.
+lean_obj_res lean_uploadworkers_collect(b_lean_obj_arg lworkers, uint8_t wait)
+{
+    uploadWorkers_t *workers = (uploadWorkers_t *)(lean_get_external_data(lworkers));
+    if (workers == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL upload workers passed to collectUploads")));
+    }
+
+    lean_object *completions = lean_alloc_array(0, 4);
+    for (;;) {
+        pthread_mutex_lock(&workers->lock);
+        while (wait && workers->doneHead == NULL && workers->inFlight > 0) {
+            pthread_cond_wait(&workers->jobFinished, &workers->lock);
+        }
+        uploadJob_t *job = workers->doneHead;
+        pthread_mutex_unlock(&workers->lock);
+        if (job == NULL) {
+            break;
+        }
+
+        // only the consumer removes from the done list, so the job stays at its head
+        GLenum status = glClientWaitSync(job->fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait ? GL_TIMEOUT_IGNORED : 0);
+        if (status == GL_TIMEOUT_EXPIRED) {
+            break;
+        }
+        glDeleteSync(job->fence);
+
+        pthread_mutex_lock(&workers->lock);
+        popJob(&workers->doneHead, &workers->doneTail);
+        workers->inFlight--;
+        pthread_mutex_unlock(&workers->lock);
+
+        completions = lean_array_push(completions, mkCompletion(job));
+        free(job);
+    }
+    return lean_io_result_mk_ok(completions);
+}
+
+// pendingUploads : @& UploadWorkers → IO UInt32
+//
+// submitted jobs that collectUploads hasn't returned yet
+lean_obj_res lean_uploadworkers_pending(b_lean_obj_arg lworkers)
+{
+    uploadWorkers_t *workers = (uploadWorkers_t *)(lean_get_external_data(lworkers));
+    if (workers == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL upload workers passed to pendingUploads")));
+    }
+    pthread_mutex_lock(&workers->lock);
+    uint32_t inFlight = workers->inFlight;
+    pthread_mutex_unlock(&workers->lock);
+    return lean_io_result_mk_ok(lean_box_uint32(inFlight));
+}
@@ -0,0 +1,292 @@
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+
+#include "data_marshal.h"
+#include "opengl_ffi.h"
+#include "vertex_layout.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Declarative vertex layouts. A Lean VertexLayout is unpacked once into a flat C description,
+// which is hashed, compared and applied to a VAO in a single call.
+//
+
+/*
+structure VertexAttribute where
+  attribIndex : UInt32
+  bindingIndex : UInt32
+  size : UInt32
+  relativeOffset : UInt32
+  dataType : GLDataType
+  normalized : Bool
+
+structure VertexBinding where
+  bindingIndex : UInt32
+  stride : UInt32
+  divisor : UInt32
+
+structure VertexLayout where
+  attributes : Array VertexAttribute
+  bindings : Array VertexBinding
+*/
+
+int unpackVertexLayout(b_lean_obj_arg layoutL, vertexLayout_t *layout)
+{
+    memset(layout, 0, sizeof(vertexLayout_t));
+
+    lean_object *attributes = lean_ctor_get(layoutL, 0);
+    lean_object *bindings = lean_ctor_get(layoutL, 1);
+    size_t attribCount = lean_array_size(attributes);
+    size_t bindingCount = lean_array_size(bindings);
+    if (attribCount > MAX_VERTEX_LAYOUT_ATTRIBUTES || bindingCount > MAX_VERTEX_LAYOUT_BINDINGS) {
+        return 0;
+    }
+
+    // scalar fields are laid out by size: the UInt32 fields first in declaration order, then the enum and the Bool
+    for (size_t ix=0; ix < attribCount; ix++) {
+        lean_object *a = lean_array_get_core(attributes, ix);
+        vertexAttribute_t *out = &layout->attributes[ix];
+        out->attribIndex    = lean_ctor_get_uint32(a, 0);
+        out->bindingIndex   = lean_ctor_get_uint32(a, 4);
+        out->size           = lean_ctor_get_uint32(a, 8);
+        out->relativeOffset = lean_ctor_get_uint32(a, 12);
+        out->dataType       = lean_ctor_get_uint8(a, 16);
+        out->normalized     = lean_ctor_get_uint8(a, 17);
+    }
+    for (size_t ix=0; ix < bindingCount; ix++) {
+        lean_object *b = lean_array_get_core(bindings, ix);
+        vertexBinding_t *out = &layout->bindings[ix];
+        out->bindingIndex = lean_ctor_get_uint32(b, 0);
+        out->stride       = lean_ctor_get_uint32(b, 4);
+        out->divisor      = lean_ctor_get_uint32(b, 8);
+    }
+    layout->attributeCount = (uint32_t)attribCount;
+    layout->bindingCount = (uint32_t)bindingCount;
+    return 1;
+}
+
+// FNV-1a over the used part of the description. Unused slots are zeroed by unpackVertexLayout
+// so hashing and comparing the whole struct would also work, just slower.
+uint64_t hashVertexLayout(const vertexLayout_t *layout)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    const uint8_t *bytes;
+    size_t length;
+
+#define FNV_BYTES(ptr, len) \
+    bytes = (const uint8_t *)(ptr); length = (len); \
+    for (size_t ix=0; ix < length; ix++) { hash ^= bytes[ix]; hash *= 1099511628211ULL; }
+
+    FNV_BYTES(&layout->attributeCount, sizeof(uint32_t));
+    FNV_BYTES(&layout->bindingCount, sizeof(uint32_t));
+    FNV_BYTES(layout->attributes, layout->attributeCount * sizeof(vertexAttribute_t));
+    FNV_BYTES(layout->bindings, layout->bindingCount * sizeof(vertexBinding_t));
+#undef FNV_BYTES
+
+    return hash;
+}
+
+static int sameVertexLayout(const vertexLayout_t *a, const vertexLayout_t *b)
+{
+    return a->attributeCount == b->attributeCount
+        && a->bindingCount == b->bindingCount
+        && memcmp(a->attributes, b->attributes, a->attributeCount * sizeof(vertexAttribute_t)) == 0
+        && memcmp(a->bindings, b->bindings, a->bindingCount * sizeof(vertexBinding_t)) == 0;
+}
+
+void applyVertexLayout(GLuint vao, const vertexLayout_t *layout)
+{
+    for (uint32_t ix=0; ix < layout->attributeCount; ix++) {
+        const vertexAttribute_t *a = &layout->attributes[ix];
+        glEnableVertexArrayAttrib(vao, a->attribIndex);
+        glVertexArrayAttribFormat(vao, a->attribIndex, (GLint)a->size, convertGLDataType(a->dataType), (GLboolean)a->normalized, a->relativeOffset);
+        glVertexArrayAttribBinding(vao, a->attribIndex, a->bindingIndex);
+    }
+    for (uint32_t ix=0; ix < layout->bindingCount; ix++) {
+        const vertexBinding_t *b = &layout->bindings[ix];
+        glVertexArrayBindingDivisor(vao, b->bindingIndex, b->divisor);
+    }
+}
+
+// vertexLayoutHash : VertexLayout → UInt64
+//
+uint64_t lean_vertex_layout_hash(b_lean_obj_arg layoutL)
+{
+    vertexLayout_t layout;
+    if (!unpackVertexLayout(layoutL, &layout)) {
+        return 0;
+    }
+    return hashVertexLayout(&layout);
+}
+
+// glApplyVertexLayout : GLVertexArrayObject → VertexLayout → IO Unit
+//
+lean_obj_res lean_opengl_applyvertexlayout(uint32_t vao, b_lean_obj_arg layoutL)
+{
+    vertexLayout_t layout;
+    if (!unpackVertexLayout(layoutL, &layout)) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Too many attributes or bindings in VertexLayout")));
+    }
+    applyVertexLayout(vao, &layout);
+    return lean_return_unit();
+}
+
+// glBindVertexLayoutBuffers : GLVertexArrayObject → VertexLayout → Array GLBufferObject → Array UInt64 → IO Unit
+//
+// binds buffers[i] at offsets[i] to the i-th binding of the layout, using the layout's stride
+lean_obj_res lean_opengl_bindvertexlayoutbuffers(uint32_t vao, b_lean_obj_arg layoutL, b_lean_obj_arg buffers, b_lean_obj_arg offsets)
+{
+    lean_object *bindings = lean_ctor_get(layoutL, 1);
+    size_t bindingCount = lean_array_size(bindings);
+    if (lean_array_size(buffers) != bindingCount || lean_array_size(offsets) != bindingCount) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("glBindVertexLayoutBuffers needs one buffer and one offset per layout binding")));
+    }
+
+    for (size_t ix=0; ix < bindingCount; ix++) {
+        lean_object *b = lean_array_get_core(bindings, ix);
+        glVertexArrayVertexBuffer(
+            (GLuint)vao,
+            lean_ctor_get_uint32(b, 0),
+            (GLuint)lean_unbox_uint32(lean_array_get_core(buffers, ix)),
+            (GLintptr)lean_unbox_uint64(lean_array_get_core(offsets, ix)),
+            (GLsizei)lean_ctor_get_uint32(b, 4));
+    }
+    return lean_return_unit();
+}
+
+
+//
+// VAO cache. Open addressing on the layout hash, with a full compare on hash match, so
+// every mesh using the same vertex format shares one VAO and only rebinds its buffers.
+//
+
+typedef struct {
+    uint64_t hash;
+    vertexLayout_t *layout;  // NULL for an empty slot
+    GLuint vao;
+} vaoCacheEntry_t;
+
+typedef struct {
+    vaoCacheEntry_t *entries;
+    uint32_t capacity;  // always a power of two
+    uint32_t count;
+    uint64_t hits;
+    uint64_t misses;
+} vaoCache_t;
+
+static void vaoCacheInsert(vaoCacheEntry_t *entries, uint32_t capacity, vaoCacheEntry_t entry)
+{
+    uint32_t slot = (uint32_t)entry.hash & (capacity - 1);
+    while (entries[slot].layout != NULL) {
+        slot = (slot + 1) & (capacity - 1);
+    }
+    entries[slot] = entry;
+}
+
+static void vaoCacheGrow(vaoCache_t *cache)
+{
+    uint32_t newCapacity = cache->capacity * 2;
+    vaoCacheEntry_t *newEntries = calloc(newCapacity, sizeof(vaoCacheEntry_t));
+    for (uint32_t ix=0; ix < cache->capacity; ix++) {
+        if (cache->entries[ix].layout != NULL) {
+            vaoCacheInsert(newEntries, newCapacity, cache->entries[ix]);
+        }
+    }
+    free(cache->entries);
+    cache->entries = newEntries;
+    cache->capacity = newCapacity;
+}
+
+// createVertexArrayCache : IO VertexArrayCache
+//
+lean_obj_res lean_vertexarraycache_create()
+{
+    vaoCache_t *cache = calloc(1, sizeof(vaoCache_t));
+    cache->capacity = 16;
+    cache->entries = calloc(cache->capacity, sizeof(vaoCacheEntry_t));
+    return lean_io_result_mk_ok(lean_mk_ptr(cache));
+}
+
+// destroyVertexArrayCache : VertexArrayCache → IO Unit
+//
+// deletes every VAO the cache created
+lean_obj_res lean_vertexarraycache_destroy(lean_obj_arg lcache)
+{
+    vaoCache_t *cache = (vaoCache_t *)lean_get_external_data(lcache);
+    if (cache == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL cache passed to destroyVertexArrayCache")));
+    }
+    for (uint32_t ix=0; ix < cache->capacity; ix++) {
+        if (cache->entries[ix].layout != NULL) {
+            glDeleteVertexArrays(1, &cache->entries[ix].vao);
+            free(cache->entries[ix].layout);
+        }
+    }
+    free(cache->entries);
+    free(cache);
+    lean_clear_ptr(lcache);
+    return lean_return_unit();
+}
+
+// getCachedVertexArray : VertexArrayCache → VertexLayout → IO GLVertexArrayObject
+//
+lean_obj_res lean_vertexarraycache_get(b_lean_obj_arg lcache, b_lean_obj_arg layoutL)
+{
+    vaoCache_t *cache = (vaoCache_t *)lean_get_external_data(lcache);
+    if (cache == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL cache passed to getCachedVertexArray")));
+    }
+
+    vertexLayout_t layout;
+    if (!unpackVertexLayout(layoutL, &layout)) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Too many attributes or bindings in VertexLayout")));
+    }
+    uint64_t hash = hashVertexLayout(&layout);
+
+    uint32_t slot = (uint32_t)hash & (cache->capacity - 1);
+    while (cache->entries[slot].layout != NULL) {
+        vaoCacheEntry_t *entry = &cache->entries[slot];
+        if (entry->hash == hash && sameVertexLayout(entry->layout, &layout)) {
+            cache->hits++;
+            return lean_io_result_mk_ok(lean_box_uint32(entry->vao));
+        }
+        slot = (slot + 1) & (cache->capacity - 1);
+    }
+
+    // miss: build a new VAO for this layout
+    cache->misses++;
+    vaoCacheEntry_t entry;
+    entry.hash = hash;
+    entry.layout = malloc(sizeof(vertexLayout_t));
+    memcpy(entry.layout, &layout, sizeof(vertexLayout_t));
+    glCreateVertexArrays(1, &entry.vao);
+    applyVertexLayout(entry.vao, &layout);
+
+    // keep the load factor under 1/2
+    if ((cache->count + 1) * 2 > cache->capacity) {
+        vaoCacheGrow(cache);
+    }
+    vaoCacheInsert(cache->entries, cache->capacity, entry);
+    cache->count++;
+
+    return lean_io_result_mk_ok(lean_box_uint32(entry.vao));
+}
+
+// vertexArrayCacheStats : VertexArrayCache → IO (UInt64 × UInt64)
+//
+// (hits, misses)
+lean_obj_res lean_vertexarraycache_stats(b_lean_obj_arg lcache)
+{
+    vaoCache_t *cache = (vaoCache_t *)lean_get_external_data(lcache);
+    if (cache == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL cache passed to vertexArrayCacheStats")));
+    }
+    lean_object* tuple = lean_alloc_ctor(0, 2, 0);
+    lean_ctor_set(tuple, 0, lean_box_uint64(cache->hits));
+    lean_ctor_set(tuple, 1, lean_box_uint64(cache->misses));
+    return lean_io_result_mk_ok(tuple);
+}
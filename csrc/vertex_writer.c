@@ -0,0 +1,357 @@
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+
+#include "data_marshal.h"
+#include "vertex_layout.h"
+#include "vertex_pack.h"
+#include "attrib_compress.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Interleaved vertex writer. Attribute values come in as doubles (Lean Float) and are encoded into
+// the GPU type given by the VertexLayout, straight into a Lean ByteArray that can be handed to
+// glNamedBufferStorage_Bytes without another copy or conversion.
+//
+
+typedef struct {
+    vertexLayout_t layout;
+    uint32_t bindingIndex;
+    uint32_t stride;
+    uint8_t *currentVertex;  // staging for the per-vertex attrib/endVertex interface
+    lean_object *bytes;      // ByteArray being built, size = vertexCount * stride
+    size_t vertexCount;
+} vertexWriter_t;
+
+// the GLDataType tags, see convertGLDataType
+enum {
+    DT_BYTE = 0, DT_UNSIGNED_BYTE, DT_SHORT, DT_UNSIGNED_SHORT, DT_INT, DT_UNSIGNED_INT,
+    DT_FLOAT, DT_DOUBLE, DT_HALF_FLOAT, DT_INT_2_10_10_10_REV, DT_UNSIGNED_INT_2_10_10_10_REV
+};
+
+static size_t componentBytes(uint8_t dataType)
+{
+    switch (dataType) {
+        case DT_BYTE: case DT_UNSIGNED_BYTE: return 1;
+        case DT_SHORT: case DT_UNSIGNED_SHORT: case DT_HALF_FLOAT: return 2;
+        case DT_INT: case DT_UNSIGNED_INT: case DT_FLOAT: return 4;
+        case DT_DOUBLE: return 8;
+    }
+    return 0;
+}
+
+// bytes taken by one attribute in the vertex
+static size_t attributeBytes(const vertexAttribute_t *a)
+{
+    if (a->dataType == DT_INT_2_10_10_10_REV || a->dataType == DT_UNSIGNED_INT_2_10_10_10_REV) {
+        return 4;
+    }
+    return componentBytes(a->dataType) * a->size;
+}
+
+// encode one attribute. values always holds four components; missing ones were filled with (0,0,0,1).
+static void encodeAttribute(uint8_t *dst, const vertexAttribute_t *a, const double *values)
+{
+    float f[4] = { (float)values[0], (float)values[1], (float)values[2], (float)values[3] };
+    int normalized = a->normalized;
+
+    switch (a->dataType) {
+        case DT_BYTE:
+            for (uint32_t c=0; c < a->size; c++) {
+                ((int8_t *)dst)[c] = normalized ? packSnorm8(f[c]) : (int8_t)values[c];
+            }
+            break;
+        case DT_UNSIGNED_BYTE:
+            for (uint32_t c=0; c < a->size; c++) {
+                dst[c] = normalized ? packUnorm8(f[c]) : (uint8_t)values[c];
+            }
+            break;
+        case DT_SHORT:
+            for (uint32_t c=0; c < a->size; c++) {
+                int16_t v = normalized ? packSnorm16(f[c]) : (int16_t)values[c];
+                memcpy(dst + c*2, &v, 2);
+            }
+            break;
+        case DT_UNSIGNED_SHORT:
+            for (uint32_t c=0; c < a->size; c++) {
+                uint16_t v = normalized ? packUnorm16(f[c]) : (uint16_t)values[c];
+                memcpy(dst + c*2, &v, 2);
+            }
+            break;
+        case DT_INT:
+            for (uint32_t c=0; c < a->size; c++) {
+                int32_t v = (int32_t)values[c];
+                memcpy(dst + c*4, &v, 4);
+            }
+            break;
+        case DT_UNSIGNED_INT:
+            for (uint32_t c=0; c < a->size; c++) {
+                uint32_t v = (uint32_t)values[c];
+                memcpy(dst + c*4, &v, 4);
+            }
+            break;
+        case DT_FLOAT:
+            memcpy(dst, f, a->size * 4);
+            break;
+        case DT_DOUBLE:
+            memcpy(dst, values, a->size * 8);
+            break;
+        case DT_HALF_FLOAT:
+            for (uint32_t c=0; c < a->size; c++) {
+                uint16_t v = packHalf(f[c]);
+                memcpy(dst + c*2, &v, 2);
+            }
+            break;
+        case DT_INT_2_10_10_10_REV: {
+            uint32_t v;
+            if (normalized) {
+                v = packSnorm10_10_10_2(f[0], f[1], f[2], f[3]);
+            }
+            else {
+                v = ((uint32_t)(int32_t)values[0] & 0x3ff) | (((uint32_t)(int32_t)values[1] & 0x3ff) << 10)
+                  | (((uint32_t)(int32_t)values[2] & 0x3ff) << 20) | (((uint32_t)(int32_t)values[3] & 0x3) << 30);
+            }
+            memcpy(dst, &v, 4);
+            break;
+        }
+        case DT_UNSIGNED_INT_2_10_10_10_REV: {
+            uint32_t v;
+            if (normalized) {
+                v = packUnorm10_10_10_2(f[0], f[1], f[2], f[3]);
+            }
+            else {
+                v = ((uint32_t)values[0] & 0x3ff) | (((uint32_t)values[1] & 0x3ff) << 10)
+                  | (((uint32_t)values[2] & 0x3ff) << 20) | (((uint32_t)values[3] & 0x3) << 30);
+            }
+            memcpy(dst, &v, 4);
+            break;
+        }
+    }
+}
+
+static const vertexAttribute_t *findAttribute(const vertexWriter_t *writer, uint32_t attribIndex)
+{
+    for (uint32_t ix=0; ix < writer->layout.attributeCount; ix++) {
+        const vertexAttribute_t *a = &writer->layout.attributes[ix];
+        if (a->attribIndex == attribIndex && a->bindingIndex == writer->bindingIndex) {
+            return a;
+        }
+    }
+    return NULL;
+}
+
+// make room for at least vertexCount vertices, growing the ByteArray geometrically
+static void reserveVertices(vertexWriter_t *writer, size_t vertexCount)
+{
+    size_t needed = vertexCount * writer->stride;
+    size_t capacity = lean_sarray_capacity(writer->bytes);
+    if (needed <= capacity) {
+        return;
+    }
+    size_t newCapacity = capacity * 2 > needed ? capacity * 2 : needed;
+    size_t used = lean_sarray_size(writer->bytes);
+    lean_object *grown = lean_alloc_sarray(1, used, newCapacity);
+    memcpy(lean_sarray_cptr(grown), lean_sarray_cptr(writer->bytes), used);
+    lean_dec(writer->bytes);
+    writer->bytes = grown;
+}
+
+// vertices past the old count are zero filled, so attributes not yet streamed are well defined
+static void extendVertexCount(vertexWriter_t *writer, size_t vertexCount)
+{
+    if (vertexCount <= writer->vertexCount) {
+        return;
+    }
+    reserveVertices(writer, vertexCount);
+    uint8_t *base = lean_sarray_cptr(writer->bytes);
+    memset(base + writer->vertexCount * writer->stride, 0, (vertexCount - writer->vertexCount) * writer->stride);
+    writer->vertexCount = vertexCount;
+    lean_sarray_set_size(writer->bytes, vertexCount * writer->stride);
+}
+
+static lean_obj_res writerError(const char *message)
+{
+    return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string(message)));
+}
+
+// createVertexWriter : VertexLayout → (bindingIndex : UInt32) → (reserveVertices : UInt32) → IO VertexWriter
+//
+lean_obj_res lean_vertexwriter_create(b_lean_obj_arg layoutL, uint32_t bindingIndex, uint32_t reserve)
+{
+    vertexWriter_t *writer = calloc(1, sizeof(vertexWriter_t));
+    if (!unpackVertexLayout(layoutL, &writer->layout)) {
+        free(writer);
+        return writerError("Too many attributes or bindings in VertexLayout");
+    }
+    writer->bindingIndex = bindingIndex;
+
+    // stride comes from the binding; if the layout has no explicit binding entry use the packed size
+    int foundBinding = 0;
+    for (uint32_t ix=0; ix < writer->layout.bindingCount; ix++) {
+        if (writer->layout.bindings[ix].bindingIndex == bindingIndex) {
+            writer->stride = writer->layout.bindings[ix].stride;
+            foundBinding = 1;
+        }
+    }
+    for (uint32_t ix=0; ix < writer->layout.attributeCount; ix++) {
+        const vertexAttribute_t *a = &writer->layout.attributes[ix];
+        if (a->bindingIndex != bindingIndex) continue;
+        int packed = (a->dataType == DT_INT_2_10_10_10_REV || a->dataType == DT_UNSIGNED_INT_2_10_10_10_REV);
+        if (a->size < 1 || a->size > 4 || (packed && a->size != 4) || (!packed && componentBytes(a->dataType) == 0)) {
+            free(writer);
+            return writerError("Unsupported attribute size or type in createVertexWriter");
+        }
+        size_t end = a->relativeOffset + attributeBytes(a);
+        if (!foundBinding && end > writer->stride) {
+            writer->stride = (uint32_t)end;
+        }
+        else if (end > writer->stride) {
+            free(writer);
+            return writerError("Attribute extends past the binding stride in createVertexWriter");
+        }
+    }
+    if (writer->stride == 0) {
+        free(writer);
+        return writerError("No attributes use this binding in createVertexWriter");
+    }
+
+    writer->currentVertex = calloc(1, writer->stride);
+    writer->bytes = lean_alloc_sarray(1, 0, (size_t)(reserve > 0 ? reserve : 64) * writer->stride);
+    return lean_io_result_mk_ok(lean_mk_ptr(writer));
+}
+
+// destroyVertexWriter : VertexWriter → IO Unit
+//
+lean_obj_res lean_vertexwriter_destroy(lean_obj_arg lwriter)
+{
+    vertexWriter_t *writer = (vertexWriter_t *)lean_get_external_data(lwriter);
+    if (writer == NULL) {
+        return writerError("NULL writer passed to destroyVertexWriter");
+    }
+    if (writer->bytes != NULL) {
+        lean_dec(writer->bytes);
+    }
+    free(writer->currentVertex);
+    free(writer);
+    lean_clear_ptr(lwriter);
+    return lean_return_unit();
+}
+
+// vertexWriterAttrib : VertexWriter → (attribIndex : UInt32) → Float → Float → Float → Float → IO Unit
+//
+// sets an attribute of the vertex under construction. Values persist until changed, so
+// constant attributes only need to be set once.
+lean_obj_res lean_vertexwriter_attrib(b_lean_obj_arg lwriter, uint32_t attribIndex, double x, double y, double z, double w)
+{
+    vertexWriter_t *writer = (vertexWriter_t *)lean_get_external_data(lwriter);
+    if (writer == NULL) {
+        return writerError("NULL writer passed to vertexWriterAttrib");
+    }
+    const vertexAttribute_t *a = findAttribute(writer, attribIndex);
+    if (a == NULL) {
+        return writerError("vertexWriterAttrib: attribute not in this writer's binding");
+    }
+    double values[4] = { x, y, z, w };
+    encodeAttribute(writer->currentVertex + a->relativeOffset, a, values);
+    return lean_return_unit();
+}
+
+// vertexWriterEndVertex : VertexWriter → IO Unit
+//
+lean_obj_res lean_vertexwriter_endvertex(b_lean_obj_arg lwriter)
+{
+    vertexWriter_t *writer = (vertexWriter_t *)lean_get_external_data(lwriter);
+    if (writer == NULL) {
+        return writerError("NULL writer passed to vertexWriterEndVertex");
+    }
+    reserveVertices(writer, writer->vertexCount + 1);
+    memcpy(lean_sarray_cptr(writer->bytes) + writer->vertexCount * writer->stride, writer->currentVertex, writer->stride);
+    writer->vertexCount++;
+    lean_sarray_set_size(writer->bytes, writer->vertexCount * writer->stride);
+    return lean_return_unit();
+}
+
+// vertexWriterAppendStream : VertexWriter → (attribIndex : UInt32) → (firstVertex : UInt32) → (components : UInt32) → FloatArray → IO Unit
+//
+// bulk write of one attribute for consecutive vertices starting at firstVertex. The source holds
+// `components` values per vertex; missing components default to (0,0,0,1). The vertex count grows
+// to cover the stream.
+lean_obj_res lean_vertexwriter_appendstream(b_lean_obj_arg lwriter, uint32_t attribIndex, uint32_t firstVertex, uint32_t components, b_lean_obj_arg stream)
+{
+    vertexWriter_t *writer = (vertexWriter_t *)lean_get_external_data(lwriter);
+    if (writer == NULL) {
+        return writerError("NULL writer passed to vertexWriterAppendStream");
+    }
+    const vertexAttribute_t *a = findAttribute(writer, attribIndex);
+    if (a == NULL) {
+        return writerError("vertexWriterAppendStream: attribute not in this writer's binding");
+    }
+    if (components < 1 || components > 4) {
+        return writerError("vertexWriterAppendStream: components must be 1 to 4");
+    }
+    size_t valueCount = lean_sarray_size(stream);
+    if (valueCount % components != 0) {
+        return writerError("vertexWriterAppendStream: stream length is not a multiple of the component count");
+    }
+    size_t streamVertices = valueCount / components;
+    extendVertexCount(writer, (size_t)firstVertex + streamVertices);
+
+    const double *src = (const double *)lean_sarray_cptr(stream);
+    uint8_t *dst = lean_sarray_cptr(writer->bytes) + (size_t)firstVertex * writer->stride + a->relativeOffset;
+
+    if (a->dataType == DT_HALF_FLOAT) {
+        // convert the whole stream with the SIMD kernel, then scatter into the interleaved vertices
+        uint16_t *halves = malloc(valueCount * sizeof(uint16_t) + 1);
+        convertDoublesToHalves(src, halves, valueCount);
+        uint16_t defaults[4] = { packHalf(0.0f), packHalf(0.0f), packHalf(0.0f), packHalf(1.0f) };
+        for (size_t v=0; v < streamVertices; v++) {
+            for (uint32_t c=0; c < a->size; c++) {
+                uint16_t h = c < components ? halves[v * components + c] : defaults[c];
+                memcpy(dst + c*2, &h, 2);
+            }
+            dst += writer->stride;
+        }
+        free(halves);
+        return lean_return_unit();
+    }
+
+    double values[4] = { 0.0, 0.0, 0.0, 1.0 };
+    for (size_t v=0; v < streamVertices; v++) {
+        for (uint32_t c=0; c < components; c++) {
+            values[c] = src[v * components + c];
+        }
+        encodeAttribute(dst, a, values);
+        dst += writer->stride;
+    }
+    return lean_return_unit();
+}
+
+// vertexWriterVertexCount : VertexWriter → IO UInt32
+//
+lean_obj_res lean_vertexwriter_vertexcount(b_lean_obj_arg lwriter)
+{
+    vertexWriter_t *writer = (vertexWriter_t *)lean_get_external_data(lwriter);
+    if (writer == NULL) {
+        return writerError("NULL writer passed to vertexWriterVertexCount");
+    }
+    return lean_io_result_mk_ok(lean_box_uint32((uint32_t)writer->vertexCount));
+}
+
+// vertexWriterFinish : VertexWriter → IO ByteArray
+//
+// hands the interleaved data over to Lean and frees the writer
+lean_obj_res lean_vertexwriter_finish(lean_obj_arg lwriter)
+{
+    vertexWriter_t *writer = (vertexWriter_t *)lean_get_external_data(lwriter);
+    if (writer == NULL) {
+        return writerError("NULL writer passed to vertexWriterFinish");
+    }
+    lean_object *bytes = writer->bytes;
+    free(writer->currentVertex);
+    free(writer);
+    lean_clear_ptr(lwriter);
+    return lean_io_result_mk_ok(bytes);
+}
@@ -0,0 +1,397 @@
+#include <lean/lean.h>
+
+#include <glad/glad_context.h>
+#include <GLFW/glfw3.h>
+
+#include "data_marshal.h"
+#include "window_state.h"
+
+#include <stdlib.h>
+
+//
+// Input events without per-key polling. GLFW callbacks append timestamped records to a
+// per-window ring buffer while glfwPollEvents runs, and drainEvents hands everything queued so
+// far to Lean in one call, so input costs one FFI crossing per frame however many events there
+// are. The ring is lock-free single producer / single consumer, so the drain can also happen on
+// a different thread from the one polling.
+//
+
+windowState_t *getWindowState(GLFWwindow *window)
+{
+    windowState_t *state = glfwGetWindowUserPointer(window);
+    if (state == NULL) {
+        state = calloc(1, sizeof(windowState_t));
+        state->statsStart = glfwGetTimerValue();
+        glfwSetWindowUserPointer(window, state);
+    }
+    return state;
+}
+
+void destroyWindowState(GLFWwindow *window)
+{
+    windowState_t *state = glfwGetWindowUserPointer(window);
+    if (state != NULL) {
+        if (gladCurrentContext == state->gl) {
+            gladCurrentContext = NULL;
+        }
+        if (state->gl != NULL) {
+            gladFreeGLContext(state->gl);
+        }
+        free(state->gl);
+        free(state->ring.events);
+        free(state);
+        glfwSetWindowUserPointer(window, NULL);
+    }
+}
+
+/*inductive InputEventKind
+  | Key
+  | Char
+  | MouseButton
+  | CursorPos
+  | CursorEnter
+  | Scroll
+  | WindowSize
+  | FramebufferSize
+  | Focus
+  | Iconify
+  | Close
+  | Refresh
+*/
+enum {
+    EVENT_KEY, EVENT_CHAR, EVENT_MOUSE_BUTTON, EVENT_CURSOR_POS, EVENT_CURSOR_ENTER, EVENT_SCROLL,
+    EVENT_WINDOW_SIZE, EVENT_FRAMEBUFFER_SIZE, EVENT_FOCUS, EVENT_ICONIFY, EVENT_CLOSE, EVENT_REFRESH
+};
+
+/*inductive InputAction
+  | Release
+  | Press
+  | Repeat
+*/
+
+static void pushEvent(GLFWwindow *window, uint8_t kind, uint32_t code, uint32_t detail, uint8_t action, uint32_t mods, double x, double y)
+{
+    windowState_t *state = glfwGetWindowUserPointer(window);
+    if (state == NULL || state->ring.events == NULL) {
+        return;
+    }
+    eventRing_t *ring = &state->ring;
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if (head - tail > ring->mask) {
+        // full: keep the older events, a consumer that fell behind cares about ordering more
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return;
+    }
+    inputEvent_t *event = &ring->events[head & ring->mask];
+    event->time = glfwGetTimerValue();
+    event->x = x;
+    event->y = y;
+    event->code = code;
+    event->detail = detail;
+    event->mods = mods;
+    event->kind = kind;
+    event->action = action;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+static void keyCallback(GLFWwindow *window, int key, int scancode, int action, int mods)
+{
+    pushEvent(window, EVENT_KEY, (uint32_t)key, (uint32_t)scancode, (uint8_t)action, (uint32_t)mods, 0, 0);
+}
+
+static void charCallback(GLFWwindow *window, unsigned int codepoint)
+{
+    pushEvent(window, EVENT_CHAR, codepoint, 0, 0, 0, 0, 0);
+}
+
+static void mouseButtonCallback(GLFWwindow *window, int button, int action, int mods)
+{
+    pushEvent(window, EVENT_MOUSE_BUTTON, (uint32_t)button, 0, (uint8_t)action, (uint32_t)mods, 0, 0);
+}
+
+static void cursorPosCallback(GLFWwindow *window, double x, double y)
+{
+    pushEvent(window, EVENT_CURSOR_POS, 0, 0, 0, 0, x, y);
+}
+
+static void cursorEnterCallback(GLFWwindow *window, int entered)
+{
+    pushEvent(window, EVENT_CURSOR_ENTER, (uint32_t)entered, 0, 0, 0, 0, 0);
+}
+
+static void scrollCallback(GLFWwindow *window, double x, double y)
+{
+    pushEvent(window, EVENT_SCROLL, 0, 0, 0, 0, x, y);
+}
+
+static void windowSizeCallback(GLFWwindow *window, int width, int height)
+{
+    pushEvent(window, EVENT_WINDOW_SIZE, (uint32_t)width, (uint32_t)height, 0, 0, 0, 0);
+}
+
+static void framebufferSizeCallback(GLFWwindow *window, int width, int height)
+{
+    pushEvent(window, EVENT_FRAMEBUFFER_SIZE, (uint32_t)width, (uint32_t)height, 0, 0, 0, 0);
+}
+
+static void focusCallback(GLFWwindow *window, int focused)
+{
+    pushEvent(window, EVENT_FOCUS, (uint32_t)focused, 0, 0, 0, 0, 0);
+}
+
+static void iconifyCallback(GLFWwindow *window, int iconified)
+{
+    pushEvent(window, EVENT_ICONIFY, (uint32_t)iconified, 0, 0, 0, 0, 0);
+}
+
+static void closeCallback(GLFWwindow *window)
+{
+    pushEvent(window, EVENT_CLOSE, 0, 0, 0, 0, 0, 0);
+}
+
+static void refreshCallback(GLFWwindow *window)
+{
+    pushEvent(window, EVENT_REFRESH, 0, 0, 0, 0, 0, 0);
+}
+
+// glfwEnableEventQueue : @& Window → (capacity : UInt32) → IO Unit
+//
+lean_obj_res lean_glfw_enable_event_queue(b_lean_obj_arg lw, uint32_t capacity)
+{
+    GLFWwindow *window = (GLFWwindow *)(lean_get_external_data(lw));
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to glfwEnableEventQueue")));
+    }
+    windowState_t *state = getWindowState(window);
+    if (state->ring.events != NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("glfwEnableEventQueue: the window already has an event queue")));
+    }
+
+    uint32_t rounded = 16;
+    while (rounded < capacity && rounded < (1u << 20)) rounded <<= 1;
+    state->ring.events = malloc(sizeof(inputEvent_t) * rounded);
+    state->ring.mask = rounded - 1;
+    atomic_store(&state->ring.head, 0);
+    atomic_store(&state->ring.tail, 0);
+    atomic_store(&state->ring.dropped, 0);
+
+    glfwSetKeyCallback(window, keyCallback);
+    glfwSetCharCallback(window, charCallback);
+    glfwSetMouseButtonCallback(window, mouseButtonCallback);
+    glfwSetCursorPosCallback(window, cursorPosCallback);
+    glfwSetCursorEnterCallback(window, cursorEnterCallback);
+    glfwSetScrollCallback(window, scrollCallback);
+    glfwSetWindowSizeCallback(window, windowSizeCallback);
+    glfwSetFramebufferSizeCallback(window, framebufferSizeCallback);
+    glfwSetWindowFocusCallback(window, focusCallback);
+    glfwSetWindowIconifyCallback(window, iconifyCallback);
+    glfwSetWindowCloseCallback(window, closeCallback);
+    glfwSetWindowRefreshCallback(window, refreshCallback);
+
+    return lean_return_unit();
+}
+
+/*structure InputEvent where
+  timestamp : UInt64
+  x : Float
+  y : Float
+  code : UInt32
+  detail : UInt32
+  mods : UInt32
+  kind : InputEventKind
+  action : InputAction
+*/
+static lean_object *mkInputEvent(const inputEvent_t *event)
+{
+    lean_object *result = lean_alloc_ctor(0, 0, 38);
+    lean_ctor_set_uint64(result, 0, event->time);
+    lean_ctor_set_float(result, 8, event->x);
+    lean_ctor_set_float(result, 16, event->y);
+    lean_ctor_set_uint32(result, 24, event->code);
+    lean_ctor_set_uint32(result, 28, event->detail);
+    lean_ctor_set_uint32(result, 32, event->mods);
+    lean_ctor_set_uint8(result, 36, event->kind);
+    lean_ctor_set_uint8(result, 37, event->action);
+    return result;
+}
+
+// drainEvents : @& Window → IO (Array InputEvent)
+//
+lean_obj_res lean_glfw_drain_events(b_lean_obj_arg lw)
+{
+    GLFWwindow *window = (GLFWwindow *)(lean_get_external_data(lw));
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to drainEvents")));
+    }
+    windowState_t *state = glfwGetWindowUserPointer(window);
+    if (state == NULL || state->ring.events == NULL) {
+        return lean_io_result_mk_ok(lean_alloc_array(0, 0));
+    }
+
+    eventRing_t *ring = &state->ring;
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    uint32_t count = head - tail;
+
+    lean_object *events = lean_alloc_array(count, count);
+    for (uint32_t ix=0; ix < count; ix++) {
+        lean_array_cptr(events)[ix] = mkInputEvent(&ring->events[(tail + ix) & ring->mask]);
+    }
+    atomic_store_explicit(&ring->tail, head, memory_order_release);
+
+    return lean_io_result_mk_ok(events);
+}
+
+// droppedEventCount : @& Window → IO UInt64
+//
+lean_obj_res lean_glfw_dropped_event_count(b_lean_obj_arg lw)
+{
+    GLFWwindow *window = (GLFWwindow *)(lean_get_external_data(lw));
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to droppedEventCount")));
+    }
+    windowState_t *state = glfwGetWindowUserPointer(window);
+    uint64_t dropped = state == NULL ? 0 : atomic_load(&state->ring.dropped);
+    return lean_io_result_mk_ok(lean_box_uint64(dropped));
+}
+
+// requestRedraw : @& Window → IO Unit
+//
+// callable from any thread; wakes a waitForRedraw on the main thread
+lean_obj_res lean_glfw_request_redraw(b_lean_obj_arg lw)
+{
+    GLFWwindow *window = (GLFWwindow *)(lean_get_external_data(lw));
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to requestRedraw")));
+    }
+    // the state must already exist: creating it here would race with the main thread
+    windowState_t *state = glfwGetWindowUserPointer(window);
+    if (state == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("requestRedraw: call waitForRedraw or glfwEnableEventQueue on the window's thread first")));
+    }
+    atomic_store_explicit(&state->redrawRequested, 1, memory_order_release);
+    glfwPostEmptyEvent();
+    return lean_return_unit();
+}
+
+/*inductive WakeReason
+  | Input
+  | Redraw
+  | Timeout
+  | Close
+*/
+enum { WAKE_INPUT, WAKE_REDRAW, WAKE_TIMEOUT, WAKE_CLOSE };
+
+// sleeps until the window should close, a redraw is requested, input arrives or the deadline
+// passes (never, if forever)
+static uint8_t waitForWake(GLFWwindow *window, windowState_t *state, uint64_t deadline, int forever)
+{
+    uint64_t frequency = glfwGetTimerFrequency();
+    int hasQueue = state->ring.events != NULL;
+    for (;;) {
+        uint32_t headBefore = atomic_load_explicit(&state->ring.head, memory_order_relaxed);
+        uint64_t now = glfwGetTimerValue();
+        if (forever) {
+            glfwWaitEvents();
+        }
+        else if (now < deadline) {
+            glfwWaitEventsTimeout((double)(deadline - now) / (double)frequency);
+        }
+        else {
+            glfwPollEvents();
+        }
+        state->wakeups++;
+
+        if (glfwWindowShouldClose(window)) {
+            return WAKE_CLOSE;
+        }
+        // before anything else, so the empty event requestRedraw posts isn't taken for input
+        if (atomic_exchange_explicit(&state->redrawRequested, 0, memory_order_acquire)) {
+            return WAKE_REDRAW;
+        }
+        if (hasQueue && atomic_load_explicit(&state->ring.head, memory_order_relaxed) != headBefore) {
+            return WAKE_INPUT;
+        }
+        if (!forever && glfwGetTimerValue() >= deadline) {
+            return WAKE_TIMEOUT;
+        }
+        if (!hasQueue) {
+            return WAKE_INPUT;
+        }
+    }
+}
+
+// waitForRedraw : @& Window → (timeout : Float) → IO WakeReason
+//
+// Sleeps in glfwWaitEventsTimeout until there is a reason to draw a frame. A timeout of 0 or
+// less only polls, an infinite one waits without a deadline. With an event queue only wakeups
+// that queued something count as input, so the empty events other threads post are slept
+// through; without one any wakeup before the deadline does, as GLFW can't tell them apart.
+lean_obj_res lean_glfw_wait_for_redraw(b_lean_obj_arg lw, double timeout)
+{
+    GLFWwindow *window = (GLFWwindow *)(lean_get_external_data(lw));
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to waitForRedraw")));
+    }
+    windowState_t *state = getWindowState(window);
+    uint64_t frequency = glfwGetTimerFrequency();
+    uint64_t start = glfwGetTimerValue();
+    // NaN polls too; a deadline past the end of the timer range is the same as none
+    double ticks = timeout > 0.0 ? timeout * (double)frequency : 0.0;
+    int forever = ticks >= (double)(UINT64_MAX - start);
+    uint64_t deadline = forever ? UINT64_MAX : start + (uint64_t)ticks;
+    uint8_t reason;
+
+    if (glfwWindowShouldClose(window)) {
+        reason = WAKE_CLOSE;
+    }
+    else if (atomic_exchange_explicit(&state->redrawRequested, 0, memory_order_acquire)) {
+        reason = WAKE_REDRAW;
+    }
+    else {
+        reason = waitForWake(window, state, deadline, forever);
+    }
+
+    state->waitTicks += glfwGetTimerValue() - start;
+    if (reason == WAKE_REDRAW) {
+        state->redraws++;
+    }
+    return lean_io_result_mk_ok(lean_box(reason));
+}
+
+/*structure IdleStats where
+  elapsedTicks : UInt64
+  waitTicks : UInt64
+  wakeups : UInt64
+  redraws : UInt64
+  idlePercent : Float
+*/
+
+// idleStats : @& Window → (reset : Bool) → IO IdleStats
+//
+lean_obj_res lean_glfw_idle_stats(b_lean_obj_arg lw, uint8_t reset)
+{
+    GLFWwindow *window = (GLFWwindow *)(lean_get_external_data(lw));
+    if (window == NULL) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("NULL window pointer passed to idleStats")));
+    }
+    windowState_t *state = getWindowState(window);
+    uint64_t now = glfwGetTimerValue();
+    uint64_t elapsed = now - state->statsStart;
+
+    lean_object *result = lean_alloc_ctor(0, 0, 40);
+    lean_ctor_set_uint64(result, 0, elapsed);
+    lean_ctor_set_uint64(result, 8, state->waitTicks);
+    lean_ctor_set_uint64(result, 16, state->wakeups);
+    lean_ctor_set_uint64(result, 24, state->redraws);
+    lean_ctor_set_float(result, 32, elapsed == 0 ? 0.0 : 100.0 * (double)state->waitTicks / (double)elapsed);
+
+    if (reset) {
+        state->statsStart = now;
+        state->waitTicks = 0;
+        state->wakeups = 0;
+        state->redraws = 0;
+    }
+    return lean_io_result_mk_ok(result);
+}
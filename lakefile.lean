@@ -37,7 +37,26 @@ def cLibTarget (pkgDir : FilePath) : FileTarget :=
                             ffiOTarget pkgDir "glfw_ffi.c",
                             ffiOTarget pkgDir "opengl_ffi.c",
                             ffiOTarget pkgDir "data_marshal.c",
-                            ffiOTarget pkgDir "glad.c"
+                            ffiOTarget pkgDir "gpu_culling.c",
+                            ffiOTarget pkgDir "vertex_layout.c",
+                            ffiOTarget pkgDir "vertex_writer.c",
+                            ffiOTarget pkgDir "attrib_compress.c",
+                            ffiOTarget pkgDir "mesh_optimizer.c",
+                            ffiOTarget pkgDir "texture_streaming.c",
+                            ffiOTarget pkgDir "image_decode.c",
+                            ffiOTarget pkgDir "image_decode_pool.c",
+                            ffiOTarget pkgDir "texture_file.c",
+                            ffiOTarget pkgDir "mip_generate.c",
+                            ffiOTarget pkgDir "srgb_tables.c",
+                            ffiOTarget pkgDir "sampler_cache.c",
+                            ffiOTarget pkgDir "texture_atlas.c",
+                            ffiOTarget pkgDir "pixel_convert.c",
+                            ffiOTarget pkgDir "window_events.c",
+                            ffiOTarget pkgDir "render_thread.c",
+                            ffiOTarget pkgDir "upload_workers.c",
+                            ffiOTarget pkgDir "timing_histogram.c",
+                            ffiOTarget pkgDir "gl_loader.c",
+                            ffiOTarget pkgDir "glad_context.c"
                             ]
 
 
@@ -49,6 +68,6 @@ package GLFW (pkgDir) (args) {
   moreLibTargets := #[cLibTarget pkgDir]
 
   -- The final executable needs to link in glfw and gdi32 as well as the cLibTarget
-  moreLinkArgs := #["-L", glfwLibDir.toString, "-lglfw3", gdiFile.toString]
+  moreLinkArgs := #["-L", glfwLibDir.toString, "-lglfw3", gdiFile.toString, "-lpthread"]
 
 }
@@ -14,6 +14,50 @@ constant glfwTerminate : IO Unit
 @[extern "lean_glfw_create_window"]
 constant glfwCreateWindow : IO Window
 
+inductive ContextErrorMode
+  | Default
+  | Debug    -- KHR_debug output, slower
+  | NoError  -- GL errors become undefined behaviour, lets the driver skip validation
+
+-- size, framebuffer and context hints for glfwCreateWindowWithConfig. The defaults match
+-- glfwCreateWindow; production builds can drop to the minimal framebuffer they need.
+structure WindowConfig where
+  width : UInt32 := 640
+  height : UInt32 := 480
+  title : String := "Hello World"
+  contextMajor : UInt32 := 4
+  contextMinor : UInt32 := 5
+  samples : UInt32 := 0
+  depthBits : UInt32 := 24
+  stencilBits : UInt32 := 8
+  alphaBits : UInt32 := 8    -- forced to at least 8 for transparent windows
+  refreshRate : UInt32 := 0  -- 0 is don't care; only used with fullscreen
+  fullscreen : Bool := false -- on the primary monitor, in the video mode closest to width x height
+  coreProfile : Bool := false  -- a core profile for 3.2+, otherwise whatever profile the driver picks
+  visible : Bool := true
+  resizable : Bool := true
+  srgb : Bool := false
+  doubleBuffer : Bool := true
+  transparent : Bool := false
+  errorMode : ContextErrorMode := ContextErrorMode.Default
+
+@[extern "lean_glfw_create_window_with_config"]
+constant glfwCreateWindowWithConfig : @& WindowConfig → IO Window
+
+-- a hidden context sharing buffers, textures, programs and sync objects (but not vertex
+-- arrays or framebuffers) with the window's, to make current on a worker thread
+@[extern "lean_glfw_create_shared_context"]
+constant glfwCreateSharedContext : @& Window → IO Window
+
+-- selects GLFW's null platform when the library has one (3.4+), so no display server is needed
+@[extern "lean_glfw_init_headless"]
+constant glfwInitHeadless : IO Unit
+
+-- a hidden window that only owns a 4.5 context, for rendering into framebuffer objects
+-- on servers and CI. Tries EGL (Mesa llvmpipe works surfaceless), then OSMesa.
+@[extern "lean_glfw_create_headless_window"]
+constant glfwCreateHeadlessWindow : (width : UInt32) → (height : UInt32) → IO Window
+
 -- this makes the context and also calls the glad API loader
 @[extern "lean_glfw_make_context_current"]
 constant glfwMakeContextCurrent : @& Window → IO Unit
@@ -31,6 +75,15 @@ constant glfwWindowShouldClose : @& Window → IO Bool
 @[extern "lean_glfw_get_time"]
 constant glfwGetTime : IO Double
 
+-- the raw counter behind glfwGetTime, without going through a Float. For timing many short
+-- intervals see TimingHistogram in GLFW.Timing, which keeps the ticks on the C side.
+@[extern "lean_glfw_get_timer_value"]
+constant glfwGetTimerValue : IO UInt64
+
+-- ticks per second
+@[extern "lean_glfw_get_timer_frequency"]
+constant glfwGetTimerFrequency : IO UInt64
+
 @[extern "lean_glfw_swap_buffers"]
 constant glfwSwapBuffers : Window → IO Unit
 
@@ -40,4 +93,81 @@ constant glfwSwapInterval : Int → IO Unit
 @[extern "lean_glfw_poll_events"]
 constant glfwPollEvents : IO Unit
 
-end GLFW
\ No newline at end of file
+-- sleeps until at least one event has been processed
+@[extern "lean_glfw_wait_events"]
+constant glfwWaitEvents : IO Unit
+
+-- timeout in seconds
+@[extern "lean_glfw_wait_events_timeout"]
+constant glfwWaitEventsTimeout : (timeout : Float) → IO Unit
+
+-- wakes glfwWaitEvents on the main thread; safe to call from any thread
+@[extern "lean_glfw_post_empty_event"]
+constant glfwPostEmptyEvent : IO Unit
+
+structure FrameTick where
+  timestamp : UInt64          -- glfwGetTimerValue ticks, taken after polling
+  framebufferWidth : UInt32   -- current size, valid whether or not it changed
+  framebufferHeight : UInt32
+  eventCount : UInt32         -- events waiting for drainEvents, 0 without an event queue
+  shouldClose : Bool
+  framebufferResized : Bool   -- also true on the first tick
+
+-- glfwSwapBuffers, glfwPollEvents, glfwWindowShouldClose and the frame timestamp in one call
+@[extern "lean_glfw_frame_tick"]
+constant frameTick : @& Window → IO FrameTick
+
+inductive GLLoaderMode
+  | Eager  -- resolves every entry point when a context is first made current
+  | Lazy   -- installs trampolines that resolve each entry point on its first call
+
+-- load times in nanoseconds, summed over every context loaded in that mode
+structure GLLoaderStats where
+  eagerLoads : UInt64
+  eagerNanos : UInt64
+  lazyLoads : UInt64
+  lazyNanos : UInt64
+  lazyResolved : UInt64    -- entry points the current context has resolved on first use
+  extensionCount : UInt64  -- extensions of the current context
+
+-- affects contexts made current for the first time after the call. Lazy suits short-lived
+-- jobs that only touch a few dozen of the ~700 entry points.
+@[extern "lean_glfw_set_loader_mode"]
+constant glSetLoaderMode : GLLoaderMode → IO Unit
+
+@[extern "lean_glfw_loader_stats"]
+constant glLoaderStats : IO GLLoaderStats
+
+-- e.g. "GL_ARB_bindless_texture", checked against the current context
+@[extern "lean_glfw_has_extension"]
+constant glHasExtension : @& String → IO Bool
+
+-- limits and fast-path features of a context, queried once when it is first made current.
+-- A feature flag is set when either the core version or the extension provides it, so fast
+-- paths can branch on it and fall back otherwise (e.g. on Mesa's llvmpipe, which lacks bindless)
+structure GLCapabilities where
+  major : UInt32
+  minor : UInt32
+  maxTextureSize : UInt32
+  max3DTextureSize : UInt32
+  maxArrayTextureLayers : UInt32
+  maxSamples : UInt32
+  maxColorAttachments : UInt32
+  maxVertexAttribs : UInt32
+  maxUniformBlockSize : UInt32
+  maxShaderStorageBufferBindings : UInt32
+  maxComputeWorkGroupInvocations : UInt32
+  maxCombinedTextureImageUnits : UInt32
+  maxAnisotropy : Float              -- 0 without anisotropic filtering
+  maxShaderCompilerThreads : UInt32  -- 0 without KHR_parallel_shader_compile
+  bindlessTexture : Bool             -- ARB_bindless_texture
+  indirectParameters : Bool          -- 4.6 or ARB_indirect_parameters
+  parallelShaderCompile : Bool       -- KHR_parallel_shader_compile
+  spirv : Bool                       -- 4.6 or ARB_gl_spirv
+  anisotropicFiltering : Bool        -- 4.6 or EXT_texture_filter_anisotropic
+
+-- fails if the window's context has never been made current
+@[extern "lean_glfw_get_capabilities"]
+constant glGetCapabilities : @& Window → IO GLCapabilities
+
+end GLFW
@@ -0,0 +1,30 @@
+import GLFW.OpenGL
+
+namespace OpenGL
+
+--
+-- Bulk compression of attribute and texture data. Half floats use F16C/NEON where the CPU has it.
+-- Each result is packed little-endian, ready for glNamedBufferStorage_Bytes or glTextureSubImage2D.
+--
+
+-- 2 bytes per value: GLDataType.GLHalfFloat attributes or GLPixelType.HalfFloat texels (R16F etc.)
+@[extern "lean_pack_half_floats"]
+constant packHalfFloats : @& FloatArray → ByteArray
+
+@[extern "lean_unpack_half_floats"]
+constant unpackHalfFloats : @& ByteArray → FloatArray
+
+-- unit normals as xyz triplets to octahedral coordinates, two normalized GLShort per normal (4 bytes).
+-- The shader has to decode these.
+@[extern "lean_pack_octahedral_normals"]
+constant packOctahedralNormals : @& FloatArray → ByteArray
+
+-- unit normals as xyz triplets to one GLInt2_10_10_10Rev (normalized, size 4) per normal, w = 0
+@[extern "lean_pack_normals_10_10_10_2"]
+constant packNormals10_10_10_2 : @& FloatArray → ByteArray
+
+-- rgba quadruples in [0,1] to four normalized GLUnsignedByte per color
+@[extern "lean_pack_colors_unorm8"]
+constant packColorsUnorm8 : @& FloatArray → ByteArray
+
+end OpenGL
@@ -0,0 +1,51 @@
+import GLFW
+import GLFW.WindowEvents
+
+namespace GLFW
+
+--
+-- Render on demand for tool UIs and dashboards: instead of drawing at the refresh rate, the
+-- loop sleeps in glfwWaitEventsTimeout until input arrives, a timer runs out or another thread
+-- asks for a redraw, so an idle window costs next to no CPU.
+--
+
+inductive WakeReason
+  | Input    -- events were processed (queued ones, if glfwEnableEventQueue is on)
+  | Redraw   -- requestRedraw was called
+  | Timeout
+  | Close    -- the window should close
+  deriving BEq
+
+-- times are glfwGetTimerValue ticks since the last reset
+structure IdleStats where
+  elapsedTicks : UInt64
+  waitTicks : UInt64
+  wakeups : UInt64
+  redraws : UInt64    -- waits that ended in Redraw
+  idlePercent : Float  -- share of elapsed time spent asleep in waitForRedraw
+
+-- safe from any thread, once the window has been waited on or had its event queue enabled
+@[extern "lean_glfw_request_redraw"]
+constant requestRedraw : @& Window → IO Unit
+
+-- timeout in seconds, 0 to only poll, inf to wait without one; must be called on the main thread
+@[extern "lean_glfw_wait_for_redraw"]
+constant waitForRedraw : @& Window → (timeout : Float) → IO WakeReason
+
+@[extern "lean_glfw_idle_stats"]
+constant idleStats : @& Window → (reset : Bool) → IO IdleStats
+
+partial def onDemandLoop (w : Window) (timeout : Float) (frame : WakeReason → IO Unit) : IO Unit := do
+  let reason <- waitForRedraw w timeout
+  if reason == WakeReason.Close then
+    return ()
+  frame reason
+  onDemandLoop w timeout frame
+
+-- draws one frame up front and then one per wakeup, until the window closes. The timeout is
+-- the period of any timer-driven content (clocks, polling dashboards); frame sees Timeout then.
+def runOnDemand (w : Window) (timeout : Float) (frame : WakeReason → IO Unit) : IO Unit := do
+  frame WakeReason.Redraw
+  onDemandLoop w timeout frame
+
+end GLFW
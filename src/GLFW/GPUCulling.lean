@@ -0,0 +1,51 @@
+import GLFW.OpenGL
+
+namespace OpenGL
+
+--
+-- GPU driven frustum culling. A compute pass tests a bounding sphere per instance against the
+-- view frustum and compacts the visible draw commands into an indirect buffer, counting them with
+-- an atomic counter. The draw reads the count straight from that counter so the CPU never waits on
+-- the result.
+--
+
+constant GPUCullerT : NonemptyType
+def GPUCuller := GPUCullerT.type
+
+-- same layout as the GL DrawElementsIndirectCommand. baseVertex is a signed GLint on the GPU.
+structure DrawElementsIndirectCommand where
+  count : UInt32
+  instanceCount : UInt32
+  firstIndex : UInt32
+  baseVertex : UInt32
+  baseInstance : UInt32
+
+-- pack commands into a ByteArray for glNamedBufferStorage_Bytes, for use as the culling templates
+@[extern "lean_pack_draw_elements_commands"]
+constant packDrawElementsCommands : @& Array DrawElementsIndirectCommand → ByteArray
+
+-- compiles the culling compute shader and allocates the output buffers. Needs a current context.
+@[extern "lean_gpuculler_create"]
+constant createGPUCuller : (maxInstances : UInt32) → IO GPUCuller
+
+@[extern "lean_gpuculler_destroy"]
+constant destroyGPUCuller : GPUCuller → IO Unit
+
+-- boundsBuffer holds one vec4 (center xyz, radius w) per instance and commandTemplates one
+-- DrawElementsIndirectCommand per instance. Each visible instance is drawn with
+-- baseInstance set to its instance index.
+@[extern "lean_gpuculler_cull"]
+constant gpuCull : @& GPUCuller → (viewProjection : @& FloatArray) → (boundsBuffer : GLBufferObject) → (commandTemplates : GLBufferObject) → (instanceCount : UInt32) → IO Unit
+
+-- draws the survivors of the last gpuCull. Uses glMultiDrawElementsIndirectCount when the driver has it
+-- (4.6 or ARB_indirect_parameters), otherwise a plain multi-draw over zeroed trailing commands.
+@[extern "lean_gpuculler_draw"]
+constant gpuCullDraw : @& GPUCuller → GLDrawMode → (indexType : GLDataType) → GLVertexArrayObject → IO Unit
+
+-- (compacted command buffer, visible count buffer). gpuCull only orders its writes before
+-- indirect draws: issue glMemoryBarrier [MemoryBarrierFlags.BufferUpdateBarrier] before
+-- reading either buffer back with glGetNamedBufferSubData.
+@[extern "lean_gpuculler_output_buffers"]
+constant gpuCullerOutputBuffers : @& GPUCuller → IO (GLBufferObject × GLBufferObject)
+
+end OpenGL
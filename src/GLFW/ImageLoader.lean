@@ -0,0 +1,46 @@
+import GLFW.OpenGL
+
+namespace OpenGL
+
+--
+-- Threaded texture loading. PNG and QOI files are read and decoded to RGBA8 on a pool of
+-- worker threads; imageDecoderUploadCompleted runs on the GL thread and only creates the
+-- textures and uploads the pixels for images that have finished decoding.
+--
+
+constant ImageDecoderT : NonemptyType
+def ImageDecoder := ImageDecoderT.type
+
+structure DecodedTexture where
+  error : String          -- empty on success, texture is 0 otherwise
+  jobId : UInt64
+  texture : GLTextureObject
+  width : UInt32
+  height : UInt32
+
+@[extern "lean_imagedecoder_create"]
+constant createImageDecoder : (threads : UInt32) → IO ImageDecoder
+
+-- joins the workers. Images not yet handed back by imageDecoderUploadCompleted are dropped.
+@[extern "lean_imagedecoder_destroy"]
+constant destroyImageDecoder : ImageDecoder → IO Unit
+
+-- queues a file and returns its job id. The file is read on a worker thread.
+@[extern "lean_imagedecoder_submitfile"]
+constant imageDecoderSubmitFile : @& ImageDecoder → @& String → IO UInt64
+
+-- queues an already loaded PNG or QOI image; the bytes are copied
+@[extern "lean_imagedecoder_submitbytes"]
+constant imageDecoderSubmitBytes : @& ImageDecoder → @& ByteArray → IO UInt64
+
+-- jobs submitted but not yet returned by imageDecoderUploadCompleted
+@[extern "lean_imagedecoder_pending"]
+constant imageDecoderPending : @& ImageDecoder → IO UInt32
+
+-- uploads up to maxUploads finished images as RGBA8 textures with the given number of mip
+-- levels (the chain is generated by the GPU). With wait set this blocks until at least one
+-- image is ready, unless nothing is pending.
+@[extern "lean_imagedecoder_uploadcompleted"]
+constant imageDecoderUploadCompleted : @& ImageDecoder → (maxUploads : UInt32) → (levels : UInt32) → (wait : Bool) → IO (Array DecodedTexture)
+
+end OpenGL
@@ -0,0 +1,27 @@
+import GLFW.OpenGL
+
+namespace OpenGL
+
+--
+-- Index buffer optimization for indexed triangle lists. Triangles are reordered for the
+-- post-transform vertex cache (Forsyth), then vertices are renumbered in order of first use
+-- for fetch locality. ACMR (vertices transformed per triangle, FIFO cache of 16) is reported
+-- before and after.
+--
+
+structure OptimizedIndices where
+  indices : ByteArray         -- packed as indexType, ready for glNamedBufferStorage_Bytes
+  vertexRemap : Array UInt32  -- new index of each original vertex, 0xFFFFFFFF if unused
+  acmrBefore : Float
+  acmrAfter : Float
+  vertexCount : UInt32        -- vertices used after remapping
+  indexType : GLDataType      -- GLUnsignedShort when vertexCount allows, else GLUnsignedInt
+
+@[extern "lean_optimize_indices"]
+constant optimizeIndices : @& Array UInt32 → (vertexCount : UInt32) → IO OptimizedIndices
+
+-- reorder interleaved vertex data to match vertexRemap, dropping unused vertices
+@[extern "lean_remap_vertices"]
+constant remapVertices : @& ByteArray → (stride : UInt32) → @& Array UInt32 → (newVertexCount : UInt32) → ByteArray
+
+end OpenGL
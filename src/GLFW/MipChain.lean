@@ -0,0 +1,40 @@
+import GLFW.OpenGL
+
+namespace OpenGL
+
+--
+-- CPU mip chain generation for asset processing, when the driver filter behind
+-- glGenerateTextureMipmap isn't good enough. Filtering is separable, in linear float, with
+-- SSE/NEON multiply-adds; each level is filtered from the unrounded previous one.
+--
+
+inductive MipFilter
+  | Box
+  | Kaiser  -- Kaiser windowed sinc, sharper than the box filter
+
+-- number of levels in a full chain down to 1x1
+def mipLevelCount (width height : UInt32) : UInt32 := Id.run do
+  let mut size := max width height
+  let mut levels := 1
+  while size > 1 do
+    size := size / 2
+    levels := levels + 1
+  return levels
+
+-- base is tightly packed RGBA8. Returns levels 1 .. levels-1 (clamped to the full chain), each
+-- RGBA8 at half the size of the one before. With srgb the colour channels are filtered in
+-- linear space, alpha is always filtered as is.
+@[extern "lean_generate_mip_chain"]
+constant generateMipChain : @& ByteArray → (width : UInt32) → (height : UInt32) → (levels : UInt32) → MipFilter → (srgb : Bool) → IO (Array ByteArray)
+
+-- uploads a base level and the output of generateMipChain into RGBA8 or SRGB8Alpha8 storage
+def uploadMipChain (texture : GLTextureObject) (width height : UInt32) (base : ByteArray) (chain : Array ByteArray) : IO Unit := do
+  glTextureSubImage2D texture 0 0 0 width height GLPixelFormat.RGBA GLPixelType.UByte base
+  let mut w := width
+  let mut h := height
+  for level in [0:chain.size] do
+    w := max 1 (w / 2)
+    h := max 1 (h / 2)
+    glTextureSubImage2D texture (level + 1).toUInt32 0 0 w h GLPixelFormat.RGBA GLPixelType.UByte chain[level]
+
+end OpenGL
@@ -50,6 +50,11 @@ inductive BufferTarget
 | ElementBuffer
 | TextureBuffer
 | UniformBuffer
+| ShaderStorageBuffer
+| AtomicCounterBuffer
+| DrawIndirectBuffer
+| DispatchIndirectBuffer
+| ParameterBuffer     -- draw count source for the *IndirectCount draws (4.6 or ARB_indirect_parameters)
 
 @[extern "lean_convert_gl_buffer_target"]
 constant convertGLBufferTarget : BufferTarget → UInt32
@@ -57,6 +62,13 @@ constant convertGLBufferTarget : BufferTarget → UInt32
 @[extern "lean_opengl_glbindbuffer"]
 constant glBindBuffer : BufferTarget → GLBufferObject → IO Unit
 
+-- only for the indexed targets: UniformBuffer, ShaderStorageBuffer and AtomicCounterBuffer
+@[extern "lean_opengl_glbindbufferbase"]
+constant glBindBufferBase : BufferTarget → (index : UInt32) → GLBufferObject → IO Unit
+
+@[extern "lean_opengl_glbindbufferrange"]
+constant glBindBufferRange : BufferTarget → (index : UInt32) → GLBufferObject → (offset : UInt64) → (size : UInt64) → IO Unit
+
 inductive BufferFrequency
 | StreamBuffer   -- written once and used a few times
 | StaticBuffer   -- written once, used many times
@@ -151,6 +163,37 @@ constant glGetUniformLocation : GLProgramObject → String → IO UInt32
 @[extern "lean_opengl_programuniformmatrix4fv"]
 constant glProgramUniformMatrix4fv : GLProgramObject → (location : UInt32) → FloatArray → IO Unit
 
+--
+-- compute dispatch
+--
+
+@[extern "lean_opengl_dispatchcompute"]
+constant glDispatchCompute : (groupsX : UInt32) → (groupsY : UInt32) → (groupsZ : UInt32) → IO Unit
+
+-- group counts are read from the buffer bound to BufferTarget.DispatchIndirectBuffer
+@[extern "lean_opengl_dispatchcomputeindirect"]
+constant glDispatchComputeIndirect : (offset : UInt64) → IO Unit
+
+inductive MemoryBarrierFlags
+  | VertexAttribArrayBarrier
+  | ElementArrayBarrier
+  | UniformBarrier
+  | TextureFetchBarrier
+  | ShaderImageAccessBarrier
+  | CommandBarrier
+  | PixelBufferBarrier
+  | TextureUpdateBarrier
+  | BufferUpdateBarrier
+  | FramebufferBarrier
+  | AtomicCounterBarrier
+  | ShaderStorageBarrier
+  | ClientMappedBufferBarrier
+  | QueryBufferBarrier
+  | AllBarriers
+
+@[extern "lean_opengl_memorybarrier"]
+constant glMemoryBarrier : List MemoryBarrierFlags → IO Unit
+
 
 
 
@@ -179,6 +222,9 @@ constant glBindVertexBuffer : (bindingIndex : UInt32) → GLBufferObject → (of
 @[extern "lean_opengl_glvertexarrayvertexbuffer"]
 constant glVertexArrayVertexBuffer : GLVertexArrayObject → (bindingIndex : UInt32) → GLBufferObject → (offset : UInt64) → (stride : UInt64) → IO Unit
 
+@[extern "lean_opengl_glvertexarrayelementbuffer"]
+constant glVertexArrayElementBuffer : GLVertexArrayObject → GLBufferObject → IO Unit
+
 @[extern "lean_opengl_enablevertexattribarray"]
 constant glEnableVertexAttribArray : (attribIndex : UInt32) → IO Unit
 
@@ -200,6 +246,9 @@ inductive GLDataType where
   | GLUnsignedInt
   | GLFloat
   | GLDouble
+  | GLHalfFloat
+  | GLInt2_10_10_10Rev          -- packed, size must be 4
+  | GLUnsignedInt2_10_10_10Rev  -- packed, size must be 4
 
 @[extern "lean_opengl_vertexattribformat"]
 constant glVertexAttribFormat : (attribIndex : UInt32) → (size : UInt64) → GLDataType → (normalized : Bool) → (relativeOffset : UInt64) → IO Unit
@@ -223,6 +272,14 @@ inductive GLDrawMode where
 @[extern "lean_opengl_drawarrays"]
 constant glDrawArrays : GLDrawMode → (first : UInt64) → (count : UInt64) → IO Unit
 
+-- indices come from the element buffer of the bound VAO, starting at byte offset
+@[extern "lean_opengl_drawelements"]
+constant glDrawElements : GLDrawMode → (count : UInt64) → (indexType : GLDataType) → (offset : UInt64) → IO Unit
+
+-- commands are read from the buffer bound to BufferTarget.DrawIndirectBuffer
+@[extern "lean_opengl_multidrawelementsindirect"]
+constant glMultiDrawElementsIndirect : GLDrawMode → (indexType : GLDataType) → (indirectOffset : UInt64) → (drawCount : UInt32) → (stride : UInt32) → IO Unit
+
 def GLTextureObject := UInt32
 
 instance : ToString GLTextureObject where
@@ -232,6 +289,12 @@ inductive GLTextureTarget
   | GLTexture1D
   | GLTexture2D
   | GLTexture3D
+  | GLTexture1DArray
+  | GLTexture2DArray
+  | GLTextureCubeMap
+  | GLTextureCubeMapArray
+  | GLTexture2DMultisample
+  | GLTexture2DMultisampleArray
 
 @[extern "lean_opengl_createtextures"]
 constant glCreateTextures : GLTextureTarget → (count : UInt32) → IO (Array GLTextureObject)
@@ -246,10 +309,54 @@ inductive GLSizedTextureFormat
   | RGBA8
   | R16F
   | R32F
+  | SRGB8Alpha8
+  | RGBA16F
+  -- block compressed formats, use glCompressedTextureSubImage2D/3D to upload
+  | BC1RGB             -- S3TC DXT1
+  | BC1RGBA
+  | BC1SRGB
+  | BC1SRGBAlpha
+  | BC2                -- DXT3
+  | BC2SRGB
+  | BC3                -- DXT5
+  | BC3SRGB
+  | BC4                -- RGTC1
+  | BC4Signed
+  | BC5                -- RGTC2
+  | BC5Signed
+  | BC6HUnsignedFloat  -- BPTC float
+  | BC6HSignedFloat
+  | BC7                -- BPTC
+  | BC7SRGB
+  -- depth and stencil formats, for render targets and shadow maps
+  | Depth16
+  | Depth24
+  | Depth32F
+  | Depth24Stencil8
+  | Depth32FStencil8
+  | Stencil8
+  -- HDR and packed render target formats
+  | RGBA32F
+  | R11FG11FB10F
+  | RGB10A2
 
 @[extern "lean_opengl_texturestorage2d"]
 constant glTextureStorage2D : GLTextureObject → (levels : UInt32) → GLSizedTextureFormat → (width : UInt32) → (height : UInt32) → IO Unit
 
+@[extern "lean_opengl_texturestorage1d"]
+constant glTextureStorage1D : GLTextureObject → (levels : UInt32) → GLSizedTextureFormat → (width : UInt32) → IO Unit
+
+-- for 3D and 2D array textures; depth is the layer count for arrays and layers * 6 for cube map arrays.
+-- Cube maps and 1D arrays use glTextureStorage2D (height is the layer count for 1D arrays).
+@[extern "lean_opengl_texturestorage3d"]
+constant glTextureStorage3D : GLTextureObject → (levels : UInt32) → GLSizedTextureFormat → (width : UInt32) → (height : UInt32) → (depth : UInt32) → IO Unit
+
+@[extern "lean_opengl_texturestorage2dmultisample"]
+constant glTextureStorage2DMultisample : GLTextureObject → (samples : UInt32) → GLSizedTextureFormat → (width : UInt32) → (height : UInt32) → (fixedSampleLocations : Bool) → IO Unit
+
+@[extern "lean_opengl_texturestorage3dmultisample"]
+constant glTextureStorage3DMultisample : GLTextureObject → (samples : UInt32) → GLSizedTextureFormat → (width : UInt32) → (height : UInt32) → (depth : UInt32) → (fixedSampleLocations : Bool) → IO Unit
+
 
 inductive GLPixelFormat
 | Red
@@ -269,11 +376,270 @@ inductive GLPixelType
 | UInt
 | Int
 | Float
+| HalfFloat  -- e.g. R16F data from packHalfFloats
 
 @[extern "lean_opengl_texturesubimage2d"]
 constant glTextureSubImage2D : GLTextureObject → (level : UInt32) → (xoffset : Int32) → (yoffset : Int32) → (width : UInt32) → (height :  UInt32) → GLPixelFormat → GLPixelType → ByteArray → IO Unit
 
+@[extern "lean_opengl_texturesubimage1d"]
+constant glTextureSubImage1D : GLTextureObject → (level : UInt32) → (xoffset : UInt32) → (width : UInt32) → GLPixelFormat → GLPixelType → @& ByteArray → IO Unit
+
+-- zoffset and depth select array layers, or faces (layer * 6 + face) of cube map textures
+@[extern "lean_opengl_texturesubimage3d"]
+constant glTextureSubImage3D : GLTextureObject → (level : UInt32) → (xoffset : UInt32) → (yoffset : UInt32) → (zoffset : UInt32) → (width : UInt32) → (height : UInt32) → (depth : UInt32) → GLPixelFormat → GLPixelType → @& ByteArray → IO Unit
+
+-- the ByteArray holds whole 4x4 blocks; its size is passed as the image size
+@[extern "lean_opengl_compressedtexturesubimage2d"]
+constant glCompressedTextureSubImage2D : GLTextureObject → (level : UInt32) → (xoffset : UInt32) → (yoffset : UInt32) → (width : UInt32) → (height : UInt32) → GLSizedTextureFormat → @& ByteArray → IO Unit
+
+@[extern "lean_opengl_compressedtexturesubimage3d"]
+constant glCompressedTextureSubImage3D : GLTextureObject → (level : UInt32) → (xoffset : UInt32) → (yoffset : UInt32) → (zoffset : UInt32) → (width : UInt32) → (height : UInt32) → (depth : UInt32) → GLSizedTextureFormat → @& ByteArray → IO Unit
+
+-- fills levels 1.. of the storage from level 0 with the driver's (usually box) filter
+@[extern "lean_opengl_generatetexturemipmap"]
+constant glGenerateTextureMipmap : GLTextureObject → IO Unit
+
 @[extern "lean_opengl_bindtextureunit"]
 constant glBindTextureUnit : (unit : UInt32) → GLTextureObject → IO Unit
 
+inductive GLTextureFilter
+  | Nearest
+  | Linear
+  | NearestMipmapNearest
+  | LinearMipmapNearest
+  | NearestMipmapLinear
+  | LinearMipmapLinear
+
+inductive GLTextureWrap
+  | Repeat
+  | MirroredRepeat
+  | ClampToEdge
+  | ClampToBorder
+  | MirrorClampToEdge
+
+inductive GLCompareFunc
+  | Never
+  | Less
+  | Equal
+  | LessEqual
+  | Greater
+  | NotEqual
+  | GreaterEqual
+  | Always
+
+-- the default minification filter uses mipmaps; a texture with one level needs Linear or
+-- Nearest here or it is incomplete
+@[extern "lean_opengl_textureparameterfilter"]
+constant glTextureParameterFilter : GLTextureObject → (minFilter : GLTextureFilter) → (magFilter : GLTextureFilter) → IO Unit
+
+@[extern "lean_opengl_textureparameterwrap"]
+constant glTextureParameterWrap : GLTextureObject → (s : GLTextureWrap) → (t : GLTextureWrap) → (r : GLTextureWrap) → IO Unit
+
+@[extern "lean_opengl_textureparameterlevels"]
+constant glTextureParameterLevels : GLTextureObject → (baseLevel : UInt32) → (maxLevel : UInt32) → IO Unit
+
+-- 4.6 core, or EXT_texture_filter_anisotropic
+@[extern "lean_opengl_textureparameteranisotropy"]
+constant glTextureParameterAnisotropy : GLTextureObject → (maxAnisotropy : Float) → IO Unit
+
+def GLSamplerObject := UInt32
+
+instance : ToString GLSamplerObject where
+    toString x := let (y : UInt32) := x; "GLSampler: " ++ toString y
+
+@[extern "lean_opengl_createsamplers"]
+constant glCreateSamplers : (count : UInt32) → IO (Array GLSamplerObject)
+
+@[extern "lean_opengl_deletesamplers"]
+constant glDeleteSamplers : Array GLSamplerObject → IO Unit
+
+@[extern "lean_opengl_samplerparameterfilter"]
+constant glSamplerParameterFilter : GLSamplerObject → (minFilter : GLTextureFilter) → (magFilter : GLTextureFilter) → IO Unit
+
+@[extern "lean_opengl_samplerparameterwrap"]
+constant glSamplerParameterWrap : GLSamplerObject → (s : GLTextureWrap) → (t : GLTextureWrap) → (r : GLTextureWrap) → IO Unit
+
+@[extern "lean_opengl_samplerparameteranisotropy"]
+constant glSamplerParameterAnisotropy : GLSamplerObject → (maxAnisotropy : Float) → IO Unit
+
+@[extern "lean_opengl_samplerparameterlod"]
+constant glSamplerParameterLod : GLSamplerObject → (minLod : Float) → (maxLod : Float) → (lodBias : Float) → IO Unit
+
+-- depth comparison for shadow samplers
+@[extern "lean_opengl_samplerparametercompare"]
+constant glSamplerParameterCompare : GLSamplerObject → (enabled : Bool) → GLCompareFunc → IO Unit
+
+-- a sampler bound to a unit overrides the sampling state of the texture on that unit
+@[extern "lean_opengl_bindsampler"]
+constant glBindSampler : (unit : UInt32) → GLSamplerObject → IO Unit
+
+-- binds textures to units first, first+1, ... in one call; a 0 entry unbinds that unit
+@[extern "lean_opengl_bindtextures"]
+constant glBindTextures : (first : UInt32) → @& Array GLTextureObject → IO Unit
+
+@[extern "lean_opengl_bindsamplers"]
+constant glBindSamplers : (first : UInt32) → @& Array GLSamplerObject → IO Unit
+
+def GLFramebufferObject := UInt32
+
+instance : ToString GLFramebufferObject where
+    toString x := let (y : UInt32) := x; "GLFramebuffer: " ++ toString y
+
+def GLRenderbufferObject := UInt32
+
+instance : ToString GLRenderbufferObject where
+    toString x := let (y : UInt32) := x; "GLRenderbuffer: " ++ toString y
+
+-- framebuffer 0 is the window's default framebuffer
+def defaultFramebuffer : GLFramebufferObject := (0 : UInt32)
+
+inductive GLFramebufferTarget
+  | DrawFramebuffer
+  | ReadFramebuffer
+  | Framebuffer  -- both draw and read
+
+inductive GLFramebufferAttachment
+  | Color0
+  | Color1
+  | Color2
+  | Color3
+  | Color4
+  | Color5
+  | Color6
+  | Color7
+  | Depth
+  | Stencil
+  | DepthStencil
+  -- the default framebuffer's buffers, only for glInvalidateNamedFramebufferData on
+  -- defaultFramebuffer
+  | BackColor
+  | BackDepth
+  | BackStencil
+
+-- what a fragment output is written to, or pixels are read from
+inductive GLDrawBuffer
+  | Color0
+  | Color1
+  | Color2
+  | Color3
+  | Color4
+  | Color5
+  | Color6
+  | Color7
+  | None
+  -- the default framebuffer's back buffer, only valid with defaultFramebuffer
+  | Back
+
+inductive GLFramebufferStatus
+  | Complete
+  | Undefined
+  | IncompleteAttachment
+  | MissingAttachment
+  | IncompleteDrawBuffer
+  | IncompleteReadBuffer
+  | Unsupported
+  | IncompleteMultisample
+  | IncompleteLayerTargets
+  | UnknownStatus
+
+@[extern "lean_opengl_createframebuffers"]
+constant glCreateFramebuffers : (count : UInt32) → IO (Array GLFramebufferObject)
+
+@[extern "lean_opengl_deleteframebuffers"]
+constant glDeleteFramebuffers : Array GLFramebufferObject → IO Unit
+
+@[extern "lean_opengl_bindframebuffer"]
+constant glBindFramebuffer : GLFramebufferTarget → GLFramebufferObject → IO Unit
+
+@[extern "lean_opengl_namedframebuffertexture"]
+constant glNamedFramebufferTexture : GLFramebufferObject → GLFramebufferAttachment → GLTextureObject → (level : UInt32) → IO Unit
+
+-- attaches one layer of an array, cube or 3D texture
+@[extern "lean_opengl_namedframebuffertexturelayer"]
+constant glNamedFramebufferTextureLayer : GLFramebufferObject → GLFramebufferAttachment → GLTextureObject → (level : UInt32) → (layer : UInt32) → IO Unit
+
+@[extern "lean_opengl_namedframebufferrenderbuffer"]
+constant glNamedFramebufferRenderbuffer : GLFramebufferObject → GLFramebufferAttachment → GLRenderbufferObject → IO Unit
+
+-- fragment output i goes to the i'th buffer in the array, or is discarded for None
+@[extern "lean_opengl_namedframebufferdrawbuffers"]
+constant glNamedFramebufferDrawBuffers : GLFramebufferObject → @& Array GLDrawBuffer → IO Unit
+
+@[extern "lean_opengl_namedframebufferreadbuffer"]
+constant glNamedFramebufferReadBuffer : GLFramebufferObject → GLDrawBuffer → IO Unit
+
+@[extern "lean_opengl_checknamedframebufferstatus"]
+constant glCheckNamedFramebufferStatus : GLFramebufferObject → GLFramebufferTarget → IO GLFramebufferStatus
+
+-- clears one draw buffer (an index into the draw buffers, not an attachment)
+@[extern "lean_opengl_clearnamedframebuffercolor"]
+constant glClearNamedFramebufferColor : GLFramebufferObject → (drawBuffer : UInt32) → (r : Float) → (g : Float) → (b : Float) → (a : Float) → IO Unit
+
+@[extern "lean_opengl_clearnamedframebufferdepth"]
+constant glClearNamedFramebufferDepth : GLFramebufferObject → (depth : Float) → IO Unit
+
+@[extern "lean_opengl_clearnamedframebufferdepthstencil"]
+constant glClearNamedFramebufferDepthStencil : GLFramebufferObject → (depth : Float) → (stencil : UInt32) → IO Unit
+
+-- tells the driver the contents are no longer needed, e.g. depth after the last pass that
+-- reads it, so tiled GPUs can skip storing it and multisample buffers skip the resolve
+@[extern "lean_opengl_invalidatenamedframebufferdata"]
+constant glInvalidateNamedFramebufferData : GLFramebufferObject → @& Array GLFramebufferAttachment → IO Unit
+
+-- bits from glClearBits select which buffers are copied; depth and stencil need Nearest
+@[extern "lean_opengl_blitnamedframebuffer"]
+constant glBlitNamedFramebuffer : (read : GLFramebufferObject) → (draw : GLFramebufferObject) → (srcX0 : UInt32) → (srcY0 : UInt32) → (srcX1 : UInt32) → (srcY1 : UInt32) → (dstX0 : UInt32) → (dstY0 : UInt32) → (dstX1 : UInt32) → (dstY1 : UInt32) → (bits : UInt64) → GLTextureFilter → IO Unit
+
+@[extern "lean_opengl_createrenderbuffers"]
+constant glCreateRenderbuffers : (count : UInt32) → IO (Array GLRenderbufferObject)
+
+@[extern "lean_opengl_deleterenderbuffers"]
+constant glDeleteRenderbuffers : Array GLRenderbufferObject → IO Unit
+
+@[extern "lean_opengl_namedrenderbufferstorage"]
+constant glNamedRenderbufferStorage : GLRenderbufferObject → GLSizedTextureFormat → (width : UInt32) → (height : UInt32) → IO Unit
+
+@[extern "lean_opengl_namedrenderbufferstoragemultisample"]
+constant glNamedRenderbufferStorageMultisample : GLRenderbufferObject → (samples : UInt32) → GLSizedTextureFormat → (width : UInt32) → (height : UInt32) → IO Unit
+
+@[extern "lean_opengl_finish"]
+constant glFinish : IO Unit
+
+-- reads the bound read framebuffer's read buffer; rows are tightly packed, bottom row first
+@[extern "lean_opengl_readpixels"]
+constant glReadPixels : (x : UInt32) → (y : UInt32) → (width : UInt32) → (height : UInt32) → GLPixelFormat → GLPixelType → IO ByteArray
+
+-- reads back a whole mip level, all layers or faces included
+@[extern "lean_opengl_gettextureimage"]
+constant glGetTextureImage : GLTextureObject → (level : UInt32) → GLPixelFormat → GLPixelType → IO ByteArray
+
+-- synchronous readback of a buffer range, for tests and debugging
+@[extern "lean_opengl_getnamedbuffersubdata"]
+constant glGetNamedBufferSubData : GLBufferObject → (offset : UInt64) → (size : UInt64) → IO ByteArray
+
+@[extern "lean_opengl_flush"]
+constant glFlush : IO Unit
+
+-- sync objects are shared between contexts, so a fence set on an upload context can be
+-- waited on from the main one
+def GLSyncObject := UInt64
+
+inductive GLSyncStatus
+  | AlreadySignaled
+  | TimeoutExpired
+  | ConditionSatisfied
+  | WaitFailed
+
+@[extern "lean_opengl_fencesync"]
+constant glFenceSync : IO GLSyncObject
+
+@[extern "lean_opengl_deletesync"]
+constant glDeleteSync : GLSyncObject → IO Unit
+
+@[extern "lean_opengl_clientwaitsync"]
+constant glClientWaitSync : GLSyncObject → (flush : Bool) → (timeoutNanos : UInt64) → IO GLSyncStatus
+
+@[extern "lean_opengl_waitsync"]
+constant glWaitSync : GLSyncObject → IO Unit
+
 end OpenGL
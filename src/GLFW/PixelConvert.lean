@@ -0,0 +1,42 @@
+import GLFW.OpenGL
+
+namespace OpenGL
+
+--
+-- Pixel format conversion before glTextureSubImage2D, using SSSE3/SSE2 or NEON where
+-- available. Conversions that don't grow the data reuse the input ByteArray when nothing
+-- else references it, so threading one buffer through a chain of conversions doesn't copy.
+--
+
+-- tightly packed RGB8 to RGBA8 with a constant alpha; always allocates
+@[extern "lean_pixels_rgb_to_rgba"]
+constant pixelsRGBToRGBA : @& ByteArray → (alpha : UInt8) → ByteArray
+
+@[extern "lean_pixels_rgba_to_rgb"]
+constant pixelsRGBAToRGB : ByteArray → ByteArray
+
+-- RGBA8 <-> BGRA8
+@[extern "lean_pixels_swap_red_blue"]
+constant pixelsSwapRedBlue : ByteArray → ByteArray
+
+-- RGBA8, colour channels scaled by alpha with exact rounding
+@[extern "lean_pixels_premultiply_alpha"]
+constant pixelsPremultiplyAlpha : ByteArray → ByteArray
+
+-- 8 bit lookup tables. With channels = 4 every fourth byte (alpha) is left alone,
+-- otherwise every byte is converted.
+@[extern "lean_pixels_srgb_to_linear"]
+constant pixelsSrgbToLinear : ByteArray → (channels : UInt32) → ByteArray
+
+@[extern "lean_pixels_linear_to_srgb"]
+constant pixelsLinearToSrgb : ByteArray → (channels : UInt32) → ByteArray
+
+-- GLPixelType.UShort data to UByte, rounded
+@[extern "lean_pixels_unorm16_to_unorm8"]
+constant pixelsUnorm16ToUnorm8 : ByteArray → ByteArray
+
+-- 32 bit float texels to GLPixelType.HalfFloat
+@[extern "lean_pixels_float_to_half"]
+constant pixelsFloatToHalf : ByteArray → ByteArray
+
+end OpenGL
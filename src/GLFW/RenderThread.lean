@@ -0,0 +1,98 @@
+import GLFW
+import GLFW.OpenGL
+
+namespace OpenGL
+
+open GLFW
+
+--
+-- Optional render thread mode. createRenderThread moves the window's context onto a C-owned
+-- thread; Lean code then records GL work into CommandBuffers and submits them, and the render
+-- thread executes them (swapping when it reaches cmdSwap) while Lean gets on with the next
+-- frame. Event polling stays on the main thread. Submission blocks when queueDepth buffers are
+-- already waiting, which bounds how far the simulation can run ahead.
+--
+
+constant RenderThreadT : NonemptyType
+def RenderThread := RenderThreadT.type
+
+-- the binary command encoding, appended to in place by the cmd* functions
+def CommandBuffer := ByteArray
+
+def CommandBuffer.empty : CommandBuffer := ByteArray.mkEmpty 4096
+
+-- latencies are glfwGetTimerValue ticks from submission to the start of execution
+structure RenderThreadStats where
+  submitted : UInt64
+  executed : UInt64
+  queued : UInt64
+  backpressureWaits : UInt64  -- submissions that found the queue full
+  backpressureTicks : UInt64
+  totalLatencyTicks : UInt64
+  maxLatencyTicks : UInt64
+  executeTicks : UInt64
+
+@[extern "lean_cmd_viewport"]
+constant cmdViewport : CommandBuffer → (x : UInt32) → (y : UInt32) → (width : UInt32) → (height : UInt32) → CommandBuffer
+
+-- clears color attachment 0 and depth
+@[extern "lean_cmd_clear"]
+constant cmdClear : CommandBuffer → GLFramebufferObject → (r : Float) → (g : Float) → (b : Float) → (a : Float) → (depth : Float) → CommandBuffer
+
+@[extern "lean_cmd_bind_framebuffer"]
+constant cmdBindFramebuffer : CommandBuffer → GLFramebufferObject → CommandBuffer
+
+@[extern "lean_cmd_use_program"]
+constant cmdUseProgram : CommandBuffer → GLProgramObject → CommandBuffer
+
+@[extern "lean_cmd_bind_vertex_array"]
+constant cmdBindVertexArray : CommandBuffer → GLVertexArrayObject → CommandBuffer
+
+@[extern "lean_cmd_bind_texture_unit"]
+constant cmdBindTextureUnit : CommandBuffer → (unit : UInt32) → GLTextureObject → CommandBuffer
+
+@[extern "lean_cmd_bind_sampler"]
+constant cmdBindSampler : CommandBuffer → (unit : UInt32) → GLSamplerObject → CommandBuffer
+
+@[extern "lean_cmd_uniform_4f"]
+constant cmdUniform4f : CommandBuffer → GLProgramObject → (location : UInt32) → (x : Float) → (y : Float) → (z : Float) → (w : Float) → CommandBuffer
+
+-- the first 16 values of the array, column major
+@[extern "lean_cmd_uniform_matrix_4f"]
+constant cmdUniformMatrix4f : CommandBuffer → GLProgramObject → (location : UInt32) → @& FloatArray → CommandBuffer
+
+@[extern "lean_cmd_draw_arrays"]
+constant cmdDrawArrays : CommandBuffer → GLDrawMode → (first : UInt32) → (count : UInt32) → (instances : UInt32) → CommandBuffer
+
+@[extern "lean_cmd_draw_elements"]
+constant cmdDrawElements : CommandBuffer → GLDrawMode → (indexType : GLDataType) → (count : UInt32) → (offset : UInt64) → (instances : UInt32) → CommandBuffer
+
+-- the data is copied into the command buffer; fails for 64 MiB or more, which doesn't fit
+-- the command's length field
+@[extern "lean_cmd_buffer_sub_data"]
+constant cmdBufferSubData : CommandBuffer → GLBufferObject → (offset : UInt64) → @& ByteArray → IO CommandBuffer
+
+@[extern "lean_cmd_swap"]
+constant cmdSwap : CommandBuffer → CommandBuffer
+
+-- releases the context on the calling thread; fails if it can't be made current on the new one
+@[extern "lean_renderthread_create"]
+constant createRenderThread : @& Window → (queueDepth : UInt32) → IO RenderThread
+
+-- executes everything already submitted, then stops; call glfwMakeContextCurrent to use the
+-- context on the calling thread again
+@[extern "lean_renderthread_destroy"]
+constant destroyRenderThread : RenderThread → IO Unit
+
+-- the buffer is validated and copied, so it can be reused for the next frame
+@[extern "lean_renderthread_submit"]
+constant submitCommands : @& RenderThread → @& CommandBuffer → IO Unit
+
+-- blocks until every submitted buffer has been executed
+@[extern "lean_renderthread_wait_idle"]
+constant waitRenderIdle : @& RenderThread → IO Unit
+
+@[extern "lean_renderthread_stats"]
+constant renderThreadStats : @& RenderThread → IO RenderThreadStats
+
+end OpenGL
@@ -0,0 +1,41 @@
+import GLFW.OpenGL
+
+namespace OpenGL
+
+--
+-- Sampler objects keyed by their state. Every request for the same description returns the
+-- same GL sampler, so materials can describe their sampling declaratively and bind the result
+-- with glBindSamplers.
+--
+
+structure SamplerDescription where
+  minFilter : GLTextureFilter := GLTextureFilter.LinearMipmapLinear
+  magFilter : GLTextureFilter := GLTextureFilter.Linear
+  wrapS : GLTextureWrap := GLTextureWrap.Repeat
+  wrapT : GLTextureWrap := GLTextureWrap.Repeat
+  wrapR : GLTextureWrap := GLTextureWrap.Repeat
+  maxAnisotropy : Float := 1.0  -- values above 1 need anisotropic filtering support
+  minLod : Float := -1000.0
+  maxLod : Float := 1000.0
+  lodBias : Float := 0.0
+  depthCompare : Bool := false
+  compareFunc : GLCompareFunc := GLCompareFunc.LessEqual
+
+constant SamplerCacheT : NonemptyType
+def SamplerCache := SamplerCacheT.type
+
+@[extern "lean_samplercache_create"]
+constant createSamplerCache : IO SamplerCache
+
+-- deletes all the samplers handed out by the cache
+@[extern "lean_samplercache_destroy"]
+constant destroySamplerCache : SamplerCache → IO Unit
+
+@[extern "lean_samplercache_get"]
+constant getCachedSampler : @& SamplerCache → @& SamplerDescription → IO GLSamplerObject
+
+-- (hits, misses)
+@[extern "lean_samplercache_stats"]
+constant samplerCacheStats : @& SamplerCache → IO (UInt64 × UInt64)
+
+end OpenGL
@@ -0,0 +1,69 @@
+import GLFW.OpenGL
+
+namespace OpenGL
+
+--
+-- Runtime atlas for small RGBA8 images such as UI icons and glyphs. Images are skyline packed
+-- into the layers of one 2D array texture and uploaded incrementally, so a whole UI can be
+-- drawn with one texture bound. Sample with the region's UVs and layer.
+--
+-- Removed images leave dead space until the atlas is repacked, which happens automatically
+-- when an add would otherwise fail. Repacking moves images: re-query regions with atlasRegion
+-- whenever atlasGeneration changes.
+--
+
+constant TextureAtlasT : NonemptyType
+def TextureAtlas := TextureAtlasT.type
+
+structure AtlasRegion where
+  u0 : Float
+  v0 : Float
+  u1 : Float
+  v1 : Float
+  id : UInt32
+  layer : UInt32
+
+structure TextureAtlasStats where
+  liveImages : UInt64
+  liveTexels : UInt64
+  deadTexels : UInt64  -- space held by removed images until the next repack
+  repacks : UInt64
+  bytesUploaded : UInt64
+  occupancy : Float    -- live texels / total texels
+
+-- creates a size x size x layers RGBA8 array texture (linear filtering, clamped). padding
+-- empty texels are kept right of and below each image so linear filtering doesn't bleed.
+@[extern "lean_textureatlas_create"]
+constant createTextureAtlas : (size : UInt32) → (layers : UInt32) → (padding : UInt32) → IO TextureAtlas
+
+-- deletes the texture and the CPU copies of the images
+@[extern "lean_textureatlas_destroy"]
+constant destroyTextureAtlas : TextureAtlas → IO Unit
+
+@[extern "lean_textureatlas_texture"]
+constant atlasTexture : @& TextureAtlas → GLTextureObject
+
+-- packs and uploads a tightly packed RGBA8 image. none if it doesn't fit even after a repack.
+@[extern "lean_textureatlas_add"]
+constant atlasAdd : @& TextureAtlas → (width : UInt32) → (height : UInt32) → @& ByteArray → IO (Option AtlasRegion)
+
+-- the id may be handed out again by a later atlasAdd
+@[extern "lean_textureatlas_remove"]
+constant atlasRemove : @& TextureAtlas → (id : UInt32) → IO Unit
+
+@[extern "lean_textureatlas_region"]
+constant atlasRegion : @& TextureAtlas → (id : UInt32) → IO AtlasRegion
+
+-- reclaims dead space by packing every live image again; false (and nothing moved) if they no
+-- longer fit
+@[extern "lean_textureatlas_repack"]
+constant atlasRepack : @& TextureAtlas → IO Bool
+
+-- bumped by every repack
+@[extern "lean_textureatlas_generation"]
+constant atlasGeneration : @& TextureAtlas → IO UInt64
+
+@[extern "lean_textureatlas_stats"]
+constant textureAtlasStats : @& TextureAtlas → IO TextureAtlasStats
+
+end OpenGL
@@ -0,0 +1,27 @@
+import GLFW.OpenGL
+
+namespace OpenGL
+
+--
+-- KTX2 and DDS loading. The file is memory mapped and each mip level is uploaded straight from
+-- the mapping with glCompressedTextureSubImage*, no intermediate copies. Handles BC1-BC7,
+-- RGBA8, SRGB8Alpha8 and RGBA16F in 2D, 3D, 2D array, cube and cube array textures. The mip
+-- chain in the file is used as is; supercompressed KTX2 (zstd/basis) is not supported.
+--
+
+structure LoadedTexture where
+  texture : GLTextureObject
+  width : UInt32
+  height : UInt32
+  depth : UInt32
+  layers : UInt32           -- array layers * faces, 6 for a cube map
+  levels : UInt32
+  target : GLTextureTarget
+  format : GLSizedTextureFormat
+
+-- picks the target from the file, allocates immutable storage and uploads every level.
+-- Needs a current GL 4.5 context.
+@[extern "lean_texturefile_load"]
+constant loadTextureFile : @& String → IO LoadedTexture
+
+end OpenGL
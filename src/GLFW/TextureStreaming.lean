@@ -0,0 +1,40 @@
+import GLFW.OpenGL
+
+namespace OpenGL
+
+--
+-- Streamed texture uploads through a persistently mapped pixel unpack buffer ring. Pixel data
+-- is copied into the ring and the sub-image is sourced from the buffer, so the upload doesn't
+-- block on the driver copying client memory. Call textureStreamerEndFrame once per frame: it
+-- fences that frame's part of the ring, and writes only wait when they catch up with a region
+-- the GPU is still reading.
+--
+
+constant TextureStreamerT : NonemptyType
+def TextureStreamer := TextureStreamerT.type
+
+structure TextureStreamerStats where
+  bytesUploaded : UInt64
+  uploads : UInt64
+  stalls : UInt64       -- uploads that had to wait for the GPU
+  stallNanos : UInt64
+  bytesPerSecond : Float  -- averaged since the streamer was created
+
+-- needs OpenGL 4.4 (persistent mapping). The ring should hold a few frames' worth of uploads.
+@[extern "lean_texturestreamer_create"]
+constant createTextureStreamer : (ringBytes : UInt64) → IO TextureStreamer
+
+-- waits for outstanding uploads, then unmaps and deletes the ring
+@[extern "lean_texturestreamer_destroy"]
+constant destroyTextureStreamer : TextureStreamer → IO Unit
+
+@[extern "lean_texturestreamer_subimage2d"]
+constant streamTextureSubImage2D : @& TextureStreamer → GLTextureObject → (level : UInt32) → (xoffset : UInt32) → (yoffset : UInt32) → (width : UInt32) → (height : UInt32) → GLPixelFormat → GLPixelType → @& ByteArray → IO Unit
+
+@[extern "lean_texturestreamer_endframe"]
+constant textureStreamerEndFrame : @& TextureStreamer → IO Unit
+
+@[extern "lean_texturestreamer_stats"]
+constant textureStreamerStats : @& TextureStreamer → IO TextureStreamerStats
+
+end OpenGL
@@ -0,0 +1,57 @@
+import GLFW
+
+namespace GLFW
+
+--
+-- Low-overhead interval timing for profiling. timingBegin and timingEnd read the GLFW timer on
+-- the C side and record the elapsed time into a preallocated log-linear histogram, so timing a
+-- scope never boxes a Float or a tick count. Summaries report nanoseconds; percentiles are
+-- accurate to within 12.5%. A histogram is not thread safe: use one per thread.
+--
+
+constant TimingHistogramT : NonemptyType
+def TimingHistogram := TimingHistogramT.type
+
+structure TimingSummary where
+  count : UInt64
+  totalNanos : UInt64
+  minNanos : UInt64
+  maxNanos : UInt64
+  p50Nanos : UInt64
+  p90Nanos : UInt64
+  p99Nanos : UInt64
+
+-- call after glfwInit
+@[extern "lean_timing_histogram_create"]
+constant createTimingHistogram : IO TimingHistogram
+
+@[extern "lean_timing_histogram_destroy"]
+constant destroyTimingHistogram : TimingHistogram → IO Unit
+
+-- scopes nest up to 16 deep on one histogram
+@[extern "lean_timing_begin"]
+constant timingBegin : @& TimingHistogram → IO Unit
+
+-- records the time since the innermost open timingBegin
+@[extern "lean_timing_end"]
+constant timingEnd : @& TimingHistogram → IO Unit
+
+-- an interval measured elsewhere, in glfwGetTimerValue ticks
+@[extern "lean_timing_record"]
+constant recordTiming : @& TimingHistogram → (ticks : UInt64) → IO Unit
+
+@[extern "lean_timing_summary"]
+constant timingSummary : @& TimingHistogram → (reset : Bool) → IO TimingSummary
+
+-- times `action` into the histogram, also when it throws
+def withTiming (h : TimingHistogram) (action : IO α) : IO α := do
+  timingBegin h
+  try action finally timingEnd h
+
+def TimingSummary.meanNanos (s : TimingSummary) : UInt64 :=
+  if s.count == 0 then 0 else s.totalNanos / s.count
+
+instance : ToString TimingSummary where
+  toString s := s!"{s.count} samples, mean {s.meanNanos} ns, min {s.minNanos} ns, p50 {s.p50Nanos} ns, p90 {s.p90Nanos} ns, p99 {s.p99Nanos} ns, max {s.maxNanos} ns"
+
+end GLFW
@@ -0,0 +1,44 @@
+import GLFW
+import GLFW.OpenGL
+
+namespace OpenGL
+
+open GLFW
+
+--
+-- Resource creation off the render thread. Each worker owns a hidden context shared with the
+-- main window's and runs upload jobs on it: any IO action using the GL bindings, returning the
+-- names of the objects it made (buffers, textures, programs). collectUploads hands the names
+-- back only once the fence set after the job has signalled, so the main thread can use them
+-- straight away. Vertex arrays and framebuffers aren't shared; create those on the main thread.
+--
+
+constant UploadWorkersT : NonemptyType
+def UploadWorkers := UploadWorkersT.type
+
+structure UploadCompletion where
+  names : Array UInt32  -- whatever the job returned; empty if it failed
+  error : String        -- empty on success
+  jobId : UInt64
+
+-- creates the shared contexts, so call on the main thread
+@[extern "lean_uploadworkers_create"]
+constant createUploadWorkers : @& Window → (workerCount : UInt32) → IO UploadWorkers
+
+-- runs the jobs already queued before stopping; objects from uncollected jobs stay alive
+@[extern "lean_uploadworkers_destroy"]
+constant destroyUploadWorkers : UploadWorkers → IO Unit
+
+-- returns the job id reported in its completion
+@[extern "lean_uploadworkers_submit"]
+constant submitUpload : @& UploadWorkers → IO (Array UInt32) → IO UInt64
+
+-- finished jobs whose GPU work is complete; with wait, blocks until every submitted job is
+-- done. Call with the main context current.
+@[extern "lean_uploadworkers_collect"]
+constant collectUploads : @& UploadWorkers → (wait : Bool) → IO (Array UploadCompletion)
+
+@[extern "lean_uploadworkers_pending"]
+constant pendingUploads : @& UploadWorkers → IO UInt32
+
+end OpenGL
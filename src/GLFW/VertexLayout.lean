@@ -0,0 +1,60 @@
+import GLFW.OpenGL
+
+namespace OpenGL
+
+--
+-- Declarative vertex formats. A VertexLayout describes every attribute and buffer binding of a VAO
+-- and is applied in a single FFI call instead of four calls per attribute.
+--
+
+structure VertexAttribute where
+  attribIndex : UInt32
+  bindingIndex : UInt32
+  size : UInt32            -- number of components, 1 to 4
+  relativeOffset : UInt32  -- byte offset within the vertex
+  dataType : GLDataType
+  normalized : Bool
+
+structure VertexBinding where
+  bindingIndex : UInt32
+  stride : UInt32
+  divisor : UInt32  -- 0 for per-vertex data, n to advance once every n instances
+
+structure VertexLayout where
+  attributes : Array VertexAttribute
+  bindings : Array VertexBinding
+
+@[extern "lean_vertex_layout_hash"]
+constant vertexLayoutHash : @& VertexLayout → UInt64
+
+-- enable, format and bind every attribute and set the binding divisors
+@[extern "lean_opengl_applyvertexlayout"]
+constant glApplyVertexLayout : GLVertexArrayObject → @& VertexLayout → IO Unit
+
+-- bind one buffer per layout binding (in the order of VertexLayout.bindings), with the layout strides
+@[extern "lean_opengl_bindvertexlayoutbuffers"]
+constant glBindVertexLayoutBuffers : GLVertexArrayObject → @& VertexLayout → (buffers : @& Array GLBufferObject) → (offsets : @& Array UInt64) → IO Unit
+
+--
+-- VAO cache: identical layouts share a single VAO. Meshes then only swap their buffers with
+-- glBindVertexLayoutBuffers/glVertexArrayElementBuffer before drawing.
+--
+
+constant VertexArrayCacheT : NonemptyType
+def VertexArrayCache := VertexArrayCacheT.type
+
+@[extern "lean_vertexarraycache_create"]
+constant createVertexArrayCache : IO VertexArrayCache
+
+-- deletes all the VAOs handed out by the cache
+@[extern "lean_vertexarraycache_destroy"]
+constant destroyVertexArrayCache : VertexArrayCache → IO Unit
+
+@[extern "lean_vertexarraycache_get"]
+constant getCachedVertexArray : @& VertexArrayCache → @& VertexLayout → IO GLVertexArrayObject
+
+-- (hits, misses)
+@[extern "lean_vertexarraycache_stats"]
+constant vertexArrayCacheStats : @& VertexArrayCache → IO (UInt64 × UInt64)
+
+end OpenGL
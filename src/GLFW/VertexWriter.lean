@@ -0,0 +1,44 @@
+import GLFW.OpenGL
+import GLFW.VertexLayout
+
+namespace OpenGL
+
+--
+-- Builds interleaved vertex data for one binding of a VertexLayout. Each attribute is encoded in
+-- the layout's GPU type (float, half, normalized 8/16 bit, packed 10-10-10-2...) directly into a
+-- ByteArray, ready for glNamedBufferStorage_Bytes.
+--
+
+constant VertexWriterT : NonemptyType
+def VertexWriter := VertexWriterT.type
+
+-- the stride comes from the layout binding, or the packed attribute size if the layout has no binding entry
+@[extern "lean_vertexwriter_create"]
+constant createVertexWriter : @& VertexLayout → (bindingIndex : UInt32) → (reserveVertices : UInt32) → IO VertexWriter
+
+-- frees a writer without producing its data
+@[extern "lean_vertexwriter_destroy"]
+constant destroyVertexWriter : VertexWriter → IO Unit
+
+-- set an attribute of the current vertex; unused components are ignored.
+-- Values stick until changed, so per-mesh constants only need setting once.
+@[extern "lean_vertexwriter_attrib"]
+constant vertexWriterAttrib : @& VertexWriter → (attribIndex : UInt32) → Float → Float → Float → Float → IO Unit
+
+-- append the current vertex
+@[extern "lean_vertexwriter_endvertex"]
+constant vertexWriterEndVertex : @& VertexWriter → IO Unit
+
+-- bulk write of a whole attribute stream starting at firstVertex, `components` values per vertex
+-- (missing components default to 0,0,0,1). Grows the vertex count to fit.
+@[extern "lean_vertexwriter_appendstream"]
+constant vertexWriterAppendStream : @& VertexWriter → (attribIndex : UInt32) → (firstVertex : UInt32) → (components : UInt32) → @& FloatArray → IO Unit
+
+@[extern "lean_vertexwriter_vertexcount"]
+constant vertexWriterVertexCount : @& VertexWriter → IO UInt32
+
+-- returns the interleaved data and frees the writer
+@[extern "lean_vertexwriter_finish"]
+constant vertexWriterFinish : VertexWriter → IO ByteArray
+
+end OpenGL
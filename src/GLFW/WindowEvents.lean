@@ -0,0 +1,61 @@
+import GLFW
+
+namespace GLFW
+
+--
+-- Input as a queue instead of per-key polling. Once enabled, GLFW's callbacks record every key,
+-- character, mouse, scroll, resize and focus event with a glfwGetTimerValue timestamp, and
+-- drainEvents returns everything since the last drain in a single call.
+--
+
+inductive InputEventKind
+  | Key
+  | Char
+  | MouseButton
+  | CursorPos
+  | CursorEnter
+  | Scroll
+  | WindowSize
+  | FramebufferSize
+  | Focus
+  | Iconify
+  | Close
+  | Refresh
+  deriving BEq
+
+inductive InputAction
+  | Release
+  | Press
+  | Repeat
+  deriving BEq
+
+-- which fields are meaningful depends on the kind:
+--   Key: code is the GLFW key (GLFW_KEY_UNKNOWN wraps to 0xFFFFFFFF), detail the scancode
+--   Char: code is the unicode codepoint
+--   MouseButton: code is the button
+--   CursorPos, Scroll: x and y
+--   CursorEnter, Focus, Iconify: code is 1 or 0
+--   WindowSize, FramebufferSize: code is the width, detail the height
+structure InputEvent where
+  timestamp : UInt64  -- glfwGetTimerValue ticks
+  x : Float
+  y : Float
+  code : UInt32
+  detail : UInt32
+  mods : UInt32
+  kind : InputEventKind
+  action : InputAction
+
+-- installs the callbacks; capacity is rounded up to a power of two. Events arriving while the
+-- queue is full are dropped and counted.
+@[extern "lean_glfw_enable_event_queue"]
+constant glfwEnableEventQueue : @& Window → (capacity : UInt32) → IO Unit
+
+-- everything queued since the last call, oldest first; empty if the queue isn't enabled
+@[extern "lean_glfw_drain_events"]
+constant drainEvents : @& Window → IO (Array InputEvent)
+
+@[extern "lean_glfw_dropped_event_count"]
+constant droppedEventCount : @& Window → IO UInt64
+
+end GLFW
@@ -1,5 +1,22 @@
 import GLFW
 import GLFW.OpenGL
+import GLFW.GPUCulling
+import GLFW.VertexLayout
+import GLFW.VertexWriter
+import GLFW.AttribCompress
+import GLFW.MeshOptimizer
+import GLFW.TextureStreaming
+import GLFW.ImageLoader
+import GLFW.TextureFile
+import GLFW.MipChain
+import GLFW.SamplerCache
+import GLFW.TextureAtlas
+import GLFW.PixelConvert
+import GLFW.WindowEvents
+import GLFW.EventLoop
+import GLFW.RenderThread
+import GLFW.UploadWorkers
+import GLFW.Timing
 
 
 open GLFW
@@ -36,15 +53,20 @@ partial def renderLoop : Int → Window → GLVertexArrayObject → GLProgramObj
     glUseProgram prog
     glDrawArrays GLDrawMode.GLTriangles 0 3
 
-    glfwSwapBuffers w
-    glfwPollEvents
-    let terminate <- glfwWindowShouldClose w
-    if (terminate || c < 0)
+    let tick <- frameTick w
+    if tick.framebufferResized then
+        glViewport 0 0 tick.framebufferWidth.toNat tick.framebufferHeight.toNat
+    if (tick.shouldClose || c < 0)
     then return ()
     else renderLoop (c-1) w vao prog
 
 def vertexData := FloatArray.mk <| Array.mk [-0.5,-0.7,0.0, 0.5,-0.7,0.0, 0.0,0.68,0.0, 1,0,0]
 
+def positionLayout : VertexLayout := {
+  attributes := #[{ attribIndex := 0, bindingIndex := 0, size := 3, relativeOffset := 0, dataType := GLDataType.GLFloat, normalized := false }],
+  bindings := #[{ bindingIndex := 0, stride := 12, divisor := 0 }]
+}
+
 def textureBytes := ByteArray.mk <| Array.mk [0,255,255,0, 0,255,0,0, 0,0,255,0, 0,255,255,0]
 
 def vertexShader := [
@@ -114,10 +136,8 @@ def startRender : Window → IO Unit :=
         match (vaos.get? 0) with
         | Option.none => return ()
         | Option.some vao => do
-            glVertexArrayAttribBinding vao 0 0
-            glVertexArrayVertexBuffer vao 0 vBuf 0 12
-            glEnableVertexArrayAttrib vao 0
-            glVertexArrayAttribFormat vao 0 3 GLDataType.GLFloat false 0
+            glApplyVertexLayout vao positionLayout
+            glBindVertexLayoutBuffers vao positionLayout #[vBuf] #[0]
 
             let textures <- glCreateTextures GLTextureTarget.GLTexture2D 2
             IO.println ("textures=" ++ toString textures)
@@ -126,6 +146,8 @@ def startRender : Window → IO Unit :=
             | Option.some tObj => do
                 glTextureStorage2D tObj 1 GLSizedTextureFormat.R8 4 4
                 glTextureSubImage2D tObj 0 0 0 4 4 GLPixelFormat.Red GLPixelType.UByte textureBytes
+                -- single level, so the default mipmapped min filter would leave it incomplete
+                glTextureParameterFilter tObj GLTextureFilter.Nearest GLTextureFilter.Nearest
                 glBindTextureUnit 0 tObj
 
                 renderLoop 100 w vao programID
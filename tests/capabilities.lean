@@ -0,0 +1,34 @@
+import GLFW
+
+open GLFW
+
+-- prints what the loader found on a context and the path each fast path takes. Running it on
+-- Mesa's software driver exercises the fallbacks, e.g.
+--   LIBGL_ALWAYS_SOFTWARE=1 EGL_PLATFORM=surfaceless ./capabilities
+
+def path (fast : Bool) (name fallback : String) : String :=
+  if fast then name else s!"{fallback} (no {name})"
+
+def main : IO Unit := do
+  glfwInitHeadless
+  let w <- glfwCreateHeadlessWindow 64 64
+  glfwMakeContextCurrent w
+  let caps <- glGetCapabilities w
+  IO.println s!"OpenGL {caps.major}.{caps.minor}"
+  IO.println s!"max texture size {caps.maxTextureSize}, 3D {caps.max3DTextureSize}, layers {caps.maxArrayTextureLayers}"
+  IO.println s!"max samples {caps.maxSamples}, color attachments {caps.maxColorAttachments}, vertex attribs {caps.maxVertexAttribs}"
+  IO.println s!"max uniform block {caps.maxUniformBlockSize} bytes, SSBO bindings {caps.maxShaderStorageBufferBindings}"
+  IO.println s!"max compute invocations {caps.maxComputeWorkGroupInvocations}, texture units {caps.maxCombinedTextureImageUnits}"
+  IO.println (path caps.bindlessTexture "bindless textures" "bound texture units")
+  IO.println (path caps.indirectParameters "indirect draw count" "fixed count indirect draws")
+  IO.println (path caps.parallelShaderCompile s!"parallel shader compile ({caps.maxShaderCompilerThreads} threads)" "serial shader compile")
+  IO.println (path caps.spirv "SPIR-V shaders" "GLSL shaders")
+  IO.println (path caps.anisotropicFiltering s!"anisotropic filtering ({caps.maxAnisotropy}x)" "trilinear filtering")
+
+  -- the flags have to agree with the extension set where no core version provides the feature
+  if caps.bindlessTexture != (← glHasExtension "GL_ARB_bindless_texture") then
+    throw <| IO.userError "bindlessTexture disagrees with the extension list"
+  if caps.parallelShaderCompile != (← glHasExtension "GL_KHR_parallel_shader_compile") then
+    throw <| IO.userError "parallelShaderCompile disagrees with the extension list"
+  glfwDestroyWindow w
+  glfwTerminate
@@ -0,0 +1,79 @@
+import GLFW
+import GLFW.OpenGL
+import GLFW.GPUCulling
+
+open GLFW
+open OpenGL
+
+-- culls a known set of bounding spheres on a headless context and checks the visible count
+-- the compute pass leaves in the draw count buffer, and the commands it compacted.
+--   LIBGL_ALWAYS_SOFTWARE=1 EGL_PLATFORM=surfaceless ./headless_gpu_culling
+
+-- with an identity view-projection the frustum is the clip cube [-1,1]^3
+def identity : FloatArray := FloatArray.mk #[1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1]
+
+-- center xyz, radius w
+def spheres : Array (Float × Float × Float × Float) := #[
+  (0.0, 0.0, 0.0, 0.1),    -- visible
+  (3.0, 0.0, 0.0, 0.1),    -- right of the frustum
+  (0.5, 0.5, 0.0, 0.1),    -- visible
+  (0.0, -3.0, 0.0, 0.5),   -- below
+  (1.05, 0.0, 0.0, 0.1),   -- outside, but the sphere reaches into it: visible
+  (0.0, 0.0, 5.0, 1.0)     -- beyond the far plane
+]
+
+def visibleInstances : Array UInt32 := #[0, 2, 4]
+
+def readUInt32 (bytes : ByteArray) (offset : Nat) : UInt32 :=
+  (bytes.get! offset).toUInt32 ||| ((bytes.get! (offset+1)).toUInt32 <<< 8) |||
+  ((bytes.get! (offset+2)).toUInt32 <<< 16) ||| ((bytes.get! (offset+3)).toUInt32 <<< 24)
+
+def cullAndCheck : IO Unit := do
+  let bounds := spheres.foldl (fun acc (x, y, z, r) => acc.push x |>.push y |>.push z |>.push r) FloatArray.empty
+  -- each template remembers its instance in firstIndex, so the compacted output can be checked
+  let templates := (List.range spheres.size).toArray.map fun ix =>
+    { count := 3, instanceCount := 0, firstIndex := ix.toUInt32, baseVertex := 0, baseInstance := 0 : DrawElementsIndirectCommand }
+
+  let buffers <- glCreateBuffers 2
+  let [boundsBuffer, templateBuffer] := buffers | throw <| IO.userError "glCreateBuffers failed"
+  glNamedBufferStorage_Floats boundsBuffer bounds []
+  glNamedBufferStorage_Bytes templateBuffer (packDrawElementsCommands templates) []
+
+  let culler <- createGPUCuller spheres.size.toUInt32
+  gpuCull culler identity boundsBuffer templateBuffer spheres.size.toUInt32
+  let (commandBuffer, countBuffer) <- gpuCullerOutputBuffers culler
+  -- the compute writes are only ordered before indirect draws, not buffer reads
+  glMemoryBarrier [MemoryBarrierFlags.BufferUpdateBarrier]
+
+  let count := readUInt32 (← glGetNamedBufferSubData countBuffer 0 4) 0
+  IO.println s!"{count} of {spheres.size} instances visible"
+  if count != visibleInstances.size.toUInt32 then
+    throw <| IO.userError s!"expected {visibleInstances.size} visible instances"
+
+  -- the survivors come out in whatever order the invocations ran
+  let commands <- glGetNamedBufferSubData commandBuffer 0 (count.toUInt64 * 20)
+  let mut found : Array UInt32 := #[]
+  for ix in [0:count.toNat] do
+    let instance := readUInt32 commands (ix * 20 + 16)
+    if readUInt32 commands (ix * 20 + 8) != instance || readUInt32 commands (ix * 20 + 4) != 1 then
+      throw <| IO.userError s!"command {ix} was not compacted from its template"
+    found := found.push instance
+  for ix in visibleInstances do
+    if !found.contains ix then
+      throw <| IO.userError s!"instance {ix} should be visible"
+
+  destroyGPUCuller culler
+  glDeleteBuffers buffers
+
+def main : IO Unit := do
+  glfwInitHeadless
+  try do
+    let w <- glfwCreateHeadlessWindow 16 16
+    try do
+      glfwMakeContextCurrent w
+      cullAndCheck
+      IO.println "headless gpu culling ok"
+    finally
+      glfwDestroyWindow w
+  finally
+    glfwTerminate
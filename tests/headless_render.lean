@@ -0,0 +1,177 @@
+import GLFW
+import GLFW.OpenGL
+import GLFW.TextureFile
+
+open GLFW
+open OpenGL
+
+-- renders into a framebuffer object with no display and checks the pixels read back.
+-- On a Linux box without a GPU run with Mesa's software driver, e.g.
+--   LIBGL_ALWAYS_SOFTWARE=1 EGL_PLATFORM=surfaceless ./headless_render
+
+def targetWidth : UInt32 := 64
+def targetHeight : UInt32 := 32
+
+-- a blue triangle over the lower left half of the target; the upper right corner keeps the
+-- clear colour
+def vertexShader := [
+"#version 330
+const vec2 positions[] = vec2[](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(-1.0, 1.0));
+void main() {
+  gl_Position = vec4(positions[gl_VertexID], 0.0, 1.0);
+}"
+]
+
+def fragmentShader := [
+"#version 330
+out vec4 fragColor;
+void main() {
+  fragColor = vec4(0.0, 0.0, 1.0, 1.0);
+}"
+]
+
+def buildShader (sType : ShaderType) (source : List String) : IO GLShaderObject := do
+  let shader <- glCreateShader sType
+  glShaderSource shader source
+  glCompileShader shader
+  pure shader
+
+-- 0.5 isn't exactly representable in 8 bits, so drivers may round either way
+def near (value expected : UInt8) : Bool :=
+  (Int.ofNat value.toNat - Int.ofNat expected.toNat).natAbs <= 1
+
+def pixelAt (pixels : ByteArray) (x y : UInt32) : UInt8 × UInt8 × UInt8 :=
+  let ix := ((y * targetWidth + x) * 4).toNat
+  (pixels.get! ix, pixels.get! (ix+1), pixels.get! (ix+2))
+
+def renderAndRead : IO Unit := do
+  let textures <- glCreateTextures GLTextureTarget.GLTexture2D 1
+  let some color := textures.get? 0 | throw <| IO.userError "glCreateTextures failed"
+  glTextureStorage2D color 1 GLSizedTextureFormat.RGBA8 targetWidth targetHeight
+  let renderbuffers <- glCreateRenderbuffers 1
+  let some depth := renderbuffers.get? 0 | throw <| IO.userError "glCreateRenderbuffers failed"
+  glNamedRenderbufferStorage depth GLSizedTextureFormat.Depth24Stencil8 targetWidth targetHeight
+
+  let fbos <- glCreateFramebuffers 1
+  let some fbo := fbos.get? 0 | throw <| IO.userError "glCreateFramebuffers failed"
+  glNamedFramebufferTexture fbo GLFramebufferAttachment.Color0 color 0
+  glNamedFramebufferRenderbuffer fbo GLFramebufferAttachment.DepthStencil depth
+  glNamedFramebufferDrawBuffers fbo #[GLDrawBuffer.Color0]
+  match (← glCheckNamedFramebufferStatus fbo GLFramebufferTarget.DrawFramebuffer) with
+  | GLFramebufferStatus.Complete => pure ()
+  | _ => throw <| IO.userError "framebuffer incomplete"
+
+  glClearNamedFramebufferColor fbo 0 1.0 0.5 0.0 1.0
+  glClearNamedFramebufferDepthStencil fbo 1.0 0
+
+  let vertex <- buildShader ShaderType.VertexShader vertexShader
+  let fragment <- buildShader ShaderType.FragmentShader fragmentShader
+  let program <- glCreateProgram
+  glAttachShader program vertex
+  glAttachShader program fragment
+  glLinkProgram program
+  let vaos <- glCreateVertexArrays 1
+  let some vao := vaos.get? 0 | throw <| IO.userError "glCreateVertexArrays failed"
+  glBindFramebuffer GLFramebufferTarget.DrawFramebuffer fbo
+  glViewport 0 0 (Int.ofNat targetWidth.toNat) (Int.ofNat targetHeight.toNat)
+  glUseProgram program
+  glBindVertexArray vao
+  glDrawArrays GLDrawMode.GLTriangles 0 3
+  glBindFramebuffer GLFramebufferTarget.DrawFramebuffer defaultFramebuffer
+
+  -- depth is never read back, so the driver may drop it
+  glInvalidateNamedFramebufferData fbo #[GLFramebufferAttachment.DepthStencil]
+
+  glBindFramebuffer GLFramebufferTarget.ReadFramebuffer fbo
+  let pixels <- glReadPixels 0 0 targetWidth targetHeight GLPixelFormat.RGBA GLPixelType.UByte
+  let image <- glGetTextureImage color 0 GLPixelFormat.RGBA GLPixelType.UByte
+  glBindFramebuffer GLFramebufferTarget.ReadFramebuffer defaultFramebuffer
+
+  if pixels.size != (targetWidth * targetHeight * 4).toNat then
+    throw <| IO.userError s!"glReadPixels returned {pixels.size} bytes"
+  let (r, g, b) := pixelAt pixels 0 0
+  IO.println s!"triangle pixel {r} {g} {b}"
+  if r != 0 || g != 0 || b != 255 then
+    throw <| IO.userError "the triangle was not drawn"
+  let (r, g, b) := pixelAt pixels (targetWidth - 1) (targetHeight - 1)
+  IO.println s!"clear pixel {r} {g} {b}"
+  if r != 255 || !near g 128 || b != 0 then
+    throw <| IO.userError "unexpected clear colour outside the triangle"
+  if image.data != pixels.data then
+    throw <| IO.userError "glGetTextureImage does not match glReadPixels"
+
+  glDeleteVertexArrays vaos
+  glDeleteProgram program
+  glDeleteShader vertex
+  glDeleteShader fragment
+  glDeleteFramebuffers fbos
+  glDeleteRenderbuffers renderbuffers
+  glDeleteTextures textures
+
+-- DDS fixtures are written out by the test itself: a 4x4 RGBA8 image and a single red BC1 block
+
+def pushU32 (bytes : ByteArray) (value : UInt32) : ByteArray :=
+  bytes.push value.toUInt8 |>.push (value >>> 8).toUInt8 |>.push (value >>> 16).toUInt8 |>.push (value >>> 24).toUInt8
+
+def ddsHeader (pixelFlags fourCC bitCount : UInt32) (masks : List UInt32) : ByteArray := Id.run do
+  let mut header := ByteArray.empty
+  for word in [0x20534444, 124, 0x1007, 4, 4, 0, 0, 1] do   -- "DDS ", size, flags, height, width, pitch, depth, levels
+    header := pushU32 header word
+  for _ in [0:11] do
+    header := pushU32 header 0
+  for word in [32, pixelFlags, fourCC, bitCount] ++ masks ++ [0x1000, 0, 0, 0, 0] do
+    header := pushU32 header word
+  header
+
+def rgbaFixture : ByteArray := Id.run do
+  let mut file := ddsHeader 0x41 0 32 [0xFF, 0xFF00, 0xFF0000, 0xFF000000]
+  for ix in [0:16] do
+    file := file.push (ix * 16).toUInt8 |>.push 0x40 |>.push 0x80 |>.push 0xFF
+  file
+
+-- color0 = pure red in RGB565, every texel index 0
+def bc1Fixture : ByteArray :=
+  let header := ddsHeader 0x4 0x31545844 0 [0, 0, 0, 0]   -- "DXT1"
+  header ++ ByteArray.mk #[0x00, 0xF8, 0, 0, 0, 0, 0, 0]
+
+def loadFixture (name : String) (contents : ByteArray) : IO LoadedTexture := do
+  let path := s!"headless_render_{name}.dds"
+  IO.FS.writeBinFile path contents
+  try loadTextureFile path finally IO.FS.removeFile path
+
+def loadTextureFiles : IO Unit := do
+  let rgba <- loadFixture "rgba8" rgbaFixture
+  let texels <- glGetTextureImage rgba.texture 0 GLPixelFormat.RGBA GLPixelType.UByte
+  if rgba.width != 4 || rgba.height != 4 || rgba.levels != 1 || texels.size != 64 || texels.get! 20 != 16 || texels.get! 21 != 0x40 then
+    throw <| IO.userError "RGBA8 DDS fixture did not load as written"
+  glDeleteTextures #[rgba.texture]
+
+  -- BC1 needs EXT_texture_compression_s3tc, which loadTextureFile checks for
+  if (← glHasExtension "GL_EXT_texture_compression_s3tc") then
+    let bc1 <- loadFixture "bc1" bc1Fixture
+    let texels <- glGetTextureImage bc1.texture 0 GLPixelFormat.RGBA GLPixelType.UByte
+    if texels.get! 0 != 255 || texels.get! 1 != 0 || texels.get! 2 != 0 then
+      throw <| IO.userError "BC1 DDS fixture did not decode to red"
+    glDeleteTextures #[bc1.texture]
+  else
+    let failed <- try
+        let _ <- loadFixture "bc1" bc1Fixture
+        pure false
+      catch _ => pure true
+    if !failed then
+      throw <| IO.userError "BC1 loaded without EXT_texture_compression_s3tc"
+  IO.println "texture file fixtures ok"
+
+def main : IO Unit := do
+  glfwInitHeadless
+  try do
+    let w <- glfwCreateHeadlessWindow targetWidth targetHeight
+    try do
+      glfwMakeContextCurrent w
+      renderAndRead
+      loadTextureFiles
+      IO.println "headless render ok"
+    finally
+      glfwDestroyWindow w
+  finally
+    glfwTerminate
@@ -0,0 +1,100 @@
+import GLFW
+import GLFW.OpenGL
+import GLFW.TextureAtlas
+
+open GLFW
+open OpenGL
+
+-- fills a small atlas on a headless context, removes and repacks, and checks that regions only
+-- move when the generation changes and that the texture still holds each image afterwards.
+--   LIBGL_ALWAYS_SOFTWARE=1 EGL_PLATFORM=surfaceless ./headless_texture_atlas
+
+def atlasSize : UInt32 := 64
+def tile : UInt32 := 32
+
+def solid (r g b : UInt8) : ByteArray := Id.run do
+  let mut bytes := ByteArray.mkEmpty (tile * tile * 4).toNat
+  for _ in [0:(tile * tile).toNat] do
+    bytes := bytes.push r |>.push g |>.push b |>.push 255
+  bytes
+
+def sameRegion (a b : AtlasRegion) : Bool :=
+  a.u0 == b.u0 && a.v0 == b.v0 && a.u1 == b.u1 && a.v1 == b.v1 && a.id == b.id && a.layer == b.layer
+
+def addTile (atlas : TextureAtlas) (pixels : ByteArray) : IO AtlasRegion := do
+  let some region <- atlasAdd atlas tile tile pixels | throw <| IO.userError "atlasAdd: a tile should fit"
+  pure region
+
+-- the red channel at the centre of a region, read back from the whole (single layer) texture
+def centreRed (texels : ByteArray) (region : AtlasRegion) : UInt8 :=
+  let size := atlasSize.toNat.toFloat
+  let x := ((region.u0 + region.u1) * 0.5 * size).toUInt32.toNat
+  let y := ((region.v0 + region.v1) * 0.5 * size).toUInt32.toNat
+  texels.get! ((y * atlasSize.toNat + x) * 4)
+
+def expectRegion (atlas : TextureAtlas) (region : AtlasRegion) (what : String) : IO Unit := do
+  if !sameRegion (← atlasRegion atlas region.id) region then
+    throw <| IO.userError s!"{what}: region moved without a generation change"
+
+def addRemoveRepack : IO Unit := do
+  let atlas <- createTextureAtlas atlasSize 1 0
+  let generation <- atlasGeneration atlas
+
+  let red <- addTile atlas (solid 200 0 0)
+  let green <- addTile atlas (solid 0 200 0)
+  let blue <- addTile atlas (solid 0 0 200)
+  expectRegion atlas red "add"
+  expectRegion atlas green "add"
+
+  atlasRemove atlas green.id
+  expectRegion atlas red "remove"
+  expectRegion atlas blue "remove"
+  let stats <- textureAtlasStats atlas
+  if stats.liveImages != 2 || stats.deadTexels != (tile * tile).toUInt64 then
+    throw <| IO.userError s!"after remove: {stats.liveImages} live images, {stats.deadTexels} dead texels"
+  if (← atlasGeneration atlas) != generation then
+    throw <| IO.userError "adds and removes should not change the generation"
+  let stale <- try
+      let _ <- atlasRegion atlas green.id
+      pure true
+    catch _ => pure false
+  if stale then
+    throw <| IO.userError "atlasRegion accepted a removed id"
+
+  if !(← atlasRepack atlas) then
+    throw <| IO.userError "atlasRepack failed with room to spare"
+  if (← atlasGeneration atlas) != generation + 1 then
+    throw <| IO.userError "atlasRepack should bump the generation"
+  let stats <- textureAtlasStats atlas
+  if stats.liveImages != 2 || stats.deadTexels != 0 || stats.repacks != 1 then
+    throw <| IO.userError s!"after repack: {stats.liveImages} live images, {stats.deadTexels} dead texels"
+
+  -- the ids survive the repack; the repacked images must have been uploaded again
+  let red <- atlasRegion atlas red.id
+  let blue <- atlasRegion atlas blue.id
+  let texels <- glGetTextureImage (atlasTexture atlas) 0 GLPixelFormat.RGBA GLPixelType.UByte
+  IO.println s!"after repack: red {centreRed texels red}, blue {centreRed texels blue}"
+  if centreRed texels red != 200 || centreRed texels blue != 0 then
+    throw <| IO.userError "repacked images are not where their regions say"
+
+  -- two free tiles left: the third add can't fit even after repacking
+  let _ <- addTile atlas (solid 0 200 0)
+  let _ <- addTile atlas (solid 200 200 0)
+  if (← atlasAdd atlas tile tile (solid 0 0 0)).isSome then
+    throw <| IO.userError "atlasAdd should fail on a full atlas"
+  expectRegion atlas red "full atlas"
+
+  destroyTextureAtlas atlas
+
+def main : IO Unit := do
+  glfwInitHeadless
+  try do
+    let w <- glfwCreateHeadlessWindow 16 16
+    try do
+      glfwMakeContextCurrent w
+      addRemoveRepack
+      IO.println "headless texture atlas ok"
+    finally
+      glfwDestroyWindow w
+  finally
+    glfwTerminate
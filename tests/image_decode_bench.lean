@@ -0,0 +1,49 @@
+import GLFW
+import GLFW.OpenGL
+import GLFW.ImageLoader
+
+open GLFW
+open OpenGL
+
+-- startup texture loading throughput: every .png/.qoi file in a directory is decoded on the
+-- pool and uploaded, once per thread count. Needs a GL 4.5 context.
+
+def imageFiles (dir : System.FilePath) : IO (Array System.FilePath) := do
+  let entries <- dir.readDir
+  return entries.filterMap fun entry =>
+    match entry.path.extension with
+    | some "png" => some entry.path
+    | some "qoi" => some entry.path
+    | _ => none
+
+partial def uploadAll (decoder : ImageDecoder) (textures : Array DecodedTexture) : IO (Array DecodedTexture) := do
+  if (← imageDecoderPending decoder) == 0
+  then return textures
+  else do
+    let done <- imageDecoderUploadCompleted decoder 64 1 true
+    uploadAll decoder (textures ++ done)
+
+def benchThreads (files : Array System.FilePath) (threads : UInt32) : IO Unit := do
+  let decoder <- createImageDecoder threads
+  let start <- IO.monoMsNow
+  for file in files do
+    let _ <- imageDecoderSubmitFile decoder file.toString
+  let textures <- uploadAll decoder #[]
+  let ms := (← IO.monoMsNow) - start
+  destroyImageDecoder decoder
+  let failed := textures.filter (·.error != "")
+  let perSec := if ms == 0 then 0 else textures.size * 1000 / ms
+  IO.println s!"{threads} threads: {textures.size} textures in {ms} ms, {perSec} textures/s, {failed.size} failed"
+  glDeleteTextures (textures.filter (·.error == "") |>.map (·.texture))
+
+def main (args : List String) : IO Unit := do
+  let dir := args.headD "textures"
+  let files <- imageFiles dir
+  IO.println s!"{files.size} images in {dir}"
+  glfwInit
+  let w <- glfwCreateWindow
+  glfwMakeContextCurrent w
+  for threads in [1, 2, 4, 8] do
+    benchThreads files threads.toUInt32
+  glfwDestroyWindow w
+  glfwTerminate
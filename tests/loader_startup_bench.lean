@@ -0,0 +1,33 @@
+import GLFW
+
+open GLFW
+
+-- context startup cost of the eager and lazy GL loaders. Each round creates a fresh hidden
+-- context, so its function table is loaded from scratch when it is made current.
+
+def loadContext (mode : GLLoaderMode) : IO Unit := do
+  glSetLoaderMode mode
+  let w <- glfwCreateWindowWithConfig { width := 64, height := 64, visible := false }
+  glfwMakeContextCurrent w
+  glfwDestroyWindow w
+
+def main : IO Unit := do
+  glfwInit
+  let rounds := 20
+  for _ in [0:rounds] do
+    loadContext GLLoaderMode.Eager
+    loadContext GLLoaderMode.Lazy
+
+  let stats <- glLoaderStats
+  let average (nanos loads : UInt64) := if loads == 0 then 0 else nanos / loads / 1000
+  IO.println s!"eager: {stats.eagerLoads} loads, {average stats.eagerNanos stats.eagerLoads} us each"
+  IO.println s!"lazy: {stats.lazyLoads} loads, {average stats.lazyNanos stats.lazyLoads} us each"
+
+  -- lazy entry points resolve as they are used
+  let w <- glfwCreateWindowWithConfig { width := 64, height := 64, visible := false }
+  glfwMakeContextCurrent w
+  glfwSwapInterval 0
+  let stats <- glLoaderStats
+  IO.println s!"{stats.extensionCount} extensions, {stats.lazyResolved} entry points resolved so far"
+  glfwDestroyWindow w
+  glfwTerminate
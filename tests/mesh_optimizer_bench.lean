@@ -0,0 +1,49 @@
+import GLFW.OpenGL
+import GLFW.MeshOptimizer
+
+open OpenGL
+
+-- throughput of optimizeIndices on large grid meshes with the triangle order scrambled.
+-- No GL context needed.
+
+-- n x n quads, two triangles each
+def gridIndices (n : Nat) : Array UInt32 := Id.run do
+  let mut indices : Array UInt32 := Array.mkEmpty (n * n * 6)
+  for y in [0:n] do
+    for x in [0:n] do
+      let a := (y * (n+1) + x).toUInt32
+      let b := a + 1
+      let c := a + (n+1).toUInt32
+      let d := c + 1
+      indices := indices.push a |>.push b |>.push c |>.push b |>.push d |>.push c
+  return indices
+
+-- Fisher-Yates over whole triangles with a fixed LCG so every run sees the same mesh
+def shuffleTriangles (indices : Array UInt32) : Array UInt32 := Id.run do
+  let mut result := indices
+  let mut seed : UInt64 := 12345
+  let triCount := indices.size / 3
+  for i' in [0:triCount - 1] do
+    let i := triCount - 1 - i'
+    seed := seed * 6364136223846793005 + 1442695040888963407
+    let j := ((seed >>> 33).toNat) % (i + 1)
+    for c in [0:3] do
+      let t := result[i*3 + c]
+      result := result.set! (i*3 + c) result[j*3 + c]
+      result := result.set! (j*3 + c) t
+  return result
+
+def benchGrid (n : Nat) : IO Unit := do
+  let indices := shuffleTriangles (gridIndices n)
+  let vertexCount := ((n+1) * (n+1)).toUInt32
+  let triangles := indices.size / 3
+  let start <- IO.monoMsNow
+  let result <- optimizeIndices indices vertexCount
+  let elapsed <- IO.monoMsNow
+  let ms := elapsed - start
+  let trisPerSec := if ms == 0 then 0 else triangles * 1000 / ms
+  IO.println s!"{triangles} triangles: {ms} ms, {trisPerSec} tris/s, ACMR {result.acmrBefore} -> {result.acmrAfter}, {result.indices.size} index bytes"
+
+def main : IO Unit := do
+  for n in [64, 256, 512, 1024] do
+    benchGrid n
@@ -0,0 +1,64 @@
+import GLFW.OpenGL
+import GLFW.PixelConvert
+
+open OpenGL
+
+-- throughput of the pixel conversions on a 2048x2048 RGBA8 image. The buffer is threaded
+-- through each conversion so it stays exclusive and is converted in place.
+-- No GL context needed.
+
+def imageSize : Nat := 2048 * 2048 * 4
+
+def testImage : ByteArray := Id.run do
+  let mut bytes := ByteArray.mkEmpty imageSize
+  for i in [0:imageSize] do
+    bytes := bytes.push (i * 31 % 251).toUInt8
+  return bytes
+
+def report (name : String) (bytes : Nat) (iterations : Nat) (ms : Nat) : IO Unit := do
+  let mbPerSec := if ms == 0 then 0 else bytes * iterations / 1000 / ms
+  IO.println s!"{name}: {iterations} x {bytes} bytes in {ms} ms, {mbPerSec} MB/s"
+
+def benchInPlace (name : String) (convert : ByteArray → ByteArray) (iterations : Nat) : IO Unit := do
+  let mut buffer := testImage
+  let start <- IO.monoMsNow
+  for _ in [0:iterations] do
+    buffer := convert buffer
+  let ms := (← IO.monoMsNow) - start
+  report name imageSize iterations ms
+  -- keeps the work from being optimized away
+  IO.println s!"  checksum byte {buffer.get! 12345}"
+
+def main : IO Unit := do
+  let iterations := 50
+  benchInPlace "swap red/blue" pixelsSwapRedBlue iterations
+  benchInPlace "premultiply alpha" pixelsPremultiplyAlpha iterations
+  benchInPlace "sRGB to linear" (pixelsSrgbToLinear · 4) iterations
+  benchInPlace "linear to sRGB" (pixelsLinearToSrgb · 4) iterations
+
+  -- the size changing conversions start from a fresh buffer each time
+  let rgba := testImage
+  let start <- IO.monoMsNow
+  let mut rgb := ByteArray.empty
+  for _ in [0:iterations] do
+    rgb := pixelsRGBAToRGB (rgba.extract 0 rgba.size)
+  report "RGBA to RGB (includes copy)" imageSize iterations ((← IO.monoMsNow) - start)
+
+  let start <- IO.monoMsNow
+  let mut expanded := ByteArray.empty
+  for _ in [0:iterations] do
+    expanded := pixelsRGBToRGBA rgb 255
+  report "RGB to RGBA" rgb.size iterations ((← IO.monoMsNow) - start)
+
+  let start <- IO.monoMsNow
+  let mut narrowed := ByteArray.empty
+  for _ in [0:iterations] do
+    narrowed := pixelsUnorm16ToUnorm8 (rgba.extract 0 rgba.size)
+  report "unorm16 to unorm8 (includes copy)" imageSize iterations ((← IO.monoMsNow) - start)
+
+  let start <- IO.monoMsNow
+  let mut halves := ByteArray.empty
+  for _ in [0:iterations] do
+    halves := pixelsFloatToHalf (rgba.extract 0 rgba.size)
+  report "float to half (includes copy)" imageSize iterations ((← IO.monoMsNow) - start)
+  IO.println s!"  sizes {expanded.size} {narrowed.size} {halves.size}"
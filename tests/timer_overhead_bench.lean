@@ -0,0 +1,38 @@
+import GLFW
+import GLFW.Timing
+
+open GLFW
+
+-- cost of timing an empty scope: glfwGetTime pairs (boxed Floats) against timingBegin/timingEnd
+-- recording into a histogram
+
+def iterations : Nat := 1000000
+
+def main : IO Unit := do
+  glfwInit
+  let freq <- glfwGetTimerFrequency
+
+  let start <- glfwGetTimerValue
+  let mut total : Float := 0
+  for _ in [0:iterations] do
+    let t0 <- glfwGetTime
+    let t1 <- glfwGetTime
+    total := total + (t1 - t0)
+  let floatTicks := (← glfwGetTimerValue) - start
+  IO.println s!"glfwGetTime pairs: {floatTicks * 1000000000 / freq / iterations.toUInt64} ns per scope (sum {total})"
+
+  let h <- createTimingHistogram
+  let start <- glfwGetTimerValue
+  for _ in [0:iterations] do
+    timingBegin h
+    timingEnd h
+  let scopeTicks := (← glfwGetTimerValue) - start
+  IO.println s!"timingBegin/timingEnd: {scopeTicks * 1000000000 / freq / iterations.toUInt64} ns per scope"
+  IO.println s!"recorded: {← timingSummary h true}"
+
+  let _ <- withTiming h (pure ())
+  let summary <- timingSummary h false
+  if summary.count != 1 then
+    throw <| IO.userError s!"withTiming recorded {summary.count} samples"
+  destroyTimingHistogram h
+  glfwTerminate
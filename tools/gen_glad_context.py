@@ -0,0 +1,354 @@
+#!/usr/bin/env python3
+#
+# Generates per-context GL dispatch tables from the glad 0.1 header, plus the 4.6 and extension
+# entry points of glad_ext.h (written by hand in the same layout).
+#
+# glad's generated loader keeps one global pointer per GL function, filled by gladLoadGLLoader,
+# so every context switch reloads everything and contexts on different threads overwrite each
+# other's pointers. This emits
+#
+#   csrc/include/glad/glad_context.h  a GladGLContext struct with one member per function and
+#                                     per version or extension flag, a thread-local current-context
+#                                     pointer, and macros routing glFoo / GLAD_GL_VERSION_x_y /
+#                                     GLAD_GL_ARB_foo through it
+#   csrc/glad_context.c               the loaders filling a GladGLContext, eagerly or with
+#                                     trampolines that resolve each entry point on first call,
+#                                     and a hashed extension set
+#
+# C files include <glad/glad_context.h> instead of <glad/glad.h>. Rerun this after regenerating
+# glad or editing glad_ext.h:
+#
+#   python3 tools/gen_glad_context.py
+#
+
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+GLAD_HEADER = os.path.join(ROOT, "csrc", "include", "glad", "glad.h")
+EXT_HEADER = os.path.join(ROOT, "csrc", "include", "glad", "glad_ext.h")
+OUT_HEADER = os.path.join(ROOT, "csrc", "include", "glad", "glad_context.h")
+OUT_SOURCE = os.path.join(ROOT, "csrc", "glad_context.c")
+
+VERSION_RE = re.compile(r"^#define GL_VERSION_(\d)_(\d) 1$")
+EXTENSION_RE = re.compile(r"^#define GL_((?:ARB|EXT|KHR)_\w+) 1$")
+TYPEDEF_RE = re.compile(r"^typedef (.+?) \(APIENTRYP (PFNGL\w+PROC)\)\((.*)\);$")
+GLAPI_RE = re.compile(r"^GLAPI (PFNGL\w+PROC) glad_gl(\w+);$")
+
+
+class Function:
+    def __init__(self, name, pfn, result, params, flag):
+        self.name = name          # without the gl prefix
+        self.pfn = pfn
+        self.result = result
+        self.params = params
+        self.flag = flag          # VERSION_x_y or extension name making it available
+
+
+def parse_header(path, versions, extensions, functions):
+    typedefs = {}
+    flag = None
+    with open(path) as header:
+        for line in header:
+            line = line.rstrip("\n")
+            m = VERSION_RE.match(line)
+            if m:
+                version = (int(m.group(1)), int(m.group(2)))
+                versions.append(version)
+                flag = version_name(version)
+                continue
+            m = EXTENSION_RE.match(line)
+            if m:
+                extensions.append(m.group(1))
+                flag = m.group(1)
+                continue
+            m = TYPEDEF_RE.match(line)
+            if m:
+                typedefs[m.group(2)] = (m.group(1), m.group(3))
+                continue
+            m = GLAPI_RE.match(line)
+            if m and flag is not None:
+                result, params = typedefs[m.group(1)]
+                functions.append(Function(m.group(2), m.group(1), result, params, flag))
+
+
+def param_names(params):
+    if params.strip() == "void":
+        return []
+    return [re.search(r"(\w+)\s*$", p).group(1) for p in params.split(",")]
+
+
+def version_name(version):
+    return "VERSION_%d_%d" % version
+
+
+def write_header(versions, extensions, functions):
+    out = []
+    out.append("// Per-context GL dispatch tables, generated from glad.h and glad_ext.h by")
+    out.append("// tools/gen_glad_context.py.")
+    out.append("// Do not edit; rerun the script instead.")
+    out.append("")
+    out.append("#ifndef __glad_context_h_")
+    out.append("#define __glad_context_h_")
+    out.append("")
+    out.append("#include <glad/glad_ext.h>")
+    out.append("")
+    out.append("#if defined(_MSC_VER)")
+    out.append("#define GLAD_THREAD_LOCAL __declspec(thread)")
+    out.append("#else")
+    out.append("#define GLAD_THREAD_LOCAL __thread")
+    out.append("#endif")
+    out.append("")
+    out.append("typedef struct GladGLContext {")
+    out.append("    int major;")
+    out.append("    int minor;")
+    out.append("    GLADloadproc load;             // kept for lazily resolved entry points")
+    out.append("    unsigned lazyResolved;         // entry points resolved by trampolines so far")
+    out.append("    unsigned extensionCount;")
+    out.append("    unsigned extensionMask;        // hash table size - 1")
+    out.append("    const char **extensionSlots;   // the driver's own strings, open addressed")
+    for v in versions:
+        out.append("    int %s;" % version_name(v))
+    for e in extensions:
+        out.append("    int %s;" % e)
+    for f in functions:
+        out.append("    %s %s;" % (f.pfn, f.name))
+    out.append("} GladGLContext;")
+    out.append("")
+    out.append("// the table of the context current on this thread, NULL if there is none")
+    out.append("extern GLAD_THREAD_LOCAL GladGLContext *gladCurrentContext;")
+    out.append("")
+    out.append("// fills the table for the context current on this thread; returns 0 if it isn't usable")
+    out.append("int gladLoadGLContext(GladGLContext *context, GLADloadproc load);")
+    out.append("")
+    out.append("// the same, but each entry point is a trampoline that resolves the real one the first time")
+    out.append("// it is called on this context")
+    out.append("int gladLoadGLContextLazy(GladGLContext *context, GLADloadproc load);")
+    out.append("")
+    out.append("// frees the extension set; the struct itself belongs to the caller")
+    out.append("void gladFreeGLContext(GladGLContext *context);")
+    out.append("")
+    out.append("int gladHasExtension(const GladGLContext *context, const char *name);")
+    out.append("")
+    for v in versions:
+        out.append("#define GLAD_GL_%s (gladCurrentContext->%s)" % (version_name(v), version_name(v)))
+    for e in extensions:
+        out.append("#define GLAD_GL_%s (gladCurrentContext->%s)" % (e, e))
+    out.append("")
+    for f in functions:
+        out.append("#undef gl%s" % f.name)
+        out.append("#define gl%s (gladCurrentContext->%s)" % (f.name, f.name))
+    out.append("")
+    out.append("#endif")
+    out.append("")
+    return "\n".join(out)
+
+
+def write_source(versions, extensions, functions):
+    out = []
+    out.append("// Per-context GL loader, generated from glad.h and glad_ext.h by")
+    out.append("// tools/gen_glad_context.py.")
+    out.append("// Do not edit; rerun the script instead.")
+    out.append("")
+    out.append("#include <glad/glad_context.h>")
+    out.append("")
+    out.append("#include <stddef.h>")
+    out.append("#include <stdlib.h>")
+    out.append("#include <string.h>")
+    out.append("")
+    out.append("GLAD_THREAD_LOCAL GladGLContext *gladCurrentContext = NULL;")
+    out.append("")
+    out.append("typedef struct {")
+    out.append("    const char *name;")
+    out.append("    unsigned short offset;")
+    out.append("    unsigned short flag;    // offset of the version or extension flag providing it")
+    out.append("} gladFunction_t;")
+    out.append("")
+    out.append("static const gladFunction_t gladFunctions[] = {")
+    for f in functions:
+        out.append('    { "gl%s", offsetof(GladGLContext, %s), offsetof(GladGLContext, %s) },' % (f.name, f.name, f.flag))
+    out.append("};")
+    out.append("")
+    out.append("// like glad, only entry points of versions and extensions the context provides: some")
+    out.append("// drivers hand out non-NULL stubs for functions they don't support")
+    out.append("static int isAvailable(const GladGLContext *context, const gladFunction_t *function)")
+    out.append("{")
+    out.append("    int flag;")
+    out.append("    memcpy(&flag, (const char *)context + function->flag, sizeof(flag));")
+    out.append("    return flag;")
+    out.append("}")
+    out.append("")
+    out.append("// reads \"4.6.0 ...\" or \"OpenGL ES 3.2 ...\"")
+    out.append("static int parseVersion(const char *version, int *major, int *minor)")
+    out.append("{")
+    out.append("    while (*version != '\\0' && (*version < '0' || *version > '9')) version++;")
+    out.append("    if (*version == '\\0') {")
+    out.append("        return 0;")
+    out.append("    }")
+    out.append("    *major = *version++ - '0';")
+    out.append("    if (*version++ != '.' || *version < '0' || *version > '9') {")
+    out.append("        return 0;")
+    out.append("    }")
+    out.append("    *minor = *version - '0';")
+    out.append("    return 1;")
+    out.append("}")
+    out.append("")
+    out.append("static unsigned hashName(const char *name)")
+    out.append("{")
+    out.append("    unsigned hash = 2166136261u;")
+    out.append("    while (*name != '\\0') {")
+    out.append("        hash = (hash ^ (unsigned char)*name++) * 16777619u;")
+    out.append("    }")
+    out.append("    return hash;")
+    out.append("}")
+    out.append("")
+    out.append("// glGetStringi's strings live as long as the context, so the set only stores pointers")
+    out.append("static void buildExtensionSet(GladGLContext *context, GLADloadproc load)")
+    out.append("{")
+    out.append("    PFNGLGETINTEGERVPROC getIntegerv = (PFNGLGETINTEGERVPROC)load(\"glGetIntegerv\");")
+    out.append("    PFNGLGETSTRINGIPROC getStringi = (PFNGLGETSTRINGIPROC)load(\"glGetStringi\");")
+    out.append("    GLint count = 0;")
+    out.append("    if (getIntegerv == NULL || getStringi == NULL) {")
+    out.append("        return;")
+    out.append("    }")
+    out.append("    getIntegerv(GL_NUM_EXTENSIONS, &count);")
+    out.append("    if (count <= 0) {")
+    out.append("        return;")
+    out.append("    }")
+    out.append("    unsigned size = 64;")
+    out.append("    while (size < (unsigned)count * 2) size <<= 1;")
+    out.append("    context->extensionSlots = calloc(size, sizeof(const char *));")
+    out.append("    if (context->extensionSlots == NULL) {")
+    out.append("        return;")
+    out.append("    }")
+    out.append("    context->extensionMask = size - 1;")
+    out.append("    for (GLint ix=0; ix < count; ix++) {")
+    out.append("        const char *name = (const char *)getStringi(GL_EXTENSIONS, (GLuint)ix);")
+    out.append("        if (name == NULL) {")
+    out.append("            continue;")
+    out.append("        }")
+    out.append("        unsigned slot = hashName(name) & context->extensionMask;")
+    out.append("        while (context->extensionSlots[slot] != NULL) {")
+    out.append("            slot = (slot + 1) & context->extensionMask;")
+    out.append("        }")
+    out.append("        context->extensionSlots[slot] = name;")
+    out.append("        context->extensionCount++;")
+    out.append("    }")
+    out.append("}")
+    out.append("")
+    out.append("int gladHasExtension(const GladGLContext *context, const char *name)")
+    out.append("{")
+    out.append("    if (context->extensionSlots == NULL) {")
+    out.append("        return 0;")
+    out.append("    }")
+    out.append("    unsigned slot = hashName(name) & context->extensionMask;")
+    out.append("    while (context->extensionSlots[slot] != NULL) {")
+    out.append("        if (strcmp(context->extensionSlots[slot], name) == 0) {")
+    out.append("            return 1;")
+    out.append("        }")
+    out.append("        slot = (slot + 1) & context->extensionMask;")
+    out.append("    }")
+    out.append("    return 0;")
+    out.append("}")
+    out.append("")
+    out.append("void gladFreeGLContext(GladGLContext *context)")
+    out.append("{")
+    out.append("    free((void *)context->extensionSlots);")
+    out.append("    context->extensionSlots = NULL;")
+    out.append("}")
+    out.append("")
+    out.append("// version, flags and extensions; the entry points are left NULL")
+    out.append("static int loadContextCommon(GladGLContext *context, GLADloadproc load)")
+    out.append("{")
+    out.append("    memset(context, 0, sizeof(*context));")
+    out.append("    context->load = load;")
+    out.append("    PFNGLGETSTRINGPROC getString = (PFNGLGETSTRINGPROC)load(\"glGetString\");")
+    out.append("    if (getString == NULL) {")
+    out.append("        return 0;")
+    out.append("    }")
+    out.append("    const char *version = (const char *)getString(GL_VERSION);")
+    out.append("    if (version == NULL || !parseVersion(version, &context->major, &context->minor)) {")
+    out.append("        return 0;")
+    out.append("    }")
+    out.append("    int loaded = context->major * 10 + context->minor;")
+    for v in versions:
+        out.append("    context->%s = loaded >= %d;" % (version_name(v), v[0] * 10 + v[1]))
+    out.append("    buildExtensionSet(context, load);")
+    for e in extensions:
+        out.append('    context->%s = gladHasExtension(context, "GL_%s");' % (e, e))
+    out.append("    return context->VERSION_1_0;")
+    out.append("}")
+    out.append("")
+    out.append("int gladLoadGLContext(GladGLContext *context, GLADloadproc load)")
+    out.append("{")
+    out.append("    if (!loadContextCommon(context, load)) {")
+    out.append("        return 0;")
+    out.append("    }")
+    out.append("    for (size_t ix=0; ix < sizeof(gladFunctions) / sizeof(gladFunctions[0]); ix++) {")
+    out.append("        if (isAvailable(context, &gladFunctions[ix])) {")
+    out.append("            void *proc = load(gladFunctions[ix].name);")
+    out.append("            memcpy((char *)context + gladFunctions[ix].offset, &proc, sizeof(proc));")
+    out.append("        }")
+    out.append("    }")
+    out.append("    return 1;")
+    out.append("}")
+    out.append("")
+    out.append("// called by a trampoline on the context current on its thread. Two threads sharing a")
+    out.append("// context may both resolve an entry point; they store the same pointer.")
+    out.append("static void resolveLazily(size_t ix)")
+    out.append("{")
+    out.append("    GladGLContext *context = gladCurrentContext;")
+    out.append("    void *proc = context->load(gladFunctions[ix].name);")
+    out.append("    memcpy((char *)context + gladFunctions[ix].offset, &proc, sizeof(proc));")
+    out.append("    context->lazyResolved++;")
+    out.append("}")
+    out.append("")
+    for ix, f in enumerate(functions):
+        names = param_names(f.params)
+        call = "gladCurrentContext->%s(%s)" % (f.name, ", ".join(names))
+        out.append("static %s APIENTRY lazy_gl%s(%s)" % (f.result, f.name, f.params))
+        out.append("{")
+        out.append("    resolveLazily(%d);" % ix)
+        if f.result == "void":
+            out.append("    %s;" % call)
+        else:
+            out.append("    return %s;" % call)
+        out.append("}")
+    out.append("")
+    out.append("static void *const gladTrampolines[] = {")
+    for f in functions:
+        out.append("    (void *)lazy_gl%s," % f.name)
+    out.append("};")
+    out.append("")
+    out.append("int gladLoadGLContextLazy(GladGLContext *context, GLADloadproc load)")
+    out.append("{")
+    out.append("    if (!loadContextCommon(context, load)) {")
+    out.append("        return 0;")
+    out.append("    }")
+    out.append("    for (size_t ix=0; ix < sizeof(gladFunctions) / sizeof(gladFunctions[0]); ix++) {")
+    out.append("        if (isAvailable(context, &gladFunctions[ix])) {")
+    out.append("            memcpy((char *)context + gladFunctions[ix].offset, &gladTrampolines[ix], sizeof(void *));")
+    out.append("        }")
+    out.append("    }")
+    out.append("    return 1;")
+    out.append("}")
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    versions, extensions, functions = [], [], []
+    parse_header(GLAD_HEADER, versions, extensions, functions)
+    if not functions:
+        sys.exit("no functions found in " + GLAD_HEADER)
+    parse_header(EXT_HEADER, versions, extensions, functions)
+    with open(OUT_HEADER, "w") as f:
+        f.write(write_header(versions, extensions, functions))
+    with open(OUT_SOURCE, "w") as f:
+        f.write(write_source(versions, extensions, functions))
+    print("%d functions, %d versions, %d extensions" % (len(functions), len(versions), len(extensions)))
+
+
+if __name__ == "__main__":
+    main()